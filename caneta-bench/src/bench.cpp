@@ -0,0 +1,55 @@
+// bench.cpp
+// JSON output for caneta-bench results
+
+#include "bench.h"
+
+namespace caneta_bench {
+
+    namespace {
+
+        void writeString(FILE* out, const std::string& s) {
+            std::fputc('"', out);
+            for (char c : s) {
+                if (c == '"' || c == '\\') {
+                    std::fputc('\\', out);
+                    std::fputc(c, out);
+                } else if (static_cast<unsigned char>(c) < 0x20) {
+                    std::fprintf(out, "\\u%04x", c);
+                } else {
+                    std::fputc(c, out);
+                }
+            }
+            std::fputc('"', out);
+        }
+
+    } // namespace
+
+    void Suite::writeJson(FILE* out, const char* revision, const char* compiler, const char* system) const {
+        std::fprintf(out, "{\n  \"suite\": \"caneta-bench\",\n  \"format\": 1,\n");
+        std::fprintf(out, "  \"revision\": ");
+        writeString(out, revision);
+        std::fprintf(out, ",\n  \"compiler\": ");
+        writeString(out, compiler);
+        std::fprintf(out, ",\n  \"system\": ");
+        writeString(out, system);
+        std::fprintf(out, ",\n  \"results\": [");
+
+        for (size_t i = 0; i < results.size(); i++) {
+            const Result& r = results[i];
+            std::fprintf(out, "%s\n    {\"path\": ", i ? "," : "");
+            writeString(out, r.path);
+            std::fprintf(out, ", \"workload\": ");
+            writeString(out, r.workload);
+            std::fprintf(out, ", \"unit\": ");
+            writeString(out, r.unit);
+            std::fprintf(out,
+                         ", \"threads\": %u, \"items\": %llu, \"bytes\": %llu, \"seconds\": %.6f"
+                         ", \"items_per_sec\": %.1f, \"bytes_per_sec\": %.1f, \"ns_per_item\": %.3f}",
+                         r.threads, (unsigned long long)r.items, (unsigned long long)r.bytes, r.seconds,
+                         r.items / r.seconds, r.bytes / r.seconds, r.seconds * 1e9 / r.items);
+        }
+
+        std::fprintf(out, "\n  ]\n}\n");
+    }
+
+} // namespace caneta_bench
@@ -0,0 +1,79 @@
+// bench.h
+// Timing harness and JSON results for caneta-bench
+
+#ifndef CANETA_BENCH_BENCH_H
+#define CANETA_BENCH_BENCH_H
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+namespace caneta_bench {
+
+    struct Result {
+        std::string path;      // Translation path, e.g. "caneta-c/decoder_feed"
+        std::string workload;  // Input workload name
+        std::string unit;      // What one item is: "report", "keycode" or "event"
+        unsigned threads;
+        uint64_t items;
+        uint64_t bytes;        // Terminal output bytes produced
+        double seconds;
+    };
+
+    class Suite {
+        public:
+            using Clock = std::chrono::steady_clock;
+
+            Suite(double min_seconds, std::string filter)
+                : min_seconds(min_seconds), filter(std::move(filter)) {}
+
+            bool enabled(const std::string& path) const {
+                return filter.empty() || path.find(filter) != std::string::npos;
+            }
+
+            // Times pass() repeatedly until min_seconds have elapsed. Each call
+            // processes items_per_pass items and returns the output bytes it
+            // produced.
+            template <typename Pass>
+            void run(const std::string& path, const std::string& workload, const char* unit,
+                     uint64_t items_per_pass, Pass pass) {
+                if (!enabled(path)) {
+                    return;
+                }
+
+                pass();  // Warm caches and branch predictors
+
+                uint64_t passes = 0;
+                uint64_t bytes = 0;
+                auto start = Clock::now();
+                std::chrono::duration<double> elapsed{0};
+                do {
+                    bytes += pass();
+                    passes++;
+                    elapsed = Clock::now() - start;
+                } while (elapsed.count() < min_seconds);
+
+                add({path, workload, unit, 1, items_per_pass * passes, bytes, elapsed.count()});
+            }
+
+            void add(const Result& result) {
+                results.push_back(result);
+                std::fprintf(stderr, "%-34s %-10s %2u  %12.1f ns/%s  %8.2f M%ss/s\n",
+                             result.path.c_str(), result.workload.c_str(), result.threads,
+                             result.seconds * 1e9 / result.items, result.unit.c_str(),
+                             result.items / result.seconds / 1e6, result.unit.c_str());
+            }
+
+            void writeJson(FILE* out, const char* revision, const char* compiler, const char* system) const;
+
+        private:
+            double min_seconds;
+            std::string filter;
+            std::vector<Result> results;
+    };
+
+} // namespace caneta_bench
+
+#endif // CANETA_BENCH_BENCH_H
@@ -0,0 +1,137 @@
+// frontends.cpp
+// The firmware report paths on the host, for benchmarking
+
+#include "frontends.h"
+#include "hid_reports.h"
+
+#include <cstring>
+
+namespace caneta_bench {
+
+    void OutputCounter::write(const uint8_t* data, size_t len) {
+        for (size_t i = 0; i < len; i++) {
+            putc(data[i]);
+        }
+    }
+
+    void OutputCounter::putc(uint8_t c) {
+        tail[bytes % sizeof(tail)] = c;
+        bytes++;
+    }
+
+    Rp2040Pipeline::Rp2040Pipeline(OutputCounter& uart) : uart(&uart), sink{terminalWrite, this} {
+        caneta_ring_init(&ring);
+        caneta_host_init(&host, nullptr);
+        caneta_tx_init(&tx);
+
+        // tuh_hid_mount_cb hands core 1 the keyboard's descriptor
+        caneta_host_post_mount(&ring, kDevAddr, 0, kBootDescriptor, kBootDescriptorSize);
+        caneta_host_drain(&host, &ring, 0, &sink);
+    }
+
+    // Core 1's terminal_send_waiting: queue each write whole, waiting for the
+    // DMA to make room
+    void Rp2040Pipeline::terminalWrite(void* ctx, const uint8_t* data, size_t len) {
+        Rp2040Pipeline* self = static_cast<Rp2040Pipeline*>(ctx);
+        while (len > 0) {
+            size_t part = len < CANETA_TX_SIZE ? len : CANETA_TX_SIZE;
+            if (caneta_tx_try_write(&self->tx, data, part)) {
+                data += part;
+                len -= part;
+            } else {
+                self->drainUart();
+            }
+        }
+    }
+
+    // The DMA transfers whatever is queued, one contiguous run at a time
+    void Rp2040Pipeline::drainUart() {
+        const uint8_t* data;
+        size_t len;
+        while ((len = caneta_tx_peek(&tx, &data)) > 0) {
+            uart->write(data, len);
+            caneta_tx_consume(&tx, len);
+        }
+    }
+
+    void Rp2040Pipeline::processReport(const uint8_t* report, uint16_t len) {
+        caneta_host_post_report(&ring, kDevAddr, 0, report, len);
+
+        uint32_t deadline_ms;
+        caneta_host_drain(&host, &ring, 0, &sink);
+        caneta_host_run_repeats(&host, 0, &sink, &deadline_ms);
+        drainUart();
+    }
+
+    Esp32Pipeline::Esp32Pipeline(OutputCounter& serial) : reports(OutputSink{this}) {
+        // The example sketch writes each batch of output to Serial1 in one write
+        output_callback = [&serial](const uint8_t* data, size_t len) {
+            serial.write(data, len);
+        };
+
+        // The first notification queues the keyboard's report map
+        reports.postMount(0, kBootDescriptor, kBootDescriptorSize);
+    }
+
+    void Esp32Pipeline::processReport(const uint8_t* report, size_t len) {
+        // A boot layout has no report IDs
+        reports.postReport(0, 0, report, len);
+        reports.drain();
+    }
+
+    LegacyEsp32Processor::LegacyEsp32Processor(OutputCounter& serial) {
+        std::memset(&kbd_state, 0, sizeof(kbd_state));
+
+        // The example sketch writes each character and sequence to Serial1
+        key_event_callback = [&serial](char ascii_char) {
+            serial.putc(static_cast<uint8_t>(ascii_char));
+        };
+        escape_sequence_callback = [&serial](const char* sequence) {
+            serial.putc('\x1B');
+            serial.write(reinterpret_cast<const uint8_t*>(sequence), std::strlen(sequence));
+        };
+    }
+
+    void LegacyEsp32Processor::processReport(const uint8_t* report, size_t len) {
+        if (len < CANETA_REPORT_SIZE) return;
+
+        uint8_t modifiers = report[0];
+        bool shift = (modifiers & CANETA_MODIFIER_SHIFT) != 0;
+        bool ctrl = (modifiers & CANETA_MODIFIER_CTRL) != 0;
+        bool alt = (modifiers & CANETA_MODIFIER_ALT) != 0;
+
+        uint8_t pressed = caneta_kbd_diff(&kbd_state, report).pressed;
+        for (int slot = 0; slot < 6; slot++) {
+            if (pressed & (1 << slot)) {
+                processKeycode(report[2 + slot], shift, ctrl, alt);
+            }
+        }
+
+        std::memcpy(&kbd_state, report, CANETA_REPORT_SIZE);
+    }
+
+    void LegacyEsp32Processor::processKeycode(uint8_t keycode, bool shift, bool ctrl, bool alt) {
+        (void)alt;
+
+        const char* special_seq = process_special_keys(keycode);
+        if (std::strlen(special_seq) > 0) {
+            if (escape_sequence_callback) {
+                escape_sequence_callback(special_seq);
+            }
+            return;
+        }
+
+        char ascii_char = hid_to_ascii(keycode, shift);
+        if (ascii_char != 0) {
+            if (ctrl && ascii_char >= 'a' && ascii_char <= 'z') {
+                ascii_char = ascii_char - 'a' + 1;
+            } else if (ctrl && ascii_char >= 'A' && ascii_char <= 'Z') {
+                ascii_char = ascii_char - 'A' + 1;
+            }
+            if (key_event_callback) {
+                key_event_callback(ascii_char);
+            }
+        }
+    }
+
+} // namespace caneta_bench
@@ -0,0 +1,102 @@
+// frontends.h
+// The firmware report paths on the host, for benchmarking. Both are built
+// from the library modules the firmware links, so what is timed is what
+// ships; only the hardware at either end (radio, USB host, UART) is replaced.
+// The pre-engine ESP32 processor stays as a frozen baseline.
+
+#ifndef CANETA_BENCH_FRONTENDS_H
+#define CANETA_BENCH_FRONTENDS_H
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+
+#include <caneta.h>
+#include <caneta.hpp>
+#include <caneta_host.h>
+#include <caneta_ring.h>
+#include <caneta_tx.h>
+
+namespace caneta_bench {
+
+    // Stand-in for the UART: counts bytes and keeps the last few so the
+    // writes can't be optimised away
+    struct OutputCounter {
+        uint64_t bytes = 0;
+        uint8_t tail[64] = {};
+
+        void write(const uint8_t* data, size_t len);
+        void putc(uint8_t c);
+    };
+
+    // caneta-rp2040 with one boot keyboard: the USB callback posts each
+    // report into the caneta_host ring, core 1 drains it and runs repeats,
+    // its output is queued in the caneta_tx ring, and the UART DMA empties
+    // that. The two cores take turns on the calling thread, once per report.
+    class Rp2040Pipeline {
+        public:
+            explicit Rp2040Pipeline(OutputCounter& uart);
+            void processReport(const uint8_t* report, uint16_t len);
+
+        private:
+            static constexpr uint8_t kDevAddr = 1;
+
+            OutputCounter* uart;
+            caneta_ring_t ring;
+            caneta_host_t host;
+            caneta_tx_t tx;
+            caneta_sink_t sink;
+
+            static void terminalWrite(void* ctx, const uint8_t* data, size_t len);
+            void drainUart();
+    };
+
+    // CanetaBluetooth with one boot keyboard connected: the notify callback
+    // posts each report into its caneta::ReportQueue, the report task drains
+    // it, and the batched output goes to the std::function the sketch
+    // installs. The report task runs once per report.
+    class Esp32Pipeline {
+        public:
+            using OutputCallback = std::function<void(const uint8_t* data, size_t len)>;
+
+            explicit Esp32Pipeline(OutputCounter& serial);
+            void processReport(const uint8_t* report, size_t len);
+
+        private:
+            // CanetaBluetooth's default number of keyboard slots
+            static constexpr size_t kKeyboards = 3;
+
+            struct OutputSink {
+                Esp32Pipeline* owner;
+                void write(const uint8_t* data, size_t len) {
+                    if (owner->output_callback) {
+                        owner->output_callback(data, len);
+                    }
+                }
+            };
+
+            caneta::ReportQueue<OutputSink, kKeyboards> reports;
+            OutputCallback output_callback;
+    };
+
+    // CanetaBluetooth before the streaming engine: per-key translation with a
+    // std::function call per character or escape sequence. Kept as a baseline.
+    class LegacyEsp32Processor {
+        public:
+            using KeyEventCallback = std::function<void(char ascii_char)>;
+            using EscapeSequenceCallback = std::function<void(const char* sequence)>;
+
+            explicit LegacyEsp32Processor(OutputCounter& serial);
+            void processReport(const uint8_t* report, size_t len);
+
+        private:
+            kbd_state_t kbd_state;
+            KeyEventCallback key_event_callback;
+            EscapeSequenceCallback escape_sequence_callback;
+
+            void processKeycode(uint8_t keycode, bool shift, bool ctrl, bool alt);
+    };
+
+} // namespace caneta_bench
+
+#endif // CANETA_BENCH_FRONTENDS_H
@@ -0,0 +1,96 @@
+// hid_reports.cpp
+// Report-protocol versions of the workloads
+
+#include "hid_reports.h"
+
+#include <caneta.h>
+
+namespace caneta_bench {
+
+    const uint8_t kBootDescriptor[] = {
+        0x05, 0x01,        // Usage Page (Generic Desktop)
+        0x09, 0x06,        // Usage (Keyboard)
+        0xA1, 0x01,        // Collection (Application)
+        0x05, 0x07,        //   Usage Page (Keyboard)
+        0x19, 0xE0,        //   Usage Minimum (Left Control)
+        0x29, 0xE7,        //   Usage Maximum (Right GUI)
+        0x15, 0x00,        //   Logical Minimum (0)
+        0x25, 0x01,        //   Logical Maximum (1)
+        0x75, 0x01,        //   Report Size (1)
+        0x95, 0x08,        //   Report Count (8)
+        0x81, 0x02,        //   Input (Data, Variable, Absolute): modifiers
+        0x95, 0x01,        //   Report Count (1)
+        0x75, 0x08,        //   Report Size (8)
+        0x81, 0x01,        //   Input (Constant): reserved
+        0x95, 0x05,        //   Report Count (5)
+        0x75, 0x01,        //   Report Size (1)
+        0x05, 0x08,        //   Usage Page (LEDs)
+        0x19, 0x01,        //   Usage Minimum (Num Lock)
+        0x29, 0x05,        //   Usage Maximum (Kana)
+        0x91, 0x02,        //   Output (Data, Variable, Absolute): LEDs
+        0x95, 0x01,        //   Report Count (1)
+        0x75, 0x03,        //   Report Size (3)
+        0x91, 0x01,        //   Output (Constant): padding
+        0x95, 0x06,        //   Report Count (6)
+        0x75, 0x08,        //   Report Size (8)
+        0x15, 0x00,        //   Logical Minimum (0)
+        0x25, 0x65,        //   Logical Maximum (101)
+        0x05, 0x07,        //   Usage Page (Keyboard)
+        0x19, 0x00,        //   Usage Minimum (0)
+        0x29, 0x65,        //   Usage Maximum (101)
+        0x81, 0x00,        //   Input (Data, Array): keys
+        0xC0,              // End Collection
+    };
+    const size_t kBootDescriptorSize = sizeof(kBootDescriptor);
+
+    const uint8_t kNkroDescriptor[] = {
+        0x05, 0x01,        // Usage Page (Generic Desktop)
+        0x09, 0x06,        // Usage (Keyboard)
+        0xA1, 0x01,        // Collection (Application)
+        0x85, 0x01,        //   Report ID (1)
+        0x05, 0x07,        //   Usage Page (Keyboard)
+        0x19, 0xE0,        //   Usage Minimum (Left Control)
+        0x29, 0xE7,        //   Usage Maximum (Right GUI)
+        0x15, 0x00,        //   Logical Minimum (0)
+        0x25, 0x01,        //   Logical Maximum (1)
+        0x75, 0x01,        //   Report Size (1)
+        0x95, 0x08,        //   Report Count (8)
+        0x81, 0x02,        //   Input (Data, Variable, Absolute): modifiers
+        0x19, 0x00,        //   Usage Minimum (0)
+        0x29, 0x77,        //   Usage Maximum (119)
+        0x95, 0x78,        //   Report Count (120)
+        0x81, 0x02,        //   Input (Data, Variable, Absolute): key bitmap
+        0xC0,              // End Collection
+        0x05, 0x0C,        // Usage Page (Consumer)
+        0x09, 0x01,        // Usage (Consumer Control)
+        0xA1, 0x01,        // Collection (Application)
+        0x85, 0x02,        //   Report ID (2)
+        0x15, 0x00,        //   Logical Minimum (0)
+        0x26, 0xFF, 0x03,  //   Logical Maximum (1023)
+        0x19, 0x00,        //   Usage Minimum (0)
+        0x2A, 0xFF, 0x03,  //   Usage Maximum (1023)
+        0x75, 0x10,        //   Report Size (16)
+        0x95, 0x01,        //   Report Count (1)
+        0x81, 0x00,        //   Input (Data, Array)
+        0xC0,              // End Collection
+    };
+    const size_t kNkroDescriptorSize = sizeof(kNkroDescriptor);
+
+    std::vector<uint8_t> makeNkroReports(const Workload& workload) {
+        std::vector<uint8_t> reports(workload.report_count() * kNkroReportSize, 0);
+        for (size_t i = 0; i < workload.report_count(); i++) {
+            const uint8_t* boot = workload.report(i);
+            uint8_t* nkro = &reports[i * kNkroReportSize];
+            nkro[0] = 1;
+            nkro[1] = boot[0];
+            for (int slot = 2; slot < CANETA_REPORT_SIZE; slot++) {
+                uint8_t keycode = boot[slot];
+                if (keycode != 0 && keycode < 0x78) {
+                    nkro[2 + keycode / 8] |= static_cast<uint8_t>(1 << (keycode % 8));
+                }
+            }
+        }
+        return reports;
+    }
+
+} // namespace caneta_bench
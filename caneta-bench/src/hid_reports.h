@@ -0,0 +1,32 @@
+// hid_reports.h
+// Report-protocol versions of the workloads, for the descriptor-driven decoder
+
+#ifndef CANETA_BENCH_HID_REPORTS_H
+#define CANETA_BENCH_HID_REPORTS_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "workload.h"
+
+namespace caneta_bench {
+
+    // Report descriptor of a standard boot keyboard
+    extern const uint8_t kBootDescriptor[];
+    extern const size_t kBootDescriptorSize;
+
+    // Report descriptor of an NKRO keyboard: report ID 1 with a modifier
+    // bitmap and a 120-bit key bitmap, plus a consumer control report
+    extern const uint8_t kNkroDescriptor[];
+    extern const size_t kNkroDescriptorSize;
+
+    // Report ID byte, modifier byte and 15 bitmap bytes
+    constexpr size_t kNkroReportSize = 17;
+
+    // The workload's boot reports rewritten as NKRO bitmap reports
+    std::vector<uint8_t> makeNkroReports(const Workload& workload);
+
+} // namespace caneta_bench
+
+#endif // CANETA_BENCH_HID_REPORTS_H
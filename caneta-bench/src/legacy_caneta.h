@@ -0,0 +1,27 @@
+// legacy_caneta.h
+// Switch-based reference implementation of the caneta-c translation functions
+
+#ifndef LEGACY_CANETA_H
+#define LEGACY_CANETA_H
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#include <stdint.h>
+#include <stdbool.h>
+
+char legacy_hid_to_ascii(uint8_t keycode, bool shift);
+const char* legacy_process_special_keys(uint8_t keycode);
+
+// The 6x6 "was this key already pressed" loop the front-ends used, extended
+// to report releases the same way
+void legacy_kbd_diff(const uint8_t* last_keys, const uint8_t* report,
+                     uint8_t* pressed, uint8_t* released);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // LEGACY_CANETA_H
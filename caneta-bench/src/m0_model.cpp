@@ -0,0 +1,195 @@
+// m0_model.cpp
+// Cortex-M0+ cost model of the key diff
+//
+// Instruction costs are the Cortex-M0+ TRM's: data processing 1 cycle, MULS
+// 1 (the RP2040 has the single-cycle multiplier), loads and stores 2, a taken
+// branch 2 and an untaken one 1, BL 3, PUSH/POP 1 + registers and POP with
+// PC 3 + registers. The libgcc helpers are priced by their ARMv6-M code,
+// call and return included. Register spills are not charged; the word diff
+// keeps more live values than the M0+'s eight low registers hold, so the
+// model flatters it.
+
+#include "m0_model.h"
+
+namespace caneta_bench {
+
+    namespace {
+
+        // libgcc on ARMv6-M: __aeabi_lmul builds the low 64 bits of a 64x64
+        // product from 16-bit partial products; __aeabi_llsr branches on a
+        // shift of 32 or more; __ctzsi2 isolates the low bit and counts
+        // through a table
+        constexpr M0Cost kLmul = {34, 28};
+        constexpr M0Cost kLlsr = {15, 10};
+        constexpr M0Cost kCtz = {20, 14};
+
+        // BL, PUSH {r4-r7, lr}, POP {r4-r7, pc}
+        constexpr M0Cost kCall = {17, 3};
+
+        class Charge {
+            public:
+                explicit Charge(M0Cost& cost) : cost(cost) {}
+
+                void alu(unsigned n) { add(n, n); }
+                void load(unsigned n) { add(2 * n, n); }
+                void store(unsigned n) { add(2 * n, n); }
+                void branch(bool taken) { add(taken ? 2 : 1, 1); }
+                void call(const M0Cost& helper) { add(helper.cycles, helper.instructions); }
+
+            private:
+                M0Cost& cost;
+
+                void add(uint64_t cycles, uint64_t instructions) {
+                    cost.cycles += cycles;
+                    cost.instructions += instructions;
+                }
+        };
+
+        constexpr uint64_t kLanes01 = 0x0101010101010101ULL;
+        constexpr uint64_t kLanes7F = 0x7F7F7F7F7F7F7F7FULL;
+
+        // Six LDRB, and three LSLS/ORRS pairs into the low word and one into the high
+        uint64_t loadKeys(const uint8_t* keys, Charge& charge) {
+            charge.load(6);
+            charge.alu(8);
+            return (uint64_t)keys[0] | (uint64_t)keys[1] << 8 | (uint64_t)keys[2] << 16 |
+                   (uint64_t)keys[3] << 24 | (uint64_t)keys[4] << 32 | (uint64_t)keys[5] << 40;
+        }
+
+        // AND, ADDS/ADCS, two ORRs and MVN, each on both halves
+        uint64_t zeroLanes(uint64_t x, Charge& charge) {
+            charge.alu(10);
+            return ~(((x & kLanes7F) + kLanes7F) | x | kLanes7F);
+        }
+
+        // A 64-bit shift by 7 (four instructions without a barrel shifter), the
+        // AND, the multiplier's literal pair, the multiply, and the top byte
+        uint8_t laneBits(uint64_t x, Charge& charge) {
+            charge.alu(6);
+            charge.load(2);
+            charge.call(kLmul);
+            charge.alu(2);
+            return (uint8_t)((((x >> 7) & kLanes01) * 0x0102040810204080ULL) >> 56);
+        }
+
+        unsigned lowestSlot(unsigned mask, Charge& charge) {
+            charge.call(kCtz);
+            unsigned slot = 0;
+            while (!(mask & 1u)) {
+                mask >>= 1;
+                slot++;
+            }
+            return slot;
+        }
+
+        // Every lane of other compared against the keycode in slot of word
+        uint64_t matchSlot(uint64_t word, unsigned slot, uint64_t other, Charge& charge) {
+            charge.alu(1);             // slot * 8
+            charge.call(kLlsr);
+            charge.alu(2);             // UXTB, clear the high half
+            charge.call(kLmul);        // Broadcast
+            charge.alu(2);             // EOR both halves
+            return zeroLanes(other ^ (((word >> (8 * slot)) & 0xFF) * kLanes01), charge);
+        }
+
+    } // namespace
+
+    caneta_key_diff_t m0LegacyDiff(const kbd_state_t& state, const uint8_t* report, M0Cost& cost) {
+        Charge charge(cost);
+        charge.call(kCall);
+        charge.store(2);  // Zero both masks
+        uint8_t pressed = 0;
+        uint8_t released = 0;
+
+        // One pass looks up each report key in the state, the other each
+        // state key in the report; the inner loop stops at the first match
+        auto pass = [&](const uint8_t* keys, const uint8_t* others, uint8_t& mask) {
+            for (int i = 0; i < 6; i++) {
+                uint8_t keycode = keys[i];
+                charge.load(1);
+                charge.alu(1);
+                charge.branch(keycode == 0);
+                if (keycode != 0) {
+                    bool found = false;
+                    for (int j = 0; j < 6 && !found; j++) {
+                        charge.load(1);
+                        charge.alu(1);
+                        found = others[j] == keycode;
+                        charge.branch(found);
+                        if (!found) {
+                            charge.alu(2);  // ADDS, CMP
+                            charge.branch(j < 5);
+                        }
+                    }
+                    charge.branch(found);
+                    if (!found) {
+                        charge.alu(3);  // MOVS, LSLS, ORRS
+                        mask |= (uint8_t)(1 << i);
+                    }
+                }
+                charge.alu(2);
+                charge.branch(i < 5);
+            }
+        };
+        pass(report + 2, state.last_keys, pressed);
+        pass(state.last_keys, report + 2, released);
+
+        charge.store(2);
+        return {pressed, released};
+    }
+
+    caneta_key_diff_t m0WordDiff(const kbd_state_t& state, const uint8_t* report, M0Cost& cost) {
+        Charge charge(cost);
+        charge.call(kCall);
+        uint64_t prev = loadKeys(state.last_keys, charge);
+        uint64_t next = loadKeys(report + 2, charge);
+
+        // EORS, EORS, ORRS and the branch out
+        charge.alu(3);
+        charge.branch(prev == next);
+        if (prev == next) {
+            charge.alu(1);
+            return {0, 0};
+        }
+
+        // The lane constants' literals (each has equal halves)
+        charge.load(2);
+        charge.alu(2 + 2);  // The two MVNs, both halves
+        uint8_t next_used = laneBits(~zeroLanes(next, charge), charge) & 0x3F;
+        uint8_t prev_used = laneBits(~zeroLanes(prev, charge), charge) & 0x3F;
+        charge.alu(4);      // MOVS and ANDS for each mask
+
+        charge.alu(1);
+        charge.branch(prev == 0);
+        if (prev != 0) {
+            charge.alu(1);
+            charge.branch(next == 0);
+        }
+        if (prev == 0 || next == 0) {
+            charge.alu(2);
+            return {next_used, prev_used};
+        }
+
+        auto seen = [&](unsigned held, uint64_t word, uint64_t other) {
+            uint64_t matched = 0;
+            for (; held; held &= held - 1) {
+                charge.alu(1);
+                charge.branch(false);
+                matched |= matchSlot(word, lowestSlot(held, charge), other, charge);
+                charge.alu(2 + 2);  // ORR both halves; SUBS, ANDS
+                charge.branch(true);
+            }
+            charge.alu(1);
+            charge.branch(true);
+            return matched;
+        };
+        uint64_t next_seen = seen(prev_used, prev, next);
+        uint64_t prev_seen = seen(next_used, next, prev);
+
+        uint8_t pressed = next_used & ~laneBits(next_seen, charge);
+        uint8_t released = prev_used & ~laneBits(prev_seen, charge);
+        charge.alu(4 + 2);  // MVNS and ANDS for each mask; combine
+        return {pressed, released};
+    }
+
+} // namespace caneta_bench
@@ -0,0 +1,37 @@
+// m0_model.h
+// Cortex-M0+ cost model of the key diff
+//
+// The bench host has no Cortex-M0+ toolchain, so the two key diffs are
+// restated here step by step, each step charged what ARMv6-M code for it
+// costs on an RP2040. The M0+ has no barrel shifter in its ALU operations,
+// no unaligned or 64-bit loads, no CLZ and no 32x32->64 multiply, so 64-bit
+// words live in register pairs and the wide operations are libgcc calls.
+// verifyKeyDiff checks that both restatements compute the same masks as the
+// real functions, so the model can't drift from the code it prices.
+
+#ifndef CANETA_BENCH_M0_MODEL_H
+#define CANETA_BENCH_M0_MODEL_H
+
+#include <cstdint>
+
+#include <caneta.h>
+
+namespace caneta_bench {
+
+    // RP2040's default system clock, for turning cycles into time
+    constexpr double kM0ClockHz = 125e6;
+
+    struct M0Cost {
+        uint64_t cycles = 0;
+        uint64_t instructions = 0;
+    };
+
+    // legacy_kbd_diff's nested loops, with their modelled cost added to cost
+    caneta_key_diff_t m0LegacyDiff(const kbd_state_t& state, const uint8_t* report, M0Cost& cost);
+
+    // caneta_kbd_diff's word-parallel comparison, with its modelled cost added to cost
+    caneta_key_diff_t m0WordDiff(const kbd_state_t& state, const uint8_t* report, M0Cost& cost);
+
+} // namespace caneta_bench
+
+#endif // CANETA_BENCH_M0_MODEL_H
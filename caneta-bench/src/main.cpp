@@ -0,0 +1,502 @@
+// main.cpp
+// caneta-bench: throughput benchmarks for the caneta translation paths
+//
+// Usage: caneta-bench [--quick] [--min-time SECONDS] [--reports N]
+//                     [--filter SUBSTRING] [--no-verify] [--output FILE]
+//
+// Progress goes to stderr; the results are written as JSON to stdout (or
+// FILE) so runs on different revisions can be compared.
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <caneta.h>
+#include <caneta.hpp>
+#include <caneta_hid.h>
+#include "bench.h"
+#include "frontends.h"
+#include "hid_reports.h"
+#include "legacy_caneta.h"
+#include "m0_model.h"
+#include "verify.h"
+#include "workload.h"
+
+#ifdef CANETA_BENCH_SDL
+#include "sdl_path.h"
+#endif
+
+#ifndef CANETA_BENCH_REVISION
+#define CANETA_BENCH_REVISION "unknown"
+#endif
+
+#ifndef CANETA_BENCH_SYSTEM
+#define CANETA_BENCH_SYSTEM "unknown"
+#endif
+
+using namespace caneta_bench;
+
+namespace {
+
+    using Clock = std::chrono::steady_clock;
+
+    struct Options {
+        double min_seconds = 0.5;
+        size_t reports = 200000;
+        std::string filter;
+        bool verify = true;
+        const char* output = nullptr;
+    };
+
+    void usage(const char* argv0) {
+        std::fprintf(stderr,
+                     "Usage: %s [--quick] [--min-time SECONDS] [--reports N]\n"
+                     "          [--filter SUBSTRING] [--no-verify] [--output FILE]\n",
+                     argv0);
+    }
+
+    bool parseOptions(int argc, char* argv[], Options& options) {
+        for (int i = 1; i < argc; i++) {
+            const char* arg = argv[i];
+            const char* value = i + 1 < argc ? argv[i + 1] : nullptr;
+            if (std::strcmp(arg, "--quick") == 0) {
+                options.min_seconds = 0.05;
+                options.reports = 20000;
+            } else if (std::strcmp(arg, "--min-time") == 0 && value) {
+                options.min_seconds = std::atof(value);
+                i++;
+            } else if (std::strcmp(arg, "--reports") == 0 && value) {
+                options.reports = std::strtoull(value, nullptr, 10);
+                i++;
+            } else if (std::strcmp(arg, "--filter") == 0 && value) {
+                options.filter = value;
+                i++;
+            } else if (std::strcmp(arg, "--no-verify") == 0) {
+                options.verify = false;
+            } else if (std::strcmp(arg, "--output") == 0 && value) {
+                options.output = value;
+                i++;
+            } else {
+                return false;
+            }
+        }
+        return options.min_seconds > 0 && options.reports > 0;
+    }
+
+    std::string compilerName() {
+#if defined(__clang__)
+        return std::string("clang ") + __clang_version__;
+#elif defined(__GNUC__)
+        return std::string("gcc ") + __VERSION__;
+#elif defined(_MSC_VER)
+        return "msvc " + std::to_string(_MSC_VER);
+#else
+        return "unknown";
+#endif
+    }
+
+    // Keycodes drawn from the keyboard page range the translators know about,
+    // plus a share of unmapped codes so the "no translation" path is exercised.
+    std::vector<uint8_t> makeKeycodes(size_t count) {
+        std::mt19937 rng(0xCA9E7A);
+        std::uniform_int_distribution<int> dist(0x00, 0x65);
+        std::vector<uint8_t> keycodes(count);
+        for (auto& k : keycodes) {
+            k = static_cast<uint8_t>(dist(rng));
+        }
+        return keycodes;
+    }
+
+    // Single keycode lookups, legacy switches against the tables
+    void runKeycodeBenchmarks(Suite& suite, const std::vector<uint8_t>& keycodes) {
+        auto lookup = [&](const char* path, auto translate) {
+            suite.run(path, "uniform", "keycode", keycodes.size(), [&]() {
+                uint32_t checksum = 0;
+                for (uint8_t keycode : keycodes) {
+                    checksum += translate(keycode);
+                }
+                // Keep the work observable so the loop is not optimised away
+                volatile uint32_t sink = checksum;
+                (void)sink;
+                return uint64_t{0};
+            });
+        };
+
+        lookup("legacy/hid_to_ascii", [](uint8_t k) {
+            return static_cast<uint32_t>(legacy_hid_to_ascii(k, k & 1));
+        });
+        lookup("caneta-c/hid_to_ascii", [](uint8_t k) {
+            return static_cast<uint32_t>(hid_to_ascii(k, k & 1));
+        });
+        lookup("legacy/process_special_keys", [](uint8_t k) {
+            return static_cast<uint32_t>(static_cast<unsigned char>(*legacy_process_special_keys(k)));
+        });
+        lookup("caneta-c/process_special_keys", [](uint8_t k) {
+            return static_cast<uint32_t>(static_cast<unsigned char>(*process_special_keys(k)));
+        });
+    }
+
+    // New-key detection alone, legacy nested loop against the word diff
+    void runDiffBenchmarks(Suite& suite, const Workload& workload) {
+        const size_t count = workload.report_count();
+        auto diff = [&](const char* path, auto diff_one) {
+            suite.run(path, workload.name, "report", count, [&]() {
+                kbd_state_t state = {};
+                uint32_t checksum = 0;
+                for (size_t i = 0; i < count; i++) {
+                    const uint8_t* report = workload.report(i);
+                    checksum += diff_one(state, report);
+                    std::memcpy(&state, report, CANETA_REPORT_SIZE);
+                }
+                volatile uint32_t sink = checksum;
+                (void)sink;
+                return uint64_t{0};
+            });
+        };
+
+        diff("legacy/kbd_diff", [](const kbd_state_t& state, const uint8_t* report) {
+            uint8_t pressed, released;
+            legacy_kbd_diff(state.last_keys, report, &pressed, &released);
+            return static_cast<uint32_t>(pressed | released << 8);
+        });
+        diff("caneta-c/kbd_diff", [](const kbd_state_t& state, const uint8_t* report) {
+            caneta_key_diff_t d = caneta_kbd_diff(&state, report);
+            return static_cast<uint32_t>(d.pressed | d.released << 8);
+        });
+
+        // The same streams priced by the Cortex-M0+ model, as time at the
+        // RP2040's clock
+        auto model = [&](const char* path, auto diff_one) {
+            if (!suite.enabled(path)) {
+                return;
+            }
+            M0Cost cost;
+            kbd_state_t state = {};
+            for (size_t i = 0; i < count; i++) {
+                const uint8_t* report = workload.report(i);
+                diff_one(state, report, cost);
+                std::memcpy(&state, report, CANETA_REPORT_SIZE);
+            }
+            suite.add({path, workload.name, "report", 1, count, 0, cost.cycles / kM0ClockHz});
+            std::fprintf(stderr, "%-34s %-10s     %8.1f cycles, %.1f instructions per report\n", path,
+                         workload.name.c_str(), static_cast<double>(cost.cycles) / count,
+                         static_cast<double>(cost.instructions) / count);
+        };
+        model("m0-model/legacy_kbd_diff", m0LegacyDiff);
+        model("m0-model/kbd_diff", m0WordDiff);
+    }
+
+    // Full report-to-terminal-bytes paths
+    void runReportBenchmarks(Suite& suite, const Workload& workload) {
+        const size_t count = workload.report_count();
+
+        caneta_decoder_t decoder;
+        caneta_decoder_init(&decoder);
+        suite.run("caneta-c/decoder_feed", workload.name, "report", count, [&]() {
+            uint8_t out[CANETA_REPORT_OUTPUT_MAX];
+            uint64_t bytes = 0;
+            for (size_t i = 0; i < count; i++) {
+                bytes += caneta_decoder_feed(&decoder, workload.report(i), CANETA_REPORT_SIZE, out);
+            }
+            return bytes;
+        });
+
+        caneta_decoder_init(&decoder);
+        suite.run("caneta-c/translate_reports", workload.name, "report", count, [&]() {
+            uint8_t out[4096];
+            uint64_t bytes = 0;
+            for (size_t done = 0; done < count;) {
+                size_t used;
+                bytes += caneta_translate_reports(&decoder, workload.report(done), count - done,
+                                                  out, sizeof(out), &used);
+                done += used;
+            }
+            return bytes;
+        });
+
+        // The same engine with the sink as a function pointer and as a template parameter
+        OutputCounter c_output;
+        caneta_sink_t c_sink = {[](void* ctx, const uint8_t* data, size_t len) {
+            static_cast<OutputCounter*>(ctx)->write(data, len);
+        }, &c_output};
+        caneta_decoder_init(&decoder);
+        suite.run("caneta-c/decoder_stream", workload.name, "report", count, [&]() {
+            uint64_t before = c_output.bytes;
+            for (size_t i = 0; i < count; i++) {
+                caneta_decoder_stream(&decoder, workload.report(i), 1, &c_sink);
+            }
+            return c_output.bytes - before;
+        });
+
+        struct CounterSink {
+            OutputCounter* counter;
+            void write(const uint8_t* data, size_t len) { counter->write(data, len); }
+        };
+        OutputCounter cpp_output;
+        caneta::Stream<CounterSink> stream(CounterSink{&cpp_output});
+        suite.run("caneta-c/Stream", workload.name, "report", count, [&]() {
+            uint64_t before = cpp_output.bytes;
+            for (size_t i = 0; i < count; i++) {
+                stream.feed(workload.report(i), CANETA_REPORT_SIZE);
+            }
+            return cpp_output.bytes - before;
+        });
+
+        // Descriptor-driven decoding: a boot layout, and the same keys as NKRO bitmap reports
+        caneta_hid_decoder_t hid;
+        caneta_hid_decoder_init(&hid, kBootDescriptor, kBootDescriptorSize);
+        suite.run("caneta-c/hid_boot", workload.name, "report", count, [&]() {
+            uint64_t before = c_output.bytes;
+            for (size_t i = 0; i < count; i++) {
+                caneta_hid_decoder_stream(&hid, workload.report(i), CANETA_REPORT_SIZE, &c_sink);
+            }
+            return c_output.bytes - before;
+        });
+
+        std::vector<uint8_t> nkro_reports = makeNkroReports(workload);
+        caneta_hid_decoder_init(&hid, kNkroDescriptor, kNkroDescriptorSize);
+        suite.run("caneta-c/hid_nkro", workload.name, "report", count, [&]() {
+            uint64_t before = c_output.bytes;
+            for (size_t i = 0; i < count; i++) {
+                caneta_hid_decoder_stream(&hid, &nkro_reports[i * kNkroReportSize], kNkroReportSize, &c_sink);
+            }
+            return c_output.bytes - before;
+        });
+
+        OutputCounter uart;
+        Rp2040Pipeline rp2040(uart);
+        suite.run("rp2040/host_pipeline", workload.name, "report", count, [&]() {
+            uint64_t before = uart.bytes;
+            for (size_t i = 0; i < count; i++) {
+                rp2040.processReport(workload.report(i), CANETA_REPORT_SIZE);
+            }
+            return uart.bytes - before;
+        });
+
+        OutputCounter serial;
+        Esp32Pipeline esp32(serial);
+        suite.run("esp32/report_queue", workload.name, "report", count, [&]() {
+            uint64_t before = serial.bytes;
+            for (size_t i = 0; i < count; i++) {
+                esp32.processReport(workload.report(i), CANETA_REPORT_SIZE);
+            }
+            return serial.bytes - before;
+        });
+
+        OutputCounter legacy_serial;
+        LegacyEsp32Processor legacy_esp32(legacy_serial);
+        suite.run("legacy/esp32_process_keycode", workload.name, "report", count, [&]() {
+            uint64_t before = legacy_serial.bytes;
+            for (size_t i = 0; i < count; i++) {
+                legacy_esp32.processReport(workload.report(i), CANETA_REPORT_SIZE);
+            }
+            return legacy_serial.bytes - before;
+        });
+    }
+
+    // Decodes the workload on each thread with its own decoder, from 1 thread
+    // up to every core. Independent decoders share no state, so throughput
+    // should scale with cores; every thread must also produce the same output.
+    // Returns false if one didn't.
+    bool runThreadScaling(Suite& suite, const Workload& workload, double min_seconds) {
+        const char* path = "caneta-c/decoder_feed";
+        if (!suite.enabled(path)) {
+            return true;
+        }
+
+        const size_t count = workload.report_count();
+        unsigned cores = std::max(1u, std::thread::hardware_concurrency());
+        std::vector<unsigned> thread_counts;
+        for (unsigned threads = 1; threads < cores; threads *= 2) {
+            thread_counts.push_back(threads);
+        }
+        thread_counts.push_back(cores);
+
+        // Each pass starts from a reset decoder, so every pass of every
+        // thread must produce this many bytes
+        caneta_decoder_t reference;
+        caneta_decoder_init(&reference);
+        uint8_t reference_out[CANETA_REPORT_OUTPUT_MAX];
+        uint64_t pass_bytes = 0;
+        for (size_t i = 0; i < count; i++) {
+            pass_bytes += caneta_decoder_feed(&reference, workload.report(i), CANETA_REPORT_SIZE, reference_out);
+        }
+
+        double single = 0;
+        for (unsigned threads : thread_counts) {
+            std::vector<std::thread> workers;
+            std::vector<uint64_t> bytes(threads, 0);
+            std::vector<uint64_t> passes(threads, 0);
+            std::vector<uint64_t> wrong_passes(threads, 0);
+
+            // Totals stay in locals until a thread finishes: the vectors'
+            // neighbouring elements share cache lines
+            auto start = Clock::now();
+            for (unsigned t = 0; t < threads; t++) {
+                workers.emplace_back([&, t]() {
+                    caneta_decoder_t decoder;
+                    caneta_decoder_init(&decoder);
+                    uint8_t out[CANETA_REPORT_OUTPUT_MAX];
+                    uint64_t total = 0;
+                    uint64_t done = 0;
+                    uint64_t wrong = 0;
+                    std::chrono::duration<double> elapsed{0};
+                    do {
+                        caneta_decoder_reset(&decoder);
+                        uint64_t pass = 0;
+                        for (size_t i = 0; i < count; i++) {
+                            pass += caneta_decoder_feed(&decoder, workload.report(i), CANETA_REPORT_SIZE, out);
+                        }
+                        total += pass;
+                        wrong += pass != pass_bytes;
+                        done++;
+                        elapsed = Clock::now() - start;
+                    } while (elapsed.count() < min_seconds);
+                    bytes[t] = total;
+                    passes[t] = done;
+                    wrong_passes[t] = wrong;
+                });
+            }
+            for (auto& worker : workers) {
+                worker.join();
+            }
+            std::chrono::duration<double> elapsed = Clock::now() - start;
+
+            Result result = {path, workload.name, "report", threads, 0, 0, elapsed.count()};
+            for (unsigned t = 0; t < threads; t++) {
+                if (wrong_passes[t] != 0) {
+                    std::fprintf(stderr, "decoder on thread %u of %u: %llu of %llu passes differ from %llu bytes\n",
+                                 t, threads, (unsigned long long)wrong_passes[t], (unsigned long long)passes[t],
+                                 (unsigned long long)pass_bytes);
+                    return false;
+                }
+                result.items += passes[t] * count;
+                result.bytes += bytes[t];
+            }
+            suite.add(result);
+
+            double rate = result.items / result.seconds;
+            if (threads == 1) {
+                single = rate;
+            }
+            std::fprintf(stderr, "%-34s %-10s %2u  %.2fx one thread\n", path, workload.name.c_str(), threads,
+                         rate / single);
+        }
+        return true;
+    }
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    Options options;
+    if (!parseOptions(argc, argv, options)) {
+        usage(argv[0]);
+        return 2;
+    }
+
+    std::vector<Workload> workloads = makeWorkloads(options.reports);
+
+    // Everything timed below has to be correct first
+    if (options.verify) {
+        if (!verifyTables()) {
+            return 1;
+        }
+        uint64_t diff_cases = verifyKeyDiff();
+        if (diff_cases == 0) {
+            return 1;
+        }
+        std::fprintf(stderr, "caneta_kbd_diff matches the nested loop on %llu key combinations\n",
+                     (unsigned long long)diff_cases);
+        if (!verifyPaths(workloads)) {
+            return 1;
+        }
+        if (!verifyHid(workloads)) {
+            return 1;
+        }
+        if (!verifyRepeat()) {
+            return 1;
+        }
+        if (!verifyRing(workloads)) {
+            return 1;
+        }
+        if (!verifyTx(workloads)) {
+            return 1;
+        }
+        if (!verifyBatch(workloads)) {
+            return 1;
+        }
+        if (!verifyReconnect()) {
+            return 1;
+        }
+        if (!verifyGatt(workloads)) {
+            return 1;
+        }
+        if (!verifyQueue(workloads)) {
+            return 1;
+        }
+        if (!verifyLink()) {
+            return 1;
+        }
+        if (!verifySnapshot()) {
+            return 1;
+        }
+        if (!verifyLayouts()) {
+            return 1;
+        }
+        if (!verifyCompose()) {
+            return 1;
+        }
+        if (!verifyKeyEncoding()) {
+            return 1;
+        }
+#ifdef CANETA_BENCH_SDL
+        if (!verifySdl(workloads)) {
+            return 1;
+        }
+#endif
+        std::fprintf(stderr, "all translation paths agree on every workload\n");
+    }
+
+    for (const Workload& workload : workloads) {
+        std::fprintf(stderr, "workload %-10s %8zu reports  %8zu key events\n",
+                     workload.name.c_str(), workload.report_count(), workload.events.size());
+    }
+
+    Suite suite(options.min_seconds, options.filter);
+
+    runKeycodeBenchmarks(suite, makeKeycodes(options.reports * 4));
+    for (const Workload& workload : workloads) {
+        runDiffBenchmarks(suite, workload);
+    }
+    for (const Workload& workload : workloads) {
+        runReportBenchmarks(suite, workload);
+    }
+#ifdef CANETA_BENCH_SDL
+    runSdlBenchmarks(suite, workloads);
+#endif
+    if (!runThreadScaling(suite, workloads.front(), options.min_seconds)) {
+        return 1;
+    }
+
+    FILE* out = stdout;
+    if (options.output) {
+        out = std::fopen(options.output, "w");
+        if (!out) {
+            std::perror(options.output);
+            return 1;
+        }
+    }
+    suite.writeJson(out, CANETA_BENCH_REVISION, compilerName().c_str(), CANETA_BENCH_SYSTEM);
+    if (out != stdout) {
+        std::fclose(out);
+    }
+
+    return 0;
+}
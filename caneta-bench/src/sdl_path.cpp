@@ -0,0 +1,262 @@
+// sdl_path.cpp
+// caneta-sdl benchmarks
+
+#include "sdl_path.h"
+
+#include <caneta_sdl.h>
+#include <caneta.hpp>
+
+#include <cstdio>
+#include <cstring>
+
+namespace caneta_bench {
+
+    namespace {
+
+        // The SDL keycode a US layout produces for a HID usage. Character keys
+        // use their character; everything else uses the scancode-derived code.
+        SDL_Keycode sdlKeycodeFor(uint8_t hid) {
+            if (hid == 0x4C) {
+                return SDLK_DELETE;
+            }
+            char c = hid_to_ascii(hid, false);
+            if (c != 0) {
+                return static_cast<SDL_Keycode>(c);
+            }
+            return SDL_SCANCODE_TO_KEYCODE(static_cast<SDL_Scancode>(hid));
+        }
+
+        SDL_Event makeEvent(bool down, SDL_Scancode scancode, SDL_Keycode sym) {
+            SDL_Event event = {};
+            event.type = down ? SDL_KEYDOWN : SDL_KEYUP;
+            event.key.type = event.type;
+            event.key.state = down ? SDL_PRESSED : SDL_RELEASED;
+            event.key.keysym.scancode = scancode;
+            event.key.keysym.sym = sym;
+            return event;
+        }
+
+        // Appends every report it is given
+        struct ReportLog {
+            std::vector<uint8_t>* reports;
+            void write(const uint8_t* data, size_t len) { reports->insert(reports->end(), data, data + len); }
+        };
+
+        // Counts report bytes, for the benchmark
+        struct ReportCount {
+            uint64_t* bytes;
+            void write(const uint8_t*, size_t len) { *bytes += len; }
+        };
+
+        std::vector<SDL_Event> makeEvents(const Workload& workload) {
+            std::vector<SDL_Event> events;
+            events.reserve(workload.events.size());
+            for (const KeyEvent& key : workload.events) {
+                events.push_back(makeEvent(key.down, static_cast<SDL_Scancode>(key.keycode),
+                                           sdlKeycodeFor(key.keycode)));
+            }
+            return events;
+        }
+
+    } // namespace
+
+    bool verifySdl(const std::vector<Workload>& workloads) {
+        // Every scancode SDL names on the Keyboard/Keypad page is its own usage.
+        // SDL2 leaves some it defines unnamed (International, Lang), so those
+        // only have to map to themselves or to nothing.
+        int named = 0;
+        for (int s = 0; s < SDL_NUM_SCANCODES; s++) {
+            SDL_Scancode scancode = static_cast<SDL_Scancode>(s);
+            const char* name = SDL_GetScancodeName(scancode);
+            uint8_t hid = caneta::SDLToHID::sdlScancodeToHID(scancode);
+            uint8_t expected = 0;
+            if (scancode == SDL_SCANCODE_MODE) {
+                expected = 0xE6;
+            } else if (s <= SDL_SCANCODE_RGUI && name[0] != '\0') {
+                expected = static_cast<uint8_t>(s);
+            } else if (s <= SDL_SCANCODE_RGUI && hid == s) {
+                expected = hid;
+            }
+            if (hid != expected) {
+                std::fprintf(stderr, "caneta-sdl: scancode %d (%s) maps to usage 0x%02X, not 0x%02X\n",
+                             s, name, hid, expected);
+                return false;
+            }
+            if (name[0] != '\0' && hid != 0) {
+                named++;
+            }
+        }
+        if (caneta::SDLToHID::sdlScancodeToHID(static_cast<SDL_Scancode>(SDL_NUM_SCANCODES)) != 0) {
+            std::fprintf(stderr, "caneta-sdl: scancodes past SDL_NUM_SCANCODES must map to nothing\n");
+            return false;
+        }
+
+        // The report follows the physical key, not the character: Q on an
+        // AZERTY layout types 'a' and is still usage 0x14
+        caneta::SDLToHID keyboard;
+        uint8_t report[CANETA_REPORT_SIZE] = {};
+        keyboard.setReportCallback([&report](const uint8_t* data, uint16_t len) {
+            std::memcpy(report, data, len < sizeof(report) ? len : sizeof(report));
+        });
+        keyboard.processEvent(makeEvent(true, SDL_SCANCODE_Q, SDLK_a));
+        if (report[2] != 0x14) {
+            std::fprintf(stderr, "caneta-sdl: AZERTY 'a' on scancode Q reported usage 0x%02X\n", report[2]);
+            return false;
+        }
+        keyboard.processEvent(makeEvent(false, SDL_SCANCODE_Q, SDLK_a));
+        if (report[2] != 0) {
+            std::fprintf(stderr, "caneta-sdl: releasing scancode Q left usage 0x%02X down\n", report[2]);
+            return false;
+        }
+
+        // Modifier keys set bits of byte 0 from their own events and take no key slot
+        keyboard.processEvent(makeEvent(true, SDL_SCANCODE_LSHIFT, SDLK_LSHIFT));
+        keyboard.processEvent(makeEvent(true, SDL_SCANCODE_A, SDLK_a));
+        if (report[0] != 0x02 || report[2] != 0x04 || report[3] != 0) {
+            std::fprintf(stderr, "caneta-sdl: Shift+A reported modifiers %02X keys %02X %02X\n",
+                         report[0], report[2], report[3]);
+            return false;
+        }
+
+        // Batches produce the reports single events do, in one write per batch
+        for (const Workload& workload : workloads) {
+            std::vector<SDL_Event> events = makeEvents(workload);
+
+            caneta::SDLToHID single;
+            std::vector<uint8_t> expected;
+            single.setReportCallback([&expected](const uint8_t* data, uint16_t len) {
+                expected.insert(expected.end(), data, data + len);
+            });
+            for (const SDL_Event& event : events) {
+                single.processEvent(event);
+            }
+
+            caneta::SDLToHID batched;
+            std::vector<uint8_t> reports;
+            batched.processEvents(events.data(), events.size(), ReportLog{&reports});
+            if (reports != expected) {
+                std::fprintf(stderr, "caneta-sdl: %s: processEvents gave %zu report bytes, processEvent %zu\n",
+                             workload.name.c_str(), reports.size(), expected.size());
+                return false;
+            }
+
+            // NKRO reports through their own descriptor type what boot reports do
+            caneta::SDLToHID nkro;
+            nkro.setReportMode(caneta::SDLToHID::NKRO_REPORTS);
+            std::vector<uint8_t> nkro_reports;
+            nkro.processEvents(events.data(), events.size(), ReportLog{&nkro_reports});
+
+            std::vector<uint8_t> boot_out;
+            caneta::Stream<ReportLog> boot_stream(ReportLog{&boot_out});
+            boot_stream.feedReports(expected.data(), expected.size() / CANETA_REPORT_SIZE);
+
+            uint8_t desc[caneta::SDLToHID::NKRO_DESCRIPTOR_MAX];
+            size_t desc_len = nkro.nkroDescriptor(desc);
+            std::vector<uint8_t> nkro_out;
+            caneta::HidStream<ReportLog> nkro_stream(ReportLog{&nkro_out});
+            size_t size = nkro.reportSize();
+            if (!nkro_stream.begin(desc, desc_len) || nkro_reports.size() % size != 0) {
+                std::fprintf(stderr, "caneta-sdl: NKRO descriptor does not describe %zu-byte reports\n", size);
+                return false;
+            }
+            for (size_t i = 0; i < nkro_reports.size(); i += size) {
+                nkro_stream.feed(&nkro_reports[i], size);
+            }
+            if (nkro_out != boot_out) {
+                std::fprintf(stderr, "caneta-sdl: %s: NKRO reports typed %zu bytes, boot reports %zu\n",
+                             workload.name.c_str(), nkro_out.size(), boot_out.size());
+                return false;
+            }
+        }
+
+        // Eight keys: boot reports say ErrorRollOver, NKRO reports have them all,
+        // in a format without a report ID that stops after usage 0x3F
+        caneta::SDLToHID boot;
+        caneta::SDLToHID nkro;
+        nkro.setReportMode(caneta::SDLToHID::NKRO_REPORTS);
+        nkro.setNkroFormat(0, 0x3C);
+        uint8_t boot_report[CANETA_REPORT_SIZE] = {};
+        uint8_t nkro_report[caneta::SDLToHID::REPORT_MAX] = {};
+        boot.setReportCallback([&boot_report](const uint8_t* data, uint16_t len) {
+            std::memcpy(boot_report, data, len);
+        });
+        nkro.setReportCallback([&nkro_report](const uint8_t* data, uint16_t len) {
+            std::memcpy(nkro_report, data, len);
+        });
+        for (int key = SDL_SCANCODE_A; key < SDL_SCANCODE_A + 8; key++) {
+            boot.processEvent(makeEvent(true, static_cast<SDL_Scancode>(key), SDLK_a));
+            nkro.processEvent(makeEvent(true, static_cast<SDL_Scancode>(key), SDLK_a));
+        }
+        nkro.processEvent(makeEvent(true, SDL_SCANCODE_LSHIFT, SDLK_LSHIFT));
+        const uint8_t rollover[CANETA_REPORT_SIZE] = {0, 0, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01};
+        const uint8_t bitmap[9] = {0x02, 0xF0, 0x0F, 0, 0, 0, 0, 0, 0};
+        if (std::memcmp(boot_report, rollover, sizeof(rollover)) != 0 || nkro.reportSize() != sizeof(bitmap) ||
+            std::memcmp(nkro_report, bitmap, sizeof(bitmap)) != 0) {
+            std::fprintf(stderr, "caneta-sdl: eight keys reported as %02X %02X.. (boot) and %02X %02X %02X.. (NKRO)\n",
+                         boot_report[2], boot_report[3], nkro_report[0], nkro_report[1], nkro_report[2]);
+            return false;
+        }
+
+        std::fprintf(stderr, "caneta-sdl maps all %d named SDL scancodes to their HID usages\n", named);
+        return true;
+    }
+
+    void runSdlBenchmarks(Suite& suite, const std::vector<Workload>& workloads) {
+        for (const Workload& workload : workloads) {
+            std::vector<SDL_Event> events = makeEvents(workload);
+
+            caneta::SDLToHID keyboard;
+            uint64_t reports = 0;
+            keyboard.setReportCallback([&reports](const uint8_t*, uint16_t) {
+                reports++;
+            });
+
+            suite.run("caneta-sdl/processEvent", workload.name, "event", events.size(), [&]() {
+                uint64_t before = reports;
+                for (const SDL_Event& event : events) {
+                    keyboard.processEvent(event);
+                }
+                return (reports - before) * CANETA_REPORT_SIZE;
+            });
+
+            // Whole batches into a sink the compiler can inline, with no
+            // callback per report
+            caneta::SDLToHID batched;
+            suite.run("caneta-sdl/processEvents", workload.name, "event", events.size(), [&]() {
+                uint64_t bytes = 0;
+                batched.processEvents(events.data(), events.size(), ReportCount{&bytes});
+                return bytes;
+            });
+
+            caneta::SDLToHID nkro;
+            nkro.setReportMode(caneta::SDLToHID::NKRO_REPORTS);
+            suite.run("caneta-sdl/processEvents_nkro", workload.name, "event", events.size(), [&]() {
+                uint64_t bytes = 0;
+                nkro.processEvents(events.data(), events.size(), ReportCount{&bytes});
+                return bytes;
+            });
+
+            // The per-event translation alone: the scancode table key events
+            // use, and the keycode path that has to ask SDL's keymap first
+            auto lookup = [&](const char* path, auto translate) {
+                suite.run(path, workload.name, "event", events.size(), [&]() {
+                    uint32_t checksum = 0;
+                    for (const SDL_Event& event : events) {
+                        checksum += translate(event.key.keysym);
+                    }
+                    // Keep the work observable so the loop is not optimised away
+                    volatile uint32_t sink = checksum;
+                    (void)sink;
+                    return uint64_t{0};
+                });
+            };
+            lookup("caneta-sdl/sdlScancodeToHID", [](const SDL_Keysym& keysym) {
+                return static_cast<uint32_t>(caneta::SDLToHID::sdlScancodeToHID(keysym.scancode));
+            });
+            lookup("caneta-sdl/sdlToHIDKeycode", [](const SDL_Keysym& keysym) {
+                return static_cast<uint32_t>(caneta::SDLToHID::sdlToHIDKeycode(keysym.sym));
+            });
+        }
+    }
+
+} // namespace caneta_bench
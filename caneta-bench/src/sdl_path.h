@@ -0,0 +1,24 @@
+// sdl_path.h
+// caneta-sdl benchmarks (built only when SDL2 is available)
+
+#ifndef CANETA_BENCH_SDL_PATH_H
+#define CANETA_BENCH_SDL_PATH_H
+
+#include <vector>
+
+#include "bench.h"
+#include "workload.h"
+
+namespace caneta_bench {
+
+    // SDLToHID's scancode table against SDL's own scancode list, key events
+    // against the reports they should produce, batched events against single
+    // ones, and NKRO reports against boot reports on every workload
+    bool verifySdl(const std::vector<Workload>& workloads);
+
+    // SDL key events -> SDLToHID -> boot reports, for every workload
+    void runSdlBenchmarks(Suite& suite, const std::vector<Workload>& workloads);
+
+} // namespace caneta_bench
+
+#endif // CANETA_BENCH_SDL_PATH_H
@@ -0,0 +1,2197 @@
+// verify.cpp
+// Correctness checks run before any timing
+
+#include "verify.h"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <deque>
+#include <map>
+#include <memory>
+#include <random>
+#include <string>
+#include <thread>
+
+#include <caneta.h>
+#include <caneta_batch.h>
+#include <caneta_compose.h>
+#include <caneta_gatt.h>
+#include <caneta.hpp>
+#include <caneta_hid.h>
+#include <caneta_layout.h>
+#include <caneta_link.h>
+#include <caneta_host.h>
+#include <caneta_reconnect.h>
+#include <caneta_repeat.h>
+#include <caneta_ring.h>
+#include <caneta_snapshot.h>
+#include <caneta_tx.h>
+#include "frontends.h"
+#include "hid_reports.h"
+#include "legacy_caneta.h"
+#include "m0_model.h"
+
+namespace caneta_bench {
+
+    bool verifyTables() {
+        for (int k = 0; k < 256; k++) {
+            uint8_t keycode = static_cast<uint8_t>(k);
+            for (int shift = 0; shift < 2; shift++) {
+                if (hid_to_ascii(keycode, shift) != legacy_hid_to_ascii(keycode, shift)) {
+                    std::fprintf(stderr, "hid_to_ascii mismatch: keycode 0x%02X shift %d\n", k, shift);
+                    return false;
+                }
+            }
+            if (std::strcmp(process_special_keys(keycode), legacy_process_special_keys(keycode)) != 0) {
+                std::fprintf(stderr, "process_special_keys mismatch: keycode 0x%02X\n", k);
+                return false;
+            }
+        }
+        return true;
+    }
+
+    // Checks caneta_kbd_diff against the nested-loop reference for every
+    // 6-key previous state and 6-key report, up to relabelling. Both only
+    // depend on which of the 12 slots hold equal keycodes and which are empty,
+    // so every set partition of the slots, with at most one block mapped to
+    // keycode 0, covers every combination. Returns the number of cases checked.
+    uint64_t verifyKeyDiff() {
+        // Distinct non-zero keycodes chosen to exercise the high and low bits of each lane
+        static const uint8_t kValues[12] = {0x80, 0xFF, 0x01, 0x7F, 0x04, 0xE7, 0x81, 0x52, 0x2C, 0xFE, 0x40, 0x10};
+
+        uint8_t blocks[12] = {0};
+        uint64_t checked = 0;
+        bool ok = true;
+
+        // Iterate restricted growth strings: blocks[i] <= max(blocks[0..i-1]) + 1
+        while (ok) {
+            int block_count = 0;
+            for (int i = 0; i < 12; i++) {
+                block_count = std::max(block_count, blocks[i] + 1);
+            }
+
+            for (int zero_block = -1; zero_block < block_count && ok; zero_block++) {
+                kbd_state_t state = {};
+                uint8_t report[CANETA_REPORT_SIZE] = {};
+                for (int i = 0; i < 12; i++) {
+                    uint8_t value = blocks[i] == zero_block ? 0 : kValues[blocks[i]];
+                    if (i < 6) {
+                        state.last_keys[i] = value;
+                    } else {
+                        report[2 + i - 6] = value;
+                    }
+                }
+
+                uint8_t pressed, released;
+                legacy_kbd_diff(state.last_keys, report, &pressed, &released);
+                caneta_key_diff_t diff = caneta_kbd_diff(&state, report);
+                if (diff.pressed != pressed || diff.released != released) {
+                    std::fprintf(stderr, "caneta_kbd_diff mismatch: pressed %02X/%02X released %02X/%02X\n",
+                                 diff.pressed, pressed, diff.released, released);
+                    ok = false;
+                }
+
+                // The Cortex-M0+ model prices these same computations
+                M0Cost cost;
+                caneta_key_diff_t legacy_model = m0LegacyDiff(state, report, cost);
+                caneta_key_diff_t word_model = m0WordDiff(state, report, cost);
+                if (legacy_model.pressed != pressed || legacy_model.released != released ||
+                    word_model.pressed != pressed || word_model.released != released) {
+                    std::fprintf(stderr, "Cortex-M0+ model of the key diff disagrees with the code it prices\n");
+                    ok = false;
+                }
+                checked++;
+            }
+
+            // Next restricted growth string
+            int i = 11;
+            while (i > 0) {
+                int prefix_max = 0;
+                for (int j = 0; j < i; j++) {
+                    prefix_max = std::max(prefix_max, static_cast<int>(blocks[j]));
+                }
+                if (blocks[i] <= prefix_max) {
+                    blocks[i]++;
+                    break;
+                }
+                blocks[i] = 0;
+                i--;
+            }
+            if (i == 0) {
+                break;
+            }
+        }
+
+        return ok ? checked : 0;
+    }
+
+    bool verifyPaths(const std::vector<Workload>& workloads) {
+        for (const Workload& workload : workloads) {
+            const size_t count = workload.report_count();
+
+            // Reference: one report at a time through the decoder
+            std::vector<uint8_t> expected;
+            caneta_decoder_t decoder;
+            caneta_decoder_init(&decoder);
+            for (size_t i = 0; i < count; i++) {
+                uint8_t out[CANETA_REPORT_OUTPUT_MAX];
+                size_t n = caneta_decoder_feed(&decoder, workload.report(i), CANETA_REPORT_SIZE, out);
+                expected.insert(expected.end(), out, out + n);
+            }
+
+            // Bulk translation with a small buffer, so it has to resume mid-report
+            std::vector<uint8_t> bulk;
+            caneta_decoder_init(&decoder);
+            for (size_t done = 0; done < count;) {
+                uint8_t out[7];
+                size_t used;
+                size_t n = caneta_translate_reports(&decoder, workload.report(done), count - done,
+                                                    out, sizeof(out), &used);
+                bulk.insert(bulk.end(), out, out + n);
+                done += used;
+            }
+
+            // The streaming engine over the whole workload at once, batched into chunks
+            struct VectorSink {
+                std::vector<uint8_t>* bytes;
+                void write(const uint8_t* data, size_t len) { bytes->insert(bytes->end(), data, data + len); }
+            };
+            std::vector<uint8_t> streamed;
+            caneta::Stream<VectorSink> stream(VectorSink{&streamed});
+            stream.feedReports(workload.report(0), count);
+
+            OutputCounter rp2040_uart;
+            OutputCounter esp32_serial;
+            OutputCounter legacy_serial;
+            Rp2040Pipeline rp2040(rp2040_uart);
+            Esp32Pipeline esp32(esp32_serial);
+            LegacyEsp32Processor legacy_esp32(legacy_serial);
+            for (size_t i = 0; i < count; i++) {
+                rp2040.processReport(workload.report(i), CANETA_REPORT_SIZE);
+                esp32.processReport(workload.report(i), CANETA_REPORT_SIZE);
+                legacy_esp32.processReport(workload.report(i), CANETA_REPORT_SIZE);
+            }
+
+            // The legacy sketch ignored Alt and the modifiers of special keys,
+            // so it only agrees on workloads that use neither
+            bool legacy_encodable = true;
+            for (size_t i = 0; i < count && legacy_encodable; i++) {
+                const uint8_t* report = workload.report(i);
+                if (report[0] & CANETA_MODIFIER_ALT) legacy_encodable = false;
+                for (int slot = 2; slot < CANETA_REPORT_SIZE; slot++) {
+                    if (report[0] && *process_special_keys(report[slot])) legacy_encodable = false;
+                }
+            }
+
+            if (bulk != expected || streamed != expected || rp2040_uart.bytes != expected.size() ||
+                esp32_serial.bytes != expected.size() ||
+                (legacy_encodable && legacy_serial.bytes != expected.size())) {
+                std::fprintf(stderr, "%s: paths disagree (decoder %zu, bulk %zu, stream %zu, rp2040 %llu, "
+                             "esp32 %llu, legacy esp32 %llu bytes)\n",
+                             workload.name.c_str(), expected.size(), bulk.size(), streamed.size(),
+                             (unsigned long long)rp2040_uart.bytes, (unsigned long long)esp32_serial.bytes,
+                             (unsigned long long)legacy_serial.bytes);
+                return false;
+            }
+        }
+        return true;
+    }
+
+    bool verifyHid(const std::vector<Workload>& workloads) {
+        caneta_hid_plan_t plan;
+        if (!caneta_hid_compile(kBootDescriptor, kBootDescriptorSize, &plan) || !caneta_hid_plan_is_boot(&plan)) {
+            std::fprintf(stderr, "boot keyboard descriptor not recognised\n");
+            return false;
+        }
+        if (!caneta_hid_compile(kNkroDescriptor, kNkroDescriptorSize, &plan) || caneta_hid_plan_is_boot(&plan) ||
+            plan.layout_count != 1 || !plan.report_ids || plan.layouts[0].report_id != 1 ||
+            plan.layouts[0].min_len != kNkroReportSize - 1) {
+            std::fprintf(stderr, "NKRO keyboard descriptor compiled to the wrong plan\n");
+            return false;
+        }
+
+        // A report count whose size in bits wraps 32 bits must not compile
+        // into a field longer than the report it is read from
+        static const uint8_t kWrappingDescriptor[] = {
+            0x05, 0x07, 0x75, 0x03, 0x97, 0x56, 0x55, 0x55, 0x55,
+            0x19, 0x00, 0x29, 0xFF, 0x15, 0x00, 0x81, 0x00,
+        };
+        if (caneta_hid_compile(kWrappingDescriptor, sizeof(kWrappingDescriptor), &plan)) {
+            std::fprintf(stderr, "descriptor with a wrapping report count compiled (%u-byte report)\n",
+                         static_cast<unsigned>(plan.layouts[0].min_len));
+            return false;
+        }
+
+        struct VectorSink {
+            std::vector<uint8_t>* bytes;
+            void write(const uint8_t* data, size_t len) { bytes->insert(bytes->end(), data, data + len); }
+        };
+
+        for (const Workload& workload : workloads) {
+            const size_t count = workload.report_count();
+
+            // Boot layout through the HID decoder must match the boot decoder
+            std::vector<uint8_t> expected;
+            std::vector<uint8_t> boot;
+            caneta::Stream<VectorSink> reference(VectorSink{&expected});
+            caneta::HidStream<VectorSink> boot_stream(VectorSink{&boot});
+            boot_stream.begin(kBootDescriptor, kBootDescriptorSize);
+            for (size_t i = 0; i < count; i++) {
+                reference.feed(workload.report(i), CANETA_REPORT_SIZE);
+                boot_stream.feed(workload.report(i), CANETA_REPORT_SIZE);
+            }
+            if (boot != expected) {
+                std::fprintf(stderr, "%s: HID decoder disagrees with the boot decoder\n", workload.name.c_str());
+                return false;
+            }
+
+            // NKRO reports emit each report's new keys in usage order
+            std::vector<uint8_t> sorted;
+            uint8_t held[256] = {};
+            for (size_t i = 0; i < count; i++) {
+                const uint8_t* report = workload.report(i);
+                uint8_t down[256] = {};
+                for (int slot = 2; slot < CANETA_REPORT_SIZE; slot++) {
+                    down[report[slot]] = 1;
+                }
+                down[0] = 0;
+                for (int usage = 0; usage < 256; usage++) {
+                    if (down[usage] && !held[usage]) {
+                        uint8_t seq[CANETA_KEY_OUTPUT_MAX];
+                        size_t n = caneta_translate_key(static_cast<uint8_t>(usage), report[0], seq);
+                        sorted.insert(sorted.end(), seq, seq + n);
+                    }
+                }
+                std::memcpy(held, down, sizeof(held));
+            }
+
+            std::vector<uint8_t> nkro_reports = makeNkroReports(workload);
+            std::vector<uint8_t> nkro;
+            caneta::HidStream<VectorSink> nkro_stream(VectorSink{&nkro});
+            nkro_stream.begin(kNkroDescriptor, kNkroDescriptorSize);
+            for (size_t i = 0; i < count; i++) {
+                nkro_stream.feed(&nkro_reports[i * kNkroReportSize], kNkroReportSize);
+            }
+            if (nkro != sorted) {
+                std::fprintf(stderr, "%s: NKRO decoding disagrees with the reference (%zu vs %zu bytes)\n",
+                             workload.name.c_str(), nkro.size(), sorted.size());
+                return false;
+            }
+        }
+
+        // Two keyboard report IDs: a 6KRO array with the modifiers, and a key
+        // bitmap without them. Each ID only releases its own keys, and the
+        // modifiers held on one apply to keys pressed on the other.
+        const uint8_t two_ids[] = {
+            0x05, 0x01, 0x09, 0x06, 0xA1, 0x01,  // Keyboard collection
+            0x85, 0x01,                          //   Report ID (1)
+            0x05, 0x07, 0x19, 0xE0, 0x29, 0xE7,  //   Modifiers
+            0x15, 0x00, 0x25, 0x01, 0x75, 0x01, 0x95, 0x08, 0x81, 0x02,
+            0x95, 0x06, 0x75, 0x08, 0x15, 0x00,  //   6 key slots
+            0x25, 0x65, 0x19, 0x00, 0x29, 0x65, 0x81, 0x00,
+            0x85, 0x02,                          //   Report ID (2)
+            0x19, 0x00, 0x29, 0x3F, 0x15, 0x00,  //   Bitmap of usages 0x00-0x3F
+            0x25, 0x01, 0x75, 0x01, 0x95, 0x40, 0x81, 0x02,
+            0xC0,
+        };
+        struct IdReport {
+            uint8_t id;
+            uint8_t data[8];
+        };
+        const IdReport split[] = {
+            {1, {0x00, 0x04}},                    // a down on ID 1
+            {2, {0x20}},                          // b down on ID 2, a still held
+            {1, {0x00, 0x04}},                    // ID 1 repeats: nothing new
+            {2, {0x20}},                          // ID 2 repeats: nothing new
+            {1, {0x02, 0x04}},                    // Shift down on ID 1
+            {2, {0x60}},                          // c on ID 2 types C
+            {1, {0x00}},                          // Shift and a up
+            {2, {0x60}},                          // Nothing new
+        };
+        std::vector<uint8_t> split_out;
+        caneta::HidStream<VectorSink> split_stream(VectorSink{&split_out});
+        if (!split_stream.begin(two_ids, sizeof(two_ids))) {
+            std::fprintf(stderr, "two report ID keyboard descriptor not recognised\n");
+            return false;
+        }
+        for (const IdReport& report : split) {
+            split_stream.feed(report.id, report.data, report.id == 1 ? 7 : 8);
+        }
+        if (std::string(split_out.begin(), split_out.end()) != "abC") {
+            std::fprintf(stderr, "keys held across report IDs typed \"%.*s\", expected \"abC\"\n",
+                         static_cast<int>(split_out.size()), reinterpret_cast<const char*>(split_out.data()));
+            return false;
+        }
+
+        // A seventh key turns a boot report into ErrorRollOver; releasing it
+        // brings back the six keys, none of which may be typed again
+        const uint8_t rollover[][CANETA_REPORT_SIZE] = {
+            {0x00, 0, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09},
+            {0x02, 0, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01},
+            {0x02, 0, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09},
+            {0x02, 0, 0x04, 0x05, 0x06, 0x07, 0x08, 0x00},
+            {0x02, 0, 0x04, 0x05, 0x06, 0x07, 0x08, 0x1D},
+        };
+        std::vector<uint8_t> boot_out;
+        std::vector<uint8_t> hid_out;
+        caneta::Stream<VectorSink> boot_stream(VectorSink{&boot_out});
+        caneta::HidStream<VectorSink> hid_stream(VectorSink{&hid_out});
+        hid_stream.begin(kBootDescriptor, kBootDescriptorSize);
+        for (const auto& report : rollover) {
+            boot_stream.feed(report, CANETA_REPORT_SIZE);
+            hid_stream.feed(report, CANETA_REPORT_SIZE);
+            if (&report == &rollover[1] && boot_stream.state().modifiers != 0x02) {
+                std::fprintf(stderr, "ErrorRollOver report dropped its modifiers\n");
+                return false;
+            }
+        }
+        const std::string typed = "abcdefZ";
+        if (std::string(boot_out.begin(), boot_out.end()) != typed ||
+            std::string(hid_out.begin(), hid_out.end()) != typed) {
+            std::fprintf(stderr, "ErrorRollOver: typed \"%.*s\", expected \"%s\"\n",
+                         static_cast<int>(boot_out.size()), reinterpret_cast<const char*>(boot_out.data()),
+                         typed.c_str());
+            return false;
+        }
+        return true;
+    }
+
+    namespace {
+
+        // Held keys changing at a point in (virtual) time
+        struct RepeatEvent {
+            uint32_t time;
+            kbd_state_t state;
+        };
+
+        // Repeat output keyed by the time it fired. Keys that fire in the same
+        // millisecond may come out in any order, so each entry is sorted.
+        using RepeatLog = std::map<uint32_t, std::string>;
+
+        void logRepeat(RepeatLog& log, uint32_t time, const uint8_t* data, size_t len) {
+            if (len == 0) return;
+            std::string& entry = log[time];
+            entry.append(reinterpret_cast<const char*>(data), len);
+            std::sort(entry.begin(), entry.end());
+        }
+
+        // Random letters held and released over duration ms, with a share of
+        // keys that produce no output and must never repeat
+        std::vector<RepeatEvent> makeRepeatEvents(uint32_t start, uint32_t duration, uint32_t seed) {
+            std::mt19937 rng(seed);
+            std::vector<RepeatEvent> events;
+            kbd_state_t state = {};
+            for (uint32_t t = 1; t < duration; t += 1 + rng() % 400) {
+                int slot = static_cast<int>(rng() % 6);
+                uint32_t pick = rng() % 32;
+                uint8_t keycode = pick < 26 ? static_cast<uint8_t>(0x04 + pick) : pick < 29 ? 0xE1 : 0;
+                bool present = false;
+                for (uint8_t key : state.last_keys) {
+                    present |= keycode != 0 && key == keycode;
+                }
+                if (!present) state.last_keys[slot] = keycode;
+                events.push_back({start + t, state});
+            }
+            state = kbd_state_t{};
+            events.push_back({start + duration, state});
+            return events;
+        }
+
+        // What a typematic keyboard does: each key that produces output fires
+        // delay ms after it went down, then every interval ms while held
+        RepeatLog referenceRepeat(const std::vector<RepeatEvent>& events, const caneta_repeat_config_t& config,
+                                  uint32_t start, uint32_t end) {
+            RepeatLog log;
+            std::map<uint8_t, uint32_t> next;
+            size_t e = 0;
+            for (uint32_t t = start; t != end; t++) {
+                if (e < events.size() && events[e].time == t) {
+                    const kbd_state_t& state = events[e++].state;
+                    std::map<uint8_t, uint32_t> held;
+                    for (uint8_t key : state.last_keys) {
+                        uint8_t scratch[CANETA_KEY_OUTPUT_MAX];
+                        if (key == 0 || config.interval_ms == 0 || caneta_translate_key(key, 0, scratch) == 0) continue;
+                        auto it = next.find(key);
+                        held[key] = it != next.end() ? it->second : t + std::max<uint32_t>(config.delay_ms, 1);
+                    }
+                    next = held;
+                }
+                for (auto& timer : next) {
+                    if (timer.second == t) {
+                        uint8_t out[CANETA_KEY_OUTPUT_MAX];
+                        logRepeat(log, t, out, caneta_translate_key(timer.first, 0, out));
+                        timer.second += config.interval_ms;
+                    }
+                }
+            }
+            return log;
+        }
+
+        // Runs the engine every millisecond, with an output buffer that only
+        // holds one key so runs have to resume
+        RepeatLog tickRepeat(const std::vector<RepeatEvent>& events, const caneta_repeat_config_t& config,
+                             uint32_t start, uint32_t end) {
+            RepeatLog log;
+            caneta_repeat_t repeat;
+            caneta_repeat_init(&repeat, &config);
+            size_t e = 0;
+            for (uint32_t t = start; t != end; t++) {
+                if (e < events.size() && events[e].time == t) {
+                    caneta_repeat_update(&repeat, &events[e++].state, t);
+                }
+                bool complete;
+                do {
+                    uint8_t out[CANETA_KEY_OUTPUT_MAX];
+                    size_t n = caneta_repeat_run(&repeat, t, out, sizeof(out), &complete);
+                    logRepeat(log, t, out, n);
+                } while (!complete);
+            }
+            return log;
+        }
+
+        // Wakes only for the next report or the next repeat deadline, as a
+        // sleeping host or MCU would
+        RepeatLog sleepRepeat(const std::vector<RepeatEvent>& events, const caneta_repeat_config_t& config,
+                              uint32_t start, uint32_t end) {
+            struct LogSink {
+                RepeatLog* log;
+                uint32_t* now;
+                void write(const uint8_t* data, size_t len) { logRepeat(*log, *now, data, len); }
+            };
+            RepeatLog log;
+            uint32_t now = start;
+            caneta::Repeat<LogSink> repeat(LogSink{&log, &now}, &config);
+            size_t e = 0;
+            while (now != end) {
+                uint32_t wake = e < events.size() ? events[e].time : end;
+                uint32_t deadline;
+                if (repeat.nextDeadline(deadline) && static_cast<int32_t>(deadline - wake) < 0) {
+                    // Everything up to now has run, so a deadline that isn't
+                    // in the future would never be met
+                    if (now != start && static_cast<int32_t>(deadline - now) <= 0) {
+                        std::fprintf(stderr, "repeat deadline %u is not after the clock at %u\n", deadline, now);
+                        return RepeatLog();
+                    }
+                    wake = deadline;
+                }
+                now = wake;
+                if (e < events.size() && events[e].time == now) {
+                    repeat.update(events[e++].state, now);
+                }
+                repeat.run(now);
+            }
+            return log;
+        }
+
+    } // namespace
+
+    bool verifyRepeat() {
+        static const caneta_repeat_config_t kConfigs[] = {
+            {CANETA_REPEAT_DEFAULT_DELAY_MS, CANETA_REPEAT_DEFAULT_INTERVAL_MS},
+            {250, 10},
+            {0, 1},
+            {40, CANETA_REPEAT_WHEEL_SLOTS},
+            {15, 100},
+            {500, 0},
+        };
+        // Start just before the millisecond clock wraps, as well as at boot
+        static const uint32_t kStarts[] = {0, 0xFFFFF000u};
+
+        for (const caneta_repeat_config_t& config : kConfigs) {
+            for (uint32_t start : kStarts) {
+                const uint32_t duration = 20000;
+                std::vector<RepeatEvent> events = makeRepeatEvents(start, duration, config.delay_ms ^ start);
+                uint32_t end = start + duration + 1;
+
+                RepeatLog expected = referenceRepeat(events, config, start, end);
+                RepeatLog ticked = tickRepeat(events, config, start, end);
+                RepeatLog slept = sleepRepeat(events, config, start, end);
+                if (ticked != expected || slept != expected || (config.interval_ms != 0 && expected.empty())) {
+                    std::fprintf(stderr, "repeat delay %u interval %u from %u: engine disagrees with the "
+                                 "reference (%zu, %zu vs %zu repeats)\n", config.delay_ms, config.interval_ms,
+                                 start, ticked.size(), slept.size(), expected.size());
+                    return false;
+                }
+            }
+        }
+
+        // A caller that wakes late gets one repeat per key, and nothing is due after a release
+        caneta_repeat_t repeat;
+        caneta_repeat_init(&repeat, nullptr);
+        kbd_state_t state = {};
+        state.last_keys[0] = 0x04;
+        state.last_keys[1] = 0x52;
+        caneta_repeat_update(&repeat, &state, 100);
+        uint8_t out[64];
+        bool complete;
+        size_t late = caneta_repeat_run(&repeat, 100000, out, sizeof(out), &complete);
+        uint32_t deadline;
+        bool pending = caneta_repeat_next_deadline(&repeat, &deadline);
+        state = kbd_state_t{};
+        caneta_repeat_update(&repeat, &state, 100001);
+        if (late != 1 + 3 || !complete || !pending || deadline != 100000 + CANETA_REPEAT_DEFAULT_INTERVAL_MS ||
+            caneta_repeat_next_deadline(&repeat, &deadline)) {
+            std::fprintf(stderr, "repeat: late or released keys handled wrongly\n");
+            return false;
+        }
+        return true;
+    }
+
+    namespace {
+
+        // Payload of stress record seq: the sequence number, then a pattern
+        // derived from it, with lengths cycling through 4-69 bytes
+        size_t stressLength(uint32_t seq) { return 4 + seq * 7 % 66; }
+
+        void fillStress(uint32_t seq, uint8_t* data) {
+            std::memcpy(data, &seq, sizeof(seq));
+            for (size_t i = 4; i < stressLength(seq); i++) {
+                data[i] = static_cast<uint8_t>(seq + i);
+            }
+        }
+
+        // A record as posted by the USB host side
+        struct HostRecord {
+            uint8_t kind;
+            uint8_t dev_addr;
+            uint8_t instance;
+            std::vector<uint8_t> data;
+        };
+
+        bool postRecord(caneta_ring_t* ring, const HostRecord& record) {
+            switch (record.kind) {
+                case CANETA_HOST_MOUNT:
+                    return caneta_host_post_mount(ring, record.dev_addr, record.instance,
+                                                  record.data.data(), record.data.size());
+                case CANETA_HOST_UNMOUNT:
+                    return caneta_host_post_unmount(ring, record.dev_addr);
+                default:
+                    return caneta_host_post_report(ring, record.dev_addr, record.instance,
+                                                   record.data.data(), record.data.size());
+            }
+        }
+
+    } // namespace
+
+    bool verifyRing(const std::vector<Workload>& workloads) {
+        // Integrity: every record that was accepted comes out intact and in
+        // order, and every push that wasn't is counted. The consumer stalls
+        // now and then so the ring fills and wraps at every offset; the
+        // producer retries most refused records and drops the rest.
+        static caneta_ring_t ring;
+        caneta_ring_init(&ring);
+        const uint32_t records = 1000000;
+        uint32_t refused = 0;
+        uint32_t dropped = 0;
+        uint32_t too_long = 0;
+        std::atomic<bool> produced{false};
+
+        std::thread producer([&]() {
+            uint8_t data[CANETA_RING_DATA_MAX + 1] = {};
+            for (uint32_t seq = 0; seq < records; seq++) {
+                size_t len = seq % 10007 == 0 ? sizeof(data) : stressLength(seq);
+                fillStress(seq, data);
+                while (!caneta_ring_push(&ring, static_cast<uint8_t>(1 + seq % 3), static_cast<uint8_t>(seq),
+                                         static_cast<uint8_t>(seq >> 8), data, len)) {
+                    if (len > CANETA_RING_DATA_MAX) {
+                        too_long++;
+                        break;
+                    }
+                    refused++;
+                    if (seq % 16 == 0) {
+                        dropped++;
+                        break;
+                    }
+                    std::this_thread::yield();
+                }
+            }
+            produced = true;
+        });
+
+        uint32_t received = 0;
+        int64_t last = -1;
+        bool intact = true;
+        for (;;) {
+            const caneta_ring_record_t* record = caneta_ring_peek(&ring);
+            if (!record) {
+                if (produced && !caneta_ring_peek(&ring)) break;
+                std::this_thread::yield();
+                continue;
+            }
+
+            uint32_t seq;
+            std::memcpy(&seq, caneta_ring_data(record), sizeof(seq));
+            uint8_t expected[CANETA_RING_DATA_MAX + 1];
+            fillStress(seq, expected);
+            if (static_cast<int64_t>(seq) <= last || record->len != stressLength(seq) ||
+                record->kind != 1 + seq % 3 || record->dev_addr != static_cast<uint8_t>(seq) ||
+                record->instance != static_cast<uint8_t>(seq >> 8) ||
+                std::memcmp(caneta_ring_data(record), expected, record->len) != 0) {
+                intact = false;
+                break;
+            }
+            last = seq;
+            caneta_ring_release(&ring);
+            received++;
+
+            if (received % 4096 == 0) {
+                std::this_thread::sleep_for(std::chrono::microseconds(50));
+            }
+        }
+        producer.join();
+
+        if (!intact || refused != caneta_ring_overflows(&ring) || too_long != caneta_ring_oversize(&ring) ||
+            too_long == 0 || received + dropped + too_long != records) {
+            std::fprintf(stderr, "report ring: record %lld corrupt or drops miscounted (%u/%u full, %u/%u "
+                         "oversize)\n", static_cast<long long>(last + 1), refused, caneta_ring_overflows(&ring),
+                         too_long, caneta_ring_oversize(&ring));
+            return false;
+        }
+        std::fprintf(stderr, "report ring passed %u of %u records intact (%u pushes refused, %u dropped)\n",
+                     received, records, refused, dropped);
+
+        // Pipeline: a boot keyboard and an NKRO keyboard interleaved, with a
+        // replug halfway, decoded on a consumer thread
+        struct VectorSink {
+            std::vector<uint8_t>* bytes;
+            void write(const uint8_t* data, size_t len) { bytes->insert(bytes->end(), data, data + len); }
+        };
+
+        const Workload& workload = workloads.front();
+        const size_t count = workload.report_count();
+        std::vector<uint8_t> nkro_reports = makeNkroReports(workload);
+        std::vector<uint8_t> expected;
+        caneta::HidStream<VectorSink> boot_keyboard(VectorSink{&expected});
+        caneta::HidStream<VectorSink> nkro_keyboard(VectorSink{&expected});
+
+        std::vector<HostRecord> posted;
+        auto mount = [&](uint8_t dev_addr, const uint8_t* desc, size_t desc_len) {
+            posted.push_back({CANETA_HOST_MOUNT, dev_addr, 0, std::vector<uint8_t>(desc, desc + desc_len)});
+        };
+        mount(1, kBootDescriptor, kBootDescriptorSize);
+        mount(2, kNkroDescriptor, kNkroDescriptorSize);
+        boot_keyboard.begin(kBootDescriptor, kBootDescriptorSize);
+        nkro_keyboard.begin(kNkroDescriptor, kNkroDescriptorSize);
+        for (size_t i = 0; i < count; i++) {
+            if (i == count / 2) {
+                posted.push_back({CANETA_HOST_UNMOUNT, 2, 0, {}});
+                mount(2, kNkroDescriptor, kNkroDescriptorSize);
+                nkro_keyboard.begin(kNkroDescriptor, kNkroDescriptorSize);
+            }
+            const uint8_t* boot = workload.report(i);
+            const uint8_t* nkro = &nkro_reports[(count - 1 - i) * kNkroReportSize];
+            posted.push_back({CANETA_HOST_REPORT, 1, 0, std::vector<uint8_t>(boot, boot + CANETA_REPORT_SIZE)});
+            posted.push_back({CANETA_HOST_REPORT, 2, 0, std::vector<uint8_t>(nkro, nkro + kNkroReportSize)});
+            boot_keyboard.feed(boot, CANETA_REPORT_SIZE);
+            nkro_keyboard.feed(nkro, kNkroReportSize);
+        }
+
+        static caneta_host_t host;
+        caneta_host_init(&host, nullptr);
+        caneta_ring_init(&ring);
+        std::vector<uint8_t> output;
+        VectorSink output_sink{&output};
+        caneta_sink_t sink = {[](void* ctx, const uint8_t* data, size_t len) {
+            static_cast<VectorSink*>(ctx)->write(data, len);
+        }, &output_sink};
+
+        // The producer retries instead of dropping, so the output must be complete
+        std::thread usb_host([&]() {
+            for (const HostRecord& record : posted) {
+                while (!postRecord(&ring, record)) {
+                    std::this_thread::yield();
+                }
+            }
+        });
+        size_t handled = 0;
+        while (handled < posted.size()) {
+            handled += caneta_host_drain(&host, &ring, 0, &sink);
+        }
+        usb_host.join();
+
+        if (output != expected) {
+            std::fprintf(stderr, "host pipeline output disagrees with direct decoding (%zu vs %zu bytes)\n",
+                         output.size(), expected.size());
+            return false;
+        }
+        return true;
+    }
+
+    namespace {
+
+        // A UART at 115200 baud with 8N1 framing, as seen by a drain that
+        // hands it at most a DMA transfer's worth of contiguous bytes at a time
+        struct SimulatedUart {
+            static constexpr uint32_t kBitsPerSecond = 115200;
+            static constexpr uint32_t kBitsPerByte = 10;
+
+            uint64_t bit_budget = 0;
+            std::vector<uint8_t> wire;
+
+            // Advance the clock by us microseconds and send what the line allows
+            void run(caneta_tx_t* tx, uint32_t us) {
+                bit_budget += static_cast<uint64_t>(us) * kBitsPerSecond / 1000000;
+                for (;;) {
+                    const uint8_t* data;
+                    size_t len = caneta_tx_peek(tx, &data);
+                    size_t affordable = static_cast<size_t>(bit_budget / kBitsPerByte);
+                    if (len == 0 || affordable == 0) break;
+                    if (len > affordable) len = affordable;
+                    wire.insert(wire.end(), data, data + len);
+                    caneta_tx_consume(tx, len);
+                    bit_budget -= len * kBitsPerByte;
+                }
+            }
+        };
+
+    } // namespace
+
+    bool verifyTx(const std::vector<Workload>& workloads) {
+        static caneta_tx_t tx;
+
+        // Drop policy: self-describing sequences (length, 16-bit id, pattern)
+        // offered faster than the line drains. Whatever reaches the wire must
+        // be whole sequences, in order, and the rest must be counted.
+        caneta_tx_init(&tx);
+        SimulatedUart uart;
+        const uint32_t sequences = 200000;
+        uint32_t refused = 0;
+        for (uint32_t id = 0; id < sequences; id++) {
+            uint8_t seq[3 + 40];
+            size_t len = 3 + id * 13 % 41;
+            seq[0] = static_cast<uint8_t>(len);
+            seq[1] = static_cast<uint8_t>(id);
+            seq[2] = static_cast<uint8_t>(id >> 8);
+            for (size_t i = 3; i < len; i++) {
+                seq[i] = static_cast<uint8_t>(id * 7 + i);
+            }
+            if (!caneta_tx_write(&tx, seq, len)) refused++;
+
+            // Bursts of output with quiet gaps, so the ring fills and empties
+            uart.run(&tx, id % 64 < 48 ? 200 : 3000);
+        }
+        uart.run(&tx, 1000000);
+
+        uint32_t delivered = 0;
+        uint32_t next_id = 0;
+        bool whole = true;
+        for (size_t at = 0; at < uart.wire.size() && whole;) {
+            size_t len = uart.wire[at];
+            if (len < 3 || at + len > uart.wire.size()) {
+                whole = false;
+                break;
+            }
+            uint32_t low = uart.wire[at + 1] | static_cast<uint32_t>(uart.wire[at + 2]) << 8;
+            uint32_t id = next_id + ((low - next_id) & 0xFFFF);
+            whole = len == 3 + id * 13 % 41;
+            for (size_t i = 3; i < len && whole; i++) {
+                whole = uart.wire[at + i] == static_cast<uint8_t>(id * 7 + i);
+            }
+            next_id = id + 1;
+            delivered++;
+            at += len;
+        }
+        if (!whole || delivered + refused != sequences || refused != caneta_tx_dropped(&tx) || refused == 0) {
+            std::fprintf(stderr, "uart ring: partial or miscounted sequences (%u delivered, %u dropped, %u counted)\n",
+                         delivered, refused, caneta_tx_dropped(&tx));
+            return false;
+        }
+
+        // Backpressure: a writer that waits for room gets every byte of the
+        // workload's terminal output onto the wire, in order
+        for (const Workload& workload : workloads) {
+            std::vector<uint8_t> expected;
+            caneta_tx_init(&tx);
+            SimulatedUart line;
+            caneta_decoder_t decoder;
+            caneta_decoder_init(&decoder);
+            for (size_t i = 0; i < workload.report_count(); i++) {
+                uint8_t out[CANETA_REPORT_OUTPUT_MAX];
+                size_t n = caneta_decoder_feed(&decoder, workload.report(i), CANETA_REPORT_SIZE, out);
+                expected.insert(expected.end(), out, out + n);
+                while (!caneta_tx_try_write(&tx, out, n)) {
+                    line.run(&tx, 100);
+                }
+                line.run(&tx, workload.times_us[i]);
+            }
+            line.run(&tx, 10000000);
+            if (line.wire != expected || caneta_tx_dropped(&tx) != 0) {
+                std::fprintf(stderr, "%s: uart ring with backpressure lost output (%zu vs %zu bytes)\n",
+                             workload.name.c_str(), line.wire.size(), expected.size());
+                return false;
+            }
+        }
+        std::fprintf(stderr, "uart ring delivered %u of %u sequences whole at 115200 baud, dropped the rest\n",
+                     delivered, sequences);
+        return true;
+    }
+
+    namespace {
+
+        // The firmware's CDC path on a virtual clock: terminal output queued
+        // in a transmit ring, core 0's cdc_task moving what the batcher says is
+        // ready into TinyUSB's TX FIFO, and a full-speed host taking up to 19
+        // bulk packets per 1 ms frame once stalled_until has passed
+        class SimulatedCdc {
+            public:
+                static constexpr size_t kFifoSize = 1024;
+                static constexpr uint32_t kPacketsPerFrame = 19;
+                static constexpr uint32_t kStepUs = 10;
+
+                uint32_t now = 0;
+                std::vector<uint8_t> wire;
+                size_t packets = 0;
+                size_t short_packets = 0;
+                size_t flushes = 0;
+                uint32_t worst_wait_us = 0;
+                uint32_t stalled_until = 0;
+
+                explicit SimulatedCdc(size_t fifo_size = kFifoSize) : fifo_size(fifo_size) {
+                    caneta_tx_init(&tx);
+                    caneta_batch_init(&batch, nullptr);
+                }
+
+                // Queue a sequence, running the clock while the ring is full
+                void write(const uint8_t* data, size_t len) {
+                    while (!caneta_tx_try_write(&tx, data, len)) {
+                        step();
+                    }
+                    for (size_t i = 0; i < len; i++) {
+                        queued_at.push_back(now);
+                    }
+                }
+
+                void run(uint32_t us) {
+                    for (uint32_t end = now + us; static_cast<int32_t>(end - now) > 0;) {
+                        step();
+                    }
+                }
+
+                bool idle() const { return caneta_tx_queued(&tx) == 0 && fifo.empty(); }
+
+            private:
+                caneta_tx_t tx;
+                caneta_batch_t batch;
+                size_t fifo_size;
+                std::deque<uint8_t> fifo;
+                std::deque<uint32_t> queued_at;
+                bool flush_pending = false;
+
+                void step() {
+                    now += kStepUs;
+                    cdcTask();
+                    if (now % 1000 == 0) frame();
+                }
+
+                void cdcTask() {
+                    size_t queued = caneta_tx_queued(&tx);
+                    uint32_t deadline;
+                    bool flushing = caneta_batch_next_deadline(&batch, &deadline) &&
+                                    static_cast<int32_t>(now - deadline) >= 0;
+                    size_t send = caneta_batch_ready_within(&batch, queued, fifo_size - fifo.size(), now);
+                    if (send == 0) return;
+                    if (flushing && send % SimulatedCdc::packetSize() != 0) {
+                        flushes++;
+                        flush_pending = true;
+                    }
+
+                    while (send > 0) {
+                        const uint8_t* data;
+                        size_t len = std::min(caneta_tx_peek(&tx, &data), send);
+                        fifo.insert(fifo.end(), data, data + len);
+                        caneta_tx_consume(&tx, len);
+                        send -= len;
+                        for (size_t i = 0; i < len; i++) {
+                            worst_wait_us = std::max(worst_wait_us, now - queued_at.front());
+                            queued_at.pop_front();
+                        }
+                    }
+                }
+
+                // Each transfer takes a full packet, or whatever is left once flushed
+                void frame() {
+                    if (static_cast<int32_t>(now - stalled_until) < 0) return;
+                    for (uint32_t p = 0; p < kPacketsPerFrame && !fifo.empty(); p++) {
+                        size_t len = std::min(fifo.size(), packetSize());
+                        if (len < packetSize() && !flush_pending) break;
+                        wire.insert(wire.end(), fifo.begin(), fifo.begin() + len);
+                        fifo.erase(fifo.begin(), fifo.begin() + len);
+                        packets++;
+                        if (len < packetSize()) {
+                            short_packets++;
+                            flush_pending = false;
+                        }
+                    }
+                }
+
+                static size_t packetSize() { return CANETA_BATCH_DEFAULT_PACKET; }
+        };
+
+    } // namespace
+
+    bool verifyBatch(const std::vector<Workload>& workloads) {
+        // Keyboard workloads at their own pace: every byte arrives, short
+        // packets only follow a flush, and no byte waits past the timeout
+        for (const Workload& workload : workloads) {
+            SimulatedCdc cdc;
+            std::vector<uint8_t> expected;
+            caneta_decoder_t decoder;
+            caneta_decoder_init(&decoder);
+            for (size_t i = 0; i < workload.report_count(); i++) {
+                cdc.run(workload.times_us[i]);
+                uint8_t out[CANETA_REPORT_OUTPUT_MAX];
+                size_t n = caneta_decoder_feed(&decoder, workload.report(i), CANETA_REPORT_SIZE, out);
+                expected.insert(expected.end(), out, out + n);
+                cdc.write(out, n);
+            }
+            while (!cdc.idle()) {
+                cdc.run(1000);
+            }
+
+            if (cdc.wire != expected || cdc.short_packets > cdc.flushes ||
+                cdc.worst_wait_us > CANETA_BATCH_DEFAULT_FLUSH_US + SimulatedCdc::kStepUs) {
+                std::fprintf(stderr, "%s: CDC batching lost bytes or held them too long (%zu vs %zu bytes, "
+                             "%zu short packets for %zu flushes, worst wait %u us)\n", workload.name.c_str(),
+                             cdc.wire.size(), expected.size(), cdc.short_packets, cdc.flushes, cdc.worst_wait_us);
+                return false;
+            }
+        }
+
+        // A flush that finds the FIFO nearly full sends what fits; the rest
+        // keeps its deadline and goes as soon as the host drains the FIFO,
+        // rather than waiting out another flush timeout
+        {
+            SimulatedCdc cdc(1000);
+            cdc.stalled_until = 2000;
+            cdc.run(500);
+            std::vector<uint8_t> text(1100);
+            for (size_t i = 0; i < text.size(); i++) {
+                text[i] = static_cast<uint8_t>('a' + i % 26);
+            }
+            uint32_t start = cdc.now;
+            for (size_t at = 0; at < text.size(); at += CANETA_STREAM_CHUNK) {
+                cdc.write(&text[at], std::min<size_t>(CANETA_STREAM_CHUNK, text.size() - at));
+            }
+            while (!cdc.idle()) {
+                cdc.run(1000);
+            }
+            uint32_t bound = cdc.stalled_until - start + SimulatedCdc::kStepUs;
+            if (cdc.wire != text || cdc.worst_wait_us > bound) {
+                std::fprintf(stderr, "CDC with a nearly full FIFO: %zu of %zu bytes, worst wait %u us (bound %u us)\n",
+                             cdc.wire.size(), text.size(), cdc.worst_wait_us, bound);
+                return false;
+            }
+        }
+
+        // A macro burst far larger than every buffer goes out in full packets
+        // at USB speed
+        SimulatedCdc cdc;
+        std::vector<uint8_t> burst(256 * 1024);
+        for (size_t i = 0; i < burst.size(); i++) {
+            burst[i] = static_cast<uint8_t>(' ' + i % 95);
+        }
+        uint32_t start = cdc.now;
+        for (size_t at = 0; at < burst.size(); at += CANETA_STREAM_CHUNK) {
+            cdc.write(&burst[at], std::min<size_t>(CANETA_STREAM_CHUNK, burst.size() - at));
+        }
+        while (!cdc.idle()) {
+            cdc.run(1000);
+        }
+        double cdc_seconds = (cdc.now - start) / 1e6;
+        double uart_seconds = burst.size() * 10 / 115200.0;
+        if (cdc.wire != burst || cdc.short_packets > 1 || uart_seconds / cdc_seconds < 50) {
+            std::fprintf(stderr, "CDC burst: %zu bytes in %.3f s with %zu short packets\n", cdc.wire.size(),
+                         cdc_seconds, cdc.short_packets);
+            return false;
+        }
+        std::fprintf(stderr, "CDC batching sends a %zu KiB burst %.0fx faster than the 115200 baud UART\n",
+                     burst.size() / 1024, uart_seconds / cdc_seconds);
+        return true;
+    }
+
+    namespace {
+
+        using BleAddr = std::array<uint8_t, CANETA_BLE_ADDR_LEN>;
+
+        BleAddr randomAddr(std::mt19937& rng) {
+            BleAddr addr;
+            for (uint8_t& byte : addr) {
+                byte = static_cast<uint8_t>(rng());
+            }
+            return addr;
+        }
+
+        caneta_peer_t makePeer(const BleAddr& addr, uint8_t type) {
+            caneta_peer_t peer;
+            std::memcpy(peer.addr, addr.data(), CANETA_BLE_ADDR_LEN);
+            peer.addr_type = type;
+            return peer;
+        }
+
+        // A bonded keyboard drops its link at time 0 and starts fast
+        // reconnect advertising wake_ms later, among other advertisers. Time
+        // is in milliseconds.
+        struct SimulatedBle {
+            static constexpr uint32_t kKeyboardAdvertMs = 30;
+            static constexpr uint32_t kOtherAdvertMs = 100;
+            static constexpr uint32_t kConnectMs = 15;   // Connection setup once the advert is heard
+            static constexpr uint32_t kLogMs = 7;        // One Serial.printf of an advertisement at 115200 baud
+            static constexpr uint32_t kLoopMs = 10;      // The example sketch's loop(), which runs update()
+
+            BleAddr keyboard;
+            uint32_t wake_ms;
+            std::vector<BleAddr> others;
+            std::vector<uint32_t> phases;
+
+            // First keyboard advertisement at or after t
+            uint32_t keyboardAdvert(uint32_t t) const {
+                if (t <= wake_ms) return wake_ms;
+                return wake_ms + (t - wake_ms + kKeyboardAdvertMs - 1) / kKeyboardAdvertMs * kKeyboardAdvertMs;
+            }
+
+            // First advertisement of other device i at or after t
+            uint32_t otherAdvert(size_t i, uint32_t t) const {
+                uint32_t phase = phases[i];
+                if (t <= phase) return phase;
+                return phase + (t - phase + kOtherAdvertMs - 1) / kOtherAdvertMs * kOtherAdvertMs;
+            }
+
+            // Connecting: the connect request can only answer an advertisement
+            // heard while initiating, so a connect started at t waits for the
+            // keyboard's next one. A direct connect to a bonded address
+            // initiates at once; a scan has already spent the advertisement it
+            // heard, and connects on the one after.
+            uint32_t initiate(uint32_t t) const {
+                return keyboardAdvert(t) + kConnectMs;
+            }
+
+            // The original policy: delay(1000) in the disconnect callback, then
+            // a scan that logs every device the controller reports (once each)
+            // and connects to the first HID device from the scan callback
+            uint32_t originalReconnect() const {
+                uint32_t start = 1000;
+                uint32_t found = keyboardAdvert(start);
+                uint32_t busy = start;
+                std::vector<uint32_t> heard;
+                for (size_t i = 0; i < others.size(); i++) {
+                    uint32_t t = otherAdvert(i, start);
+                    if (t < found) heard.push_back(t);
+                }
+                std::sort(heard.begin(), heard.end());
+                for (uint32_t t : heard) {
+                    busy = std::max(busy, t) + kLogMs;
+                }
+                // The keyboard's own line, then "Found HID keyboard!"
+                return initiate(std::max(busy, found) + 2 * kLogMs);
+            }
+
+            // caneta_reconnect driving the radio. Every advertisement reaches
+            // the filter, as if the controller filtered no duplicates.
+            uint32_t plannedReconnect(const caneta_bonds_t* bonds, size_t* filtered, size_t* duplicates) const {
+                caneta_reconnect_t plan;
+                caneta_reconnect_init(&plan, nullptr);
+                caneta_scan_filter_t filter;
+                caneta_scan_filter_init(&filter, bonds, false);
+
+                uint32_t now = 0;
+                caneta_reconnect_action_t action;
+                while (caneta_reconnect_next(&plan, bonds, now, &action)) {
+                    switch (action.op) {
+                        case CANETA_RECONNECT_WAIT:
+                            now = action.deadline_ms;
+                            break;
+                        case CANETA_RECONNECT_CONNECT:
+                            if (std::memcmp(action.peer.addr, keyboard.data(), CANETA_BLE_ADDR_LEN) == 0 &&
+                                keyboardAdvert(now) - now <= action.timeout_ms) {
+                                return initiate(now);
+                            }
+                            now += action.timeout_ms;
+                            break;
+                        case CANETA_RECONNECT_SCAN: {
+                            caneta_scan_filter_reset(&filter);
+                            uint32_t end = now + action.timeout_ms;
+                            uint32_t found = keyboardAdvert(now);
+                            for (uint32_t t = now; t < std::min(found, end); t += kOtherAdvertMs) {
+                                for (size_t i = 0; i < others.size(); i++) {
+                                    uint32_t advert = otherAdvert(i, t);
+                                    if (advert >= std::min(found, end)) continue;
+                                    caneta_scan_verdict_t verdict = caneta_scan_filter_check(&filter, others[i].data(), false);
+                                    if (verdict == CANETA_SCAN_CONNECT) return UINT32_MAX;
+                                    (*filtered)++;
+                                    if (verdict == CANETA_SCAN_DUPLICATE) (*duplicates)++;
+                                }
+                            }
+                            if (found < end &&
+                                caneta_scan_filter_check(&filter, keyboard.data(), true) == CANETA_SCAN_CONNECT) {
+                                // onResult hands it to update(), which stops the scan
+                                return initiate(found + kLoopMs);
+                            }
+                            now = end;
+                            break;
+                        }
+                    }
+                }
+                return UINT32_MAX;
+            }
+        };
+
+        uint32_t percentile(std::vector<uint32_t> values, size_t pct) {
+            std::sort(values.begin(), values.end());
+            return values[values.size() * pct / 100];
+        }
+
+    } // namespace
+
+    bool verifyReconnect() {
+        std::mt19937 rng(14);
+
+        // Bond cache against a most-recent-first list, saved and reloaded at
+        // every step
+        {
+            std::vector<BleAddr> pool;
+            for (int i = 0; i < 7; i++) {
+                pool.push_back(randomAddr(rng));
+            }
+            caneta_bonds_t bonds;
+            caneta_bonds_init(&bonds);
+            std::deque<std::pair<BleAddr, uint8_t>> model;
+            for (int step = 0; step < 20000; step++) {
+                const BleAddr& addr = pool[rng() % pool.size()];
+                auto known = std::find_if(model.begin(), model.end(), [&](const auto& entry) { return entry.first == addr; });
+                if (rng() % 4 == 0) {
+                    bool forgot = caneta_bonds_forget(&bonds, addr.data());
+                    if (forgot != (known != model.end())) return false;
+                    if (known != model.end()) model.erase(known);
+                } else {
+                    uint8_t type = static_cast<uint8_t>(rng() % 2);
+                    caneta_peer_t peer = makePeer(addr, type);
+                    bool changed = caneta_bonds_touch(&bonds, &peer);
+                    bool expected_change = !(known == model.begin() && known != model.end() && known->second == type);
+                    if (known != model.end()) model.erase(known);
+                    model.emplace_front(addr, type);
+                    if (model.size() > CANETA_BONDS_MAX) model.pop_back();
+                    if (changed != expected_change) {
+                        std::fprintf(stderr, "caneta_bonds_touch reported the wrong change at step %d\n", step);
+                        return false;
+                    }
+                }
+
+                uint8_t blob[CANETA_BONDS_BLOB_SIZE];
+                caneta_bonds_t loaded;
+                if (caneta_bonds_save(&bonds, blob, sizeof(blob)) != sizeof(blob) ||
+                    !caneta_bonds_load(&loaded, blob, sizeof(blob)) || loaded.count != model.size()) {
+                    std::fprintf(stderr, "bond cache save/load failed at step %d\n", step);
+                    return false;
+                }
+                for (size_t i = 0; i < model.size(); i++) {
+                    if (std::memcmp(loaded.peers[i].addr, model[i].first.data(), CANETA_BLE_ADDR_LEN) != 0 ||
+                        loaded.peers[i].addr_type != model[i].second) {
+                        std::fprintf(stderr, "bond cache order differs from most-recent-first at step %d\n", step);
+                        return false;
+                    }
+                }
+
+                // Any single flipped bit or lost byte is refused, leaving no bonds
+                size_t at = rng() % sizeof(blob);
+                blob[at] ^= static_cast<uint8_t>(1u << rng() % 8);
+                if (caneta_bonds_load(&loaded, blob, sizeof(blob)) || loaded.count != 0 ||
+                    caneta_bonds_load(&loaded, blob, sizeof(blob) - 1)) {
+                    std::fprintf(stderr, "corrupt bond cache blob accepted at step %d\n", step);
+                    return false;
+                }
+            }
+        }
+
+        // Scan filter: bonded keyboards always connect, even without the HID
+        // UUID; other HID devices connect unless bonded_only; everything else
+        // never does, and a lone repeat advertiser is a duplicate
+        {
+            caneta_bonds_t bonds;
+            caneta_bonds_init(&bonds);
+            BleAddr bonded = randomAddr(rng);
+            caneta_peer_t peer = makePeer(bonded, 0);
+            caneta_bonds_touch(&bonds, &peer);
+            BleAddr hid = randomAddr(rng);
+
+            for (bool bonded_only : {false, true}) {
+                caneta_scan_filter_t filter;
+                caneta_scan_filter_init(&filter, &bonds, bonded_only);
+                std::vector<BleAddr> others;
+                for (int i = 0; i < 200; i++) {
+                    others.push_back(randomAddr(rng));
+                }
+                for (int round = 0; round < 20; round++) {
+                    for (const BleAddr& addr : others) {
+                        if (caneta_scan_filter_check(&filter, addr.data(), false) == CANETA_SCAN_CONNECT) return false;
+                    }
+                    if (caneta_scan_filter_check(&filter, bonded.data(), round % 2) != CANETA_SCAN_CONNECT ||
+                        (caneta_scan_filter_check(&filter, hid.data(), true) == CANETA_SCAN_CONNECT) == bonded_only) {
+                        std::fprintf(stderr, "scan filter turned down a keyboard (bonded_only %d)\n", bonded_only);
+                        return false;
+                    }
+                }
+
+                caneta_scan_filter_reset(&filter);
+                if (caneta_scan_filter_check(&filter, others[0].data(), false) != CANETA_SCAN_IGNORE ||
+                    caneta_scan_filter_check(&filter, others[0].data(), false) != CANETA_SCAN_DUPLICATE) {
+                    std::fprintf(stderr, "scan filter did not suppress a repeat advertisement\n");
+                    return false;
+                }
+            }
+        }
+
+        // The plan: bonded keyboards most recent first, a scan, a pause, and
+        // round again, across the millisecond clock wrapping
+        {
+            caneta_bonds_t bonds;
+            caneta_bonds_init(&bonds);
+            std::vector<BleAddr> addrs;
+            for (int i = 0; i < 3; i++) {
+                addrs.push_back(randomAddr(rng));
+                caneta_peer_t peer = makePeer(addrs.back(), 1);
+                caneta_bonds_touch(&bonds, &peer);
+            }
+            caneta_reconnect_t plan;
+            caneta_reconnect_init(&plan, nullptr);
+            caneta_reconnect_action_t action;
+            uint32_t now = 0xFFFFFF00u;
+            for (int round = 0; round < 3; round++) {
+                for (int i = 2; i >= 0; i--) {
+                    if (!caneta_reconnect_next(&plan, &bonds, now, &action) || action.op != CANETA_RECONNECT_CONNECT ||
+                        std::memcmp(action.peer.addr, addrs[i].data(), CANETA_BLE_ADDR_LEN) != 0 ||
+                        action.timeout_ms != CANETA_RECONNECT_DEFAULT_DIRECT_MS) {
+                        std::fprintf(stderr, "reconnect plan skipped bonded keyboard %d in round %d\n", i, round);
+                        return false;
+                    }
+                    now += action.timeout_ms;
+                }
+                if (!caneta_reconnect_next(&plan, &bonds, now, &action) || action.op != CANETA_RECONNECT_SCAN) return false;
+                now += action.timeout_ms;
+                if (!caneta_reconnect_next(&plan, &bonds, now, &action) || action.op != CANETA_RECONNECT_WAIT ||
+                    action.deadline_ms != now + CANETA_RECONNECT_DEFAULT_RETRY_MS) {
+                    std::fprintf(stderr, "reconnect plan did not pause after a scan in round %d\n", round);
+                    return false;
+                }
+                now = action.deadline_ms - 1;
+                if (!caneta_reconnect_next(&plan, &bonds, now, &action) || action.op != CANETA_RECONNECT_WAIT) return false;
+                now++;
+            }
+            caneta_reconnect_connected(&plan);
+            if (caneta_reconnect_next(&plan, &bonds, now, &action)) return false;
+            caneta_reconnect_lost(&plan);
+            if (!caneta_reconnect_next(&plan, &bonds, now, &action) || action.op != CANETA_RECONNECT_CONNECT ||
+                std::memcmp(action.peer.addr, addrs[2].data(), CANETA_BLE_ADDR_LEN) != 0) {
+                return false;
+            }
+        }
+
+        // Reconnect latency after a drop: most keyboards are back within a few
+        // hundred milliseconds, some sleep for seconds. Against the original
+        // delay-then-scan policy, with and without a bond.
+        std::vector<uint32_t> original, direct, first_pairing;
+        size_t filtered = 0;
+        size_t duplicates = 0;
+        for (int trial = 0; trial < 2000; trial++) {
+            SimulatedBle ble;
+            ble.keyboard = randomAddr(rng);
+            ble.wake_ms = rng() % 5 == 0 ? 1000 + rng() % 7000 : 30 + rng() % 370;
+            for (int i = 0; i < 40; i++) {
+                ble.others.push_back(randomAddr(rng));
+                ble.phases.push_back(rng() % SimulatedBle::kOtherAdvertMs);
+            }
+
+            caneta_bonds_t bonds;
+            caneta_bonds_init(&bonds);
+            uint32_t unbonded = ble.plannedReconnect(&bonds, &filtered, &duplicates);
+            caneta_peer_t peer = makePeer(ble.keyboard, 0);
+            caneta_bonds_touch(&bonds, &peer);
+            uint32_t bonded = ble.plannedReconnect(&bonds, &filtered, &duplicates);
+            uint32_t before = ble.originalReconnect();
+
+            // Never slower than the original or than scanning, and a keyboard
+            // that wakes within the direct attempt is reached on its first
+            // advertisement, sooner than a scan can
+            if (bonded > before || unbonded > before || bonded > unbonded ||
+                (ble.wake_ms <= CANETA_RECONNECT_DEFAULT_DIRECT_MS &&
+                 (bonded != ble.initiate(0) || bonded >= unbonded))) {
+                std::fprintf(stderr, "reconnect after waking at %u ms: %u ms bonded, %u ms unbonded, %u ms before\n",
+                             ble.wake_ms, bonded, unbonded, before);
+                return false;
+            }
+            original.push_back(before);
+            direct.push_back(bonded);
+            first_pairing.push_back(unbonded);
+        }
+        if (percentile(direct, 50) * 3 > percentile(original, 50) ||
+            percentile(direct, 50) >= percentile(first_pairing, 50) || duplicates * 2 < filtered) {
+            std::fprintf(stderr, "BLE reconnect p50 %u ms against %u ms scanning, %u ms before; "
+                         "%zu of %zu adverts were duplicates\n", percentile(direct, 50),
+                         percentile(first_pairing, 50), percentile(original, 50), duplicates, filtered);
+            return false;
+        }
+        std::fprintf(stderr, "BLE reconnect p50/p99: %u/%u ms bonded, %u/%u ms scanning, %u/%u ms before\n",
+                     percentile(direct, 50), percentile(direct, 99), percentile(first_pairing, 50),
+                     percentile(first_pairing, 99), percentile(original, 50), percentile(original, 99));
+        return true;
+    }
+
+    bool verifyGatt(const std::vector<Workload>& workloads) {
+        std::mt19937 rng(15);
+
+        // Routing table against a map, filled in random order, saved and
+        // reloaded, with lookups of every handle nearby
+        for (int trial = 0; trial < 2000; trial++) {
+            caneta_gatt_layout_t layout;
+            caneta_gatt_layout_init(&layout);
+            std::map<uint16_t, std::pair<uint16_t, uint8_t>> model;
+            int attempts = static_cast<int>(rng() % (CANETA_GATT_REPORTS_MAX + 4));
+            for (int i = 0; i < attempts; i++) {
+                uint16_t handle = static_cast<uint16_t>(1 + rng() % 40);
+                uint16_t cccd = static_cast<uint16_t>(handle + 1);
+                uint8_t id = static_cast<uint8_t>(rng() % 8);
+                bool expected = model.size() < CANETA_GATT_REPORTS_MAX && model.count(handle) == 0;
+                if (caneta_gatt_layout_add(&layout, handle, cccd, id) != expected) {
+                    std::fprintf(stderr, "caneta_gatt_layout_add accepted the wrong report in trial %d\n", trial);
+                    return false;
+                }
+                if (expected) model[handle] = {cccd, id};
+            }
+            std::vector<uint8_t> map(rng() % 64);
+            for (uint8_t& byte : map) {
+                byte = static_cast<uint8_t>(rng());
+            }
+            caneta_gatt_layout_set_map(&layout, map.data(), map.size());
+
+            uint8_t blob[CANETA_GATT_BLOB_MAX];
+            size_t len = caneta_gatt_layout_save(&layout, blob, sizeof(blob));
+            caneta_gatt_layout_t loaded;
+            if (len == 0 || !caneta_gatt_layout_load(&loaded, blob, len) || loaded.map_len != map.size() ||
+                !std::equal(map.begin(), map.end(), loaded.map)) {
+                std::fprintf(stderr, "GATT layout save/load failed in trial %d\n", trial);
+                return false;
+            }
+            for (const caneta_gatt_layout_t* table : {&layout, &loaded}) {
+                for (uint16_t handle = 0; handle < 48; handle++) {
+                    const caneta_gatt_report_t* route = caneta_gatt_layout_route(table, handle);
+                    auto known = model.find(handle);
+                    if ((route != nullptr) != (known != model.end()) ||
+                        (route && (route->cccd_handle != known->second.first || route->report_id != known->second.second))) {
+                        std::fprintf(stderr, "GATT layout routed handle %u wrongly in trial %d\n", handle, trial);
+                        return false;
+                    }
+                }
+            }
+
+            // Any single flipped bit or lost byte is refused, leaving no routes
+            blob[rng() % len] ^= static_cast<uint8_t>(1u << rng() % 8);
+            if (caneta_gatt_layout_load(&loaded, blob, len) || loaded.count != 0 ||
+                caneta_gatt_layout_load(&loaded, blob, len - 1)) {
+                std::fprintf(stderr, "corrupt GATT layout blob accepted in trial %d\n", trial);
+                return false;
+            }
+        }
+
+        // A keyboard with two input report characteristics: consumer control
+        // (report ID 2) at the lower handle, the NKRO keyboard (report ID 1)
+        // after it. Notifications carry no report ID byte. Routing every
+        // notification by handle must decode as the reports themselves do;
+        // subscribing to the first characteristic alone loses every key.
+        const uint16_t kConsumerHandle = 0x001B;
+        const uint16_t kKeyboardHandle = 0x001F;
+        caneta_gatt_layout_t layout;
+        caneta_gatt_layout_init(&layout);
+        caneta_gatt_layout_add(&layout, kKeyboardHandle, kKeyboardHandle + 1, 1);
+        caneta_gatt_layout_add(&layout, kConsumerHandle, kConsumerHandle + 1, 2);
+        caneta_gatt_layout_set_map(&layout, kNkroDescriptor, kNkroDescriptorSize);
+
+        // Through a save and load, as a reconnect finds it
+        uint8_t blob[CANETA_GATT_BLOB_MAX];
+        caneta_gatt_layout_t cached;
+        if (!caneta_gatt_layout_load(&cached, blob, caneta_gatt_layout_save(&layout, blob, sizeof(blob)))) return false;
+
+        struct VectorSink {
+            std::vector<uint8_t>* bytes;
+            void write(const uint8_t* data, size_t len) { bytes->insert(bytes->end(), data, data + len); }
+        };
+
+        size_t routed_bytes = 0;
+        for (const Workload& workload : workloads) {
+            std::vector<uint8_t> expected, routed, first_only;
+            caneta::HidStream<VectorSink> reference(VectorSink{&expected});
+            caneta::HidStream<VectorSink> host(VectorSink{&routed});
+            caneta::HidStream<VectorSink> original(VectorSink{&first_only});
+            reference.begin(kNkroDescriptor, kNkroDescriptorSize);
+            host.begin(cached.map, cached.map_len);
+            original.begin(kNkroDescriptor, kNkroDescriptorSize);
+
+            auto notify = [&](uint16_t handle, const uint8_t* report, size_t len) {
+                reference.feed(report, len);
+                const caneta_gatt_report_t* route = caneta_gatt_layout_route(&cached, handle);
+                if (route) host.feed(route->report_id, report + 1, len - 1);
+                if (handle == kConsumerHandle) original.feed(2, report + 1, len - 1);
+            };
+
+            std::vector<uint8_t> nkro_reports = makeNkroReports(workload);
+            for (size_t i = 0; i < workload.report_count(); i++) {
+                if (rng() % 4 == 0) {
+                    uint8_t consumer[3] = {2, static_cast<uint8_t>(rng()), static_cast<uint8_t>(rng() % 4)};
+                    notify(kConsumerHandle, consumer, sizeof(consumer));
+                }
+                notify(kKeyboardHandle, &nkro_reports[i * kNkroReportSize], kNkroReportSize);
+            }
+            if (routed != expected || (!expected.empty() && first_only == expected)) {
+                std::fprintf(stderr, "%s: routed GATT notifications decode to %zu bytes, %zu expected\n",
+                             workload.name.c_str(), routed.size(), expected.size());
+                return false;
+            }
+            routed_bytes += routed.size();
+        }
+        // A keyboard whose keys arrive on two characteristics: report ID 1
+        // holds the modifiers and usages below 0x20 in six array slots,
+        // report ID 2 a bitmap of usages 0x20-0x9F. Both notify for every
+        // report, so keys stay held on one while the other notifies. The
+        // reference is the boot decoder on the unsplit reports.
+        const uint8_t kSplitDescriptor[] = {
+            0x05, 0x01, 0x09, 0x06, 0xA1, 0x01,  // Keyboard collection
+            0x85, 0x01,                          //   Report ID (1)
+            0x05, 0x07, 0x19, 0xE0, 0x29, 0xE7,  //   Modifiers
+            0x15, 0x00, 0x25, 0x01, 0x75, 0x01, 0x95, 0x08, 0x81, 0x02,
+            0x95, 0x06, 0x75, 0x08, 0x15, 0x00,  //   6 key slots
+            0x25, 0x1F, 0x19, 0x00, 0x29, 0x1F, 0x81, 0x00,
+            0x85, 0x02,                          //   Report ID (2)
+            0x19, 0x20, 0x29, 0x9F, 0x15, 0x00,  //   Bitmap of usages 0x20-0x9F
+            0x25, 0x01, 0x75, 0x01, 0x95, 0x80, 0x81, 0x02,
+            0xC0,
+        };
+        const uint16_t kLowHandle = 0x0023;
+        const uint16_t kHighHandle = 0x0027;
+        caneta_gatt_layout_t split;
+        caneta_gatt_layout_init(&split);
+        caneta_gatt_layout_add(&split, kLowHandle, kLowHandle + 1, 1);
+        caneta_gatt_layout_add(&split, kHighHandle, kHighHandle + 1, 2);
+        caneta_gatt_layout_set_map(&split, kSplitDescriptor, sizeof(kSplitDescriptor));
+
+        for (const Workload& workload : workloads) {
+            std::vector<uint8_t> expected, routed;
+            caneta::Stream<VectorSink> reference(VectorSink{&expected});
+            caneta::HidStream<VectorSink> host(VectorSink{&routed});
+            if (!host.begin(split.map, split.map_len)) {
+                std::fprintf(stderr, "split keyboard descriptor not recognised\n");
+                return false;
+            }
+
+            for (size_t i = 0; i < workload.report_count(); i++) {
+                const uint8_t* boot = workload.report(i);
+                reference.feed(boot, CANETA_REPORT_SIZE);
+
+                uint8_t low[7] = {boot[0]};
+                uint8_t high[16] = {};
+                int slot = 1;
+                for (int k = 2; k < CANETA_REPORT_SIZE; k++) {
+                    uint8_t usage = boot[k];
+                    if (usage == 0) continue;
+                    if (usage < 0x20) {
+                        low[slot++] = usage;
+                    } else if (usage < 0xA0) {
+                        high[(usage - 0x20) / 8] |= static_cast<uint8_t>(1u << (usage % 8));
+                    }
+                }
+                for (uint16_t handle : {kLowHandle, kHighHandle}) {
+                    const caneta_gatt_report_t* route = caneta_gatt_layout_route(&split, handle);
+                    if (handle == kLowHandle) {
+                        host.feed(route->report_id, low, sizeof(low));
+                    } else {
+                        host.feed(route->report_id, high, sizeof(high));
+                    }
+                }
+            }
+            if (routed != expected) {
+                std::fprintf(stderr, "%s: keys split over two characteristics decode to %zu bytes, %zu expected\n",
+                             workload.name.c_str(), routed.size(), expected.size());
+                return false;
+            }
+        }
+
+        std::fprintf(stderr, "GATT routing: %u input reports, %zu bytes decoded from cached handles\n", cached.count,
+                     routed_bytes);
+        return true;
+    }
+
+    bool verifyQueue(const std::vector<Workload>& workloads) {
+        std::mt19937 rng(16);
+
+        struct CountingSink {
+            std::vector<uint8_t>* bytes;
+            size_t* writes;
+            size_t* longest;
+            void write(const uint8_t* data, size_t len) {
+                bytes->insert(bytes->end(), data, data + len);
+                (*writes)++;
+                *longest = std::max(*longest, len);
+            }
+        };
+
+        // Batch: bytes come out complete and in order, never more than the
+        // buffer per write unless a single write was longer
+        {
+            std::vector<uint8_t> in, out;
+            size_t writes = 0;
+            size_t longest = 0;
+            size_t longest_in = 0;
+            caneta::Batch<CountingSink, 64> batch(CountingSink{&out, &writes, &longest});
+            for (int i = 0; i < 20000; i++) {
+                std::vector<uint8_t> data(rng() % 8 == 0 ? rng() % 200 : rng() % 12);
+                for (uint8_t& byte : data) {
+                    byte = static_cast<uint8_t>(rng());
+                }
+                batch.write(data.data(), data.size());
+                in.insert(in.end(), data.begin(), data.end());
+                longest_in = std::max(longest_in, data.size());
+                if (rng() % 16 == 0) batch.flush();
+            }
+            batch.flush();
+            if (out != in || batch.pending() != 0 || longest > std::max<size_t>(64, longest_in)) {
+                std::fprintf(stderr, "output batch lost or reordered bytes (%zu vs %zu)\n", out.size(), in.size());
+                return false;
+            }
+        }
+
+        // The ESP32's report queue: a BLE task posts the notifications of
+        // three NKRO keyboards (report ID 1, plus consumer reports under ID 2),
+        // interleaved, each disconnecting and reconnecting now and then; the
+        // report task drains them as it is woken. The merged output must match
+        // decoding each keyboard in place, in posting order, in one write per
+        // drain.
+        struct VectorSink {
+            std::vector<uint8_t>* bytes;
+            void write(const uint8_t* data, size_t len) { bytes->insert(bytes->end(), data, data + len); }
+        };
+
+        constexpr size_t kKeyboards = 3;
+        size_t total_reports = 0;
+        size_t total_writes = 0;
+        size_t total_drains = 0;
+        for (const Workload& workload : workloads) {
+            std::vector<uint8_t> nkro_reports = makeNkroReports(workload);
+            std::vector<uint8_t> expected;
+            caneta::HidStream<VectorSink> references[kKeyboards] = {
+                caneta::HidStream<VectorSink>(VectorSink{&expected}),
+                caneta::HidStream<VectorSink>(VectorSink{&expected}),
+                caneta::HidStream<VectorSink>(VectorSink{&expected})};
+
+            struct Event {
+                uint8_t kind;
+                uint8_t keyboard;
+                uint8_t report_id;
+                std::vector<uint8_t> data;
+            };
+            using Queue = caneta::ReportQueue<CountingSink, kKeyboards>;
+            std::vector<Event> events;
+            auto mount = [&](uint8_t keyboard) {
+                events.push_back({Queue::MOUNT, keyboard, 0,
+                                  std::vector<uint8_t>(kNkroDescriptor, kNkroDescriptor + kNkroDescriptorSize)});
+                references[keyboard].begin(kNkroDescriptor, kNkroDescriptorSize);
+            };
+
+            // Each keyboard types the workload from its own starting point
+            size_t next[kKeyboards];
+            for (uint8_t k = 0; k < kKeyboards; k++) {
+                next[k] = k * workload.report_count() / kKeyboards;
+                mount(k);
+            }
+            for (size_t i = 0; i < workload.report_count(); i++) {
+                uint8_t k = static_cast<uint8_t>(rng() % kKeyboards);
+                if (rng() % 2000 == 0) {
+                    events.push_back({Queue::RESET, k, 0, {}});
+                    references[k].reset();
+                    mount(k);
+                }
+                if (rng() % 8 == 0) {
+                    uint8_t consumer[3] = {2, static_cast<uint8_t>(rng()), static_cast<uint8_t>(rng() % 4)};
+                    events.push_back({Queue::REPORT, k, 2, std::vector<uint8_t>(consumer + 1, consumer + 3)});
+                    references[k].feed(consumer, sizeof(consumer));
+                }
+                const uint8_t* report = &nkro_reports[next[k] * kNkroReportSize];
+                next[k] = (next[k] + 1) % workload.report_count();
+                events.push_back({Queue::REPORT, k, 1, std::vector<uint8_t>(report + 1, report + kNkroReportSize)});
+                references[k].feed(report, kNkroReportSize);
+            }
+
+            std::vector<uint8_t> output;
+            size_t writes = 0;
+            size_t longest = 0;
+            std::unique_ptr<Queue> queue(new Queue(CountingSink{&output, &writes, &longest}));
+            std::atomic<bool> posted{false};
+
+            // The producer retries instead of dropping, so the output must be complete
+            std::thread ble_task([&]() {
+                for (const Event& event : events) {
+                    for (;;) {
+                        bool ok = event.kind == Queue::MOUNT
+                                      ? queue->postMount(event.keyboard, event.data.data(), event.data.size())
+                                  : event.kind == Queue::RESET
+                                      ? queue->postReset(event.keyboard)
+                                      : queue->postReport(event.keyboard, event.report_id, event.data.data(),
+                                                          event.data.size());
+                        if (ok) break;
+                        std::this_thread::yield();
+                    }
+                }
+                posted = true;
+            });
+            // A status loop watching the keyboards meanwhile, as the sketch does
+            std::atomic<bool> drained{false};
+            std::thread status_task([&]() {
+                while (!drained) {
+                    for (uint8_t k = 0; k < kKeyboards; k++) {
+                        kbd_state_t state = queue->state(k);
+                        (void)state;
+                    }
+                    std::this_thread::yield();
+                }
+            });
+            size_t handled = 0;
+            size_t drains = 0;
+            while (handled < events.size()) {
+                size_t n = queue->drain();
+                if (n > 0) {
+                    handled += n;
+                    drains++;
+                } else {
+                    std::this_thread::yield();
+                }
+            }
+            ble_task.join();
+            drained = true;
+            status_task.join();
+
+            bool same_state = true;
+            for (uint8_t k = 0; k < kKeyboards; k++) {
+                kbd_state_t a = queue->state(k);
+                kbd_state_t b = references[k].state();
+                same_state = same_state && std::memcmp(&a, &b, sizeof(a)) == 0;
+            }
+
+            // A keyboard number past the last one reads as nothing held
+            kbd_state_t none = {};
+            kbd_state_t past = queue->state(kKeyboards);
+            same_state = same_state && std::memcmp(&past, &none, sizeof(none)) == 0;
+            if (output != expected || writes > drains || !same_state) {
+                std::fprintf(stderr, "%s: report queue output disagrees with direct decoding (%zu vs %zu bytes, "
+                             "%zu writes in %zu drains)\n", workload.name.c_str(), output.size(), expected.size(),
+                             writes, drains);
+                return false;
+            }
+            total_reports += events.size();
+            total_writes += writes;
+            total_drains += drains;
+        }
+
+        // A queue that is never drained drops reports rather than block the
+        // poster, and counts every drop
+        {
+            std::vector<uint8_t> output;
+            size_t writes = 0;
+            size_t longest = 0;
+            std::unique_ptr<caneta::ReportQueue<CountingSink>> queue(
+                new caneta::ReportQueue<CountingSink>(CountingSink{&output, &writes, &longest}));
+            uint8_t report[kNkroReportSize - 1] = {};
+            uint32_t refused = 0;
+            for (int i = 0; i < 1000; i++) {
+                if (!queue->postReport(0, 1, report, sizeof(report))) refused++;
+            }
+            if (refused == 0 || queue->dropped() != refused) {
+                std::fprintf(stderr, "report queue miscounted drops (%u vs %u)\n", queue->dropped(), refused);
+                return false;
+            }
+        }
+
+        std::fprintf(stderr, "report queue: %zu records in %zu drains, %zu output writes\n", total_reports,
+                     total_drains, total_writes);
+        return true;
+    }
+
+    bool verifyLink() {
+        std::mt19937 rng(17);
+
+        // Every profile asks for parameters a controller accepts
+        for (caneta_link_profile_t profile : {CANETA_LINK_TYPING, CANETA_LINK_BALANCED, CANETA_LINK_LOW_POWER}) {
+            caneta_link_params_t params;
+            if (!caneta_link_params_for(profile, &params) || !caneta_link_params_valid(&params)) {
+                std::fprintf(stderr, "link profile %d asks for invalid parameters\n", profile);
+                return false;
+            }
+        }
+        caneta_link_params_t params;
+        caneta_link_params_t too_short = {6, 40, 4, 20};
+        caneta_link_params_t too_fast = {5, 12, 0, 200};
+        if (caneta_link_params_for(CANETA_LINK_KEYBOARD, &params) || caneta_link_params_valid(&too_short) ||
+            caneta_link_params_valid(&too_fast)) {
+            std::fprintf(stderr, "link parameter limits not enforced\n");
+            return false;
+        }
+
+        // Typing on a simulated link: a report for each press and release,
+        // sent at the next connection event and timestamped by the host a
+        // little later. Against the negotiated interval the tracker must
+        // find the real one; expecting 7.5 ms on a 45 ms link, it must not.
+        const uint32_t kIntervals[] = {6, 12, 24, 36};
+        uint32_t mean_delay_us[4] = {};
+        for (size_t i = 0; i < 4; i++) {
+            const uint32_t interval_us = kIntervals[i] * CANETA_LINK_INTERVAL_US;
+            caneta_jitter_t negotiated, hoped;
+            caneta_jitter_init(&negotiated, interval_us);
+            caneta_jitter_init(&hoped, 6 * CANETA_LINK_INTERVAL_US);
+
+            // Across the microsecond clock wrapping
+            uint32_t anchor = 0xFFF00000u + static_cast<uint32_t>(rng() % interval_us);
+            uint64_t now = 0;
+            uint64_t delay_sum = 0;
+            std::vector<uint64_t> changes;
+            for (int key = 0; key < 400; key++) {
+                now += 40000 + rng() % 200000;
+                changes.push_back(now);
+                changes.push_back(now + 50000 + rng() % 80000);
+            }
+            std::sort(changes.begin(), changes.end());
+            uint64_t last_event = 0;
+            for (uint64_t change : changes) {
+                uint64_t event = (change / interval_us + 1) * interval_us;
+                if (event <= last_event) event = last_event + interval_us;
+                last_event = event;
+                delay_sum += event - change;
+                uint32_t arrival = anchor + static_cast<uint32_t>(event) + static_cast<uint32_t>(rng() % 500);
+                caneta_jitter_record(&negotiated, arrival);
+                caneta_jitter_record(&hoped, arrival);
+            }
+            mean_delay_us[i] = static_cast<uint32_t>(delay_sum / changes.size());
+
+            if (!caneta_jitter_in_effect(&negotiated) || caneta_jitter_estimate_us(&negotiated) != interval_us ||
+                caneta_jitter_max_us(&negotiated) >= 1000 || (kIntervals[i] != 6) == caneta_jitter_in_effect(&hoped)) {
+                std::fprintf(stderr, "jitter tracker on a %u us link: estimated %u us, max jitter %u us, %s\n",
+                             interval_us, caneta_jitter_estimate_us(&negotiated), caneta_jitter_max_us(&negotiated),
+                             caneta_jitter_in_effect(&hoped) ? "mistaken for 7.5 ms" : "not mistaken");
+                return false;
+            }
+        }
+        if (mean_delay_us[0] * 4 > mean_delay_us[3]) return false;
+
+        std::fprintf(stderr, "BLE keystroke delay: %u us mean at 7.5 ms, %u us at 15 ms, %u us at 30 ms, %u us at 45 ms\n",
+                     mean_delay_us[0], mean_delay_us[1], mean_delay_us[2], mean_delay_us[3]);
+        return true;
+    }
+
+    bool verifySnapshot() {
+        // A published state is its number in the first four bytes and a hash
+        // of it in the last four, so a copy mixing two publishes shows up
+        auto make_state = [](uint32_t n) {
+            uint32_t hash = n * 0x9E3779B1u ^ 0x5BD1E995u;
+            kbd_state_t state;
+            state.modifiers = static_cast<uint8_t>(n);
+            state.locks = static_cast<uint8_t>(n >> 8);
+            state.last_keys[0] = static_cast<uint8_t>(n >> 16);
+            state.last_keys[1] = static_cast<uint8_t>(n >> 24);
+            for (int i = 0; i < 4; i++) {
+                state.last_keys[2 + i] = static_cast<uint8_t>(hash >> (8 * i));
+            }
+            return state;
+        };
+        auto state_number = [](const kbd_state_t& state) {
+            return state.modifiers | static_cast<uint32_t>(state.locks) << 8 |
+                   static_cast<uint32_t>(state.last_keys[0]) << 16 | static_cast<uint32_t>(state.last_keys[1]) << 24;
+        };
+
+        // One writer publishing as fast as it can, readers on other threads
+        constexpr uint32_t kPublishes = 200000;
+        constexpr int kReaders = 3;
+        caneta_snapshot_t snapshot;
+        caneta_snapshot_init(&snapshot);
+        kbd_state_t initial = make_state(0);
+        caneta_snapshot_publish(&snapshot, &initial);
+
+        std::atomic<int> started{0};
+        std::atomic<bool> done{false};
+        std::atomic<uint64_t> torn{0};
+        std::atomic<uint64_t> backwards{0};
+        std::atomic<uint64_t> reads{0};
+        std::atomic<uint64_t> retries{0};
+        std::vector<std::thread> readers;
+        for (int r = 0; r < kReaders; r++) {
+            readers.emplace_back([&]() {
+                uint32_t last = 0;
+                uint64_t local_reads = 0;
+                uint64_t local_retries = 0;
+                started++;
+                while (!done) {
+                    kbd_state_t state;
+                    if (!caneta_snapshot_try_read(&snapshot, &state)) {
+                        local_retries++;
+                        continue;
+                    }
+                    local_reads++;
+                    uint32_t n = state_number(state);
+                    kbd_state_t expected = make_state(n);
+                    if (std::memcmp(&state, &expected, sizeof(state)) != 0) {
+                        torn++;
+                    } else if (n < last) {
+                        backwards++;
+                    }
+                    last = n;
+                }
+                reads += local_reads;
+                retries += local_retries;
+            });
+        }
+        while (started < kReaders) {
+            std::this_thread::yield();
+        }
+        for (uint32_t n = 1; n <= kPublishes; n++) {
+            kbd_state_t state = make_state(n);
+            caneta_snapshot_publish(&snapshot, &state);
+        }
+        done = true;
+        for (std::thread& reader : readers) {
+            reader.join();
+        }
+
+        kbd_state_t last;
+        caneta_snapshot_read(&snapshot, &last);
+        kbd_state_t expected = make_state(kPublishes);
+        if (reads == 0 || torn != 0 || backwards != 0 || std::memcmp(&last, &expected, sizeof(last)) != 0 ||
+            caneta_snapshot_version(&snapshot) != kPublishes + 1) {
+            std::fprintf(stderr, "keyboard state snapshots: %llu torn and %llu stale reads in %llu\n",
+                         (unsigned long long)torn.load(), (unsigned long long)backwards.load(),
+                         (unsigned long long)reads.load());
+            return false;
+        }
+
+        // The same lock over a larger value, as caneta::Snapshot publishes
+        // link statistics: every word of a publish holds its number
+        struct Wide {
+            uint32_t n[64];
+        };
+        caneta::Snapshot<Wide> wide;
+        std::atomic<bool> wide_done{false};
+        std::atomic<uint64_t> wide_torn{0};
+        std::atomic<uint64_t> wide_reads{0};
+        std::thread wide_reader([&]() {
+            while (!wide_done) {
+                Wide value = wide.read();
+                wide_reads++;
+                for (uint32_t word : value.n) {
+                    if (word != value.n[0]) {
+                        wide_torn++;
+                        break;
+                    }
+                }
+            }
+        });
+        for (uint32_t n = 1; n <= kPublishes / 10; n++) {
+            Wide value;
+            std::fill(std::begin(value.n), std::end(value.n), n);
+            wide.publish(value);
+        }
+        wide_done = true;
+        wide_reader.join();
+        if (wide_torn != 0 || wide.read().n[63] != kPublishes / 10) {
+            std::fprintf(stderr, "caneta::Snapshot: %llu torn reads in %llu\n", (unsigned long long)wide_torn.load(),
+                         (unsigned long long)wide_reads.load());
+            return false;
+        }
+
+        std::fprintf(stderr, "state snapshots: %llu consistent reads on %d threads, %llu retries, %u publishes\n",
+                     (unsigned long long)reads.load(), kReaders, (unsigned long long)retries.load(), kPublishes);
+        return true;
+    }
+
+    bool verifyLayouts() {
+        auto text = [](uint8_t keycode, uint8_t modifiers) {
+            uint8_t seq[CANETA_KEY_OUTPUT_MAX];
+            size_t n = caneta_translate_key(keycode, modifiers, seq);
+            return std::string(reinterpret_cast<const char*>(seq), n);
+        };
+        auto fail = [](const char* what) {
+            caneta_layout_select(nullptr);
+            std::fprintf(stderr, "layouts: %s\n", what);
+            return false;
+        };
+
+        // US stays what the ASCII table has always said
+        caneta_layout_select(nullptr);
+        for (uint8_t keycode = 0; keycode < CANETA_LAYOUT_USAGES; keycode++) {
+            for (uint8_t shift = 0; shift < 2; shift++) {
+                char c = hid_to_ascii(keycode, shift);
+                uint8_t seq[CANETA_KEY_OUTPUT_MAX];
+                size_t n = caneta_translate_key(keycode, shift ? CANETA_MODIFIER_SHIFT : 0, seq);
+                if (c != 0 && c != '\b' && c != '\r' && c != 0x1B && (n != 1 || seq[0] != static_cast<uint8_t>(c))) {
+                    std::fprintf(stderr, "layouts: US usage 0x%02X does not type '%c'\n", keycode, c);
+                    return false;
+                }
+            }
+        }
+
+        for (size_t i = 0; i < caneta_layout_count; i++) {
+            if (caneta_layout_find(caneta_layouts[i].name) != &caneta_layouts[i]) return fail("a layout cannot be found by name");
+        }
+        const caneta_layout_t* de = caneta_layout_find("de");
+        const caneta_layout_t* fr = caneta_layout_find("fr");
+        const caneta_layout_t* se = caneta_layout_find("se");
+        if (!de || !fr || !se || caneta_layout_find("xx")) return fail("missing German, French or Swedish layout");
+
+        caneta_layout_select(de);
+        if (text(0x1C, 0) != "z" || text(0x1D, 0) != "y" || text(0x2D, 0) != "\xC3\x9F") {
+            return fail("German base level");
+        }
+        if (text(0x14, CANETA_MODIFIER_RIGHT_ALT) != "@" || text(0x08, CANETA_MODIFIER_RIGHT_ALT) != "\xE2\x82\xAC") {
+            return fail("German AltGr level");
+        }
+        if (text(0x64, 0) != "<" || text(0x64, CANETA_MODIFIER_SHIFT) != ">" || text(0x1C, CANETA_MODIFIER_CTRL) != "\x1A") {
+            return fail("German non-US key or control letter");
+        }
+        caneta_layout_select(fr);
+        if (text(0x14, 0) != "a" || text(0x1E, 0) != "&" || text(0x1E, CANETA_MODIFIER_SHIFT) != "1") {
+            return fail("French layout");
+        }
+        caneta_layout_select(se);
+        if (text(0x2F, 0) != "\xC3\xA5") return fail("Swedish layout");
+        caneta_layout_select(nullptr);
+
+        // NumLock starts on and toggles per keyboard, on both decoders: keypad 1,
+        // NumLock, keypad 1 again
+        const std::string expected = "1\x1B[F";
+        caneta_decoder_t boot;
+        caneta_decoder_init(&boot);
+        std::string boot_out;
+        for (uint8_t keycode : {0x59, 0x00, 0x53, 0x00, 0x59, 0x00}) {
+            uint8_t report[CANETA_REPORT_SIZE] = {0, 0, keycode};
+            uint8_t out[CANETA_REPORT_OUTPUT_MAX];
+            size_t n = caneta_decoder_feed(&boot, report, sizeof(report), out);
+            boot_out.append(reinterpret_cast<const char*>(out), n);
+        }
+        caneta_hid_decoder_t nkro;
+        caneta_hid_decoder_init(&nkro, kNkroDescriptor, kNkroDescriptorSize);
+        std::string nkro_out;
+        for (uint8_t keycode : {0x59, 0x00, 0x53, 0x00, 0x59, 0x00}) {
+            uint8_t report[kNkroReportSize - 1] = {};
+            if (keycode) report[1 + keycode / 8] |= static_cast<uint8_t>(1 << (keycode % 8));
+            uint8_t out[64];
+            bool complete;
+            size_t n = caneta_hid_decoder_translate(&nkro, 1, report, sizeof(report), out, sizeof(out), &complete);
+            nkro_out.append(reinterpret_cast<const char*>(out), n);
+        }
+        kbd_state_t state;
+        caneta_hid_decoder_state(&nkro, &state);
+        if (boot_out != expected || nkro_out != expected || caneta_decoder_state(&boot)->locks != 0 || state.locks != 0) {
+            return fail("NumLock does not switch the keypad to navigation keys");
+        }
+
+        std::fprintf(stderr, "layouts: %zu compiled, AltGr, non-US key and NumLock keypad checked\n", caneta_layout_count);
+        return true;
+    }
+
+    bool verifyCompose() {
+        // Each step is a key pressed (with modifiers) and released
+        struct Key {
+            uint8_t keycode;
+            uint8_t modifiers;
+        };
+        auto boot_reports = [](std::initializer_list<Key> keys) {
+            std::vector<uint8_t> reports;
+            for (const Key& key : keys) {
+                uint8_t press[CANETA_REPORT_SIZE] = {key.modifiers, 0, key.keycode};
+                uint8_t release[CANETA_REPORT_SIZE] = {};
+                reports.insert(reports.end(), press, press + sizeof(press));
+                reports.insert(reports.end(), release, release + sizeof(release));
+            }
+            return reports;
+        };
+        // Through a boot decoder, out_len bytes at a time
+        auto type_boot = [](const std::vector<uint8_t>& reports, size_t out_len) {
+            caneta_decoder_t decoder;
+            caneta_decoder_init(&decoder);
+            std::string text;
+            size_t count = reports.size() / CANETA_REPORT_SIZE;
+            const uint8_t* next = reports.data();
+            while (count > 0) {
+                uint8_t out[CANETA_REPORT_OUTPUT_MAX];
+                size_t used;
+                size_t n = caneta_translate_reports(&decoder, next, count, out, out_len, &used);
+                text.append(reinterpret_cast<const char*>(out), n);
+                next += used * CANETA_REPORT_SIZE;
+                count -= used;
+            }
+            return text;
+        };
+        // The same reports as NKRO bitmaps through the descriptor-driven decoder
+        auto type_nkro = [](const std::vector<uint8_t>& reports, size_t out_len) {
+            caneta_hid_decoder_t decoder;
+            caneta_hid_decoder_init(&decoder, kNkroDescriptor, kNkroDescriptorSize);
+            std::string text;
+            for (size_t i = 0; i < reports.size(); i += CANETA_REPORT_SIZE) {
+                uint8_t report[kNkroReportSize - 1] = {reports[i]};
+                uint8_t keycode = reports[i + 2];
+                if (keycode) report[1 + keycode / 8] |= static_cast<uint8_t>(1 << (keycode % 8));
+                bool complete;
+                do {
+                    uint8_t out[CANETA_REPORT_OUTPUT_MAX];
+                    size_t n = caneta_hid_decoder_translate(&decoder, 1, report, sizeof(report), out, out_len, &complete);
+                    text.append(reinterpret_cast<const char*>(out), n);
+                } while (!complete);
+            }
+            return text;
+        };
+
+        const uint8_t shift = 0x02, ctrl = 0x01;
+        const uint8_t dead_acute = 0x2E, dead_circumflex = 0x35, compose = 0x65;
+        struct Case {
+            const char* layout;
+            std::vector<uint8_t> reports;
+            const char* expected;
+        };
+        const Case cases[] = {
+            // Dead keys on German: ´ e, ` a, ^ space, ´ ´, and ^ ´ e
+            {"de", boot_reports({{dead_acute, 0}, {0x08, 0}}), "\xC3\xA9"},
+            {"de", boot_reports({{dead_acute, shift}, {0x04, 0}}), "\xC3\xA0"},
+            {"de", boot_reports({{dead_circumflex, 0}, {0x2C, 0}}), "^"},
+            {"de", boot_reports({{dead_acute, 0}, {dead_acute, 0}}), "\xC2\xB4"},
+            {"de", boot_reports({{dead_circumflex, 0}, {dead_acute, 0}, {0x08, 0}}), "\xE1\xBA\xBF"},
+            // No such sequence: dropped with the key that broke it
+            {"de", boot_reports({{dead_acute, 0}, {0x14, 0}, {0x14, 0}}), "q"},
+            // Control keys cancel and pass; NumLock leaves the sequence alone
+            {"de", boot_reports({{dead_acute, 0}, {0x06, ctrl}, {0x08, 0}}), "\x03" "e"},
+            {"de", boot_reports({{dead_acute, 0}, {0x53, 0}, {0x08, 0}}), "\xC3\xA9"},
+            // The Compose key on US: Compose " o, Compose C =, Compose s s
+            {"us", boot_reports({{compose, 0}, {0x34, shift}, {0x12, 0}}), "\xC3\xB6"},
+            {"us", boot_reports({{compose, 0}, {0x06, shift}, {0x2E, 0}}), "\xE2\x82\xAC"},
+            {"us", boot_reports({{compose, 0}, {0x16, 0}, {0x16, 0}, {0x04, 0}}), "\xC3\x9F" "a"},
+            // Swedish dead diaeresis, French dead circumflex
+            {"se", boot_reports({{0x30, 0}, {0x18, 0}}), "\xC3\xBC"},
+            {"fr", boot_reports({{0x2F, 0}, {0x08, 0}}), "\xC3\xAA"},
+        };
+
+        for (const Case& c : cases) {
+            caneta_layout_select(caneta_layout_find(c.layout));
+            // Resuming after a full buffer must not step the sequence twice
+            for (size_t out_len : {size_t(CANETA_REPORT_OUTPUT_MAX), size_t(1)}) {
+                std::string boot = type_boot(c.reports, out_len);
+                std::string nkro = type_nkro(c.reports, out_len);
+                if (boot != c.expected || nkro != c.expected) {
+                    caneta_layout_select(nullptr);
+                    std::fprintf(stderr, "compose on %s: expected %zu bytes, boot decoder typed %zu, HID decoder %zu (%zu-byte output)\n",
+                                 c.layout, std::strlen(c.expected), boot.size(), nkro.size(), out_len);
+                    return false;
+                }
+            }
+        }
+
+        // Without a compose state dead keys type nothing, so they never repeat
+        caneta_layout_select(caneta_layout_find("de"));
+        uint8_t seq[CANETA_KEY_OUTPUT_MAX];
+        size_t dead_len = caneta_translate_key_locks(dead_acute, 0, CANETA_LOCK_NUM, seq);
+        caneta_layout_select(nullptr);
+        if (dead_len != 0 || caneta_translate_key(compose, 0, seq) != 0) {
+            std::fprintf(stderr, "compose: a dead key or the Compose key types on its own\n");
+            return false;
+        }
+
+        std::fprintf(stderr, "compose: %zu sequences in %zu trie nodes (%zu bytes), %zu cases on both decoders\n",
+                     caneta_compose_sequence_count, caneta_compose_node_count,
+                     caneta_compose_node_count * sizeof(caneta_compose_node_t), sizeof(cases) / sizeof(cases[0]));
+        return true;
+    }
+
+    bool verifyKeyEncoding() {
+        const uint8_t shift = 0x02, ctrl = 0x01, alt = 0x04, right_alt = 0x40;
+        auto encode = [](uint8_t keycode, uint8_t modifiers) {
+            uint8_t seq[CANETA_KEY_OUTPUT_MAX];
+            size_t n = caneta_translate_key(keycode, modifiers, seq);
+            return std::string(reinterpret_cast<const char*>(seq), n);
+        };
+
+        // Every special key with every Shift/Alt/Ctrl combination, against
+        // xterm's parameter m = 1 + Shift + 2 Alt + 4 Ctrl added to the
+        // unmodified sequence
+        caneta_layout_select(nullptr);
+        size_t special_keys = 0;
+        for (int k = 0; k < 256; k++) {
+            uint8_t keycode = static_cast<uint8_t>(k);
+            std::string plain = process_special_keys(keycode);
+            if (plain.empty()) continue;
+            special_keys++;
+            for (int m = 0; m < 8; m++) {
+                uint8_t modifiers = static_cast<uint8_t>(((m & 1) ? shift : 0) | ((m & 2) ? alt : 0) | ((m & 4) ? ctrl : 0));
+                std::string expected = "\x1B" + plain;
+                if (m != 0) {
+                    std::string param = ";" + std::to_string(m + 1);
+                    if (plain.back() == '~') {
+                        expected.insert(expected.size() - 1, param);
+                    } else {
+                        expected = "\x1B[1" + param + plain.back();
+                    }
+                }
+                if (encode(keycode, modifiers) != expected) {
+                    std::fprintf(stderr, "key encoding: keycode 0x%02X with modifiers %02X is not %s\n",
+                                 k, modifiers, expected.c_str() + 1);
+                    return false;
+                }
+            }
+        }
+
+        struct Case {
+            const char* layout;
+            uint8_t keycode;
+            uint8_t modifiers;
+            std::string expected;
+            uint8_t locks = CANETA_LOCK_NUM;
+        };
+        const Case cases[] = {
+            // Alt as Meta, also with Ctrl and on non-ASCII characters
+            {"us", 0x04, alt, "\x1B" "a"},
+            {"us", 0x04, alt | shift, "\x1B" "A"},
+            {"us", 0x04, ctrl | alt, std::string("\x1B\x01", 2)},
+            {"us", 0x29, alt, "\x1B\x1B"},
+            {"de", 0x2F, alt, "\x1B\xC3\xBC"},
+            // Right Alt is AltGr where the layout has it, Meta elsewhere
+            {"de", 0x14, right_alt, "@"},
+            {"de", 0x14, alt, "\x1B" "q"},
+            {"us", 0x14, right_alt, "\x1B" "q"},
+            // Ctrl on every ASCII character xterm maps
+            {"us", 0x1F, ctrl | shift, std::string(1, '\0')},
+            {"us", 0x2C, ctrl, std::string(1, '\0')},
+            {"us", 0x2F, ctrl, "\x1B"},
+            {"us", 0x31, ctrl, "\x1C"},
+            {"us", 0x30, ctrl, "\x1D"},
+            {"us", 0x23, ctrl | shift, "\x1E"},
+            {"us", 0x2D, ctrl | shift, "\x1F"},
+            {"us", 0x38, ctrl, "\x1F"},
+            {"us", 0x38, ctrl | shift, "\x7F"},
+            {"us", 0x20, ctrl, "\x1B"},
+            {"us", 0x25, ctrl, "\x7F"},
+            {"us", 0x1E, ctrl, "1"},
+            // Keypad navigation keys are modified too
+            {"us", 0x5C, ctrl, "\x1B[1;5D", 0},
+        };
+        for (const Case& c : cases) {
+            caneta_layout_select(caneta_layout_find(c.layout));
+            uint8_t seq[CANETA_KEY_OUTPUT_MAX];
+            size_t n = caneta_translate_key_locks(c.keycode, c.modifiers, c.locks, seq);
+            std::string got(reinterpret_cast<const char*>(seq), n);
+            if (got != c.expected) {
+                caneta_layout_select(nullptr);
+                std::fprintf(stderr, "key encoding on %s: usage 0x%02X with modifiers %02X gives %zu bytes\n",
+                             c.layout, c.keycode, c.modifiers, got.size());
+                return false;
+            }
+        }
+        caneta_layout_select(nullptr);
+
+        std::fprintf(stderr, "key encoding: %zu special keys in 8 modifier combinations, %zu Alt/Ctrl cases\n",
+                     special_keys, sizeof(cases) / sizeof(cases[0]));
+        return true;
+    }
+
+} // namespace caneta_bench
@@ -0,0 +1,86 @@
+// verify.h
+// Correctness checks run before any timing
+
+#ifndef CANETA_BENCH_VERIFY_H
+#define CANETA_BENCH_VERIFY_H
+
+#include <cstdint>
+#include <vector>
+
+#include "workload.h"
+
+namespace caneta_bench {
+
+    // Table-driven hid_to_ascii / process_special_keys against the original switches
+    bool verifyTables();
+
+    // caneta_kbd_diff against the nested loop on every key combination, and
+    // the Cortex-M0+ cost model of both against them. Returns the number of
+    // cases checked, or 0 on a mismatch.
+    uint64_t verifyKeyDiff();
+
+    // Every translation path must produce the same bytes for every workload
+    bool verifyPaths(const std::vector<Workload>& workloads);
+
+    // The report descriptor compiler and the HID decoder, in boot and NKRO
+    // layouts, against the boot decoder and a per-report reference
+    bool verifyHid(const std::vector<Workload>& workloads);
+
+    // The auto-repeat timer wheel against a per-millisecond reference, driven
+    // by a virtual clock both tick by tick and sleeping until each deadline
+    bool verifyRepeat();
+
+    // The report ring under a producer and a consumer thread, and the host
+    // pipeline behind it against decoding each interface directly
+    bool verifyRing(const std::vector<Workload>& workloads);
+
+    // The UART transmit ring drained at 115200 baud against a simulated clock,
+    // dropping whole sequences when full and, separately, with backpressure
+    bool verifyTx(const std::vector<Workload>& workloads);
+
+    // USB CDC packet batching in a simulated full-speed device: whole packets,
+    // short ones only on the flush timeout, bounded latency, and the burst
+    // bandwidth against the 115200 baud UART
+    bool verifyBatch(const std::vector<Workload>& workloads);
+
+    // Bluetooth LE reconnection: the bond cache against a most-recent-first
+    // list, the scan filter, the order of attempts, and reconnect latency in
+    // a simulated radio against the original delay-then-scan policy
+    bool verifyReconnect();
+
+    // HID over GATT: the report routing table against a map, its flash blob,
+    // and a two-characteristic keyboard routed by handle against decoding
+    // the reports directly
+    bool verifyGatt(const std::vector<Workload>& workloads);
+
+    // Output batching, and the ESP32's report queue between a posting thread
+    // and a draining one against decoding each keyboard in place: output
+    // merged in posting order, one write per drain, states read from a third
+    // thread meanwhile, and counted drops when full
+    bool verifyQueue(const std::vector<Workload>& workloads);
+
+    // BLE connection parameter profiles within the Bluetooth limits, and the
+    // arrival jitter tracker finding the interval in effect on a simulated
+    // link, with the keystroke delay each interval costs
+    bool verifyLink();
+
+    // Keyboard state snapshots read on several threads while one publishes:
+    // never a copy mixing two states, never an older state after a newer one
+    bool verifySnapshot();
+
+    // The compiled keyboard layouts: US matching the ASCII table, German,
+    // French and Swedish levels including AltGr, and NumLock switching the
+    // keypad on the boot and descriptor-driven decoders
+    bool verifyLayouts();
+
+    // Dead keys and the Compose key on both decoders, including sequences
+    // that fail, are cancelled, or resume after a full output buffer
+    bool verifyCompose();
+
+    // Terminal key encoding as xterm sends it: every special key with every
+    // Shift/Alt/Ctrl combination, Alt as an ESC prefix, and Ctrl on ASCII
+    bool verifyKeyEncoding();
+
+} // namespace caneta_bench
+
+#endif // CANETA_BENCH_VERIFY_H
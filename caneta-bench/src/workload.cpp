@@ -0,0 +1,324 @@
+// workload.cpp
+// Synthetic keyboard workload generator
+
+#include "workload.h"
+
+#include <caneta.h>
+
+#include <algorithm>
+#include <cstring>
+#include <random>
+
+namespace caneta_bench {
+
+    namespace {
+
+        constexpr uint8_t kLeftCtrl = 0xE0;
+        constexpr uint8_t kLeftShift = 0xE1;
+        constexpr uint8_t kLeftAlt = 0xE2;
+        constexpr uint8_t kLeftGui = 0xE3;
+
+        // Simulates a boot protocol keyboard: applies key transitions and
+        // appends the report the keyboard would send after each one.
+        class KeyboardSim {
+            public:
+                explicit KeyboardSim(Workload& workload) : workload(workload) {
+                    std::memset(report, 0, sizeof(report));
+                }
+
+                void press(uint8_t keycode, uint32_t time_us) {
+                    if (keycode >= 0xE0) {
+                        report[0] |= static_cast<uint8_t>(1 << (keycode - 0xE0));
+                    } else {
+                        for (int slot = 2; slot < CANETA_REPORT_SIZE; slot++) {
+                            if (report[slot] == 0) {
+                                report[slot] = keycode;
+                                break;
+                            }
+                        }
+                    }
+                    workload.events.push_back({keycode, true, time_us});
+                    send(time_us);
+                }
+
+                void release(uint8_t keycode, uint32_t time_us) {
+                    if (keycode >= 0xE0) {
+                        report[0] &= static_cast<uint8_t>(~(1 << (keycode - 0xE0)));
+                    } else {
+                        for (int slot = 2; slot < CANETA_REPORT_SIZE; slot++) {
+                            if (report[slot] == keycode) {
+                                report[slot] = 0;
+                            }
+                        }
+                    }
+                    workload.events.push_back({keycode, false, time_us});
+                    send(time_us);
+                }
+
+                // A fast-polling keyboard repeating its current report
+                void repeat(uint32_t time_us) {
+                    send(time_us);
+                }
+
+                // Keys held in the key slots
+                int held() const {
+                    int count = 0;
+                    for (int slot = 2; slot < CANETA_REPORT_SIZE; slot++) {
+                        count += report[slot] != 0;
+                    }
+                    return count;
+                }
+
+                uint8_t heldKey(int index) const {
+                    for (int slot = 2; slot < CANETA_REPORT_SIZE; slot++) {
+                        if (report[slot] != 0 && index-- == 0) {
+                            return report[slot];
+                        }
+                    }
+                    return 0;
+                }
+
+                bool isHeld(uint8_t keycode) const {
+                    for (int slot = 2; slot < CANETA_REPORT_SIZE; slot++) {
+                        if (report[slot] == keycode) {
+                            return true;
+                        }
+                    }
+                    return false;
+                }
+
+                size_t reports() const {
+                    return workload.reports.size() / CANETA_REPORT_SIZE;
+                }
+
+            private:
+                Workload& workload;
+                uint8_t report[CANETA_REPORT_SIZE];
+
+                void send(uint32_t time_us) {
+                    workload.reports.insert(workload.reports.end(), report, report + CANETA_REPORT_SIZE);
+                    workload.times_us.push_back(time_us);
+                }
+        };
+
+        // Keycode and shift state that type a given ASCII character, from the
+        // caneta-c tables themselves
+        struct Keystroke {
+            uint8_t keycode = 0;
+            bool shift = false;
+        };
+
+        const Keystroke* keystrokeTable() {
+            static Keystroke table[128];
+            static bool built = false;
+            if (!built) {
+                for (int shift = 1; shift >= 0; shift--) {
+                    for (int keycode = 0; keycode < 256; keycode++) {
+                        char c = hid_to_ascii(static_cast<uint8_t>(keycode), shift);
+                        if (c > 0) {
+                            table[static_cast<int>(c)] = {static_cast<uint8_t>(keycode), shift != 0};
+                        }
+                    }
+                }
+                built = true;
+            }
+            return table;
+        }
+
+        const char kProse[] =
+            "The quick brown fox jumps over the lazy dog. Caneta turns keyboard input into "
+            "VT100 serial output for microcontrollers and the Linux console. Typing in a "
+            "serial terminal should feel exactly like typing on a local machine, with no "
+            "lag between pressing a key and seeing it echoed back. ";
+
+        const char kCode[] =
+            "static int parse(const char* s, size_t n) {\n"
+            "    for (size_t i = 0; i < n; i++) { if (s[i] == '#') return -1; }\n"
+            "    return (int)n * 2 + 1; // \"ok\" ~ [done] & {next} | <end>?\n"
+            "}\n";
+
+        Workload makeTyping(size_t target_reports, std::mt19937& rng) {
+            Workload workload;
+            workload.name = "typing";
+            KeyboardSim keyboard(workload);
+            const Keystroke* keystrokes = keystrokeTable();
+            std::uniform_int_distribution<int> pct(0, 99);
+            std::uniform_int_distribution<uint32_t> gap(60000, 200000);  // 60-100 wpm
+            std::uniform_int_distribution<uint32_t> dwell(40000, 110000);
+
+            size_t pos = 0;
+            uint8_t rolling = 0;  // Previous key still held (rollover)
+            while (keyboard.reports() < target_reports) {
+                char c = kProse[pos++ % (sizeof(kProse) - 1)];
+                Keystroke k = keystrokes[static_cast<int>(c)];
+
+                // Occasional typo: a wrong letter, then backspace
+                if (pct(rng) < 3) {
+                    keyboard.press(0x04 + pct(rng) % 26, gap(rng));
+                    keyboard.release(workload.events.back().keycode, dwell(rng));
+                    keyboard.press(0x2A, gap(rng));
+                    keyboard.release(0x2A, dwell(rng));
+                }
+
+                if (rolling == k.keycode) {
+                    keyboard.release(rolling, 15000);  // Double letters can't roll over
+                    rolling = 0;
+                }
+                if (k.shift) {
+                    keyboard.press(kLeftShift, gap(rng) / 2);
+                }
+                keyboard.press(k.keycode, k.shift ? 30000 : gap(rng));
+                if (rolling) {
+                    keyboard.release(rolling, 15000);
+                    rolling = 0;
+                }
+
+                // Fast typists press the next key before releasing this one
+                if (!k.shift && pct(rng) < 20) {
+                    rolling = k.keycode;
+                } else {
+                    keyboard.release(k.keycode, dwell(rng));
+                }
+                if (k.shift) {
+                    keyboard.release(kLeftShift, 20000);
+                }
+                if (c == '.' && pct(rng) < 30) {
+                    keyboard.press(0x28, gap(rng));  // Enter
+                    keyboard.release(0x28, dwell(rng));
+                }
+            }
+            return workload;
+        }
+
+        Workload makeGaming(size_t target_reports, std::mt19937& rng) {
+            Workload workload;
+            workload.name = "gaming";
+            KeyboardSim keyboard(workload);
+
+            // WASD, QERF, 1-6, space, tab, plus shift/ctrl for sprint/crouch
+            static const uint8_t kKeys[] = {
+                0x1A, 0x04, 0x16, 0x07, 0x14, 0x08, 0x15, 0x09,
+                0x1E, 0x1F, 0x20, 0x21, 0x22, 0x23, 0x2C, 0x2B,
+            };
+            std::uniform_int_distribution<int> key(0, sizeof(kKeys) - 1);
+            std::uniform_int_distribution<int> pct(0, 99);
+
+            while (keyboard.reports() < target_reports) {
+                int action = pct(rng);
+                if (action < 10) {
+                    // Sprint / crouch toggles
+                    uint8_t mod = action < 5 ? kLeftShift : kLeftCtrl;
+                    keyboard.press(mod, 1000);
+                    keyboard.release(mod, 1000);
+                } else if (action < 55 && keyboard.held() < 6) {
+                    uint8_t k = kKeys[key(rng)];
+                    if (!keyboard.isHeld(k)) {
+                        keyboard.press(k, 1000);
+                    }
+                } else if (action < 80 && keyboard.held() > 0) {
+                    keyboard.release(keyboard.heldKey(pct(rng) % keyboard.held()), 1000);
+                } else {
+                    // 1 kHz polling: the same keys reported again
+                    keyboard.repeat(1000);
+                }
+            }
+            return workload;
+        }
+
+        Workload makePaste(size_t target_reports, std::mt19937& rng) {
+            Workload workload;
+            workload.name = "paste";
+            KeyboardSim keyboard(workload);
+            const Keystroke* keystrokes = keystrokeTable();
+            std::uniform_int_distribution<int> pct(0, 99);
+
+            size_t pos = 0;
+            while (keyboard.reports() < target_reports) {
+                // Bursts of code or prose, one report per millisecond
+                const char* text = pct(rng) < 50 ? kCode : kProse;
+                size_t len = std::strlen(text);
+                for (size_t i = 0; i < len && keyboard.reports() < target_reports; i++) {
+                    Keystroke k = keystrokes[static_cast<int>(text[(pos + i) % len])];
+                    if (k.keycode == 0) {
+                        continue;
+                    }
+                    if (k.shift) {
+                        keyboard.press(kLeftShift, 1000);
+                    }
+                    keyboard.press(k.keycode, 1000);
+                    keyboard.release(k.keycode, 1000);
+                    if (k.shift) {
+                        keyboard.release(kLeftShift, 1000);
+                    }
+                }
+                pos += 17;
+            }
+            return workload;
+        }
+
+        Workload makeShortcuts(size_t target_reports, std::mt19937& rng) {
+            Workload workload;
+            workload.name = "shortcuts";
+            KeyboardSim keyboard(workload);
+
+            struct Chord {
+                uint8_t mods[3];
+                uint8_t key;
+            };
+            static const Chord kChords[] = {
+                {{kLeftCtrl}, 0x06},                     // Ctrl+C
+                {{kLeftCtrl}, 0x19},                     // Ctrl+V
+                {{kLeftCtrl}, 0x1D},                     // Ctrl+Z
+                {{kLeftCtrl, kLeftShift}, 0x17},         // Ctrl+Shift+T
+                {{kLeftAlt}, 0x2B},                      // Alt+Tab
+                {{kLeftGui}, 0x2C},                      // GUI+Space
+                {{kLeftShift}, 0x4F},                    // Shift+Right
+                {{kLeftShift}, 0x50},                    // Shift+Left
+                {{kLeftCtrl, kLeftShift}, 0x52},         // Ctrl+Shift+Up
+                {{kLeftAlt}, 0x3D},                      // Alt+F4
+                {{kLeftCtrl, kLeftAlt}, 0x4C},           // Ctrl+Alt+Delete
+                {{kLeftCtrl}, 0x1B},                     // Ctrl+X
+                {{}, 0x45},                              // F12
+                {{kLeftCtrl}, 0x4A},                     // Ctrl+Home
+            };
+            std::uniform_int_distribution<int> chord(0, sizeof(kChords) / sizeof(kChords[0]) - 1);
+            std::uniform_int_distribution<int> taps(1, 4);
+
+            while (keyboard.reports() < target_reports) {
+                const Chord& c = kChords[chord(rng)];
+                for (uint8_t mod : c.mods) {
+                    if (mod) keyboard.press(mod, 40000);
+                }
+                // Repeated taps while the modifiers stay down (Shift+Right x3)
+                for (int tap = taps(rng); tap > 0; tap--) {
+                    keyboard.press(c.key, 60000);
+                    keyboard.release(c.key, 50000);
+                }
+                for (uint8_t mod : c.mods) {
+                    if (mod) keyboard.release(mod, 30000);
+                }
+            }
+            return workload;
+        }
+
+    } // namespace
+
+    size_t Workload::report_count() const {
+        return reports.size() / CANETA_REPORT_SIZE;
+    }
+
+    const uint8_t* Workload::report(size_t i) const {
+        return &reports[i * CANETA_REPORT_SIZE];
+    }
+
+    std::vector<Workload> makeWorkloads(size_t target_reports) {
+        std::mt19937 rng(0xCA9E7A);
+        std::vector<Workload> workloads;
+        workloads.push_back(makeTyping(target_reports, rng));
+        workloads.push_back(makeGaming(target_reports, rng));
+        workloads.push_back(makePaste(target_reports, rng));
+        workloads.push_back(makeShortcuts(target_reports, rng));
+        return workloads;
+    }
+
+} // namespace caneta_bench
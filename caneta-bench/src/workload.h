@@ -0,0 +1,44 @@
+// workload.h
+// Synthetic keyboard workloads for caneta-bench
+
+#ifndef CANETA_BENCH_WORKLOAD_H
+#define CANETA_BENCH_WORKLOAD_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace caneta_bench {
+
+    // A single key transition. Modifiers are keycodes 0xE0-0xE7, as in the
+    // HID usage tables.
+    struct KeyEvent {
+        uint8_t keycode;
+        bool down;
+        uint32_t time_us;  // Time since the previous event
+    };
+
+    // A workload is a stream of key transitions and the boot reports a
+    // 6-key-rollover keyboard sends for them (one report per transition,
+    // plus any unchanged reports a fast-polling keyboard repeats).
+    struct Workload {
+        std::string name;
+        std::vector<KeyEvent> events;
+        std::vector<uint8_t> reports;    // report_count() * CANETA_REPORT_SIZE bytes
+        std::vector<uint32_t> times_us;  // Time since the previous report
+
+        size_t report_count() const;
+        const uint8_t* report(size_t i) const;
+    };
+
+    // Builds every workload with roughly target_reports reports each:
+    //   typing    - prose at 60-100 wpm with capitals, rollover and corrections
+    //   gaming    - 6KRO saturation with a 1 kHz polling keyboard
+    //   paste     - machine-speed text bursts with no rollover
+    //   shortcuts - Ctrl/Alt/GUI chords, shifted navigation and function keys
+    std::vector<Workload> makeWorkloads(size_t target_reports);
+
+} // namespace caneta_bench
+
+#endif // CANETA_BENCH_WORKLOAD_H
@@ -5,14 +5,15 @@
 #include <sstream>
 #include <cstring>
 
-// Global keyboard state for caneta-c
-kbd_state_t g_kbd_state = {0};
-
-KeyLogger::KeyLogger() : window(nullptr), renderer(nullptr), running(false) {
-    memset(&kbd_state, 0, sizeof(kbd_state));
+KeyLogger::KeyLogger()
+    : window(nullptr), renderer(nullptr), running(false), terminal(TerminalOutput{this}), recorder(nullptr) {
 }
 
 KeyLogger::~KeyLogger() {
+    if (recorder) {
+        keyboard.setCaptureWriter(nullptr);
+        caneta_capture_close_write(recorder);
+    }
     if (renderer) {
         SDL_DestroyRenderer(renderer);
     }
@@ -102,62 +103,38 @@ void KeyLogger::stop() {
     running = false;
 }
 
+bool KeyLogger::startRecording(const char* path) {
+    recorder = caneta_capture_open_write(path);
+    if (!recorder) {
+        std::cerr << "Failed to open capture file: " << path << std::endl;
+        return false;
+    }
+
+    keyboard.setCaptureWriter(recorder);
+    std::cout << "Recording HID reports to " << path << std::endl;
+    return true;
+}
+
 void KeyLogger::processHIDReport(const uint8_t* report, uint16_t len) {
-    if (len < 8) return;
+    if (len < CANETA_REPORT_SIZE) return;
 
     // Print raw HID report
     printHIDReport(report, len);
 
-    // Update modifier state
+    // Show which keys are new, then let caneta-c translate them
     uint8_t modifiers = report[0];
-    kbd_state.shift_pressed = (modifiers & 0x22) != 0;  // Left or right shift
-    kbd_state.ctrl_pressed = (modifiers & 0x11) != 0;   // Left or right ctrl
-    kbd_state.alt_pressed = (modifiers & 0x44) != 0;    // Left or right alt
-
-    // Check for newly pressed keys
-    for (int i = 2; i < 8; i++) {
-        uint8_t keycode = report[i];
-        if (keycode == 0) continue;
-
-        // Check if this is a new key press
-        bool was_pressed = false;
-        for (int j = 0; j < 6; j++) {
-            if (kbd_state.last_keys[j] == keycode) {
-                was_pressed = true;
-                break;
-            }
-        }
-
-        if (!was_pressed) {
-            printKeyPress(keycode, kbd_state.shift_pressed,
-                         kbd_state.ctrl_pressed, kbd_state.alt_pressed);
-
-            // Process using caneta-c functions
-            const char* special_seq = process_special_keys(keycode);
-            if (*special_seq) {
-                printSpecialKey(special_seq);
-            } else {
-                char ascii_char = hid_to_ascii(keycode, kbd_state.shift_pressed);
-                if (ascii_char != 0) {
-                    // Handle Ctrl combinations
-                    if (kbd_state.ctrl_pressed && ascii_char >= 'a' && ascii_char <= 'z') {
-                        ascii_char = ascii_char - 'a' + 1;
-                    } else if (kbd_state.ctrl_pressed && ascii_char >= 'A' && ascii_char <= 'Z') {
-                        ascii_char = ascii_char - 'A' + 1;
-                    }
-                    printASCIIChar(ascii_char);
-                }
-            }
+    bool shift = (modifiers & CANETA_MODIFIER_SHIFT) != 0;  // Left or right shift
+    bool ctrl = (modifiers & CANETA_MODIFIER_CTRL) != 0;    // Left or right ctrl
+    bool alt = (modifiers & CANETA_MODIFIER_ALT) != 0;      // Left or right alt
+
+    uint8_t pressed = caneta_kbd_diff(&terminal.state(), report).pressed;
+    for (int slot = 0; slot < 6; slot++) {
+        if (pressed & (1 << slot)) {
+            printKeyPress(report[2 + slot], shift, ctrl, alt);
         }
     }
 
-    // Save current keys for next comparison
-    memset(kbd_state.last_keys, 0, 6);
-    for (int i = 2; i < 8; i++) {
-        if (report[i] != 0) {
-            kbd_state.last_keys[i-2] = report[i];
-        }
-    }
+    terminal.feed(report, len);
 }
 
 void KeyLogger::printHIDReport(const uint8_t* report, uint16_t len) {
@@ -196,37 +173,46 @@ void KeyLogger::printKeyPress(uint8_t keycode, bool shift, bool ctrl, bool alt)
     std::cout << std::endl;
 }
 
-void KeyLogger::printSpecialKey(const char* sequence) {
-    std::cout << "    VT100: ESC" << sequence;
-
-    // Show escape sequence in hex
-    std::cout << " (hex: 1B";
-    for (const char* p = sequence; *p; p++) {
-        std::cout << " " << std::hex << std::setw(2) << std::setfill('0')
-                  << (int)(unsigned char)*p;
+void KeyLogger::printOutput(const uint8_t* data, size_t len) {
+    std::cout << "    Output:";
+
+    // Readable form: control characters by name, ESC-prefixed sequences as ESC[...]
+    for (size_t i = 0; i < len; i++) {
+        unsigned char c = data[i];
+        std::cout << " ";
+        if (c == 27) {
+            std::cout << "ESC";
+            if (i + 1 < len && data[i + 1] == 'O' && i + 2 < len) {
+                // SS3: one final character
+                std::cout << (char)data[i + 1] << (char)data[i + 2];
+                i += 2;
+            } else if (i + 1 < len && data[i + 1] == '[') {
+                // CSI: parameters up to and including the final character
+                std::cout << (char)data[++i];
+                while (i + 1 < len) {
+                    char p = (char)data[++i];
+                    std::cout << p;
+                    if (p >= 0x40 && p <= 0x7E) break;
+                }
+            }
+        } else if (c >= 32 && c < 127) {
+            std::cout << "'" << (char)c << "'";
+        } else if (c == '\r') {
+            std::cout << "CR";
+        } else if (c == '\t') {
+            std::cout << "TAB";
+        } else if (c == '\b') {
+            std::cout << "BS";
+        } else {
+            std::cout << "Ctrl+" << (char)('@' + c);
+        }
     }
-    std::cout << std::dec << ")" << std::endl;
-}
 
-void KeyLogger::printASCIIChar(char c) {
-    std::cout << "    ASCII: ";
-
-    if (c >= 32 && c < 127) {
-        std::cout << "'" << c << "'";
-    } else if (c == '\r') {
-        std::cout << "CR";
-    } else if (c == '\n') {
-        std::cout << "LF";
-    } else if (c == '\t') {
-        std::cout << "TAB";
-    } else if (c == 27) {
-        std::cout << "ESC";
-    } else if (c < 32) {
-        std::cout << "Ctrl+" << (char)('A' + c - 1);
+    std::cout << " (hex:";
+    for (size_t i = 0; i < len; i++) {
+        std::cout << " " << std::hex << std::setw(2) << std::setfill('0') << (int)data[i];
     }
-
-    std::cout << " (0x" << std::hex << std::setw(2) << std::setfill('0')
-              << (int)(unsigned char)c << std::dec << ")" << std::endl;
+    std::cout << std::dec << ")" << std::endl;
 }
 
 std::string KeyLogger::getKeyName(uint8_t hidCode) {
@@ -312,9 +298,10 @@ void KeyLogger::renderStatus() {
     // Draw some status text (would need SDL_ttf for actual text)
     // For now, just show different colors based on modifier state
     int r = 64, g = 64, b = 64;
-    if (kbd_state.shift_pressed) g += 64;
-    if (kbd_state.ctrl_pressed) r += 64;
-    if (kbd_state.alt_pressed) b += 64;
+    const kbd_state_t& state = terminal.state();
+    if (kbd_state_shift(&state)) g += 64;
+    if (kbd_state_ctrl(&state)) r += 64;
+    if (kbd_state_alt(&state)) b += 64;
 
     SDL_Rect rect = {50, 50, 700, 500};
     SDL_SetRenderDrawColor(renderer, r, g, b, 255);
@@ -15,6 +15,7 @@
 extern "C" {
 #include "caneta.h"
 }
+#include "caneta.hpp"
 
 class KeyLogger {
   public:
@@ -30,6 +31,9 @@ class KeyLogger {
     // Stop the event loop
     void stop();
 
+    // Record every HID report to a capture file for later replay
+    bool startRecording(const char* path);
+
   private:
     // SDL resources
     SDL_Window* window;
@@ -39,8 +43,17 @@ class KeyLogger {
     // Caneta SDL to HID converter
     caneta::SDLToHID keyboard;
 
-    // Keyboard state for caneta-c
-    kbd_state_t kbd_state;
+    // Decoder sink: prints the terminal output of each report
+    struct TerminalOutput {
+        KeyLogger* logger;
+        void write(const uint8_t* data, size_t len) { logger->printOutput(data, len); }
+    };
+
+    // Keyboard state and decoder for caneta-c
+    caneta::Stream<TerminalOutput> terminal;
+
+    // Capture file being recorded, if any
+    caneta_capture_writer_t* recorder;
 
     // Process HID report from caneta-sdl
     void processHIDReport(const uint8_t* report, uint16_t len);
@@ -48,8 +61,7 @@ class KeyLogger {
     // Display functions
     void printHIDReport(const uint8_t* report, uint16_t len);
     void printKeyPress(uint8_t keycode, bool shift, bool ctrl, bool alt);
-    void printSpecialKey(const char* sequence);
-    void printASCIIChar(char c);
+    void printOutput(const uint8_t* data, size_t len);
 
     // Helper functions
     std::string getKeyName(uint8_t hidCode);
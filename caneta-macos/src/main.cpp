@@ -4,6 +4,7 @@
 #include "key_logger.h"
 #include <iostream>
 #include <csignal>
+#include <string>
 
 // Global pointer for signal handler
 KeyLogger* g_logger = nullptr;
@@ -34,6 +35,13 @@ int main(int argc, char* argv[]) {
     return 1;
   }
 
+  // Optionally record the session: caneta-macos-test --record session.cap
+  if (argc == 3 && std::string(argv[1]) == "--record") {
+    if (!logger.startRecording(argv[2])) {
+      return 1;
+    }
+  }
+
   // Run the main event loop
   logger.run();
 
@@ -0,0 +1,130 @@
+// main.c
+// caneta-replay: play a HID capture back through the caneta decoder
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <caneta.h>
+#include <caneta_capture.h>
+
+typedef struct {
+    caneta_decoder_t decoders[256];  // One per capture source
+    bool initialized[256];
+    FILE* out;
+    bool realtime;
+    uint64_t bytes;
+} replay_t;
+
+// Decoder sink: terminal output goes straight to the output file
+static void replay_write(void* ctx, const uint8_t* data, size_t len) {
+    replay_t* replay = ctx;
+    if (replay->out) {
+        fwrite(data, 1, len, replay->out);
+        if (replay->realtime) fflush(replay->out);  // Show keys as they are "typed"
+    }
+    replay->bytes += len;
+}
+
+static void replay_record(void* ctx, const caneta_capture_record_t* record) {
+    replay_t* replay = ctx;
+    caneta_decoder_t* decoder = &replay->decoders[record->source];
+    if (!replay->initialized[record->source]) {
+        caneta_decoder_init(decoder);
+        replay->initialized[record->source] = true;
+    }
+
+    caneta_sink_t sink = { replay_write, replay };
+    caneta_decoder_stream(decoder, record->report, 1, &sink);
+}
+
+static void usage(const char* argv0) {
+    fprintf(stderr,
+            "usage: %s [options] capture\n"
+            "  --realtime        replay with the original timing (default: as fast as possible)\n"
+            "  --start SECONDS   start at this many seconds into the capture\n"
+            "  --quiet           decode without writing output\n"
+            "  --info            print capture statistics and exit\n",
+            argv0);
+}
+
+int main(int argc, char* argv[]) {
+    bool realtime = false;
+    bool quiet = false;
+    bool info = false;
+    double start_seconds = 0;
+    const char* path = NULL;
+
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--realtime") == 0) {
+            realtime = true;
+        } else if (strcmp(argv[i], "--quiet") == 0) {
+            quiet = true;
+        } else if (strcmp(argv[i], "--info") == 0) {
+            info = true;
+        } else if (strcmp(argv[i], "--start") == 0 && i + 1 < argc) {
+            start_seconds = atof(argv[++i]);
+        } else if (argv[i][0] != '-' && !path) {
+            path = argv[i];
+        } else {
+            usage(argv[0]);
+            return 2;
+        }
+    }
+    if (!path) {
+        usage(argv[0]);
+        return 2;
+    }
+
+    caneta_capture_reader_t* reader = caneta_capture_open_read(path);
+    if (!reader) {
+        fprintf(stderr, "%s: not a caneta capture\n", path);
+        return 1;
+    }
+
+    caneta_capture_cursor_t cursor;
+    caneta_capture_record_t first;
+    if (!caneta_capture_seek_record(reader, 0, &cursor) || !caneta_capture_next(reader, &cursor, &first)) {
+        fprintf(stderr, "%s: capture is empty\n", path);
+        caneta_capture_close_read(reader);
+        return 1;
+    }
+
+    if (info) {
+        caneta_capture_record_t record = first;
+        caneta_capture_record_t last = first;
+        while (caneta_capture_next(reader, &cursor, &record)) {
+            last = record;
+        }
+        printf("records:  %llu\n", (unsigned long long)caneta_capture_record_count(reader));
+        printf("blocks:   %llu\n", (unsigned long long)caneta_capture_block_count(reader));
+        printf("duration: %.3f s\n", (double)(last.time_us - first.time_us) / 1e6);
+        caneta_capture_close_read(reader);
+        return 0;
+    }
+
+    uint64_t start_us = first.time_us + (uint64_t)(start_seconds * 1e6);
+    if (!caneta_capture_seek_time(reader, start_us, &cursor)) {
+        fprintf(stderr, "%s: capture ends before %.3f s\n", path, start_seconds);
+        caneta_capture_close_read(reader);
+        return 1;
+    }
+
+    replay_t* replay = calloc(1, sizeof(*replay));
+    replay->out = quiet ? NULL : stdout;
+    replay->realtime = realtime;
+
+    uint64_t started = caneta_capture_now_us();
+    uint64_t records = caneta_capture_replay(reader, &cursor, realtime, replay_record, replay);
+    double elapsed = (double)(caneta_capture_now_us() - started) / 1e6;
+
+    fprintf(stderr, "replayed %llu reports, %llu bytes in %.3f s (%.0f reports/s)\n",
+            (unsigned long long)records, (unsigned long long)replay->bytes, elapsed,
+            elapsed > 0 ? records / elapsed : 0.0);
+
+    free(replay);
+    caneta_capture_close_read(reader);
+    return 0;
+}
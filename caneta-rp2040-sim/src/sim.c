@@ -0,0 +1,793 @@
+// sim.c
+// caneta-rp2040-sim: the RP2040 firmware on the host
+//
+// libraries/caneta-rp2040/src/main.c is compiled unchanged against the stub
+// headers in stubs/, with its main() renamed. Core 0 is the main thread and
+// core 1 a second thread. Time is virtual: it moves only when the driver in
+// tuh_task() delivers the next report or core 1 is due to send a repeat, so
+// the output depends only on the input, never on how fast the host is.
+//
+// Reports come from a capture file or a generator. The UART is infinitely
+// fast: bytes land in the output buffer when the firmware starts a DMA
+// transfer, and the transfer completes at once. Every USB callback, every
+// DMA interrupt and every period core 1 spends awake is timed on the host
+// clock, so firmware changes can be benchmarked and their output diffed
+// without hardware.
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <pthread.h>
+#include <unistd.h>
+
+#include "pico/stdlib.h"
+#include "pico/multicore.h"
+#include "hardware/sync.h"
+#include "hardware/dma.h"
+#include "hardware/irq.h"
+#include "tusb.h"
+
+#include <caneta_capture.h>
+
+// The firmware's main(), renamed by the build
+int caneta_firmware_main(void);
+
+#define MAX_DEV_ADDR (CFG_TUH_DEVICE_MAX + CFG_TUH_HUB)
+#define MAX_SOURCES (MAX_DEV_ADDR * CFG_TUH_HID)
+
+// Core 1 gets this long (virtual) after the last report to finish its output
+#define SETTLE_US 2000000
+
+//--------------------------------------------------------------------+
+// Timing
+//--------------------------------------------------------------------+
+
+enum {
+    TIMER_MOUNT,
+    TIMER_HID_MOUNT,
+    TIMER_REPORT,
+    TIMER_HID_UMOUNT,
+    TIMER_UMOUNT,
+    TIMER_DMA_IRQ,
+    TIMER_CORE1,
+    TIMER_COUNT
+};
+
+static const char* const timer_names[TIMER_COUNT] = {
+    "tuh_mount_cb",
+    "tuh_hid_mount_cb",
+    "tuh_hid_report_received_cb",
+    "tuh_hid_umount_cb",
+    "tuh_umount_cb",
+    "dma_irq",
+    "core1_wake",
+};
+
+typedef struct {
+    uint64_t* samples;  // Nanoseconds
+    size_t count;
+    size_t capacity;
+} timing_t;
+
+static timing_t timers[TIMER_COUNT];
+
+static uint64_t host_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000u + (uint64_t)ts.tv_nsec;
+}
+
+// Each timer has one writer: the USB callbacks run on core 0, the rest on core 1
+static void timer_add(int timer, uint64_t ns) {
+    timing_t* t = &timers[timer];
+    if (t->count == t->capacity) {
+        t->capacity = t->capacity ? t->capacity * 2 : 1024;
+        t->samples = realloc(t->samples, t->capacity * sizeof(*t->samples));
+        if (!t->samples) abort();
+    }
+    t->samples[t->count++] = ns;
+}
+
+//--------------------------------------------------------------------+
+// Virtual clock and the two cores
+//--------------------------------------------------------------------+
+
+static struct {
+    pthread_mutex_t lock;
+    pthread_cond_t wake;      // Core 1 may have something to do
+    pthread_cond_t idle;      // Core 1 has gone to sleep
+    uint64_t now_us;          // Read without the lock, written with it
+
+    bool event[2];            // Per-core SEV latch
+    bool core1_running;
+    bool core1_sleeping;      // Waiting in __wfe, with nothing pending
+    bool core1_has_deadline;
+    uint64_t core1_deadline;
+
+    bool irq_enabled;
+    bool irq_pending;
+    bool in_irq;
+    irq_handler_t irq_handler;
+
+    uint8_t* output;          // Everything written to the UART
+    size_t output_len;
+    size_t output_capacity;
+} sim = {
+    .lock = PTHREAD_MUTEX_INITIALIZER,
+    .wake = PTHREAD_COND_INITIALIZER,
+    .idle = PTHREAD_COND_INITIALIZER,
+};
+
+static _Thread_local int current_core;
+static _Thread_local uint64_t core1_woke_ns;
+
+uint64_t sim_now_us(void) {
+    return __atomic_load_n(&sim.now_us, __ATOMIC_ACQUIRE);
+}
+
+static void set_now(uint64_t now_us) {
+    __atomic_store_n(&sim.now_us, now_us, __ATOMIC_RELEASE);
+}
+
+void sleep_us(uint64_t us) {
+    pthread_mutex_lock(&sim.lock);
+    set_now(sim.now_us + us);
+    pthread_mutex_unlock(&sim.lock);
+}
+
+void sleep_ms(uint32_t ms) {
+    sleep_us((uint64_t)ms * 1000);
+}
+
+// Run the DMA interrupt on core 1 while it is pending, as the NVIC would the
+// moment interrupts are unmasked
+static void service_irq(void) {
+    if (current_core != 1 || sim.in_irq) return;
+    for (;;) {
+        pthread_mutex_lock(&sim.lock);
+        bool run = sim.irq_enabled && sim.irq_pending && sim.irq_handler;
+        pthread_mutex_unlock(&sim.lock);
+        if (!run) return;
+
+        sim.in_irq = true;
+        uint64_t start = host_ns();
+        sim.irq_handler();
+        timer_add(TIMER_DMA_IRQ, host_ns() - start);
+        sim.in_irq = false;
+    }
+}
+
+void sim_signal(void) {
+    pthread_mutex_lock(&sim.lock);
+    sim.event[0] = true;
+    sim.event[1] = true;
+    sim.core1_sleeping = false;
+    pthread_cond_broadcast(&sim.wake);
+    pthread_mutex_unlock(&sim.lock);
+}
+
+bool sim_wait(bool has_deadline, uint64_t deadline_us) {
+    if (current_core == 0) {
+        // Core 0 only waits for the next USB event, and the driver in
+        // tuh_task() is where those come from
+        pthread_mutex_lock(&sim.lock);
+        sim.event[0] = false;
+        pthread_mutex_unlock(&sim.lock);
+        return false;
+    }
+
+    timer_add(TIMER_CORE1, host_ns() - core1_woke_ns);
+
+    bool timed_out = false;
+    for (;;) {
+        service_irq();
+
+        pthread_mutex_lock(&sim.lock);
+        if (sim.event[1]) {
+            sim.event[1] = false;
+            pthread_mutex_unlock(&sim.lock);
+            break;
+        }
+        if (sim.irq_enabled && sim.irq_pending) {
+            pthread_mutex_unlock(&sim.lock);
+            continue;
+        }
+        if (has_deadline && (int64_t)(sim.now_us - deadline_us) >= 0) {
+            pthread_mutex_unlock(&sim.lock);
+            timed_out = true;
+            break;
+        }
+
+        sim.core1_sleeping = true;
+        sim.core1_has_deadline = has_deadline;
+        sim.core1_deadline = deadline_us;
+        pthread_cond_broadcast(&sim.idle);
+        while (sim.core1_sleeping) pthread_cond_wait(&sim.wake, &sim.lock);
+        pthread_mutex_unlock(&sim.lock);
+    }
+
+    core1_woke_ns = host_ns();
+    return timed_out;
+}
+
+static void (*core1_entry)(void);
+
+static void* core1_thread(void* arg) {
+    (void)arg;
+    current_core = 1;
+    core1_woke_ns = host_ns();
+    core1_entry();
+    return NULL;
+}
+
+void multicore_launch_core1(void (*entry)(void)) {
+    core1_entry = entry;
+    pthread_mutex_lock(&sim.lock);
+    sim.core1_running = true;
+    pthread_mutex_unlock(&sim.lock);
+
+    pthread_t thread;
+    if (pthread_create(&thread, NULL, core1_thread, NULL) != 0) {
+        fprintf(stderr, "caneta-rp2040-sim: cannot start core 1\n");
+        exit(1);
+    }
+    pthread_detach(thread);
+}
+
+// Wait until core 1 has nothing left to do before the clock moves on.
+// Returns its wake-up deadline, if it has one.
+static bool wait_core1_idle(uint64_t* deadline_us) {
+    pthread_mutex_lock(&sim.lock);
+    while (sim.core1_running && !sim.core1_sleeping) pthread_cond_wait(&sim.idle, &sim.lock);
+    bool has_deadline = sim.core1_running && sim.core1_has_deadline;
+    *deadline_us = sim.core1_deadline;
+    pthread_mutex_unlock(&sim.lock);
+    return has_deadline;
+}
+
+// Move the clock to until_us, stopping at each of core 1's deadlines on the
+// way so repeats go out when they would on hardware
+static void advance_to(uint64_t until_us) {
+    uint64_t deadline_us;
+    while (wait_core1_idle(&deadline_us) && (int64_t)(deadline_us - until_us) <= 0) {
+        pthread_mutex_lock(&sim.lock);
+        if ((int64_t)(deadline_us - sim.now_us) > 0) set_now(deadline_us);
+        sim.core1_sleeping = false;
+        pthread_cond_broadcast(&sim.wake);
+        pthread_mutex_unlock(&sim.lock);
+    }
+
+    pthread_mutex_lock(&sim.lock);
+    if ((int64_t)(until_us - sim.now_us) > 0) set_now(until_us);
+    pthread_mutex_unlock(&sim.lock);
+}
+
+//--------------------------------------------------------------------+
+// Spin locks, DMA and interrupts
+//--------------------------------------------------------------------+
+
+struct sim_spin_lock {
+    pthread_mutex_t mutex;
+};
+
+#define SPIN_LOCKS 32
+
+static spin_lock_t spin_locks[SPIN_LOCKS];
+static int spin_locks_claimed;
+
+int spin_lock_claim_unused(bool required) {
+    if (spin_locks_claimed == SPIN_LOCKS) {
+        if (required) abort();
+        return -1;
+    }
+    pthread_mutex_init(&spin_locks[spin_locks_claimed].mutex, NULL);
+    return spin_locks_claimed++;
+}
+
+spin_lock_t* spin_lock_instance(unsigned lock_num) {
+    return &spin_locks[lock_num];
+}
+
+uint32_t spin_lock_blocking(spin_lock_t* lock) {
+    pthread_mutex_lock(&lock->mutex);
+    return 0;
+}
+
+void spin_unlock(spin_lock_t* lock, uint32_t saved_irq) {
+    (void)saved_irq;
+    pthread_mutex_unlock(&lock->mutex);
+    // Interrupts are unmasked again
+    service_irq();
+}
+
+uart_inst_t sim_uart1;
+
+int dma_claim_unused_channel(bool required) {
+    (void)required;
+    return 0;
+}
+
+dma_channel_config dma_channel_get_default_config(unsigned channel) {
+    (void)channel;
+    dma_channel_config config = { 0 };
+    return config;
+}
+
+void dma_channel_configure(unsigned channel, const dma_channel_config* config, volatile void* write_addr,
+                           const volatile void* read_addr, unsigned transfer_count, bool trigger) {
+    (void)config;
+    (void)write_addr;
+    if (trigger) dma_channel_transfer_from_buffer_now(channel, read_addr, transfer_count);
+}
+
+void dma_channel_set_irq0_enabled(unsigned channel, bool enabled) {
+    (void)channel;
+    (void)enabled;
+}
+
+void dma_channel_transfer_from_buffer_now(unsigned channel, const volatile void* read_addr, uint32_t count) {
+    (void)channel;
+    pthread_mutex_lock(&sim.lock);
+    if (sim.output_len + count > sim.output_capacity) {
+        while (sim.output_len + count > sim.output_capacity) {
+            sim.output_capacity = sim.output_capacity ? sim.output_capacity * 2 : 65536;
+        }
+        sim.output = realloc(sim.output, sim.output_capacity);
+        if (!sim.output) abort();
+    }
+    memcpy(sim.output + sim.output_len, (const void*)read_addr, count);
+    sim.output_len += count;
+
+    // Done already: the completion interrupt wakes core 1
+    sim.irq_pending = true;
+    sim.core1_sleeping = false;
+    pthread_cond_broadcast(&sim.wake);
+    pthread_mutex_unlock(&sim.lock);
+}
+
+void dma_channel_acknowledge_irq0(unsigned channel) {
+    (void)channel;
+    pthread_mutex_lock(&sim.lock);
+    sim.irq_pending = false;
+    pthread_mutex_unlock(&sim.lock);
+}
+
+void irq_set_exclusive_handler(unsigned num, irq_handler_t handler) {
+    (void)num;
+    sim.irq_handler = handler;
+}
+
+void irq_set_enabled(unsigned num, bool enabled) {
+    (void)num;
+    pthread_mutex_lock(&sim.lock);
+    sim.irq_enabled = enabled;
+    pthread_mutex_unlock(&sim.lock);
+    service_irq();
+}
+
+//--------------------------------------------------------------------+
+// Report sources
+//--------------------------------------------------------------------+
+
+typedef enum { GEN_NONE, GEN_TYPING, GEN_BURST, GEN_HOLD } generator_t;
+
+static struct {
+    const char* capture;
+    generator_t generator;
+    uint64_t reports;
+    unsigned keyboards;
+    uint32_t seed;
+    const char* output;
+    const char* expect;
+    const char* json;
+    const char* record;
+    bool quiet;
+} options = {
+    .reports = 10000,
+    .keyboards = 1,
+    .seed = 1,
+};
+
+// Next record, from the capture or the generator. Generators deal
+// press/release pairs to the keyboards in turn; times start at 0.
+typedef struct {
+    caneta_capture_reader_t* reader;
+    caneta_capture_cursor_t cursor;
+    uint64_t first_us;
+
+    uint64_t produced;
+    uint32_t rng;
+    uint64_t time_us;
+    bool released;
+    uint8_t key;
+    uint8_t modifiers;
+} source_t;
+
+static uint32_t rng_next(source_t* s, uint32_t range) {
+    s->rng = s->rng * 1664525u + 1013904223u;
+    return (s->rng >> 8) % range;
+}
+
+static bool source_next(source_t* s, caneta_capture_record_t* record) {
+    if (s->reader) {
+        if (!caneta_capture_next(s->reader, &s->cursor, record)) return false;
+        record->time_us -= s->first_us;
+        return true;
+    }
+    if (s->produced == options.reports) return false;
+
+    memset(record, 0, sizeof(*record));
+    record->source = (uint8_t)(s->produced / 2 % options.keyboards);
+    bool press = s->released;
+
+    switch (options.generator) {
+        case GEN_TYPING:
+            // Letters, digits and space at 60-200 ms a key, with the odd
+            // shifted character; keys are held 40-120 ms
+            if (press) {
+                s->time_us += 60000 + rng_next(s, 140000);
+                uint32_t pick = rng_next(s, 40);
+                s->key = pick < 26 ? 0x04 + pick : pick < 36 ? 0x1E + (pick - 26) : 0x2C;
+                s->modifiers = rng_next(s, 10) == 0 ? 0x02 : 0;
+            } else {
+                s->time_us += 40000 + rng_next(s, 80000);
+            }
+            break;
+        case GEN_BURST:
+            // A report every USB poll (1 ms), as fast as a paste or a macro
+            s->time_us += 1000;
+            if (press) s->key = 0x04 + rng_next(s, 26);
+            break;
+        case GEN_HOLD:
+            // Hold a key for 1.5 s so it auto-repeats, then pause
+            s->time_us += press ? 500000 : 1500000;
+            if (press) s->key = 0x04 + rng_next(s, 26);
+            break;
+        case GEN_NONE:
+            return false;
+    }
+
+    if (press) {
+        record->report[0] = s->modifiers;
+        record->report[2] = s->key;
+    }
+    record->time_us = s->time_us;
+    s->released = !press;
+    s->produced++;
+    return true;
+}
+
+// Captures and generators number their keyboards; the firmware sees source n
+// as HID instance n % CFG_TUH_HID of device 1 + n / CFG_TUH_HID
+static uint8_t source_dev_addr(uint8_t source) { return (uint8_t)(1 + source / CFG_TUH_HID); }
+static uint8_t source_instance(uint8_t source) { return (uint8_t)(source % CFG_TUH_HID); }
+
+//--------------------------------------------------------------------+
+// TinyUSB host
+//--------------------------------------------------------------------+
+
+bool tuh_configure(uint8_t rhport, uint32_t cfg_id, const void* cfg_param) {
+    (void)rhport;
+    (void)cfg_id;
+    (void)cfg_param;
+    return true;
+}
+
+bool tuh_init(uint8_t rhport) {
+    (void)rhport;
+    return true;
+}
+
+static uint8_t protocols[MAX_DEV_ADDR + 1][CFG_TUH_HID];
+static uint64_t reports_delivered;
+static uint64_t receive_requests;
+
+bool tuh_hid_set_protocol(uint8_t dev_addr, uint8_t instance, uint8_t protocol) {
+    if (dev_addr <= MAX_DEV_ADDR && instance < CFG_TUH_HID) protocols[dev_addr][instance] = protocol;
+    return true;
+}
+
+bool tuh_hid_receive_report(uint8_t dev_addr, uint8_t instance) {
+    (void)dev_addr;
+    (void)instance;
+    receive_requests++;
+    return true;
+}
+
+uint8_t tuh_hid_interface_protocol(uint8_t dev_addr, uint8_t instance) {
+    (void)dev_addr;
+    (void)instance;
+    return 1;  // Keyboard
+}
+
+static caneta_capture_writer_t* recorder;
+static uint64_t reports_unrecorded;  // Longer than a capture's boot reports
+
+void sim_report_hook(uint8_t dev_addr, uint8_t instance, const uint8_t* report, uint16_t len) {
+    if (!recorder) return;
+    uint8_t source = (uint8_t)((dev_addr - 1) * CFG_TUH_HID + instance);
+    if (!caneta_capture_write(recorder, sim_now_us(), source, report, len)) reports_unrecorded++;
+}
+
+#define TIMED(timer, call)                              \
+    do {                                                \
+        uint64_t start_ = host_ns();                    \
+        call;                                           \
+        timer_add(timer, host_ns() - start_);           \
+    } while (0)
+
+static bool mounted[MAX_SOURCES];
+
+static void mount_source(uint8_t source) {
+    uint8_t dev_addr = source_dev_addr(source);
+    bool device_mounted = false;
+    for (uint8_t i = 0; i < CFG_TUH_HID; i++) {
+        device_mounted |= mounted[(dev_addr - 1) * CFG_TUH_HID + i];
+    }
+    if (!device_mounted) TIMED(TIMER_MOUNT, tuh_mount_cb(dev_addr));
+
+    // No report descriptor: the firmware uses boot protocol, as captures are
+    // boot reports
+    TIMED(TIMER_HID_MOUNT, tuh_hid_mount_cb(dev_addr, source_instance(source), NULL, 0));
+    mounted[source] = true;
+}
+
+static void unmount_all(void) {
+    for (uint8_t dev_addr = 1; dev_addr <= MAX_DEV_ADDR; dev_addr++) {
+        bool device_mounted = false;
+        for (uint8_t instance = 0; instance < CFG_TUH_HID; instance++) {
+            uint8_t source = (uint8_t)((dev_addr - 1) * CFG_TUH_HID + instance);
+            if (!mounted[source]) continue;
+            TIMED(TIMER_HID_UMOUNT, tuh_hid_umount_cb(dev_addr, instance));
+            mounted[source] = false;
+            device_mounted = true;
+        }
+        if (device_mounted) TIMED(TIMER_UMOUNT, tuh_umount_cb(dev_addr));
+    }
+}
+
+//--------------------------------------------------------------------+
+// Results
+//--------------------------------------------------------------------+
+
+static int compare_u64(const void* a, const void* b) {
+    uint64_t x = *(const uint64_t*)a;
+    uint64_t y = *(const uint64_t*)b;
+    return x < y ? -1 : x > y;
+}
+
+typedef struct {
+    size_t count;
+    double mean;
+    uint64_t p50, p99, max;
+} summary_t;
+
+static summary_t summarize(timing_t* t) {
+    summary_t s = { t->count, 0, 0, 0, 0 };
+    if (t->count == 0) return s;
+    qsort(t->samples, t->count, sizeof(*t->samples), compare_u64);
+    uint64_t total = 0;
+    for (size_t i = 0; i < t->count; i++) total += t->samples[i];
+    s.mean = (double)total / t->count;
+    s.p50 = t->samples[t->count / 2];
+    s.p99 = t->samples[t->count * 99 / 100];
+    s.max = t->samples[t->count - 1];
+    return s;
+}
+
+static bool write_json(const char* path, const summary_t* summaries, double wall_s) {
+    FILE* f = fopen(path, "w");
+    if (!f) return false;
+    fprintf(f, "{\n  \"reports\": %llu,\n  \"output_bytes\": %zu,\n  \"virtual_s\": %.6f,\n  \"wall_s\": %.6f,\n",
+            (unsigned long long)reports_delivered, sim.output_len, sim_now_us() / 1e6, wall_s);
+    fprintf(f, "  \"timers_ns\": {\n");
+    for (int i = 0; i < TIMER_COUNT; i++) {
+        const summary_t* s = &summaries[i];
+        fprintf(f, "    \"%s\": {\"count\": %zu, \"mean\": %.1f, \"p50\": %llu, \"p99\": %llu, \"max\": %llu}%s\n",
+                timer_names[i], s->count, s->mean, (unsigned long long)s->p50, (unsigned long long)s->p99,
+                (unsigned long long)s->max, i + 1 < TIMER_COUNT ? "," : "");
+    }
+    fprintf(f, "  }\n}\n");
+    return fclose(f) == 0;
+}
+
+// Compare the UART output with a reference. Returns false, describing the
+// first difference, if they differ.
+static bool check_expected(const char* path) {
+    FILE* f = fopen(path, "rb");
+    if (!f) {
+        fprintf(stderr, "%s: cannot open\n", path);
+        return false;
+    }
+    size_t offset = 0;
+    int c;
+    while ((c = fgetc(f)) != EOF) {
+        if (offset == sim.output_len || sim.output[offset] != (uint8_t)c) break;
+        offset++;
+    }
+    bool same = c == EOF && offset == sim.output_len;
+    fclose(f);
+    if (!same) fprintf(stderr, "output differs from %s at byte %zu\n", path, offset);
+    return same;
+}
+
+static uint64_t wall_start_ns;
+
+static void finish(void) {
+    double wall_s = (host_ns() - wall_start_ns) / 1e9;
+    int status = 0;
+
+    if (recorder && !caneta_capture_close_write(recorder)) {
+        fprintf(stderr, "%s: write failed\n", options.record);
+        status = 1;
+    }
+    if (reports_unrecorded > 0) {
+        fprintf(stderr, "%s: %llu reports longer than %d bytes not recorded\n", options.record,
+                (unsigned long long)reports_unrecorded, CANETA_CAPTURE_REPORT_SIZE);
+        status = 1;
+    }
+
+    // Core 1 is asleep with nothing to do, so the output no longer changes
+    pthread_mutex_lock(&sim.lock);
+    summary_t summaries[TIMER_COUNT];
+    for (int i = 0; i < TIMER_COUNT; i++) summaries[i] = summarize(&timers[i]);
+
+    if (!options.quiet) {
+        fprintf(stderr, "%llu reports, %zu output bytes, %.3f s virtual, %.3f s wall\n",
+                (unsigned long long)reports_delivered, sim.output_len, sim_now_us() / 1e6, wall_s);
+        fprintf(stderr, "%-28s %10s %10s %10s %10s %10s\n", "ns", "count", "mean", "p50", "p99", "max");
+        for (int i = 0; i < TIMER_COUNT; i++) {
+            const summary_t* s = &summaries[i];
+            fprintf(stderr, "%-28s %10zu %10.0f %10llu %10llu %10llu\n", timer_names[i], s->count, s->mean,
+                    (unsigned long long)s->p50, (unsigned long long)s->p99, (unsigned long long)s->max);
+        }
+    }
+
+    if (options.output) {
+        FILE* f = fopen(options.output, "wb");
+        if (!f || fwrite(sim.output, 1, sim.output_len, f) != sim.output_len || fclose(f) != 0) {
+            fprintf(stderr, "%s: write failed\n", options.output);
+            status = 1;
+        }
+    }
+    if (options.json && !write_json(options.json, summaries, wall_s)) {
+        fprintf(stderr, "%s: write failed\n", options.json);
+        status = 1;
+    }
+    if (options.expect && !check_expected(options.expect)) status = 1;
+
+    fflush(stderr);
+    _exit(status);
+}
+
+// Core 0's main loop calls this between sleeps. The first call plays the
+// whole input: each record's time is reached (with core 1's repeats on the
+// way), the record is delivered, and core 1 finishes with it before the
+// clock moves again. Records with the same time are delivered back to back.
+static source_t source;
+
+void tuh_task(void) {
+    uint64_t boot_us = sim_now_us();
+    caneta_capture_record_t record;
+
+    while (source_next(&source, &record)) {
+        if (record.source >= MAX_SOURCES) {
+            fprintf(stderr, "source %u: the firmware takes at most %d keyboards\n", record.source,
+                    MAX_SOURCES);
+            _exit(1);
+        }
+        advance_to(boot_us + record.time_us);
+        if (!mounted[record.source]) mount_source(record.source);
+
+        TIMED(TIMER_REPORT, tuh_hid_report_received_cb(source_dev_addr(record.source),
+                                                       source_instance(record.source), record.report,
+                                                       CANETA_CAPTURE_REPORT_SIZE));
+        reports_delivered++;
+    }
+
+    // Let the last repeats and output drain, then unplug everything
+    advance_to(sim_now_us() + SETTLE_US);
+    unmount_all();
+    uint64_t deadline_us;
+    wait_core1_idle(&deadline_us);
+    finish();
+}
+
+//--------------------------------------------------------------------+
+// Command line
+//--------------------------------------------------------------------+
+
+static void usage(const char* argv0) {
+    fprintf(stderr,
+            "usage: %s [options] (capture | --generate typing|burst|hold)\n"
+            "  --reports N       reports to generate (default 10000)\n"
+            "  --keyboards N     keyboards to spread generated reports over (default 1)\n"
+            "  --seed N          generator seed (default 1)\n"
+            "  --output FILE     write the UART output to FILE\n"
+            "  --expect FILE     exit 1 unless the UART output matches FILE\n"
+            "  --json FILE       write callback timings to FILE\n"
+            "  --record FILE     record the reports the firmware receives as a capture\n"
+            "  --quiet           don't print the timing table\n",
+            argv0);
+}
+
+int main(int argc, char* argv[]) {
+    for (int i = 1; i < argc; i++) {
+        const char* arg = argv[i];
+        const char* value = i + 1 < argc ? argv[i + 1] : NULL;
+        if (strcmp(arg, "--quiet") == 0) {
+            options.quiet = true;
+            continue;
+        }
+        if (arg[0] != '-' && !options.capture) {
+            options.capture = arg;
+            continue;
+        }
+        if (!value) {
+            usage(argv[0]);
+            return 2;
+        }
+        i++;
+        if (strcmp(arg, "--generate") == 0) {
+            options.generator = strcmp(value, "typing") == 0 ? GEN_TYPING
+                                : strcmp(value, "burst") == 0 ? GEN_BURST
+                                : strcmp(value, "hold") == 0 ? GEN_HOLD
+                                : GEN_NONE;
+            if (options.generator == GEN_NONE) {
+                usage(argv[0]);
+                return 2;
+            }
+        } else if (strcmp(arg, "--reports") == 0) {
+            options.reports = strtoull(value, NULL, 10);
+        } else if (strcmp(arg, "--keyboards") == 0) {
+            options.keyboards = (unsigned)atoi(value);
+        } else if (strcmp(arg, "--seed") == 0) {
+            options.seed = (uint32_t)strtoul(value, NULL, 10);
+        } else if (strcmp(arg, "--output") == 0) {
+            options.output = value;
+        } else if (strcmp(arg, "--expect") == 0) {
+            options.expect = value;
+        } else if (strcmp(arg, "--json") == 0) {
+            options.json = value;
+        } else if (strcmp(arg, "--record") == 0) {
+            options.record = value;
+        } else {
+            usage(argv[0]);
+            return 2;
+        }
+    }
+    if (!options.capture == (options.generator == GEN_NONE) || options.keyboards == 0 ||
+        options.keyboards > MAX_SOURCES) {
+        usage(argv[0]);
+        return 2;
+    }
+
+    if (options.capture) {
+        source.reader = caneta_capture_open_read(options.capture);
+        caneta_capture_record_t first;
+        if (!source.reader || !caneta_capture_seek_record(source.reader, 0, &source.cursor) ||
+            !caneta_capture_next(source.reader, &source.cursor, &first)) {
+            fprintf(stderr, "%s: not a caneta capture, or empty\n", options.capture);
+            return 1;
+        }
+        source.first_us = first.time_us;
+        caneta_capture_seek_record(source.reader, 0, &source.cursor);
+    } else {
+        source.rng = options.seed;
+        source.released = true;
+    }
+
+    if (options.record) {
+        recorder = caneta_capture_open_write(options.record);
+        if (!recorder) {
+            fprintf(stderr, "%s: cannot create\n", options.record);
+            return 1;
+        }
+    }
+
+    wall_start_ns = host_ns();
+    return caneta_firmware_main();
+}
@@ -0,0 +1,8 @@
+// class/hid/hid_host.h (host simulation): everything is declared in tusb.h
+
+#ifndef CANETA_SIM_HID_HOST_H
+#define CANETA_SIM_HID_HOST_H
+
+#include "tusb.h"
+
+#endif // CANETA_SIM_HID_HOST_H
@@ -0,0 +1,42 @@
+// hardware/dma.h (host simulation): a transfer to the UART completes at once,
+// appending to the captured output and raising DMA_IRQ_0
+
+#ifndef CANETA_SIM_HARDWARE_DMA_H
+#define CANETA_SIM_HARDWARE_DMA_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+enum dma_channel_transfer_size { DMA_SIZE_8 = 0, DMA_SIZE_16 = 1, DMA_SIZE_32 = 2 };
+
+typedef struct {
+    uint32_t ctrl;
+} dma_channel_config;
+
+int dma_claim_unused_channel(bool required);
+dma_channel_config dma_channel_get_default_config(unsigned channel);
+
+static inline void channel_config_set_transfer_data_size(dma_channel_config* c, enum dma_channel_transfer_size size) {
+    (void)c;
+    (void)size;
+}
+static inline void channel_config_set_read_increment(dma_channel_config* c, bool incr) {
+    (void)c;
+    (void)incr;
+}
+static inline void channel_config_set_write_increment(dma_channel_config* c, bool incr) {
+    (void)c;
+    (void)incr;
+}
+static inline void channel_config_set_dreq(dma_channel_config* c, unsigned dreq) {
+    (void)c;
+    (void)dreq;
+}
+
+void dma_channel_configure(unsigned channel, const dma_channel_config* config, volatile void* write_addr,
+                           const volatile void* read_addr, unsigned transfer_count, bool trigger);
+void dma_channel_set_irq0_enabled(unsigned channel, bool enabled);
+void dma_channel_transfer_from_buffer_now(unsigned channel, const volatile void* read_addr, uint32_t count);
+void dma_channel_acknowledge_irq0(unsigned channel);
+
+#endif // CANETA_SIM_HARDWARE_DMA_H
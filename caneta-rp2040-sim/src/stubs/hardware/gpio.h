@@ -0,0 +1,15 @@
+// hardware/gpio.h (host simulation)
+
+#ifndef CANETA_SIM_HARDWARE_GPIO_H
+#define CANETA_SIM_HARDWARE_GPIO_H
+
+#include <stdint.h>
+
+enum gpio_function { GPIO_FUNC_UART = 2 };
+
+static inline void gpio_set_function(uint32_t gpio, enum gpio_function fn) {
+    (void)gpio;
+    (void)fn;
+}
+
+#endif // CANETA_SIM_HARDWARE_GPIO_H
@@ -0,0 +1,16 @@
+// hardware/irq.h (host simulation): interrupts run on the core that enabled
+// them, whenever that core unlocks a spin lock or goes to sleep
+
+#ifndef CANETA_SIM_HARDWARE_IRQ_H
+#define CANETA_SIM_HARDWARE_IRQ_H
+
+#include <stdbool.h>
+
+#define DMA_IRQ_0 11
+
+typedef void (*irq_handler_t)(void);
+
+void irq_set_exclusive_handler(unsigned num, irq_handler_t handler);
+void irq_set_enabled(unsigned num, bool enabled);
+
+#endif // CANETA_SIM_HARDWARE_IRQ_H
@@ -0,0 +1,22 @@
+// hardware/sync.h (host simulation): WFE/SEV are events on the virtual
+// clock, and spin locks are mutexes
+
+#ifndef CANETA_SIM_HARDWARE_SYNC_H
+#define CANETA_SIM_HARDWARE_SYNC_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "sim.h"
+
+typedef struct sim_spin_lock spin_lock_t;
+
+static inline void __wfe(void) { sim_wait(false, 0); }
+static inline void __sev(void) { sim_signal(); }
+
+int spin_lock_claim_unused(bool required);
+spin_lock_t* spin_lock_instance(unsigned lock_num);
+uint32_t spin_lock_blocking(spin_lock_t* lock);
+void spin_unlock(spin_lock_t* lock, uint32_t saved_irq);
+
+#endif // CANETA_SIM_HARDWARE_SYNC_H
@@ -0,0 +1,48 @@
+// hardware/uart.h (host simulation): configuration is accepted and ignored;
+// bytes reach the UART through the simulated DMA
+
+#ifndef CANETA_SIM_HARDWARE_UART_H
+#define CANETA_SIM_HARDWARE_UART_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+typedef struct {
+    volatile uint32_t dr;
+} uart_hw_t;
+
+typedef struct uart_inst {
+    uart_hw_t hw;
+} uart_inst_t;
+
+extern uart_inst_t sim_uart1;
+#define uart1 (&sim_uart1)
+
+typedef enum { UART_PARITY_NONE, UART_PARITY_EVEN, UART_PARITY_ODD } uart_parity_t;
+
+static inline uint32_t uart_init(uart_inst_t* uart, uint32_t baudrate) {
+    (void)uart;
+    return baudrate;
+}
+static inline void uart_set_hw_flow(uart_inst_t* uart, bool cts, bool rts) {
+    (void)uart;
+    (void)cts;
+    (void)rts;
+}
+static inline void uart_set_format(uart_inst_t* uart, uint32_t data_bits, uint32_t stop_bits, uart_parity_t parity) {
+    (void)uart;
+    (void)data_bits;
+    (void)stop_bits;
+    (void)parity;
+}
+static inline void uart_set_fifo_enabled(uart_inst_t* uart, bool enabled) {
+    (void)uart;
+    (void)enabled;
+}
+static inline uint32_t uart_get_dreq(uart_inst_t* uart, bool is_tx) {
+    (void)uart;
+    return is_tx ? 1 : 0;
+}
+static inline uart_hw_t* uart_get_hw(uart_inst_t* uart) { return &uart->hw; }
+
+#endif // CANETA_SIM_HARDWARE_UART_H
@@ -0,0 +1,8 @@
+// pico/multicore.h (host simulation): core 1 is a thread
+
+#ifndef CANETA_SIM_PICO_MULTICORE_H
+#define CANETA_SIM_PICO_MULTICORE_H
+
+void multicore_launch_core1(void (*entry)(void));
+
+#endif // CANETA_SIM_PICO_MULTICORE_H
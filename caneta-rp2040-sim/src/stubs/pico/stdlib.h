@@ -0,0 +1,28 @@
+// pico/stdlib.h (host simulation)
+
+#ifndef CANETA_SIM_PICO_STDLIB_H
+#define CANETA_SIM_PICO_STDLIB_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "sim.h"
+#include "hardware/gpio.h"
+#include "hardware/uart.h"
+
+typedef uint64_t absolute_time_t;
+
+static inline absolute_time_t get_absolute_time(void) { return sim_now_us(); }
+static inline uint32_t to_ms_since_boot(absolute_time_t t) { return (uint32_t)(t / 1000); }
+static inline uint32_t time_us_32(void) { return (uint32_t)sim_now_us(); }
+static inline absolute_time_t make_timeout_time_us(uint64_t us) { return sim_now_us() + us; }
+static inline absolute_time_t make_timeout_time_ms(uint32_t ms) { return sim_now_us() + (uint64_t)ms * 1000; }
+
+static inline bool best_effort_wfe_or_timeout(absolute_time_t timeout) { return sim_wait(true, timeout); }
+
+// Moves the virtual clock on; only used while booting
+void sleep_ms(uint32_t ms);
+void sleep_us(uint64_t us);
+
+#endif // CANETA_SIM_PICO_STDLIB_H
@@ -0,0 +1,18 @@
+// pio_usb.h (host simulation)
+
+#ifndef CANETA_SIM_PIO_USB_H
+#define CANETA_SIM_PIO_USB_H
+
+#include <stdint.h>
+
+#define PIO_USB_PINOUT_DPDM 0
+#define PIO_USB_PINOUT_DMDP 1
+
+typedef struct {
+    uint8_t pin_dp;
+    uint8_t pinout;
+} pio_usb_configuration_t;
+
+#define PIO_USB_DEFAULT_CONFIG { 0, PIO_USB_PINOUT_DPDM }
+
+#endif // CANETA_SIM_PIO_USB_H
@@ -0,0 +1,27 @@
+// sim.h
+// Host simulation of the RP2040 firmware: the parts of the Pico SDK, PIO-USB
+// and TinyUSB that caneta-rp2040/src/main.c uses, implemented over threads
+// and a virtual clock in sim.c
+
+#ifndef CANETA_RP2040_SIM_H
+#define CANETA_RP2040_SIM_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+// Virtual time since boot, in microseconds
+uint64_t sim_now_us(void);
+
+// Wait for an event on the calling core, until deadline_us if has_deadline.
+// Returns true if the deadline was reached.
+bool sim_wait(bool has_deadline, uint64_t deadline_us);
+
+// Signal an event to both cores
+void sim_signal(void);
+
+// Every report the firmware receives, for --record
+void sim_report_hook(uint8_t dev_addr, uint8_t instance, const uint8_t* report, uint16_t len);
+#define CANETA_REPORT_HOOK(dev_addr, instance, report, len) sim_report_hook(dev_addr, instance, report, len)
+
+#endif // CANETA_RP2040_SIM_H
@@ -0,0 +1,33 @@
+// tusb.h (host simulation): the USB host API the firmware calls, and the
+// callbacks it implements, which sim.c drives from captures and generators
+
+#ifndef CANETA_SIM_TUSB_H
+#define CANETA_SIM_TUSB_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#define CFG_TUSB_MCU 0
+#include "tusb_config.h"
+
+#define HID_PROTOCOL_BOOT 0
+#define HID_PROTOCOL_REPORT 1
+
+#define TUH_CFGID_RPI_PIO_USB_CONFIGURATION 100
+
+bool tuh_configure(uint8_t rhport, uint32_t cfg_id, const void* cfg_param);
+bool tuh_init(uint8_t rhport);
+
+// Delivers the next reports of the simulation; ends the process when done
+void tuh_task(void);
+
+uint8_t tuh_hid_interface_protocol(uint8_t dev_addr, uint8_t instance);
+
+// Implemented by the firmware
+void tuh_mount_cb(uint8_t dev_addr);
+void tuh_umount_cb(uint8_t dev_addr);
+void tuh_hid_mount_cb(uint8_t dev_addr, uint8_t instance, uint8_t const* desc_report, uint16_t desc_len);
+void tuh_hid_umount_cb(uint8_t dev_addr, uint8_t instance);
+void tuh_hid_report_received_cb(uint8_t dev_addr, uint8_t instance, uint8_t const* report, uint16_t len);
+
+#endif // CANETA_SIM_TUSB_H
@@ -3,100 +3,405 @@
 //
 
 #include "caneta.h"
+#include "caneta_compose.h"
+#include "caneta_layout.h"
 #include <string.h>
 
-kbd_state_t kbd_state = {0};
+// HID keycode -> ASCII (US keyboard layout), indexed by [modifier class][keycode].
+// Modifier class 0 is unshifted, 1 is shifted. Keycodes without a mapping are 0.
+static const char ascii_table[CANETA_MOD_CLASSES][256] = {
+    [CANETA_MOD_NONE] = {
+        [0x04] = 'a', [0x05] = 'b', [0x06] = 'c', [0x07] = 'd',
+        [0x08] = 'e', [0x09] = 'f', [0x0A] = 'g', [0x0B] = 'h',
+        [0x0C] = 'i', [0x0D] = 'j', [0x0E] = 'k', [0x0F] = 'l',
+        [0x10] = 'm', [0x11] = 'n', [0x12] = 'o', [0x13] = 'p',
+        [0x14] = 'q', [0x15] = 'r', [0x16] = 's', [0x17] = 't',
+        [0x18] = 'u', [0x19] = 'v', [0x1A] = 'w', [0x1B] = 'x',
+        [0x1C] = 'y', [0x1D] = 'z', [0x1E] = '1', [0x1F] = '2',
+        [0x20] = '3', [0x21] = '4', [0x22] = '5', [0x23] = '6',
+        [0x24] = '7', [0x25] = '8', [0x26] = '9', [0x27] = '0',
+        [0x28] = '\r', [0x29] = '\x1B', [0x2A] = '\b', [0x2B] = '\t',
+        [0x2C] = ' ', [0x2D] = '-', [0x2E] = '=', [0x2F] = '[',
+        [0x30] = ']', [0x31] = '\\', [0x33] = ';', [0x34] = '\'',
+        [0x35] = '`', [0x36] = ',', [0x37] = '.', [0x38] = '/',
+    },
+    [CANETA_MOD_SHIFT] = {
+        [0x04] = 'A', [0x05] = 'B', [0x06] = 'C', [0x07] = 'D',
+        [0x08] = 'E', [0x09] = 'F', [0x0A] = 'G', [0x0B] = 'H',
+        [0x0C] = 'I', [0x0D] = 'J', [0x0E] = 'K', [0x0F] = 'L',
+        [0x10] = 'M', [0x11] = 'N', [0x12] = 'O', [0x13] = 'P',
+        [0x14] = 'Q', [0x15] = 'R', [0x16] = 'S', [0x17] = 'T',
+        [0x18] = 'U', [0x19] = 'V', [0x1A] = 'W', [0x1B] = 'X',
+        [0x1C] = 'Y', [0x1D] = 'Z', [0x1E] = '!', [0x1F] = '@',
+        [0x20] = '#', [0x21] = '$', [0x22] = '%', [0x23] = '^',
+        [0x24] = '&', [0x25] = '*', [0x26] = '(', [0x27] = ')',
+        [0x28] = '\r', [0x29] = '\x1B', [0x2A] = '\b', [0x2B] = '\t',
+        [0x2C] = ' ', [0x2D] = '_', [0x2E] = '+', [0x2F] = '{',
+        [0x30] = '}', [0x31] = '|', [0x33] = ':', [0x34] = '"',
+        [0x35] = '~', [0x36] = '<', [0x37] = '>', [0x38] = '?',
+    },
+};
+
+// Modifier combinations a key is encoded with, numbered as xterm does less
+// one: Shift 1, Alt 2, Ctrl 4
+#define KEY_MOD_SHIFT 1
+#define KEY_MOD_ALT 2
+#define KEY_MOD_CTRL 4
+#define KEY_MODS 8
+
+// Escape sequences of the special keys (without the leading ESC), for each
+// modifier combination: xterm's CSI 1;m final for the cursor keys, Home, End
+// and F1-F4, and CSI n;m ~ for the rest. Each entry carries its length so
+// callers never need strlen and a key costs one fixed-size copy, and every
+// sequence is NUL-terminated so process_special_keys can hand out the
+// unmodified ones.
+typedef struct {
+    uint8_t len;
+    char seq[CANETA_SPECIAL_SEQ_MAX];
+} special_seq_t;
+
+#define SEQ(s) { sizeof(s) - 1, s }
+#define CURSOR_KEY(plain, final)                                                   \
+    { SEQ(plain), SEQ("[1;2" final), SEQ("[1;3" final), SEQ("[1;4" final),       \
+      SEQ("[1;5" final), SEQ("[1;6" final), SEQ("[1;7" final), SEQ("[1;8" final) }
+#define TILDE_KEY(n)                                                               \
+    { SEQ("[" n "~"), SEQ("[" n ";2~"), SEQ("[" n ";3~"), SEQ("[" n ";4~"),       \
+      SEQ("[" n ";5~"), SEQ("[" n ";6~"), SEQ("[" n ";7~"), SEQ("[" n ";8~") }
+
+// Row 0 is every key that is not special
+static const special_seq_t special_table[][KEY_MODS] = {
+    {{0, ""}},
+    CURSOR_KEY("[C", "C"),  // Right Arrow
+    CURSOR_KEY("[D", "D"),  // Left Arrow
+    CURSOR_KEY("[B", "B"),  // Down Arrow
+    CURSOR_KEY("[A", "A"),  // Up Arrow
+    CURSOR_KEY("[H", "H"),  // Home
+    CURSOR_KEY("[F", "F"),  // End
+    TILDE_KEY("5"),         // Page Up
+    TILDE_KEY("6"),         // Page Down
+    TILDE_KEY("2"),         // Insert
+    TILDE_KEY("3"),         // Delete
+    CURSOR_KEY("OP", "P"),  // F1
+    CURSOR_KEY("OQ", "Q"),  // F2
+    CURSOR_KEY("OR", "R"),  // F3
+    CURSOR_KEY("OS", "S"),  // F4
+    TILDE_KEY("15"),        // F5
+    TILDE_KEY("17"),        // F6
+    TILDE_KEY("18"),        // F7
+    TILDE_KEY("19"),        // F8
+    TILDE_KEY("20"),        // F9
+    TILDE_KEY("21"),        // F10
+    TILDE_KEY("23"),        // F11
+    TILDE_KEY("24"),        // F12
+};
+
+_Static_assert(sizeof("[24;8~") == CANETA_SPECIAL_SEQ_MAX, "the longest sequence sets CANETA_SPECIAL_SEQ_MAX");
+
+#undef TILDE_KEY
+#undef CURSOR_KEY
+#undef SEQ
+
+// HID keycode -> row of special_table
+static const uint8_t special_row[256] = {
+    [0x4F] = 1,  [0x50] = 2,  [0x51] = 3,  [0x52] = 4,  [0x4A] = 5,  [0x4D] = 6,
+    [0x4B] = 7,  [0x4E] = 8,  [0x49] = 9,  [0x4C] = 10, [0x3A] = 11, [0x3B] = 12,
+    [0x3C] = 13, [0x3D] = 14, [0x3E] = 15, [0x3F] = 16, [0x40] = 17, [0x41] = 18,
+    [0x42] = 19, [0x43] = 20, [0x44] = 21, [0x45] = 22,
+};
+
+// An ASCII character typed with Ctrl, as xterm and X send it: @ through ~ keep
+// their low five bits (so Ctrl+[ is ESC and Ctrl+@ is NUL), space and 2 are
+// NUL, 3 to 7 are ESC to US, / is US, and 8 and ? are DEL. Everything else is
+// unchanged.
+static const uint8_t ctrl_table[128] = {
+    0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F,
+    0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1A, 0x1B, 0x1C, 0x1D, 0x1E, 0x1F,
+    0x00, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x2A, 0x2B, 0x2C, 0x2D, 0x2E, 0x1F,
+    0x30, 0x31, 0x00, 0x1B, 0x1C, 0x1D, 0x1E, 0x1F, 0x7F, 0x39, 0x3A, 0x3B, 0x3C, 0x3D, 0x3E, 0x7F,
+    0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F,
+    0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1A, 0x1B, 0x1C, 0x1D, 0x1E, 0x1F,
+    0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F,
+    0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1A, 0x1B, 0x1C, 0x1D, 0x1E, 0x7F,
+};
 
 char hid_to_ascii(uint8_t keycode, bool shift) {
-    if (shift) {
-        switch (keycode) {
-            case 0x04: return 'A'; case 0x05: return 'B'; case 0x06: return 'C'; case 0x07: return 'D';
-            case 0x08: return 'E'; case 0x09: return 'F'; case 0x0A: return 'G'; case 0x0B: return 'H';
-            case 0x0C: return 'I'; case 0x0D: return 'J'; case 0x0E: return 'K'; case 0x0F: return 'L';
-            case 0x10: return 'M'; case 0x11: return 'N'; case 0x12: return 'O'; case 0x13: return 'P';
-            case 0x14: return 'Q'; case 0x15: return 'R'; case 0x16: return 'S'; case 0x17: return 'T';
-            case 0x18: return 'U'; case 0x19: return 'V'; case 0x1A: return 'W'; case 0x1B: return 'X';
-            case 0x1C: return 'Y'; case 0x1D: return 'Z';
-            case 0x1E: return '!'; case 0x1F: return '@'; case 0x20: return '#'; case 0x21: return '$';
-            case 0x22: return '%'; case 0x23: return '^'; case 0x24: return '&'; case 0x25: return '*';
-            case 0x26: return '('; case 0x27: return ')';
-            case 0x28: return '\r'; case 0x29: return '\x1B'; case 0x2A: return '\b'; case 0x2B: return '\t';
-            case 0x2C: return ' ';
-            case 0x2D: return '_'; case 0x2E: return '+'; case 0x2F: return '{'; case 0x30: return '}';
-            case 0x31: return '|'; case 0x33: return ':'; case 0x34: return '"'; case 0x35: return '~';
-            case 0x36: return '<'; case 0x37: return '>'; case 0x38: return '?';
-            default: return 0;
+    return ascii_table[shift ? CANETA_MOD_SHIFT : CANETA_MOD_NONE][keycode];
+}
+
+const char* process_special_keys(uint8_t keycode) {
+    return special_table[special_row[keycode]][0].seq;
+}
+
+_Static_assert(1 + CANETA_LAYOUT_CELL <= CANETA_KEY_OUTPUT_MAX, "Alt and a layout's character must fit a key's output");
+
+// Keypad 1-9, 0 and . without NumLock: End, Down, Page Down, Left, nothing,
+// Right, Home, Up, Page Up, Insert, Delete
+#define KEYPAD_FIRST 0x59
+#define KEYPAD_LAST 0x63
+
+static const uint8_t keypad_navigation[KEYPAD_LAST - KEYPAD_FIRST + 1] = {
+    0x4D, 0x51, 0x4E, 0x50, 0x00, 0x4F, 0x4A, 0x52, 0x4B, 0x49, 0x4C,
+};
+
+// UTF-8 bytes in a non-empty layout cell, by the high nibble of its first byte
+static const uint8_t cell_len[16] = {1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 2, 2, 3, 4};
+
+// Writes the terminal output for a newly pressed key into out and returns its
+// length (0 if the key produces nothing). out must hold CANETA_KEY_OUTPUT_MAX
+// bytes. A dead key or the Compose key leaves its marker in out.
+static size_t translate_key(uint8_t keycode, uint8_t modifiers, uint8_t locks, uint8_t* out) {
+    if (keycode >= KEYPAD_FIRST && keycode <= KEYPAD_LAST && !(locks & CANETA_LOCK_NUM)) {
+        keycode = keypad_navigation[keycode - KEYPAD_FIRST];
+    }
+
+    // Right Alt is AltGr on layouts that have it, not Meta
+    const caneta_layout_t* layout = caneta_layout_active();
+    uint8_t alt = (layout->flags & CANETA_LAYOUT_ALTGR) ? CANETA_MODIFIER_ALT & ~CANETA_MODIFIER_RIGHT_ALT
+                                                        : CANETA_MODIFIER_ALT;
+    unsigned mods = ((modifiers & CANETA_MODIFIER_SHIFT) ? KEY_MOD_SHIFT : 0) |
+                    ((modifiers & alt) ? KEY_MOD_ALT : 0) |
+                    ((modifiers & CANETA_MODIFIER_CTRL) ? KEY_MOD_CTRL : 0);
+
+    uint8_t row = special_row[keycode];
+    if (row) {
+        const special_seq_t* special = &special_table[row][mods];
+        out[0] = '\x1B';
+        memcpy(out + 1, special->seq, CANETA_SPECIAL_SEQ_MAX - 1);
+        return special->len + 1;
+    }
+    if (keycode >= CANETA_LAYOUT_USAGES) {
+        return 0;
+    }
+
+    // One lookup whichever layout is active
+    unsigned level = (mods & KEY_MOD_SHIFT) ? CANETA_LEVEL_SHIFT : CANETA_LEVEL_BASE;
+    if ((modifiers & CANETA_MODIFIER_RIGHT_ALT) && (layout->flags & CANETA_LAYOUT_ALTGR)) {
+        level |= CANETA_LEVEL_ALTGR;
+    }
+    const char* cell = layout->keys[keycode][level];
+    uint8_t lead = (uint8_t)cell[0];
+    size_t len = lead ? cell_len[lead >> 4] : 0;
+    if (len == 0) {
+        memcpy(out, cell, CANETA_LAYOUT_CELL);
+        return 0;
+    }
+
+    // Alt sends ESC first (Meta), so the character lands one byte later
+    size_t meta = (mods & KEY_MOD_ALT) ? 1 : 0;
+    out[0] = '\x1B';
+    memcpy(out + meta, cell, CANETA_LAYOUT_CELL);
+    if ((mods & KEY_MOD_CTRL) && len == 1) {
+        out[meta] = ctrl_table[lead];
+    }
+    return meta + len;
+}
+
+size_t caneta_translate_key(uint8_t keycode, uint8_t modifiers, uint8_t* out) {
+    return translate_key(keycode, modifiers, CANETA_LOCK_NUM, out);
+}
+
+size_t caneta_translate_key_locks(uint8_t keycode, uint8_t modifiers, uint8_t locks, uint8_t* out) {
+    return translate_key(keycode, modifiers, locks, out);
+}
+
+size_t caneta_translate_key_compose(uint8_t keycode, uint8_t modifiers, uint8_t locks,
+                                    uint16_t* compose, uint8_t* out) {
+    out[0] = 0;  // Keys past the layouts write nothing, so no marker either
+    size_t len = translate_key(keycode, modifiers, locks, out);
+
+    // Typing with no sequence in progress costs this one test
+    if (*compose == CANETA_COMPOSE_IDLE && (len != 0 || !caneta_compose_marker(out[0]))) {
+        return len;
+    }
+    return caneta_compose_feed(compose, out, len, out);
+}
+
+// Word-parallel key comparison. The six keycodes of a report are held in the
+// low six byte lanes of a 64-bit word, so one XOR compares every lane against
+// a broadcast keycode and zero_lanes finds the matches. That pays on 64-bit
+// cores; on the Cortex-M0+ the 64-bit multiplies, shifts and ctz are libgcc
+// calls, and caneta-bench's M0+ cost model (m0_model.h) puts it behind the
+// nested loop on typing.
+_Static_assert(sizeof(kbd_state_t) == CANETA_REPORT_SIZE, "kbd_state_t must match the boot report layout");
+
+#define LANES_01 0x0101010101010101ULL
+#define LANES_7F 0x7F7F7F7F7F7F7F7FULL
+#define KEY_SLOTS_MASK 0x3F
+
+static inline uint64_t load_keys(const uint8_t* keys) {
+    return (uint64_t)keys[0] | (uint64_t)keys[1] << 8 | (uint64_t)keys[2] << 16 |
+           (uint64_t)keys[3] << 24 | (uint64_t)keys[4] << 32 | (uint64_t)keys[5] << 40;
+}
+
+// Sets the top bit of every byte lane of x that is zero (exact, no false positives)
+static inline uint64_t zero_lanes(uint64_t x) {
+    return ~(((x & LANES_7F) + LANES_7F) | x | LANES_7F);
+}
+
+// Gathers the top bit of each byte lane into bit i of the result
+static inline uint8_t lane_bits(uint64_t x) {
+    return (uint8_t)((((x >> 7) & LANES_01) * 0x0102040810204080ULL) >> 56);
+}
+
+static inline unsigned lowest_slot(unsigned mask) {
+#if defined(__GNUC__)
+    return (unsigned)__builtin_ctz(mask);
+#else
+    unsigned slot = 0;
+    while (!(mask & 1u)) { mask >>= 1; slot++; }
+    return slot;
+#endif
+}
+
+caneta_key_diff_t caneta_kbd_diff(const kbd_state_t* state, const uint8_t* report) {
+    caneta_key_diff_t diff = {0, 0};
+    uint64_t prev = load_keys(state->last_keys);
+    uint64_t next = load_keys(report + 2);
+
+    // Same keys held as last time (key repeat reports, modifier-only changes)
+    if (prev == next) {
+        return diff;
+    }
+
+    uint8_t next_used = lane_bits(~zero_lanes(next)) & KEY_SLOTS_MASK;
+    uint8_t prev_used = lane_bits(~zero_lanes(prev)) & KEY_SLOTS_MASK;
+
+    // Pressing from idle and releasing everything need no comparison at all
+    if (prev == 0 || next == 0) {
+        diff.pressed = next_used;
+        diff.released = prev_used;
+        return diff;
+    }
+
+    // Compare each held keycode of one word against every lane of the other.
+    // Only occupied slots are broadcast, so on a 64-bit core typical 1-2 key
+    // reports cost a couple of XORs rather than a full 6x6 comparison.
+    uint64_t next_seen = 0;
+    for (unsigned held = prev_used; held; held &= held - 1) {
+        next_seen |= zero_lanes(next ^ (((prev >> (8 * lowest_slot(held))) & 0xFF) * LANES_01));
+    }
+    uint64_t prev_seen = 0;
+    for (unsigned held = next_used; held; held &= held - 1) {
+        prev_seen |= zero_lanes(prev ^ (((next >> (8 * lowest_slot(held))) & 0xFF) * LANES_01));
+    }
+
+    diff.pressed = next_used & ~lane_bits(next_seen);
+    diff.released = prev_used & ~lane_bits(prev_seen);
+    return diff;
+}
+
+void caneta_decoder_init(caneta_decoder_t* decoder) {
+    memset(decoder, 0, sizeof(*decoder));
+    decoder->kbd.locks = CANETA_LOCK_NUM;
+}
+
+void caneta_decoder_reset(caneta_decoder_t* decoder) {
+    memset(&decoder->kbd, 0, sizeof(decoder->kbd));
+    decoder->kbd.locks = CANETA_LOCK_NUM;
+    decoder->pending_slot = 0;
+    decoder->pending_offset = 0;
+    decoder->compose = CANETA_COMPOSE_IDLE;
+}
+
+const kbd_state_t* caneta_decoder_state(const caneta_decoder_t* decoder) {
+    return &decoder->kbd;
+}
+
+size_t caneta_decoder_feed(caneta_decoder_t* decoder,
+                           const uint8_t* report, size_t len,
+                           uint8_t* out) {
+    if (len < CANETA_REPORT_SIZE) return 0;  // Standard keyboard report is 8 bytes
+
+    // out holds a whole report's worth of output, so this never stops partway
+    return caneta_translate_reports(decoder, report, 1, out, CANETA_REPORT_OUTPUT_MAX, NULL);
+}
+
+size_t caneta_translate_reports(caneta_decoder_t* decoder,
+                                const uint8_t* reports, size_t report_count,
+                                uint8_t* out, size_t out_len,
+                                size_t* reports_used) {
+    size_t written = 0;
+    size_t used = 0;
+
+    for (; used < report_count; used++) {
+        const uint8_t* report = reports + used * CANETA_REPORT_SIZE;
+
+        // Byte 0: Modifier keys
+        uint8_t modifiers = report[0];
+
+        // Too many keys down to report: keep the keys last seen
+        if (report[2] == CANETA_USAGE_ERROR_ROLLOVER) {
+            decoder->kbd.modifiers = modifiers;
+            continue;
         }
-    } else {
-        switch (keycode) {
-            case 0x04: return 'a'; case 0x05: return 'b'; case 0x06: return 'c'; case 0x07: return 'd';
-            case 0x08: return 'e'; case 0x09: return 'f'; case 0x0A: return 'g'; case 0x0B: return 'h';
-            case 0x0C: return 'i'; case 0x0D: return 'j'; case 0x0E: return 'k'; case 0x0F: return 'l';
-            case 0x10: return 'm'; case 0x11: return 'n'; case 0x12: return 'o'; case 0x13: return 'p';
-            case 0x14: return 'q'; case 0x15: return 'r'; case 0x16: return 's'; case 0x17: return 't';
-            case 0x18: return 'u'; case 0x19: return 'v'; case 0x1A: return 'w'; case 0x1B: return 'x';
-            case 0x1C: return 'y'; case 0x1D: return 'z';
-            case 0x1E: return '1'; case 0x1F: return '2'; case 0x20: return '3'; case 0x21: return '4';
-            case 0x22: return '5'; case 0x23: return '6'; case 0x24: return '7'; case 0x25: return '8';
-            case 0x26: return '9'; case 0x27: return '0';
-            case 0x28: return '\r'; case 0x29: return '\x1B'; case 0x2A: return '\b'; case 0x2B: return '\t';
-            case 0x2C: return ' ';
-            case 0x2D: return '-'; case 0x2E: return '='; case 0x2F: return '['; case 0x30: return ']';
-            case 0x31: return '\\'; case 0x33: return ';'; case 0x34: return '\''; case 0x35: return '`';
-            case 0x36: return ','; case 0x37: return '.'; case 0x38: return '/';
-            default: return 0;
+
+        // Bytes 2-7: Up to 6 pressed keys; only new presses produce output.
+        // Resume at the slot that did not fit last time; kbd still holds the
+        // previous report.
+        unsigned pressed = caneta_kbd_diff(&decoder->kbd, report).pressed;
+        pressed &= (KEY_SLOTS_MASK << decoder->pending_slot) & KEY_SLOTS_MASK;
+
+        while (pressed) {
+            unsigned slot = lowest_slot(pressed);
+            pressed &= pressed - 1;
+
+            // NumLock takes effect from the next key; it types nothing itself
+            uint8_t keycode = report[2 + slot];
+            decoder->kbd.locks = caneta_locks_press(decoder->kbd.locks, keycode);
+
+            // The compose state moves on once the key's output is all out, so
+            // a key resumed after a full buffer types the same again
+            uint8_t seq[CANETA_KEY_OUTPUT_MAX];
+            uint16_t compose = decoder->compose;
+            size_t len = caneta_translate_key_compose(keycode, modifiers, decoder->kbd.locks, &compose, seq);
+            size_t offset = decoder->pending_offset;
+            size_t room = out_len - written;
+
+            if (len - offset > room) {
+                // Output buffer is full: emit what fits and remember where we stopped
+                memcpy(out + written, seq + offset, room);
+                written += room;
+                decoder->pending_slot = (uint8_t)slot;
+                decoder->pending_offset = (uint8_t)(offset + room);
+                goto done;
+            }
+
+            memcpy(out + written, seq + offset, len - offset);
+            written += len - offset;
+            decoder->pending_offset = 0;
+            decoder->compose = compose;
         }
+
+        // Report fully emitted: save it for the next comparison, keeping the
+        // locks in place of its reserved byte
+        uint8_t locks = decoder->kbd.locks;
+        decoder->pending_slot = 0;
+        memcpy(&decoder->kbd, report, CANETA_REPORT_SIZE);
+        decoder->kbd.locks = locks;
+    }
+
+done:
+    if (reports_used) {
+        *reports_used = used;
     }
+    return written;
 }
 
-const char* process_special_keys(uint8_t keycode) {
-    switch(keycode) {
-        case 0x4F: // Right Arrow
-            return "[C";
-        case 0x50: // Left Arrow
-            return "[D";
-        case 0x51: // Down Arrow
-            return "[B";
-        case 0x52: // Up Arrow
-            return "[A";
-        case 0x4A: // Home
-            return "[H";
-        case 0x4D: // End
-            return "[F";
-        case 0x4B: // Page Up
-            return "[5~";
-        case 0x4E: // Page Down
-            return "[6~";
-        case 0x49: // Insert
-            return "[2~";
-        case 0x4C: // Delete
-            return "[3~";
-        case 0x3A: // F1
-            return "OP";
-        case 0x3B: // F2
-            return "OQ";
-        case 0x3C: // F3
-            return "OR";
-        case 0x3D: // F4
-            return "OS";
-        case 0x3E: // F5
-            return "[15~";
-        case 0x3F: // F6
-            return "[17~";
-        case 0x40: // F7
-            return "[18~";
-        case 0x41: // F8
-            return "[19~";
-        case 0x42: // F9
-            return "[20~";
-        case 0x43: // F10
-            return "[21~";
-        case 0x44: // F11
-            return "[23~";
-        case 0x45: // F12
-            return "[24~";
-        default:
-            // Unknown special key - return empty string
-            return "";
+_Static_assert(CANETA_STREAM_CHUNK >= CANETA_REPORT_OUTPUT_MAX, "a single report must fit in one sink write");
+
+void caneta_decoder_stream(caneta_decoder_t* decoder,
+                           const uint8_t* reports, size_t report_count,
+                           const caneta_sink_t* sink) {
+    uint8_t out[CANETA_STREAM_CHUNK];
+
+    // Every call consumes a report or fills out, so this always makes progress
+    while (report_count > 0) {
+        size_t used;
+        size_t n = caneta_translate_reports(decoder, reports, report_count, out, sizeof(out), &used);
+        if (n > 0) {
+            sink->write(sink->ctx, out, n);
+        }
+        reports += used * CANETA_REPORT_SIZE;
+        report_count -= used;
     }
-}
\ No newline at end of file
+}
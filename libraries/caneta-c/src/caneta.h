@@ -10,26 +10,164 @@ extern "C"
 {
 #endif
 
+#include <stddef.h>
 #include <stdint.h>
 #include <stdbool.h>
 
-// Convert HID scan code to ASCII character (US keyboard layout)
+// Size of a boot protocol keyboard report: modifiers, reserved, 6 keycodes
+#define CANETA_REPORT_SIZE 8
+
+// Modifier classes used to index the keycode translation tables
+enum {
+  CANETA_MOD_NONE = 0,
+  CANETA_MOD_SHIFT = 1,
+  CANETA_MOD_CLASSES
+};
+
+// Longest special key sequence, without the ESC and including the NUL: a
+// modified one, as in [ 2 4 ; 8 ~ for Ctrl+Alt+Shift+F12
+#define CANETA_SPECIAL_SEQ_MAX 7
+
+// Most bytes a single key press can produce: ESC and the longest special key
+// sequence, which goes out without its NUL
+#define CANETA_KEY_OUTPUT_MAX CANETA_SPECIAL_SEQ_MAX
+
+// Convert HID scan code to ASCII character (the main block of a US keyboard).
+// Terminal output is translated with the active caneta_layout_t instead.
 char hid_to_ascii(uint8_t keycode, bool shift);
 
-// Process special keys and return escape sequences
+// Process special keys and return escape sequences (without ESC or modifiers)
 // Returns empty string ("") if keycode is not a special key
 const char* process_special_keys(uint8_t keycode);
 
-// Keyboard state
+// Modifier bits in byte 0 of a boot report, left and right combined
+#define CANETA_MODIFIER_CTRL  0x11
+#define CANETA_MODIFIER_SHIFT 0x22
+#define CANETA_MODIFIER_ALT   0x44
+#define CANETA_MODIFIER_GUI   0x88
+
+// Right Alt alone: AltGr on layouts that have it
+#define CANETA_MODIFIER_RIGHT_ALT 0x40
+
+// Lock bits of kbd_state_t.locks. A keyboard starts with NumLock on; each
+// press of the NumLock key toggles it.
+#define CANETA_LOCK_NUM 0x01
+#define CANETA_USAGE_NUM_LOCK 0x53
+
+// Key slot usage of a report sent while more keys are down than it can hold.
+// Every slot holds it; the modifiers are still valid.
+#define CANETA_USAGE_ERROR_ROLLOVER 0x01
+
+// Lock state after a key is pressed
+static inline uint8_t caneta_locks_press(uint8_t locks, uint8_t keycode) {
+  return keycode == CANETA_USAGE_NUM_LOCK ? (uint8_t)(locks ^ CANETA_LOCK_NUM) : locks;
+}
+
+// Translate one newly pressed key with the given modifier byte into terminal
+// output as xterm sends it, with NumLock on: a character of the active layout
+// in UTF-8, or ESC and an escape sequence. Special keys carry their modifiers
+// (ESC [ 1 ; 5 C for Ctrl+Right), Ctrl maps ASCII to control characters (Ctrl+[
+// is ESC), and Alt sends ESC before the character. out must hold
+// CANETA_KEY_OUTPUT_MAX bytes. Returns the number of bytes written.
+size_t caneta_translate_key(uint8_t keycode, uint8_t modifiers, uint8_t* out);
+
+// caneta_translate_key with the given CANETA_LOCK_* state. Dead keys and the
+// Compose key type nothing.
+size_t caneta_translate_key_locks(uint8_t keycode, uint8_t modifiers, uint8_t locks, uint8_t* out);
+
+// caneta_translate_key_locks through a compose state (caneta_compose.h,
+// CANETA_COMPOSE_IDLE to start): dead keys and the Compose key begin
+// sequences whose result is typed by the key that completes them.
+size_t caneta_translate_key_compose(uint8_t keycode, uint8_t modifiers, uint8_t locks,
+                                    uint16_t* compose, uint8_t* out);
+
+// Keyboard state, packed in boot report layout (modifiers, reserved, 6 keycodes)
+// so a new report can be compared against it a word at a time. The report's
+// reserved byte holds the keyboard's lock state.
 typedef struct {
-  bool shift_pressed;
-  bool ctrl_pressed;
-  bool alt_pressed;
+  uint8_t modifiers;
+  uint8_t locks;         // CANETA_LOCK_*
   uint8_t last_keys[6];
 } kbd_state_t;
 
-// Global keyboard state (you'll need to define this in your main code)
-extern kbd_state_t kbd_state;
+static inline bool kbd_state_shift(const kbd_state_t* state) { return (state->modifiers & CANETA_MODIFIER_SHIFT) != 0; }
+static inline bool kbd_state_ctrl(const kbd_state_t* state) { return (state->modifiers & CANETA_MODIFIER_CTRL) != 0; }
+static inline bool kbd_state_alt(const kbd_state_t* state) { return (state->modifiers & CANETA_MODIFIER_ALT) != 0; }
+
+// Key slots that changed between a keyboard state and a new report.
+// Bit i of pressed is set when report key slot i holds a key that was not
+// down before; bit i of released is set when state key slot i held a key
+// that is no longer down.
+typedef struct {
+  uint8_t pressed;
+  uint8_t released;
+} caneta_key_diff_t;
+
+// Compare a boot report against the previous state. Reports whose keys match
+// the state exactly return without doing any per-key work.
+caneta_key_diff_t caneta_kbd_diff(const kbd_state_t* state, const uint8_t* report);
+
+// Most bytes a single report can produce (six newly pressed keys)
+#define CANETA_REPORT_OUTPUT_MAX (6 * CANETA_KEY_OUTPUT_MAX)
+
+// Keyboard decoder. Holds everything needed to turn one keyboard's reports
+// into terminal output, so any number of keyboards can be decoded at once by
+// giving each its own decoder. Treat the fields as private to caneta-c and use
+// the caneta_decoder_* functions; the struct is only visible so decoders can
+// be allocated statically or on the stack.
+typedef struct {
+  kbd_state_t kbd;         // State after the last fully translated report
+  uint8_t pending_slot;    // Key slot to resume at in a partially translated report
+  uint8_t pending_offset;  // Bytes of that key's output already written
+  uint16_t compose;        // Compose sequence in progress
+} caneta_decoder_t;
+
+// Prepare a decoder for first use
+void caneta_decoder_init(caneta_decoder_t* decoder);
+
+// Forget all pressed keys and modifiers (e.g. when the keyboard disconnects)
+void caneta_decoder_reset(caneta_decoder_t* decoder);
+
+// Current modifier and key state of the decoder
+const kbd_state_t* caneta_decoder_state(const caneta_decoder_t* decoder);
+
+// Translate one boot keyboard report into terminal output.
+// out must hold CANETA_REPORT_OUTPUT_MAX bytes. Returns the number of bytes
+// written; reports shorter than CANETA_REPORT_SIZE are ignored. ErrorRollOver
+// reports only update the modifiers: the keys held before stay held, so none
+// of them is typed again once the rollover ends.
+size_t caneta_decoder_feed(caneta_decoder_t* decoder,
+                           const uint8_t* report, size_t len,
+                           uint8_t* out);
+
+// Translate a contiguous array of boot keyboard reports (report_count * CANETA_REPORT_SIZE
+// bytes) into terminal output, writing at most out_len bytes into out.
+// Returns the number of bytes written and stores the number of reports fully
+// consumed in *reports_used (may be NULL). If out fills partway through a
+// report, that report is not counted as used: call again with the remaining
+// reports, starting at the partial one, and output resumes where it stopped.
+size_t caneta_translate_reports(caneta_decoder_t* decoder,
+                                const uint8_t* reports, size_t report_count,
+                                uint8_t* out, size_t out_len,
+                                size_t* reports_used);
+
+// Output sink: receives terminal output in batches. write is called with
+// everything a report (or a run of reports) produced, never byte by byte.
+typedef struct {
+  void (*write)(void* ctx, const uint8_t* data, size_t len);
+  void* ctx;
+} caneta_sink_t;
+
+// Bytes the streaming functions translate into before each sink write
+#define CANETA_STREAM_CHUNK 64
+
+// Translate report_count contiguous boot reports and deliver all output to
+// sink. A single report always reaches the sink in one write; longer runs are
+// batched up to CANETA_STREAM_CHUNK bytes per write. C++ front-ends should use
+// caneta::Stream from caneta.hpp instead, so the sink call can be inlined.
+void caneta_decoder_stream(caneta_decoder_t* decoder,
+                           const uint8_t* reports, size_t report_count,
+                           const caneta_sink_t* sink);
 
 #ifdef __cplusplus
 }
@@ -0,0 +1,353 @@
+// caneta.hpp
+// C++ front-ends for the caneta-c streaming decoders
+
+#ifndef CANETA_HPP
+#define CANETA_HPP
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "caneta.h"
+#include "caneta_hid.h"
+#include "caneta_repeat.h"
+#include "caneta_ring.h"
+#include "caneta_snapshot.h"
+
+namespace caneta {
+
+    // Decodes one keyboard's reports into a sink. Sink is any copyable type
+    // with a member
+    //
+    //     void write(const uint8_t* data, size_t len);
+    //
+    // This is the same engine as caneta_decoder_stream, but the sink is a
+    // template parameter rather than a function pointer, so the compiler can
+    // inline the write into the translation loop.
+    template <typename Sink>
+    class Stream {
+      public:
+        explicit Stream(Sink sink = Sink()) : sink(sink) {
+            caneta_decoder_init(&decoder);
+        }
+
+        // Translate one boot keyboard report. Reports shorter than
+        // CANETA_REPORT_SIZE are ignored; output reaches the sink in one write.
+        void feed(const uint8_t* report, size_t len) {
+            uint8_t out[CANETA_REPORT_OUTPUT_MAX];
+            size_t n = caneta_decoder_feed(&decoder, report, len, out);
+            if (n > 0) {
+                sink.write(out, n);
+            }
+        }
+
+        // Translate report_count contiguous boot reports, batching output up
+        // to CANETA_STREAM_CHUNK bytes per write
+        void feedReports(const uint8_t* reports, size_t report_count) {
+            uint8_t out[CANETA_STREAM_CHUNK];
+
+            // Every call consumes a report or fills out, so this always makes progress
+            while (report_count > 0) {
+                size_t used;
+                size_t n = caneta_translate_reports(&decoder, reports, report_count, out, sizeof(out), &used);
+                if (n > 0) {
+                    sink.write(out, n);
+                }
+                reports += used * CANETA_REPORT_SIZE;
+                report_count -= used;
+            }
+        }
+
+        // Forget all pressed keys and modifiers (e.g. when the keyboard disconnects)
+        void reset() { caneta_decoder_reset(&decoder); }
+
+        // Modifier and key state after the last report
+        const kbd_state_t& state() const { return *caneta_decoder_state(&decoder); }
+
+        Sink& output() { return sink; }
+
+      private:
+        caneta_decoder_t decoder;
+        Sink sink;
+    };
+
+    // Decodes one HID interface's reports into a sink, using the extraction
+    // plan compiled from its report descriptor. Reports of boot-layout
+    // devices go through the same engine as Stream.
+    template <typename Sink>
+    class HidStream {
+      public:
+        explicit HidStream(Sink sink = Sink()) : sink(sink) {
+            caneta_hid_decoder_init(&decoder, nullptr, 0);
+        }
+
+        // Compile the device's report descriptor (NULL for boot devices).
+        // Returns true if the device should be used in report protocol.
+        bool begin(const uint8_t* desc, size_t desc_len) {
+            return caneta_hid_decoder_init(&decoder, desc, desc_len);
+        }
+
+        // Translate one report, starting with the report ID byte if the device uses them
+        void feed(const uint8_t* report, size_t len) {
+            if (decoder.plan.report_ids) {
+                if (len < 1) return;
+                feed(report[0], report + 1, len - 1);
+            } else {
+                feed(0, report, len);
+            }
+        }
+
+        // Translate one report whose ID arrived separately
+        void feed(uint8_t report_id, const uint8_t* data, size_t len) {
+            uint8_t out[CANETA_STREAM_CHUNK];
+            bool complete;
+            do {
+                size_t n = caneta_hid_decoder_translate(&decoder, report_id, data, len, out, sizeof(out), &complete);
+                if (n > 0) {
+                    sink.write(out, n);
+                }
+            } while (!complete);
+        }
+
+        void reset() { caneta_hid_decoder_reset(&decoder); }
+
+        // Modifiers and up to six held keys after the last report
+        kbd_state_t state() const {
+            kbd_state_t state;
+            caneta_hid_decoder_state(&decoder, &state);
+            return state;
+        }
+
+        Sink& output() { return sink; }
+
+      private:
+        caneta_hid_decoder_t decoder;
+        Sink sink;
+    };
+
+    // Auto-repeat for one keyboard, writing repeated keys to a sink. Call
+    // update() with the keyboard state after each report and run() when the
+    // clock reaches nextDeadline().
+    template <typename Sink>
+    class Repeat {
+      public:
+        explicit Repeat(Sink sink = Sink(), const caneta_repeat_config_t* config = nullptr) : sink(sink) {
+            caneta_repeat_init(&repeat, config);
+        }
+
+        void configure(const caneta_repeat_config_t& config) { caneta_repeat_init(&repeat, &config); }
+
+        void update(const kbd_state_t& state, uint32_t now_ms) { caneta_repeat_update(&repeat, &state, now_ms); }
+
+        // Fire every repeat due at or before now_ms
+        void run(uint32_t now_ms) {
+            uint8_t out[CANETA_STREAM_CHUNK];
+            bool complete;
+            do {
+                size_t n = caneta_repeat_run(&repeat, now_ms, out, sizeof(out), &complete);
+                if (n > 0) {
+                    sink.write(out, n);
+                }
+            } while (!complete);
+        }
+
+        // Earliest pending repeat; false if no key is repeating
+        bool nextDeadline(uint32_t& deadline_ms) const { return caneta_repeat_next_deadline(&repeat, &deadline_ms); }
+
+        void reset() { caneta_repeat_reset(&repeat); }
+
+        Sink& output() { return sink; }
+
+      private:
+        caneta_repeat_t repeat;
+        Sink sink;
+    };
+
+    // Collects writes and hands them to Sink in one write per flush(), so a
+    // burst of reports costs one call into a UART driver instead of one per
+    // key. A write that would overflow the buffer flushes it first; one
+    // longer than the whole buffer goes straight through.
+    template <typename Sink, size_t Size = 256>
+    class Batch {
+      public:
+        explicit Batch(Sink sink = Sink()) : sink(sink), used(0) {}
+
+        void write(const uint8_t* data, size_t len) {
+            if (len > Size - used) {
+                flush();
+            }
+            if (len > Size) {
+                sink.write(data, len);
+                return;
+            }
+            memcpy(buffer + used, data, len);
+            used += len;
+        }
+
+        void flush() {
+            if (used > 0) {
+                sink.write(buffer, used);
+                used = 0;
+            }
+        }
+
+        size_t pending() const { return used; }
+
+        Sink& output() { return sink; }
+
+      private:
+        Sink sink;
+        size_t used;
+        uint8_t buffer[Size];
+    };
+
+    // A value of a trivially copyable type T that one context publishes for
+    // readers on any thread or core, through the sequence lock of
+    // caneta_snapshot.h. Publishing never waits; a reader that can preempt
+    // the publisher on its own core must use tryRead.
+    template <typename T>
+    class Snapshot {
+      public:
+        Snapshot() : seq(0), words() {}
+
+        // The words are only touched through the sequence lock
+        Snapshot(const Snapshot&) = delete;
+        Snapshot& operator=(const Snapshot&) = delete;
+
+        void publish(const T& value) { caneta_seqlock_publish(&seq, words, Words, &value); }
+
+        // One attempt at a copy; value is untouched if a publish got in the way
+        bool tryRead(T& value) const {
+            T copy;
+            if (!caneta_seqlock_try_read(&seq, words, Words, &copy)) return false;
+            value = copy;
+            return true;
+        }
+
+        T read() const {
+            T value;
+            while (!tryRead(value)) {
+            }
+            return value;
+        }
+
+      private:
+        static_assert(sizeof(T) % sizeof(uint32_t) == 0, "a snapshot holds whole words");
+        enum : size_t { Words = sizeof(T) / sizeof(uint32_t) };
+
+        uint32_t seq;
+        uint32_t words[Words];
+    };
+
+    // Reports from a radio stack handed to a decoding task through a
+    // caneta_ring_t. The stack's callback only copies each report into the
+    // ring; drain() decodes whatever is queued and delivers the output in one
+    // write per drain. Exactly one context may post and one may drain.
+    //
+    // Each of up to Keyboards keyboards has its own decoder and state; their
+    // output is merged into the one sink in the order the reports were posted.
+    // Each drain publishes the states into snapshots any thread may read.
+    template <typename Sink, size_t Keyboards = 1, size_t BatchSize = 256>
+    class ReportQueue {
+      public:
+        // Record kinds
+        enum : uint8_t {
+            REPORT = 1,  // Input report without its ID byte; the ID travels in the header
+            MOUNT = 2,   // Report descriptor of a newly connected keyboard (empty for boot)
+            RESET = 3    // Keyboard gone: release every key
+        };
+
+        explicit ReportQueue(Sink sink = Sink()) : batch(sink) {
+            caneta_ring_init(&ring);
+            for (size_t i = 0; i < Keyboards; i++) {
+                streams[i].output().batch = &batch;
+                caneta_snapshot_init(&snapshots[i]);
+                // Not all zeroes: NumLock starts on
+                kbd_state_t state = streams[i].state();
+                caneta_snapshot_publish(&snapshots[i], &state);
+            }
+        }
+
+        // The decoders write into batch
+        ReportQueue(const ReportQueue&) = delete;
+        ReportQueue& operator=(const ReportQueue&) = delete;
+
+        // Producer. Each returns false if the record was dropped (counted in
+        // dropped()). keyboard is below Keyboards.
+        bool postMount(uint8_t keyboard, const uint8_t* desc, size_t desc_len) {
+            return caneta_ring_push(&ring, MOUNT, keyboard, 0, desc, desc_len);
+        }
+
+        bool postReport(uint8_t keyboard, uint8_t report_id, const uint8_t* data, size_t len) {
+            return caneta_ring_push(&ring, REPORT, keyboard, report_id, data, len);
+        }
+
+        bool postReset(uint8_t keyboard) { return caneta_ring_push(&ring, RESET, keyboard, 0, nullptr, 0); }
+
+        // Consumer: decode every queued record, flush the output, then publish
+        // the state of each keyboard that had records. Returns the records
+        // handled.
+        size_t drain() {
+            size_t handled = 0;
+            bool touched[Keyboards] = {};
+            const caneta_ring_record_t* record;
+            while ((record = caneta_ring_peek(&ring)) != nullptr) {
+                if (record->dev_addr < Keyboards) {
+                    touched[record->dev_addr] = true;
+                    HidStream<Forward>& stream = streams[record->dev_addr];
+                    const uint8_t* data = caneta_ring_data(record);
+                    switch (record->kind) {
+                        case REPORT:
+                            stream.feed(record->instance, data, record->len);
+                            break;
+                        case MOUNT:
+                            stream.begin(record->len ? data : nullptr, record->len);
+                            break;
+                        case RESET:
+                            stream.reset();
+                            break;
+                    }
+                }
+                caneta_ring_release(&ring);
+                handled++;
+            }
+            batch.flush();
+            for (size_t i = 0; i < Keyboards; i++) {
+                if (touched[i]) {
+                    kbd_state_t state = streams[i].state();
+                    caneta_snapshot_publish(&snapshots[i], &state);
+                }
+            }
+            return handled;
+        }
+
+        // Any thread: a keyboard's state as of the last drain that touched it.
+        // A keyboard number of Keyboards or more has nothing held.
+        kbd_state_t state(size_t keyboard = 0) const {
+            kbd_state_t state = {};
+            if (keyboard < Keyboards) {
+                caneta_snapshot_read(&snapshots[keyboard], &state);
+            }
+            return state;
+        }
+
+        // Either side: records dropped because the ring was full or they were too long
+        uint32_t dropped() const { return caneta_ring_overflows(&ring) + caneta_ring_oversize(&ring); }
+
+        Sink& output() { return batch.output(); }
+
+      private:
+        struct Forward {
+            Batch<Sink, BatchSize>* batch;
+            void write(const uint8_t* data, size_t len) { batch->write(data, len); }
+        };
+
+        caneta_ring_t ring;
+        Batch<Sink, BatchSize> batch;
+        HidStream<Forward> streams[Keyboards];
+        caneta_snapshot_t snapshots[Keyboards];
+    };
+
+} // namespace caneta
+
+#endif // CANETA_HPP
@@ -0,0 +1,52 @@
+// caneta_batch.c
+// Packet batching policy for USB bulk output
+
+#include "caneta_batch.h"
+
+void caneta_batch_init(caneta_batch_t* batch, const caneta_batch_config_t* config) {
+    if (config) {
+        batch->config = *config;
+    } else {
+        batch->config.packet_size = CANETA_BATCH_DEFAULT_PACKET;
+        batch->config.flush_us = CANETA_BATCH_DEFAULT_FLUSH_US;
+    }
+    if (batch->config.packet_size == 0) batch->config.packet_size = 1;
+    batch->waiting = false;
+    batch->since = 0;
+}
+
+size_t caneta_batch_ready(caneta_batch_t* batch, size_t queued, uint32_t now_us) {
+    return caneta_batch_ready_within(batch, queued, queued, now_us);
+}
+
+size_t caneta_batch_ready_within(caneta_batch_t* batch, size_t queued, size_t room, uint32_t now_us) {
+    if (queued == 0) {
+        batch->waiting = false;
+        return 0;
+    }
+    if (!batch->waiting) {
+        batch->waiting = true;
+        batch->since = now_us;
+    }
+
+    // Only what fits can go, however long it has waited
+    size_t fits = queued < room ? queued : room;
+
+    // Wrap-safe: the oldest byte has waited long enough
+    if ((int32_t)(now_us - batch->since - batch->config.flush_us) >= 0) {
+        if (fits == queued) batch->waiting = false;
+        return fits;
+    }
+
+    // Whole packets go at once. A remainder keeps the oldest byte's timer,
+    // so it is never held longer than flush_us after that byte arrived.
+    size_t whole = fits - fits % batch->config.packet_size;
+    if (whole == queued) batch->waiting = false;
+    return whole;
+}
+
+bool caneta_batch_next_deadline(const caneta_batch_t* batch, uint32_t* deadline_us) {
+    if (!batch->waiting) return false;
+    *deadline_us = batch->since + batch->config.flush_us;
+    return true;
+}
@@ -0,0 +1,61 @@
+// caneta_batch.h
+// Packet batching policy for output to a USB bulk endpoint
+//
+// Sending each key's output in its own packet wastes most of a USB frame.
+// The batcher looks at how many bytes are waiting and says how many to send
+// now: whole packets as soon as they fill, and a short packet only once the
+// oldest waiting byte is flush_us old. It keeps no data itself, so it sits in
+// front of any queue (a caneta_tx_t, a USB stack FIFO). Time is passed in by
+// the caller in microseconds and may wrap.
+
+#ifndef CANETA_BATCH_H
+#define CANETA_BATCH_H
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+// Full-speed bulk packets, and one USB frame to fill one
+#define CANETA_BATCH_DEFAULT_PACKET 64
+#define CANETA_BATCH_DEFAULT_FLUSH_US 1000
+
+typedef struct {
+  uint16_t packet_size;  // Bytes in a full packet
+  uint32_t flush_us;     // Longest a byte waits for its packet to fill
+} caneta_batch_config_t;
+
+// Treat the fields as private
+typedef struct {
+  caneta_batch_config_t config;
+  bool waiting;          // Bytes are waiting for a packet to fill
+  uint32_t since;        // When the oldest of them started waiting
+} caneta_batch_t;
+
+// config may be NULL for the defaults
+void caneta_batch_init(caneta_batch_t* batch, const caneta_batch_config_t* config);
+
+// How many of the queued bytes to send now: every whole packet, or all of
+// them once the oldest has waited flush_us. Call whenever bytes are queued and
+// when the deadline passes; the caller must then send (or discard) exactly
+// that many bytes.
+size_t caneta_batch_ready(caneta_batch_t* batch, size_t queued, uint32_t now_us);
+
+// The same, for a queue that can take no more than room bytes now (free space
+// in the USB stack's FIFO). Whole packets go as far as they fit; bytes held
+// back by room keep the oldest byte's timer, so once flush_us has passed they
+// go the moment room opens up.
+size_t caneta_batch_ready_within(caneta_batch_t* batch, size_t queued, size_t room, uint32_t now_us);
+
+// When the waiting bytes must be flushed. Returns false if nothing is waiting.
+bool caneta_batch_next_deadline(const caneta_batch_t* batch, uint32_t* deadline_us);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif //CANETA_BATCH_H
@@ -0,0 +1,45 @@
+// caneta_compose.c
+// Dead key and Compose sequences; the trie is in the generated caneta_compose_table.c
+
+#include "caneta_compose.h"
+#include "caneta.h"
+#include <string.h>
+
+_Static_assert(sizeof(caneta_compose_node_t) == 4, "a trie step should touch one small node");
+
+size_t caneta_compose_feed(uint16_t* state, const uint8_t* text, size_t len, uint8_t* out) {
+    uint16_t s = *state;
+    uint8_t lead = text[0];
+
+    if (caneta_compose_marker(lead)) {
+        len = lead == CANETA_COMPOSE_DEAD ? 3 : 1;
+    } else if (s == CANETA_COMPOSE_IDLE || len == 0) {
+        memmove(out, text, len);
+        return len;
+    } else if (lead < 0x20 || lead == 0x7F) {
+        *state = CANETA_COMPOSE_IDLE;
+        memmove(out, text, len);
+        return len;
+    }
+
+    // One node per byte; the check rejects bytes no sequence continues with
+    for (size_t i = 0; i < len; i++) {
+        uint16_t base = caneta_compose_nodes[s].base;
+        uint16_t next = (uint16_t)(base + text[i]);
+        if ((base & CANETA_COMPOSE_RESULT) || caneta_compose_nodes[next].check != s) {
+            *state = CANETA_COMPOSE_IDLE;
+            return 0;
+        }
+        s = next;
+    }
+
+    uint16_t base = caneta_compose_nodes[s].base;
+    if (!(base & CANETA_COMPOSE_RESULT)) {
+        *state = s;
+        return 0;
+    }
+    const uint8_t* result = &caneta_compose_results[base & ~CANETA_COMPOSE_RESULT];
+    memcpy(out, result + 1, result[0]);
+    *state = CANETA_COMPOSE_IDLE;
+    return result[0];
+}
@@ -0,0 +1,79 @@
+// caneta_compose.h
+// Dead keys and the Compose key
+//
+// A dead key types nothing by itself; the next key decides what comes out, as
+// in ´ then e giving é. The Compose key starts longer sequences: Compose o "
+// gives ö. The sequences are described in compose/*.compose (XCompose syntax)
+// and compiled by tools/caneta_composec.c into caneta_compose_table.c.
+//
+// The table is a double-array trie over the UTF-8 text each key types, so
+// every byte of a sequence costs one load of a 4-byte node and a compare
+// however many sequences there are. The state between keys is one node index
+// kept in each decoder: nothing is allocated, and keys that start no sequence
+// pass straight through.
+//
+// A dead key's layout cell is CANETA_COMPOSE_DEAD followed by the UTF-8 of its
+// combining mark (U+0300 to U+036F); the Compose key's is CANETA_COMPOSE_KEY.
+// Neither byte can start a UTF-8 character, and both type nothing without a
+// compose state, so they never reach the output.
+
+#ifndef CANETA_COMPOSE_H
+#define CANETA_COMPOSE_H
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+// Layout cell markers
+#define CANETA_COMPOSE_DEAD 0x80  // Followed by a two-byte combining mark
+#define CANETA_COMPOSE_KEY  0x81
+
+// Compose state of a decoder with no sequence in progress
+#define CANETA_COMPOSE_IDLE 0
+
+// Node of the double-array trie. The child of node s on byte b is node
+// base + b if its check is s. A node whose base has CANETA_COMPOSE_RESULT set
+// ends a sequence; the rest of base is the offset of its result in
+// caneta_compose_results, a length byte followed by UTF-8.
+typedef struct {
+  uint16_t base;
+  uint16_t check;
+} caneta_compose_node_t;
+
+#define CANETA_COMPOSE_RESULT 0x8000
+#define CANETA_COMPOSE_NONE 0xFFFF  // check of an unused node
+
+// The compiled sequences (generated). Every base + 0xFF is inside the node
+// array, so a transition needs no bounds check.
+extern const caneta_compose_node_t caneta_compose_nodes[];
+extern const size_t caneta_compose_node_count;
+extern const uint8_t caneta_compose_results[];
+extern const size_t caneta_compose_sequence_count;
+
+// Whether text (a key's layout cell) is a dead key or the Compose key
+static inline bool caneta_compose_marker(uint8_t lead) {
+  return lead == CANETA_COMPOSE_DEAD || lead == CANETA_COMPOSE_KEY;
+}
+
+// Run one key's output through the compose state. text is what the key
+// types, len bytes (a marker cell has len 0). Writes what should be output
+// into out, which may be text, and returns its length:
+// - with no sequence in progress, anything but a marker passes through;
+// - keys that type nothing leave the state alone;
+// - control characters and escape sequences cancel the sequence and pass;
+// - otherwise the key extends the sequence and types nothing, or completes
+//   it and types the result, or matches no sequence, which is dropped with
+//   the key (as XCompose does).
+// out must hold CANETA_KEY_OUTPUT_MAX bytes.
+size_t caneta_compose_feed(uint16_t* state, const uint8_t* text, size_t len, uint8_t* out);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif //CANETA_COMPOSE_H
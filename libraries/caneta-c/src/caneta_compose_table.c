@@ -0,0 +1,1323 @@
+// caneta_compose_table.c
+// Compose sequences. Generated by tools/caneta_composec.c from
+// compose/*.compose; do not edit. Regenerate with the caneta-compose target.
+
+#include "caneta_compose.h"
+
+const caneta_compose_node_t caneta_compose_nodes[] = {
+    {0x0001, 0x0000}, {0x0000, 0xFFFF}, {0x0000, 0xFFFF}, {0x0000, 0xFFFF}, {0x0000, 0xFFFF}, {0x0000, 0xFFFF},
+    {0x0000, 0xFFFF}, {0x0000, 0xFFFF}, {0x0000, 0xFFFF}, {0x0000, 0xFFFF}, {0x0000, 0xFFFF}, {0x0000, 0xFFFF},
+    {0x0000, 0xFFFF}, {0x0000, 0xFFFF}, {0x0000, 0xFFFF}, {0x0000, 0xFFFF}, {0x0000, 0xFFFF}, {0x0000, 0xFFFF},
+    {0x0000, 0xFFFF}, {0x0000, 0xFFFF}, {0x0000, 0xFFFF}, {0x0000, 0xFFFF}, {0x0000, 0xFFFF}, {0x0000, 0xFFFF},
+    {0x0000, 0xFFFF}, {0x0000, 0xFFFF}, {0x0000, 0xFFFF}, {0x0000, 0xFFFF}, {0x0000, 0xFFFF}, {0x0000, 0xFFFF},
+    {0x0000, 0xFFFF}, {0x0000, 0xFFFF}, {0x0000, 0xFFFF}, {0x8250, 0x03B8}, {0x0000, 0xFFFF}, {0x036B, 0x05A9},
+    {0x0000, 0xFFFF}, {0x0000, 0xFFFF}, {0x8250, 0x0186}, {0x0000, 0xFFFF}, {0x0000, 0xFFFF}, {0x0000, 0xFFFF},
+    {0x8B71, 0x0920}, {0x8B78, 0x0927}, {0x0465, 0x0634}, {0x8B7C, 0x0928}, {0x8B80, 0x0034}, {0x8B84, 0x0035},
+    {0x8B88, 0x0036}, {0x8B8C, 0x0037}, {0x8B90, 0x0038}, {0x8B94, 0x0039}, {0x0005, 0x0928}, {0x0006, 0x0928},
+    {0x0007, 0x0928}, {0x0008, 0x0928}, {0x0009, 0x0928}, {0x000A, 0x0928}, {0x0015, 0x0928}, {0x0016, 0x0928},
+    {0x0017, 0x0928}, {0x0018, 0x0928}, {0x8B98, 0x003A}, {0x8B9C, 0x003B}, {0x8BA0, 0x003C}, {0x8BA4, 0x003D},
+    {0x8044, 0x0093}, {0x805C, 0x0094}, {0x80A8, 0x0097}, {0x8BAC, 0x0836}, {0x8048, 0x0093}, {0x8062, 0x0094},
+    {0x8098, 0x0095}, {0x80A8, 0x0098}, {0x80A8, 0x00A5}, {0x8068, 0x0094}, {0x8248, 0x0184}, {0x825B, 0x0188},
+    {0x83EE, 0x01D4}, {0x8253, 0x0186}, {0x804C, 0x0093}, {0x806E, 0x0094}, {0x809C, 0x0095}, {0x80B0, 0x00AC},
+    {0x80B0, 0x006E}, {0x8098, 0x00A2}, {0x8018, 0x0099}, {0x8074, 0x0094}, {0x8018, 0x0065}, {0x80B4, 0x00AC},
+    {0x80B4, 0x006E}, {0x819E, 0x0186}, {0x8271, 0x01A5}, {0x8279, 0x01B3}, {0x8271, 0x018F}, {0x809C, 0x00A2},
+    {0x8279, 0x0192}, {0x83F2, 0x01D5}, {0x8050, 0x0093}, {0x807A, 0x0094}, {0x80AC, 0x0097}, {0x0003, 0x00F1},
+    {0x8054, 0x0093}, {0x8080, 0x0094}, {0x80A0, 0x0095}, {0x80AC, 0x0098}, {0x80AC, 0x00A5}, {0x8086, 0x0094},
+    {0x824C, 0x0184}, {0x825E, 0x0188}, {0x0005, 0x00F1}, {0x8257, 0x0186}, {0x8058, 0x0093}, {0x808C, 0x0094},
+    {0x80A4, 0x0095}, {0x80B8, 0x00AC}, {0x80B8, 0x006E}, {0x80A0, 0x00A2}, {0x8039, 0x0099}, {0x8092, 0x0094},
+    {0x8039, 0x0065}, {0x80BC, 0x00AC}, {0x80BC, 0x006E}, {0x81DC, 0x0186}, {0x8275, 0x01A5}, {0x827C, 0x01B3},
+    {0x8275, 0x018F}, {0x80A4, 0x00A2}, {0x827C, 0x0192}, {0x0001, 0x0000}, {0x0708, 0x0000}, {0x0070, 0x00CD},
+    {0x00FD, 0x00CD}, {0x020C, 0x00CD}, {0x02A6, 0x00CD}, {0x032D, 0x00CD}, {0x8248, 0x01B8}, {0x037D, 0x00CD},
+    {0x03C3, 0x00CD}, {0x0421, 0x00CD}, {0x0488, 0x00CD}, {0x04C5, 0x00CD}, {0x040E, 0x00CD}, {0x0528, 0x00CD},
+    {0x8000, 0x0083}, {0x8000, 0x00CE}, {0x8044, 0x00A1}, {0x0001, 0x00CE}, {0x0002, 0x00CE}, {0x0003, 0x00CE},
+    {0x8048, 0x00A1}, {0x0003, 0x00CE}, {0x0008, 0x00F1}, {0x0001, 0x00CE}, {0x8098, 0x00B0}, {0x80F5, 0x013A},
+    {0x80FA, 0x013A}, {0x83EE, 0x01F4}, {0x0515, 0x00CD}, {0x80E1, 0x0137}, {0x804C, 0x00A1}, {0x0051, 0x00F1},
+    {0x0010, 0x00F1}, {0x80C0, 0x0132}, {0x809C, 0x00B0}, {0x0009, 0x00F1}, {0x05B3, 0x00CD}, {0x80E6, 0x0139},
+    {0x824C, 0x01B8}, {0x0561, 0x00CD}, {0x05F2, 0x00CD}, {0x05FA, 0x00CD}, {0x0004, 0x00CE}, {0x827F, 0x01BF},
+    {0x80EB, 0x0139}, {0x82A6, 0x01C4}, {0x0055, 0x0105}, {0x8002, 0x0083}, {0x8050, 0x00A1}, {0x81EC, 0x0180},
+    {0x83F2, 0x01F5}, {0x8005, 0x0083}, {0x8054, 0x00A1}, {0x81F0, 0x0180}, {0x065E, 0x00CD}, {0x8008, 0x0083},
+    {0x80A0, 0x00B0}, {0x8248, 0x01C5}, {0x80F0, 0x0139}, {0x800B, 0x0083}, {0x800F, 0x0083}, {0x8012, 0x0083},
+    {0x8058, 0x00A1}, {0x81F4, 0x0180}, {0x8044, 0x0133}, {0x842E, 0x02CE}, {0x80A4, 0x00B0}, {0x8015, 0x0083},
+    {0x8018, 0x0083}, {0x801B, 0x0083}, {0x8238, 0x0182}, {0x801F, 0x0083}, {0x8048, 0x0133}, {0x0078, 0x0151},
+    {0x007A, 0x0151}, {0x0003, 0x0081}, {0x0011, 0x00F0}, {0x00FE, 0x017D}, {0x0113, 0x028C}, {0x8023, 0x0083},
+    {0x823C, 0x0182}, {0x81F8, 0x0180}, {0x804C, 0x0133}, {0x8026, 0x0083}, {0x825B, 0x01D2}, {0x81FC, 0x0180},
+    {0x8428, 0x02F7}, {0x8029, 0x0083}, {0x845F, 0x02D3}, {0x824C, 0x01C5}, {0x8018, 0x0133}, {0x802C, 0x0083},
+    {0x8030, 0x0083}, {0x8033, 0x0083}, {0x0052, 0x02EE}, {0x8200, 0x0180}, {0x8050, 0x0133}, {0x80C3, 0x0136},
+    {0x833E, 0x00E0}, {0x8036, 0x0083}, {0x8039, 0x0083}, {0x803C, 0x0083}, {0x8240, 0x0182}, {0x8040, 0x0083},
+    {0x8054, 0x0133}, {0x80C8, 0x0136}, {0x842B, 0x02F7}, {0x80CD, 0x0136}, {0x00E9, 0x0225}, {0x8499, 0x019E},
+    {0x0002, 0x0083}, {0x0043, 0x0083}, {0x8244, 0x0182}, {0x80D2, 0x0136}, {0x8058, 0x0133}, {0x8238, 0x01C2},
+    {0x825E, 0x01D2}, {0x00D1, 0x0225}, {0x80FF, 0x00CB}, {0x8103, 0x00CB}, {0x813F, 0x00CC}, {0x8143, 0x00CC},
+    {0x8039, 0x0133}, {0x84A5, 0x01B4}, {0x8261, 0x0199}, {0x823C, 0x01C2}, {0x8107, 0x00CB}, {0x810B, 0x00CB},
+    {0x8147, 0x00CC}, {0x814B, 0x00CC}, {0x8265, 0x0199}, {0x0001, 0x00F1}, {0x8261, 0x018E}, {0x8216, 0x01E1},
+    {0x810F, 0x00CB}, {0x8113, 0x00CB}, {0x814F, 0x00CC}, {0x8153, 0x00CC}, {0x8265, 0x018E}, {0x821A, 0x01E1},
+    {0x80D7, 0x0136}, {0x80DC, 0x0136}, {0x8117, 0x00CB}, {0x811B, 0x00CB}, {0x84A9, 0x01B5}, {0x8157, 0x00CC},
+    {0x8271, 0x00F7}, {0x8240, 0x01C2}, {0x82BA, 0x01C7}, {0x82BF, 0x01C7}, {0x811F, 0x00CB}, {0x8123, 0x00CB},
+    {0x815B, 0x00CC}, {0x815F, 0x00CC}, {0x84AD, 0x01BD}, {0x816B, 0x0084}, {0x8269, 0x0199}, {0x8244, 0x01C2},
+    {0x8127, 0x00CB}, {0x812B, 0x00CB}, {0x8163, 0x00CC}, {0x8167, 0x00CC}, {0x826D, 0x0199}, {0x008B, 0x02F3},
+    {0x8269, 0x018E}, {0x8230, 0x01E1}, {0x812F, 0x00CB}, {0x8133, 0x00CB}, {0x0178, 0x01DE}, {0x018A, 0x01DE},
+    {0x826D, 0x018E}, {0x8234, 0x01E1}, {0x8238, 0x00EE}, {0x849D, 0x019F}, {0x8137, 0x00CB}, {0x813B, 0x00CB},
+    {0x0003, 0x0083}, {0x0040, 0x0083}, {0x8275, 0x00F7}, {0x8253, 0x0185}, {0x005D, 0x0083}, {0x0002, 0x0083},
+    {0x823C, 0x00EE}, {0x0013, 0x0083}, {0x0011, 0x0083}, {0x8473, 0x02D6}, {0x8478, 0x02D6}, {0x84B1, 0x0125},
+    {0x816D, 0x0084}, {0x011E, 0x0326}, {0x8170, 0x0084}, {0x819E, 0x0185}, {0x8173, 0x0084}, {0x8519, 0x0368},
+    {0x8176, 0x0084}, {0x8501, 0x01A4}, {0x8179, 0x0084}, {0x817C, 0x0084}, {0x8180, 0x0084}, {0x8184, 0x0084},
+    {0x8187, 0x0084}, {0x818B, 0x0084}, {0x818E, 0x0084}, {0x8191, 0x0084}, {0x8240, 0x00EE}, {0x8195, 0x0084},
+    {0x8198, 0x0084}, {0x000F, 0x0083}, {0x819B, 0x0084}, {0x819E, 0x0084}, {0x81A1, 0x0084}, {0x8257, 0x0185},
+    {0x81A5, 0x0084}, {0x81A8, 0x0084}, {0x8244, 0x00EE}, {0x016E, 0x02ED}, {0x00EC, 0x02ED}, {0x8501, 0x02A1},
+    {0x82AB, 0x01C6}, {0x84A1, 0x019F}, {0x81AB, 0x0084}, {0x8533, 0x036D}, {0x81AE, 0x0084}, {0x81DC, 0x0185},
+    {0x81B1, 0x0084}, {0x82B0, 0x01C6}, {0x81B4, 0x0084}, {0x8505, 0x01A4}, {0x81B7, 0x0084}, {0x81BA, 0x0084},
+    {0x81BE, 0x0084}, {0x81C2, 0x0084}, {0x81C5, 0x0084}, {0x81C9, 0x0084}, {0x81CC, 0x0084}, {0x81CF, 0x0084},
+    {0x02C8, 0x03AD}, {0x81D3, 0x0084}, {0x81D6, 0x0084}, {0x82B5, 0x01C6}, {0x81D9, 0x0084}, {0x81DC, 0x0084},
+    {0x81DF, 0x0084}, {0x8464, 0x02D5}, {0x81E3, 0x0084}, {0x81E6, 0x0084}, {0x83DE, 0x015A}, {0x83EA, 0x015A},
+    {0x85F7, 0x03EF}, {0x8505, 0x02A1}, {0x8469, 0x02D5}, {0x0003, 0x0084}, {0x0163, 0x0084}, {0x81E9, 0x00CF},
+    {0x0072, 0x00CF}, {0x0142, 0x00CF}, {0x0083, 0x00CF}, {0x8204, 0x0181}, {0x000B, 0x00CF}, {0x00EC, 0x017E},
+    {0x0006, 0x00CF}, {0x820A, 0x0181}, {0x000C, 0x00CF}, {0x0212, 0x03FD}, {0x846E, 0x02D5}, {0x8210, 0x0181},
+    {0x81EC, 0x01C1}, {0x8501, 0x02AE}, {0x00B7, 0x017E}, {0x001B, 0x017E}, {0x81F0, 0x01C1}, {0x8216, 0x0181},
+    {0x0011, 0x017E}, {0x018E, 0x00D0}, {0x0209, 0x00D0}, {0x8330, 0x00D0}, {0x027C, 0x0358}, {0x821A, 0x0181},
+    {0x8673, 0x043F}, {0x00AF, 0x00CF}, {0x81F4, 0x01C1}, {0x85C3, 0x034B}, {0x020B, 0x00D0}, {0x025F, 0x02F0},
+    {0x0056, 0x02F0}, {0x00A3, 0x02F0}, {0x02B9, 0x013F}, {0x84B5, 0x013F}, {0x0223, 0x028D}, {0x821E, 0x0181},
+    {0x0104, 0x013F}, {0x0019, 0x00CF}, {0x841C, 0x02F6}, {0x8224, 0x0181}, {0x8538, 0x036F}, {0x841F, 0x02F6},
+    {0x01FD, 0x045E}, {0x822A, 0x0181}, {0x81F8, 0x01C1}, {0x8505, 0x02AE}, {0x02FD, 0x0443}, {0x853D, 0x036F},
+    {0x81FC, 0x01C1}, {0x8230, 0x0181}, {0x872C, 0x03B2}, {0x000E, 0x00CF}, {0x0062, 0x02F1}, {0x0062, 0x02F1},
+    {0x0218, 0x00D0}, {0x8234, 0x0181}, {0x0047, 0x017E}, {0x01AF, 0x013F}, {0x8200, 0x01C1}, {0x85C6, 0x034B},
+    {0x8422, 0x02F6}, {0x0073, 0x02F1}, {0x8425, 0x02F6}, {0x000D, 0x0084}, {0x0147, 0x0084}, {0x014B, 0x017E},
+    {0x00B0, 0x017E}, {0x0154, 0x0084}, {0x0012, 0x0084}, {0x007A, 0x017E}, {0x00C8, 0x0084}, {0x008C, 0x0084},
+    {0x872F, 0x038D}, {0x81EC, 0x01C0}, {0x02A1, 0x0387}, {0x029B, 0x0387}, {0x825B, 0x01C0}, {0x8282, 0x01C0},
+    {0x8271, 0x01C0}, {0x8044, 0x0193}, {0x02ED, 0x03E9}, {0x81F0, 0x01C0}, {0x0095, 0x017E}, {0x8048, 0x0193},
+    {0x0001, 0x028D}, {0x0014, 0x028D}, {0x8253, 0x01C0}, {0x85F1, 0x0370}, {0x861E, 0x03F4}, {0x8733, 0x0485},
+    {0x8288, 0x01C3}, {0x81F4, 0x01C0}, {0x8216, 0x01C0}, {0x804C, 0x0193}, {0x006E, 0x0084}, {0x8279, 0x01C0},
+    {0x022D, 0x028D}, {0x00B8, 0x017E}, {0x828D, 0x01C3}, {0x819E, 0x01C0}, {0x8292, 0x01C3}, {0x85F1, 0x03F4},
+    {0x85F4, 0x03F4}, {0x85F1, 0x0248}, {0x8524, 0x036C}, {0x81F8, 0x01C0}, {0x8297, 0x01C3}, {0x872F, 0x0488},
+    {0x825E, 0x01C0}, {0x8285, 0x01C0}, {0x8275, 0x01C0}, {0x8050, 0x0193}, {0x8529, 0x036C}, {0x81FC, 0x01C0},
+    {0x852E, 0x036C}, {0x8054, 0x0193}, {0x0030, 0x028D}, {0x0047, 0x028D}, {0x8257, 0x01C0}, {0x85F4, 0x0370},
+    {0x82C4, 0x012A}, {0x82C8, 0x012A}, {0x021D, 0x04A4}, {0x8200, 0x01C0}, {0x8230, 0x01C0}, {0x8058, 0x0193},
+    {0x8509, 0x01B9}, {0x827C, 0x01C0}, {0x82CC, 0x012A}, {0x82D0, 0x012A}, {0x85C3, 0x028B}, {0x81DC, 0x01C0},
+    {0x850D, 0x01B9}, {0x829C, 0x01C3}, {0x82A1, 0x01C3}, {0x85F4, 0x0248}, {0x82D4, 0x012A}, {0x82D8, 0x012A},
+    {0x8304, 0x012B}, {0x8308, 0x012B}, {0x85C9, 0x03F5}, {0x85CF, 0x03F5}, {0x83D6, 0x0159}, {0x83E2, 0x0159},
+    {0x82DC, 0x012A}, {0x82E0, 0x012A}, {0x830C, 0x012B}, {0x8310, 0x012B}, {0x85CC, 0x03F5}, {0x85D2, 0x03F5},
+    {0x8632, 0x03F7}, {0x8637, 0x03F7}, {0x82E4, 0x012A}, {0x82E8, 0x012A}, {0x8314, 0x012B}, {0x8318, 0x012B},
+    {0x0190, 0x040E}, {0x01EF, 0x040E}, {0x8511, 0x01B9}, {0x0337, 0x04A1}, {0x82EC, 0x012A}, {0x82F0, 0x012A},
+    {0x85C6, 0x028B}, {0x831C, 0x012B}, {0x8515, 0x01B9}, {0x003F, 0x017E}, {0x83DA, 0x0159}, {0x83E6, 0x0159},
+    {0x82F4, 0x012A}, {0x82F8, 0x012A}, {0x8320, 0x012B}, {0x8324, 0x012B}, {0x8330, 0x0085}, {0x0333, 0x0414},
+    {0x02C6, 0x03AE}, {0x0324, 0x03AE}, {0x82FC, 0x012A}, {0x8300, 0x012A}, {0x8328, 0x012B}, {0x832C, 0x012B},
+    {0x8332, 0x0085}, {0x8336, 0x0085}, {0x0333, 0x0508}, {0x833A, 0x0085}, {0x879B, 0x054A}, {0x833E, 0x0085},
+    {0x8342, 0x0085}, {0x02C2, 0x03AE}, {0x8345, 0x0085}, {0x8349, 0x0085}, {0x834C, 0x0085}, {0x834F, 0x0085},
+    {0x8352, 0x0085}, {0x8356, 0x0085}, {0x835A, 0x0085}, {0x835E, 0x0085}, {0x8362, 0x0085}, {0x8366, 0x0085},
+    {0x85E1, 0x021C}, {0x85E9, 0x021C}, {0x0198, 0x03AE}, {0x836A, 0x0085}, {0x81EC, 0x0194}, {0x8623, 0x03F6},
+    {0x83BE, 0x019C}, {0x836E, 0x0085}, {0x81F0, 0x0194}, {0x8371, 0x0085}, {0x83C2, 0x019C}, {0x8374, 0x0085},
+    {0x8628, 0x03F6}, {0x8377, 0x0085}, {0x837A, 0x0085}, {0x837D, 0x0085}, {0x8380, 0x0085}, {0x8786, 0x04E3},
+    {0x81F4, 0x0194}, {0x83D6, 0x01B6}, {0x83C6, 0x019C}, {0x8383, 0x0085}, {0x8509, 0x0277}, {0x83DA, 0x01B6},
+    {0x8663, 0x02B5}, {0x8386, 0x0085}, {0x862D, 0x03F6}, {0x8389, 0x0085}, {0x850D, 0x0277}, {0x838C, 0x0085},
+    {0x83D6, 0x01A2}, {0x838F, 0x0085}, {0x8392, 0x0085}, {0x83DE, 0x01B6}, {0x83DA, 0x01A2}, {0x01F6, 0x0545},
+    {0x81F8, 0x0194}, {0x8738, 0x04E3}, {0x83CA, 0x019C}, {0x8396, 0x0085}, {0x81FC, 0x0194}, {0x8399, 0x0085},
+    {0x83CE, 0x019C}, {0x839C, 0x0085}, {0x83DE, 0x01A2}, {0x839F, 0x0085}, {0x83A2, 0x0085}, {0x83A5, 0x0085},
+    {0x83A8, 0x0085}, {0x020D, 0x0327}, {0x8200, 0x0194}, {0x83E2, 0x01B6}, {0x83D2, 0x019C}, {0x83AB, 0x0085},
+    {0x8511, 0x0277}, {0x83E6, 0x01B6}, {0x8667, 0x02B5}, {0x83AE, 0x0085}, {0x8843, 0x0269}, {0x83B1, 0x0085},
+    {0x8515, 0x0277}, {0x83B4, 0x0085}, {0x83E2, 0x01A2}, {0x83B7, 0x0085}, {0x83BA, 0x0085}, {0x83EA, 0x01B6},
+    {0x83E6, 0x01A2}, {0x85E5, 0x021D}, {0x85ED, 0x021D}, {0x01B3, 0x03AE}, {0x0004, 0x0085}, {0x0181, 0x0085},
+    {0x83F6, 0x01E0}, {0x866B, 0x02B9}, {0x866B, 0x0445}, {0x866F, 0x0445}, {0x83EA, 0x01A2}, {0x8663, 0x02B7},
+    {0x885A, 0x0587}, {0x83F9, 0x01E0}, {0x83FC, 0x01E0}, {0x8400, 0x01E0}, {0x863C, 0x0189}, {0x8403, 0x01E0},
+    {0x0217, 0x048E}, {0x8406, 0x01E0}, {0x840A, 0x01E0}, {0x8663, 0x01AA}, {0x8667, 0x01AA}, {0x840D, 0x01E0},
+    {0x8410, 0x01E0}, {0x011A, 0x0327}, {0x885D, 0x029A}, {0x866B, 0x02C2}, {0x8413, 0x01E0}, {0x8416, 0x01E0},
+    {0x8419, 0x01E0}, {0x85E1, 0x036B}, {0x8044, 0x02CF}, {0x81EC, 0x02CF}, {0x02BF, 0x0327}, {0x8431, 0x02CF},
+    {0x8441, 0x02D2}, {0x85E5, 0x036B}, {0x014C, 0x0327}, {0x866F, 0x02B9}, {0x8048, 0x02CF}, {0x81F0, 0x02CF},
+    {0x886C, 0x04D0}, {0x8667, 0x02B7}, {0x8446, 0x02D2}, {0x021D, 0x0189}, {0x844B, 0x02D2}, {0x0252, 0x03FE},
+    {0x02B2, 0x05A8}, {0x024A, 0x0189}, {0x804C, 0x02CF}, {0x81F4, 0x02CF}, {0x8450, 0x02D2}, {0x8435, 0x02CF},
+    {0x85C9, 0x034F}, {0x8724, 0x01FA}, {0x8728, 0x01FA}, {0x866B, 0x0196}, {0x025E, 0x03FE}, {0x866F, 0x02C2},
+    {0x8911, 0x05EA}, {0x8714, 0x037E}, {0x84B5, 0x0086}, {0x85E9, 0x036B}, {0x8050, 0x02CF}, {0x81F8, 0x02CF},
+    {0x0239, 0x0595}, {0x8439, 0x02CF}, {0x85CC, 0x034F}, {0x85ED, 0x036B}, {0x0023, 0x0085}, {0x0228, 0x0085},
+    {0x8054, 0x02CF}, {0x81FC, 0x02CF}, {0x0226, 0x0085}, {0x003D, 0x0085}, {0x8953, 0x02CA}, {0x00E1, 0x0085},
+    {0x00B1, 0x0085}, {0x8455, 0x02D2}, {0x845A, 0x02D2}, {0x871C, 0x0389}, {0x8058, 0x02CF}, {0x8200, 0x02CF},
+    {0x043D, 0x02CA}, {0x843D, 0x02CF}, {0x85CF, 0x034F}, {0x847D, 0x019D}, {0x8481, 0x019D}, {0x866F, 0x0196},
+    {0x84B7, 0x0086}, {0x84BB, 0x0086}, {0x84BF, 0x0086}, {0x8718, 0x037E}, {0x8724, 0x03A0}, {0x84C3, 0x0086},
+    {0x8485, 0x019D}, {0x8489, 0x019D}, {0x848D, 0x019D}, {0x84C6, 0x0086}, {0x85D2, 0x034F}, {0x009F, 0x0085},
+    {0x0058, 0x0085}, {0x84CA, 0x0086}, {0x00E5, 0x0085}, {0x0119, 0x0085}, {0x8953, 0x05D7}, {0x0091, 0x0085},
+    {0x84CD, 0x0086}, {0x84D0, 0x0086}, {0x0103, 0x01E0}, {0x0057, 0x01E0}, {0x8491, 0x019D}, {0x8720, 0x0389},
+    {0x8431, 0x01A0}, {0x84D3, 0x0086}, {0x84D6, 0x0086}, {0x02C7, 0x0633}, {0x84F9, 0x01A0}, {0x84DA, 0x0086},
+    {0x8431, 0x02AA}, {0x8789, 0x04E8}, {0x878C, 0x04E8}, {0x85C9, 0x023B}, {0x84F9, 0x02AA}, {0x8431, 0x0369},
+    {0x8728, 0x03A0}, {0x84DE, 0x0086}, {0x8435, 0x01A0}, {0x8949, 0x05F2}, {0x894E, 0x05F2}, {0x84E1, 0x0086},
+    {0x8495, 0x019D}, {0x84F9, 0x0369}, {0x8435, 0x02AA}, {0x84E5, 0x0086}, {0x8724, 0x0348}, {0x85CC, 0x023B},
+    {0x85E1, 0x022E}, {0x8714, 0x034E}, {0x84E8, 0x0086}, {0x84EB, 0x0086}, {0x8216, 0x0369}, {0x8435, 0x0369},
+    {0x85E5, 0x022E}, {0x851C, 0x0369}, {0x8439, 0x01A0}, {0x84EE, 0x0086}, {0x84F1, 0x0086}, {0x821A, 0x0369},
+    {0x84FD, 0x01A0}, {0x84F5, 0x0086}, {0x8439, 0x02AA}, {0x8542, 0x01CA}, {0x8546, 0x01CA}, {0x85CF, 0x023B},
+    {0x84FD, 0x02AA}, {0x8439, 0x0369}, {0x0073, 0x0086}, {0x024C, 0x0086}, {0x843D, 0x01A0}, {0x854A, 0x01CA},
+    {0x854E, 0x01CA}, {0x8572, 0x01CB}, {0x8576, 0x01CB}, {0x84FD, 0x0369}, {0x843D, 0x02AA}, {0x8972, 0x0675},
+    {0x8728, 0x0348}, {0x85D2, 0x023B}, {0x85E9, 0x022E}, {0x8718, 0x034E}, {0x857A, 0x01CB}, {0x029F, 0x05E1},
+    {0x8230, 0x0369}, {0x843D, 0x0369}, {0x85ED, 0x022E}, {0x8520, 0x0369}, {0x034C, 0x02B8}, {0x857E, 0x01CB},
+    {0x8582, 0x01CB}, {0x8234, 0x0369}, {0x886F, 0x02B8}, {0x871C, 0x038A}, {0x8714, 0x01D0}, {0x8552, 0x01CA},
+    {0x8556, 0x01CA}, {0x8586, 0x01CB}, {0x858A, 0x01CB}, {0x8A19, 0x0335}, {0x851C, 0x03BA}, {0x85D5, 0x0350},
+    {0x02BD, 0x0444}, {0x855A, 0x01CA}, {0x855E, 0x01CA}, {0x014C, 0x016E}, {0x858E, 0x016E}, {0x858E, 0x0087},
+    {0x02C0, 0x0444}, {0x027D, 0x016E}, {0x0306, 0x016E}, {0x8562, 0x01CA}, {0x8566, 0x01CA}, {0x8A27, 0x0623},
+    {0x8600, 0x03F3}, {0x85D8, 0x0350}, {0x02B0, 0x0672}, {0x8A2A, 0x0356}, {0x00DE, 0x03FE}, {0x856A, 0x01CA},
+    {0x856E, 0x01CA}, {0x85A4, 0x0350}, {0x8605, 0x03F3}, {0x877B, 0x03BB}, {0x860A, 0x03F3}, {0x8720, 0x038A},
+    {0x8718, 0x01D0}, {0x877B, 0x03B1}, {0x0451, 0x02FD}, {0x02ED, 0x067A}, {0x860F, 0x03F3}, {0x85D5, 0x022F},
+    {0x8520, 0x03BA}, {0x85DB, 0x0350}, {0x00A3, 0x0086}, {0x0283, 0x0086}, {0x8972, 0x02FD}, {0x025B, 0x016E},
+    {0x0162, 0x0086}, {0x00C2, 0x0086}, {0x8591, 0x0087}, {0x0114, 0x0086}, {0x0188, 0x016E}, {0x851C, 0x03D0},
+    {0x8594, 0x0087}, {0x85D8, 0x022F}, {0x8597, 0x0087}, {0x85DE, 0x0350}, {0x859B, 0x0087}, {0x80A8, 0x0440},
+    {0x8248, 0x0440}, {0x85A4, 0x022F}, {0x8501, 0x0440}, {0x85BD, 0x0350}, {0x859E, 0x0087}, {0x877F, 0x03BB},
+    {0x0272, 0x01AE}, {0x8614, 0x03F3}, {0x8619, 0x03F3}, {0x877F, 0x03B1}, {0x85A1, 0x0087}, {0x85A4, 0x0087},
+    {0x8676, 0x01AE}, {0x85DB, 0x022F}, {0x85A7, 0x0087}, {0x010E, 0x0086}, {0x877B, 0x022D}, {0x0286, 0x01AE},
+    {0x02EC, 0x0444}, {0x882B, 0x03B9}, {0x882B, 0x03C8}, {0x0155, 0x0444}, {0x85AA, 0x0087}, {0x882B, 0x03D5},
+    {0x825B, 0x0588}, {0x8520, 0x03D0}, {0x85AD, 0x0087}, {0x85DE, 0x022F}, {0x85B0, 0x0087}, {0x8A7A, 0x0363},
+    {0x85B4, 0x0087}, {0x80AC, 0x0440}, {0x824C, 0x0440}, {0x85BD, 0x022F}, {0x8505, 0x0440}, {0x8A9B, 0x06BC},
+    {0x85B7, 0x0087}, {0x863C, 0x0089}, {0x03C9, 0x0509}, {0x03C9, 0x06DE}, {0x0293, 0x01AE}, {0x8789, 0x033A},
+    {0x85BA, 0x0087}, {0x85BD, 0x0087}, {0x872C, 0x0450}, {0x85D5, 0x03F0}, {0x85C0, 0x0087}, {0x85FA, 0x03F0},
+    {0x877F, 0x022D}, {0x8098, 0x03F0}, {0x8238, 0x03F0}, {0x882F, 0x03B9}, {0x882F, 0x03C8}, {0x00A2, 0x0087},
+    {0x020D, 0x0087}, {0x882F, 0x03D5}, {0x825E, 0x0588}, {0x030C, 0x04A2}, {0x0148, 0x01AE}, {0x809C, 0x03F0},
+    {0x823C, 0x03F0}, {0x040C, 0x0236}, {0x85C3, 0x03F0}, {0x85D8, 0x03F0}, {0x0001, 0x021F}, {0x034A, 0x0236},
+    {0x02F7, 0x021F}, {0x0308, 0x021F}, {0x879B, 0x0236}, {0x85A4, 0x03F0}, {0x863F, 0x0089}, {0x8783, 0x021F},
+    {0x8789, 0x0023}, {0x878C, 0x033A}, {0x8642, 0x0089}, {0x8932, 0x05EF}, {0x8645, 0x0089}, {0x85DB, 0x03F0},
+    {0x8648, 0x0089}, {0x85FD, 0x03F0}, {0x034B, 0x0509}, {0x80A0, 0x03F0}, {0x8240, 0x03F0}, {0x8B18, 0x0720},
+    {0x864B, 0x0089}, {0x8789, 0x05EB}, {0x038A, 0x0236}, {0x872C, 0x0726}, {0x0322, 0x04A2}, {0x040D, 0x0509},
+    {0x864E, 0x0089}, {0x80A4, 0x03F0}, {0x8244, 0x03F0}, {0x034E, 0x0509}, {0x85C6, 0x03F0}, {0x85DE, 0x03F0},
+    {0x8937, 0x05EF}, {0x8833, 0x03CE}, {0x878F, 0x04F4}, {0x8792, 0x04F4}, {0x8B1B, 0x0727}, {0x85BD, 0x03F0},
+    {0x8651, 0x0089}, {0x8837, 0x03CE}, {0x878C, 0x0023}, {0x034A, 0x082E}, {0x8654, 0x0089}, {0x8676, 0x008A},
+    {0x8657, 0x0089}, {0x04CC, 0x03E1}, {0x865A, 0x0089}, {0x893A, 0x05F1}, {0x03D4, 0x0889}, {0x011C, 0x0444},
+    {0x8795, 0x04F4}, {0x8798, 0x04F4}, {0x865D, 0x0089}, {0x878C, 0x05EB}, {0x893F, 0x05F1}, {0x00DA, 0x0087},
+    {0x0321, 0x0087}, {0x8B3C, 0x08D8}, {0x8660, 0x0089}, {0x02CE, 0x0087}, {0x013B, 0x0087}, {0x0166, 0x0087},
+    {0x01B7, 0x0087}, {0x018C, 0x0087}, {0x8A73, 0x06B4}, {0x883B, 0x03CE}, {0x8A76, 0x06B4}, {0x8B5B, 0x072D},
+    {0x8944, 0x05F1}, {0x00BD, 0x0089}, {0x0296, 0x0089}, {0x883F, 0x03CE}, {0x866B, 0x06B6}, {0x866F, 0x06B6},
+    {0x8279, 0x044A}, {0x8279, 0x0721}, {0x8679, 0x008A}, {0x867C, 0x008A}, {0x8680, 0x008A}, {0x8683, 0x008A},
+    {0x8687, 0x008A}, {0x868A, 0x008A}, {0x868E, 0x008A}, {0x8691, 0x008A}, {0x8695, 0x008A}, {0x0528, 0x0914},
+    {0x0164, 0x0087}, {0x8698, 0x008A}, {0x869B, 0x008A}, {0x869F, 0x008A}, {0x86A3, 0x008A}, {0x86A6, 0x008A},
+    {0x017E, 0x04A2}, {0x86AA, 0x008A}, {0x86AE, 0x008A}, {0x86B2, 0x008A}, {0x8833, 0x039E}, {0x877B, 0x0868},
+    {0x86B6, 0x008A}, {0x86BA, 0x008A}, {0x86BE, 0x008A}, {0x86C2, 0x008A}, {0x8837, 0x039E}, {0x0709, 0x0975},
+    {0x05EB, 0x0975}, {0x039F, 0x0976}, {0x827C, 0x044A}, {0x827C, 0x0721}, {0x86C5, 0x008A}, {0x86C8, 0x008A},
+    {0x86CC, 0x008A}, {0x86CF, 0x008A}, {0x86D3, 0x008A}, {0x86D6, 0x008A}, {0x86DA, 0x008A}, {0x86DD, 0x008A},
+    {0x86E1, 0x008A}, {0x86E4, 0x008A}, {0x885D, 0x008E}, {0x86E7, 0x008A}, {0x86EA, 0x008A}, {0x86EE, 0x008A},
+    {0x86F2, 0x008A}, {0x86F5, 0x008A}, {0x8B6B, 0x0421}, {0x86F9, 0x008A}, {0x86FD, 0x008A}, {0x8701, 0x008A},
+    {0x883B, 0x039E}, {0x877F, 0x0868}, {0x8705, 0x008A}, {0x8709, 0x008A}, {0x870D, 0x008A}, {0x8711, 0x008A},
+    {0x883F, 0x039E}, {0x00F8, 0x0089}, {0x02F7, 0x0089}, {0x8736, 0x008B}, {0x8BB0, 0x0837}, {0x00E2, 0x008A},
+    {0x0327, 0x008A}, {0x01E8, 0x0089}, {0x8BB4, 0x0838}, {0x8253, 0x04E4}, {0x8738, 0x008B}, {0x8BB8, 0x0839},
+    {0x03B3, 0x039F}, {0x851C, 0x0887}, {0x851C, 0x0457}, {0x83BE, 0x03B5}, {0x83BE, 0x03D1}, {0x851C, 0x04E4},
+    {0x033A, 0x039F}, {0x83C2, 0x03B5}, {0x83C2, 0x03D1}, {0x8018, 0x04E4}, {0x819E, 0x04E4}, {0x8738, 0x03E8},
+    {0x8BBC, 0x083A}, {0x03FD, 0x03E8}, {0x040B, 0x03E8}, {0x8BC0, 0x083B}, {0x040C, 0x08CB}, {0x83C6, 0x03B5},
+    {0x83C6, 0x03D1}, {0x8860, 0x008E}, {0x00F0, 0x0089}, {0x8738, 0x08CB}, {0x877B, 0x0458}, {0x877B, 0x045A},
+    {0x873B, 0x008B}, {0x8863, 0x008E}, {0x851C, 0x08CC}, {0x8BC4, 0x083C}, {0x873E, 0x008B}, {0x8257, 0x04E4},
+    {0x8BC8, 0x083D}, {0x8741, 0x008B}, {0x8745, 0x008B}, {0x8520, 0x0887}, {0x8520, 0x0457}, {0x83CA, 0x03B5},
+    {0x83CA, 0x03D1}, {0x8520, 0x04E4}, {0x8748, 0x008B}, {0x83CE, 0x03B5}, {0x83CE, 0x03D1}, {0x8039, 0x04E4},
+    {0x81DC, 0x04E4}, {0x8BCC, 0x083E}, {0x874B, 0x008B}, {0x8279, 0x08C3}, {0x874E, 0x008B}, {0x8752, 0x008B},
+    {0x8756, 0x008B}, {0x83D2, 0x03B5}, {0x83D2, 0x03D1}, {0x8866, 0x008E}, {0x8A9E, 0x039F}, {0x83BE, 0x054B},
+    {0x877F, 0x0458}, {0x877F, 0x045A}, {0x8759, 0x008B}, {0x8869, 0x008E}, {0x8520, 0x08CC}, {0x0139, 0x008A},
+    {0x875C, 0x008B}, {0x83C2, 0x054B}, {0x012C, 0x008A}, {0x875F, 0x008B}, {0x8763, 0x008B}, {0x8248, 0x08F6},
+    {0x8962, 0x02DC}, {0x8248, 0x05AE}, {0x01CE, 0x008E}, {0x825B, 0x05B2}, {0x8766, 0x008B}, {0x83C6, 0x054B},
+    {0x8966, 0x02DC}, {0x8914, 0x05EE}, {0x8BD0, 0x083F}, {0x8769, 0x008B}, {0x876D, 0x008B}, {0x827C, 0x08C3},
+    {0x8770, 0x008B}, {0x8774, 0x008B}, {0x8778, 0x008B}, {0x8919, 0x05EE}, {0x8271, 0x05CF}, {0x891E, 0x05EE},
+    {0x8BD8, 0x088A}, {0x83CA, 0x054B}, {0x8962, 0x0362}, {0x0153, 0x008B}, {0x0352, 0x008B}, {0x8923, 0x05EE},
+    {0x0141, 0x008A}, {0x0576, 0x0956}, {0x8966, 0x0362}, {0x83CE, 0x054B}, {0x879B, 0x008C}, {0x8BDC, 0x088B},
+    {0x8BE0, 0x088C}, {0x824C, 0x08F6}, {0x896A, 0x02DC}, {0x824C, 0x05AE}, {0x0476, 0x0956}, {0x825E, 0x05B2},
+    {0x8BE4, 0x088D}, {0x83D2, 0x054B}, {0x896E, 0x02DC}, {0x8BE8, 0x088E}, {0x8962, 0x002C}, {0x8BEC, 0x088F},
+    {0x8BF0, 0x0890}, {0x878F, 0x08DC}, {0x8792, 0x08DC}, {0x8271, 0x04AE}, {0x8966, 0x002C}, {0x8BF4, 0x0891},
+    {0x8275, 0x05CF}, {0x8BF8, 0x0892}, {0x8928, 0x05EE}, {0x892D, 0x05EE}, {0x896A, 0x0362}, {0x8BFC, 0x0893},
+    {0x8C04, 0x089B}, {0x8C08, 0x089C}, {0x8C0C, 0x089D}, {0x8C10, 0x089E}, {0x896E, 0x0362}, {0x8795, 0x08DC},
+    {0x8798, 0x08DC}, {0x879E, 0x008C}, {0x87A2, 0x008C}, {0x87A5, 0x008C}, {0x87A8, 0x008C}, {0x87AB, 0x008C},
+    {0x87AF, 0x008C}, {0x87B2, 0x008C}, {0x0212, 0x008E}, {0x87B5, 0x008C}, {0x8C14, 0x089F}, {0x87B9, 0x008C},
+    {0x896A, 0x002C}, {0x87BC, 0x008C}, {0x87C0, 0x008C}, {0x87C3, 0x008C}, {0x87C7, 0x008C}, {0x8275, 0x04AE},
+    {0x896E, 0x002C}, {0x8C18, 0x08A0}, {0x87CA, 0x008C}, {0x87CD, 0x008C}, {0x87D1, 0x008C}, {0x87D4, 0x008C},
+    {0x8C1C, 0x08A1}, {0x87D8, 0x008C}, {0x87DC, 0x008C}, {0x01B7, 0x008B}, {0x03BA, 0x008B}, {0x8843, 0x008D},
+    {0x8C20, 0x08A2}, {0x8C24, 0x08A3}, {0x026E, 0x008B}, {0x87DF, 0x008C}, {0x87E3, 0x008C}, {0x87E6, 0x008C},
+    {0x87E9, 0x008C}, {0x87EC, 0x008C}, {0x87F0, 0x008C}, {0x87F3, 0x008C}, {0x87F6, 0x008C}, {0x87F9, 0x008C},
+    {0x8C28, 0x08A4}, {0x87FD, 0x008C}, {0x0342, 0x008B}, {0x8800, 0x008C}, {0x8803, 0x008C}, {0x8806, 0x008C},
+    {0x880A, 0x008C}, {0x880D, 0x008C}, {0x8810, 0x008C}, {0x8813, 0x008C}, {0x8816, 0x008C}, {0x8819, 0x008C},
+    {0x881D, 0x008C}, {0x8820, 0x008C}, {0x8B3F, 0x072B}, {0x8824, 0x008C}, {0x8828, 0x008C}, {0x80B0, 0x05D8},
+    {0x8261, 0x05D8}, {0x83D6, 0x0676}, {0x8846, 0x008D}, {0x8238, 0x08F3}, {0x016A, 0x008C}, {0x0373, 0x008C},
+    {0x80B4, 0x05D8}, {0x8265, 0x05D8}, {0x8C30, 0x0515}, {0x83DA, 0x0676}, {0x8C2C, 0x092C}, {0x8C34, 0x092D},
+    {0x8B1F, 0x0728}, {0x823C, 0x08F3}, {0x81EC, 0x08F2}, {0x8962, 0x07D9}, {0x8C38, 0x092E}, {0x04E3, 0x092C},
+    {0x81F0, 0x08F2}, {0x83DE, 0x0676}, {0x863C, 0x0728}, {0x8966, 0x07D9}, {0x8849, 0x008D}, {0x8962, 0x03E5},
+    {0x8A2A, 0x0728}, {0x84B5, 0x0728}, {0x8B22, 0x0728}, {0x8C3C, 0x092F}, {0x81F4, 0x08F2}, {0x8966, 0x03E5},
+    {0x8B43, 0x072B}, {0x80B8, 0x05D8}, {0x8269, 0x05D8}, {0x83E2, 0x0676}, {0x884C, 0x008D}, {0x8240, 0x08F3},
+    {0x8C40, 0x0930}, {0x8C44, 0x0938}, {0x80BC, 0x05D8}, {0x826D, 0x05D8}, {0x886F, 0x0728}, {0x83E6, 0x0676},
+    {0x8330, 0x0728}, {0x8C48, 0x0939}, {0x8B47, 0x072B}, {0x8244, 0x08F3}, {0x81F8, 0x08F2}, {0x896A, 0x07D9},
+    {0x8C4C, 0x093A}, {0x8953, 0x009E}, {0x81FC, 0x08F2}, {0x83EA, 0x0676}, {0x8C50, 0x093B}, {0x896E, 0x07D9},
+    {0x884F, 0x008D}, {0x896A, 0x03E5}, {0x8852, 0x008D}, {0x8C54, 0x093C}, {0x8856, 0x008D}, {0x8B4B, 0x072B},
+    {0x8200, 0x08F2}, {0x896E, 0x03E5}, {0x8B4F, 0x072B}, {0x8B53, 0x072B}, {0x8C58, 0x093D}, {0x019D, 0x008D},
+    {0x8253, 0x05B0}, {0x8C5C, 0x093E}, {0x886F, 0x008F}, {0x8C60, 0x093F}, {0x0198, 0x008C}, {0x03FD, 0x008C},
+    {0x8C64, 0x0940}, {0x8C68, 0x0941}, {0x8B57, 0x072B}, {0x858E, 0x0728}, {0x8872, 0x008F}, {0x8876, 0x008F},
+    {0x819E, 0x05B0}, {0x887A, 0x008F}, {0x8C6C, 0x0942}, {0x887E, 0x008F}, {0x8C70, 0x0943}, {0x8C74, 0x0944},
+    {0x8882, 0x008F}, {0x8886, 0x008F}, {0x888A, 0x008F}, {0x888E, 0x008F}, {0x8892, 0x008F}, {0x8896, 0x008F},
+    {0x889A, 0x008F}, {0x889E, 0x008F}, {0x88A2, 0x008F}, {0x88A6, 0x008F}, {0x8C78, 0x0945}, {0x8C7C, 0x0946},
+    {0x8956, 0x009E}, {0x88AA, 0x008F}, {0x8257, 0x05B0}, {0x8C80, 0x0947}, {0x8C84, 0x0948}, {0x88AE, 0x008F},
+    {0x8959, 0x009E}, {0x88B1, 0x008F}, {0x88B4, 0x008F}, {0x88B7, 0x008F}, {0x8C88, 0x0949}, {0x88BA, 0x008F},
+    {0x88BD, 0x008F}, {0x88C0, 0x008F}, {0x81DC, 0x05B0}, {0x88C3, 0x008F}, {0x88C6, 0x008F}, {0x8C8C, 0x094A},
+    {0x88C9, 0x008F}, {0x88CC, 0x008F}, {0x8250, 0x08B6}, {0x8261, 0x08BF}, {0x88CF, 0x008F}, {0x88D2, 0x008F},
+    {0x88D5, 0x008F}, {0x88D8, 0x008F}, {0x8789, 0x008F}, {0x8265, 0x08BF}, {0x8216, 0x0912}, {0x8A19, 0x00A9},
+    {0x88DB, 0x008F}, {0x8C90, 0x094B}, {0x895C, 0x009E}, {0x8C94, 0x094C}, {0x821A, 0x0912}, {0x01F4, 0x008D},
+    {0x030F, 0x008D}, {0x88DE, 0x008F}, {0x895F, 0x009E}, {0x88E1, 0x008F}, {0x88E4, 0x008F}, {0x88E7, 0x008F},
+    {0x8C98, 0x094D}, {0x88EA, 0x008F}, {0x88ED, 0x008F}, {0x88F0, 0x008F}, {0x88F3, 0x008F}, {0x88F6, 0x008F},
+    {0x88F9, 0x008F}, {0x01FE, 0x009E}, {0x88FC, 0x008F}, {0x88FF, 0x008F}, {0x8C9C, 0x094E}, {0x8269, 0x08BF},
+    {0x8902, 0x008F}, {0x8905, 0x008F}, {0x8908, 0x008F}, {0x890B, 0x008F}, {0x878C, 0x008F}, {0x826D, 0x08BF},
+    {0x8230, 0x0912}, {0x8253, 0x08B6}, {0x890E, 0x008F}, {0x8CA0, 0x094F}, {0x8CA4, 0x0950}, {0x8CA8, 0x0951},
+    {0x8234, 0x0912}, {0x8238, 0x05AC}, {0x01EC, 0x008F}, {0x0001, 0x008F}, {0x0575, 0x040D}, {0x056A, 0x040D},
+    {0x0562, 0x040D}, {0x819E, 0x08B6}, {0x044C, 0x040D}, {0x8CAC, 0x0958}, {0x04FD, 0x040D}, {0x823C, 0x05AC},
+    {0x044E, 0x040D}, {0x8CB0, 0x0959}, {0x8A1B, 0x00A9}, {0x8A1E, 0x00A9}, {0x81EC, 0x05AA}, {0x8CB4, 0x095A},
+    {0x8CB8, 0x095B}, {0x8216, 0x05AB}, {0x81F0, 0x05AA}, {0x8238, 0x04A5}, {0x8261, 0x05C3}, {0x8CBC, 0x095C},
+    {0x8CC0, 0x095D}, {0x821A, 0x05AB}, {0x8CC4, 0x095E}, {0x8257, 0x08B6}, {0x8265, 0x05C3}, {0x056D, 0x040D},
+    {0x81F4, 0x05AA}, {0x823C, 0x04A5}, {0x8CC8, 0x095F}, {0x8240, 0x05AC}, {0x8CCC, 0x0960}, {0x8CD0, 0x0961},
+    {0x8CD4, 0x0962}, {0x8CD8, 0x0963}, {0x8CDC, 0x0964}, {0x81DC, 0x08B6}, {0x8CE0, 0x0965}, {0x0459, 0x040D},
+    {0x8CE4, 0x0966}, {0x8244, 0x05AC}, {0x8CE8, 0x0967}, {0x8972, 0x00A6}, {0x8A21, 0x00A9}, {0x8A24, 0x00A9},
+    {0x81F8, 0x05AA}, {0x0252, 0x009E}, {0x0471, 0x009E}, {0x8230, 0x05AB}, {0x81FC, 0x05AA}, {0x8240, 0x04A5},
+    {0x8269, 0x05C3}, {0x8CEC, 0x0968}, {0x8975, 0x00A6}, {0x8234, 0x05AB}, {0x8979, 0x00A6}, {0x0269, 0x00A9},
+    {0x826D, 0x05C3}, {0x8CF0, 0x0969}, {0x8200, 0x05AA}, {0x8244, 0x04A5}, {0x8CF4, 0x096A}, {0x8CF8, 0x096B},
+    {0x8CFC, 0x096C}, {0x8D00, 0x096D}, {0x0224, 0x008F}, {0x0331, 0x008F}, {0x8D04, 0x096E}, {0x8D08, 0x096F},
+    {0x040D, 0x008F}, {0x0326, 0x008F}, {0x897D, 0x00A6}, {0x0353, 0x008F}, {0x027F, 0x008F}, {0x8D0C, 0x0970},
+    {0x8981, 0x00A6}, {0x8985, 0x00A6}, {0x8D10, 0x0971}, {0x8989, 0x00A6}, {0x898D, 0x00A6}, {0x08F7, 0x09D8},
+    {0x0562, 0x06B5}, {0x8991, 0x00A6}, {0x8995, 0x00A6}, {0x8D14, 0x0977}, {0x8999, 0x00A6}, {0x899D, 0x00A6},
+    {0x89A1, 0x00A6}, {0x89A5, 0x00A6}, {0x89A9, 0x00A6}, {0x05DB, 0x05FA}, {0x8D18, 0x0603}, {0x89AD, 0x00A6},
+    {0x89B1, 0x00A6}, {0x89B5, 0x00A6}, {0x89B9, 0x00A6}, {0x89BD, 0x00A6}, {0x89C1, 0x00A6}, {0x056D, 0x06C9},
+    {0x89C5, 0x00A6}, {0x89C9, 0x00A6}, {0x05E6, 0x060B}, {0x8D20, 0x060E}, {0x0575, 0x06CB}, {0x8D1C, 0x0979},
+    {0x8A2A, 0x00AA}, {0x8D24, 0x097A}, {0x89CD, 0x00A6}, {0x89D1, 0x00A6}, {0x05F0, 0x0610}, {0x89D5, 0x00A6},
+    {0x89D9, 0x00A6}, {0x8D28, 0x0616}, {0x8A7A, 0x00AB}, {0x89DD, 0x00A6}, {0x89E1, 0x00A6}, {0x8D2C, 0x097C},
+    {0x89E5, 0x00A6}, {0x89E9, 0x00A6}, {0x89ED, 0x00A6}, {0x89F1, 0x00A6}, {0x89F5, 0x00A6}, {0x02B3, 0x00A9},
+    {0x058A, 0x06D5}, {0x89F9, 0x00A6}, {0x89FD, 0x00A6}, {0x8A01, 0x00A6}, {0x8A05, 0x00A6}, {0x8A09, 0x00A6},
+    {0x8A0D, 0x00A6}, {0x0605, 0x0624}, {0x8A11, 0x00A6}, {0x8A15, 0x00A6}, {0x8D30, 0x062B}, {0x8D34, 0x097D},
+    {0x0590, 0x06E7}, {0x0609, 0x0630}, {0x8D38, 0x0631}, {0x0231, 0x00A6}, {0x0001, 0x00A6}, {0x8A2D, 0x00AA},
+    {0x8A30, 0x00AA}, {0x8A34, 0x00AA}, {0x8D3C, 0x097E}, {0x8A37, 0x00AA}, {0x8A3A, 0x00AA}, {0x8A7D, 0x00AB},
+    {0x05A0, 0x06F0}, {0x8A3E, 0x00AA}, {0x8A41, 0x00AA}, {0x8A80, 0x00AB}, {0x8A44, 0x00AA}, {0x0619, 0x063C},
+    {0x8D40, 0x0641}, {0x8A83, 0x00AB}, {0x8A47, 0x00AA}, {0x8A4A, 0x00AA}, {0x8A4D, 0x00AA}, {0x05A7, 0x0702},
+    {0x0622, 0x0647}, {0x8A86, 0x00AB}, {0x8D44, 0x0980}, {0x8D48, 0x0648}, {0x05AD, 0x0705}, {0x8D4C, 0x0982},
+    {0x0627, 0x064C}, {0x8A89, 0x00AB}, {0x8D50, 0x064E}, {0x05B2, 0x070A}, {0x8D54, 0x0983}, {0x062B, 0x0651},
+    {0x8D58, 0x0653}, {0x8A50, 0x00AA}, {0x8A53, 0x00AA}, {0x8A57, 0x00AA}, {0x8D5C, 0x0985}, {0x8A5A, 0x00AA},
+    {0x8A5D, 0x00AA}, {0x8A8C, 0x00AB}, {0x05C0, 0x0710}, {0x8A61, 0x00AA}, {0x8A64, 0x00AA}, {0x8A8F, 0x00AB},
+    {0x8A67, 0x00AA}, {0x0639, 0x065C}, {0x8D60, 0x0661}, {0x8A92, 0x00AB}, {0x8A6A, 0x00AA}, {0x8A6D, 0x00AA},
+    {0x8A70, 0x00AA}, {0x8D64, 0x0986}, {0x05C9, 0x071F}, {0x8A95, 0x00AB}, {0x0644, 0x0668}, {0x8304, 0x0420},
+    {0x8308, 0x0420}, {0x8D68, 0x066A}, {0x05CF, 0x073E}, {0x8A98, 0x00AB}, {0x0648, 0x066E}, {0x8D70, 0x0670},
+    {0x028A, 0x00AA}, {0x830C, 0x0420}, {0x8310, 0x0420}, {0x028F, 0x00A6}, {0x0483, 0x00A6}, {0x05D7, 0x0741},
+    {0x0650, 0x0677}, {0x8D78, 0x0678}, {0x0297, 0x00AB}, {0x8314, 0x0420}, {0x8318, 0x0420}, {0x05DE, 0x0787},
+    {0x8A9E, 0x00B8}, {0x0657, 0x067D}, {0x8D80, 0x067F}, {0x05D2, 0x09DA}, {0x065C, 0x0681}, {0x065E, 0x0681},
+    {0x831C, 0x0420}, {0x8D84, 0x0682}, {0x8D6C, 0x0987}, {0x8D88, 0x0683}, {0x8D8C, 0x06EA}, {0x8D74, 0x0988},
+    {0x8D90, 0x06ED}, {0x8320, 0x0420}, {0x8324, 0x0420}, {0x066A, 0x09DB}, {0x05FB, 0x09DB}, {0x0618, 0x09DB},
+    {0x8AA0, 0x00B8}, {0x0628, 0x09DB}, {0x8D94, 0x06F3}, {0x8328, 0x0420}, {0x832C, 0x0420}, {0x8D98, 0x06F4},
+    {0x8D9C, 0x06F5}, {0x8DA0, 0x0717}, {0x0670, 0x068E}, {0x8DA4, 0x0698}, {0x8AA3, 0x00B8}, {0x8AA7, 0x00B8},
+    {0x8AAB, 0x00B8}, {0x8DA8, 0x06A4}, {0x8DAC, 0x06AC}, {0x8AAF, 0x00B8}, {0x8AB2, 0x00B8}, {0x8AB5, 0x00B8},
+    {0x8AB8, 0x00B8}, {0x8ABB, 0x00B8}, {0x0674, 0x068F}, {0x8ABE, 0x00B8}, {0x8AC1, 0x00B8}, {0x8AC4, 0x00B8},
+    {0x8AC7, 0x00B8}, {0x0682, 0x0691}, {0x8ACA, 0x00B8}, {0x8DB0, 0x06A9}, {0x0675, 0x068F}, {0x8ACD, 0x00B8},
+    {0x8AD0, 0x00B8}, {0x8DB4, 0x06B9}, {0x8AD4, 0x00B8}, {0x0691, 0x098A}, {0x8AD7, 0x00B8}, {0x8ADA, 0x00B8},
+    {0x0358, 0x00AA}, {0x0575, 0x0977}, {0x036C, 0x00AA}, {0x8ADD, 0x00B8}, {0x8AE0, 0x00B8}, {0x0686, 0x0691},
+    {0x8DB8, 0x06B1}, {0x0695, 0x098B}, {0x02FB, 0x00AB}, {0x069B, 0x098B}, {0x8DBC, 0x06BB}, {0x8AE3, 0x00B8},
+    {0x8AE7, 0x00B8}, {0x8AEA, 0x00B8}, {0x8AED, 0x00B8}, {0x8AF0, 0x00B8}, {0x8DC0, 0x06BD}, {0x8AF3, 0x00B8},
+    {0x8AF6, 0x00B8}, {0x8AF9, 0x00B8}, {0x8AFC, 0x00B8}, {0x0586, 0x0979}, {0x8AFF, 0x00B8}, {0x058B, 0x097A},
+    {0x06A8, 0x098C}, {0x8B02, 0x00B8}, {0x8B05, 0x00B8}, {0x8D7C, 0x0989}, {0x8B09, 0x00B8}, {0x8DC4, 0x06CC},
+    {0x8B0C, 0x00B8}, {0x8B0F, 0x00B8}, {0x06AD, 0x0990}, {0x059F, 0x097C}, {0x8DC8, 0x06D4}, {0x8B12, 0x00B8},
+    {0x8B15, 0x00B8}, {0x06B1, 0x0992}, {0x8DCC, 0x06D9}, {0x8DD0, 0x06E5}, {0x81EC, 0x0957}, {0x8DD4, 0x06F8},
+    {0x02D3, 0x00B8}, {0x825B, 0x0957}, {0x8282, 0x0957}, {0x8271, 0x0957}, {0x8DD8, 0x0714}, {0x06BD, 0x0995},
+    {0x81F0, 0x0957}, {0x06B2, 0x0993}, {0x8DDC, 0x06E3}, {0x05AB, 0x097D}, {0x06C2, 0x0996}, {0x8253, 0x0957},
+    {0x065F, 0x068D}, {0x8DE0, 0x06E8}, {0x06C8, 0x09A1}, {0x0661, 0x068D}, {0x81F4, 0x0957}, {0x8216, 0x0957},
+    {0x05B7, 0x097E}, {0x8DE4, 0x06EC}, {0x8279, 0x0957}, {0x0669, 0x068D}, {0x066C, 0x068D}, {0x066D, 0x068D},
+    {0x819E, 0x0957}, {0x06D0, 0x09A2}, {0x06B4, 0x0993}, {0x8DE8, 0x06F7}, {0x06D2, 0x09AA}, {0x8DEC, 0x06FA},
+    {0x81F8, 0x0957}, {0x06D5, 0x09AB}, {0x8DF0, 0x06FD}, {0x825E, 0x0957}, {0x8285, 0x0957}, {0x8275, 0x0957},
+    {0x05C2, 0x0980}, {0x06DD, 0x09B3}, {0x81FC, 0x0957}, {0x05C7, 0x0982}, {0x8DF4, 0x0703}, {0x06DF, 0x09B4},
+    {0x8DF8, 0x0707}, {0x8257, 0x0957}, {0x05CC, 0x0983}, {0x06E3, 0x09BD}, {0x8DFC, 0x070B}, {0x06E8, 0x078F},
+    {0x8200, 0x0957}, {0x8230, 0x0957}, {0x05D7, 0x0985}, {0x8E00, 0x070D}, {0x827C, 0x0957}, {0x8E04, 0x078C},
+    {0x06B9, 0x0993}, {0x8E08, 0x078D}, {0x81DC, 0x0957}, {0x066E, 0x068D}, {0x8E0C, 0x07AC}, {0x06F1, 0x0798},
+    {0x8E10, 0x0719}, {0x06F3, 0x07A5}, {0x8E14, 0x071B}, {0x06F5, 0x07A8}, {0x8E18, 0x071D}, {0x05E3, 0x0986},
+    {0x032B, 0x00B8}, {0x0370, 0x00B8}, {0x06FA, 0x07AB}, {0x8E1C, 0x0722}, {0x06FC, 0x07AD}, {0x8E20, 0x0724},
+    {0x0318, 0x00B8}, {0x0333, 0x00B8}, {0x04F0, 0x0082}, {0x07AE, 0x0082}, {0x0809, 0x0082}, {0x04DD, 0x0082},
+    {0x0705, 0x07B5}, {0x038C, 0x0082}, {0x8E24, 0x072C}, {0x0894, 0x0082}, {0x08F7, 0x0082}, {0x078A, 0x0082},
+    {0x0854, 0x0082}, {0x07DE, 0x0082}, {0x09A0, 0x0082}, {0x09F0, 0x0082}, {0x0A36, 0x0082}, {0x0A88, 0x0082},
+    {0x0818, 0x0082}, {0x0966, 0x0082}, {0x07FF, 0x0082}, {0x0821, 0x0082}, {0x07C9, 0x0082}, {0x080B, 0x0082},
+    {0x05E9, 0x0987}, {0x07C7, 0x0082}, {0x07D5, 0x0082}, {0x05F2, 0x0988}, {0x0890, 0x0082}, {0x0ABE, 0x0082},
+    {0x0AF9, 0x0082}, {0x0B32, 0x0082}, {0x0B78, 0x0082}, {0x0B8D, 0x0082}, {0x0750, 0x07C0}, {0x0BDD, 0x0082},
+    {0x0836, 0x0082}, {0x0BE4, 0x0082}, {0x0979, 0x0082}, {0x0C0B, 0x0082}, {0x0845, 0x0082}, {0x0980, 0x0082},
+    {0x083A, 0x0082}, {0x0C1E, 0x0082}, {0x0848, 0x0082}, {0x084A, 0x0082}, {0x0A91, 0x0082}, {0x085A, 0x0082},
+    {0x0B14, 0x0082}, {0x0C4B, 0x0082}, {0x0982, 0x0082}, {0x0846, 0x0082}, {0x09FB, 0x0082}, {0x0C45, 0x0082},
+    {0x0A8D, 0x0082}, {0x0C94, 0x0082}, {0x0870, 0x0082}, {0x0891, 0x0082}, {0x0882, 0x0082}, {0x099C, 0x0082},
+    {0x09CA, 0x0082}, {0x0867, 0x0082}, {0x08E4, 0x0082}, {0x08B4, 0x0082}, {0x0CF0, 0x0082}, {0x0D61, 0x0082},
+    {0x0DA1, 0x0082}, {0x0E0D, 0x0082}, {0x0E20, 0x0082}, {0x0E82, 0x0082}, {0x0BE9, 0x0082}, {0x0E7A, 0x0082},
+    {0x0C46, 0x0082}, {0x0BB7, 0x0082}, {0x09BA, 0x0082}, {0x0ED8, 0x0082}, {0x0A48, 0x0082}, {0x0A40, 0x0082},
+    {0x0CBE, 0x0082}, {0x0B13, 0x0082}, {0x0BC5, 0x0082}, {0x0EE8, 0x0082}, {0x0B5C, 0x0082}, {0x8E28, 0x0748},
+    {0x0B86, 0x0082}, {0x0E71, 0x0082}, {0x0CD3, 0x0082}, {0x0F40, 0x0082}, {0x0F7C, 0x0082}, {0x09BC, 0x0082},
+    {0x0ADF, 0x0082}, {0x0D5E, 0x0082}, {0x0B77, 0x0082}, {0x09B2, 0x0082}, {0x0D7B, 0x0082}, {0x0762, 0x07C7},
+    {0x0FC2, 0x0082}, {0x05F8, 0x0989}, {0x0A0C, 0x0082}, {0x82C4, 0x041F}, {0x82C8, 0x041F}, {0x8E2C, 0x0785},
+    {0x06EA, 0x0794}, {0x06EC, 0x0794}, {0x0767, 0x07D0}, {0x0668, 0x09DD}, {0x8E30, 0x078E}, {0x82CC, 0x041F},
+    {0x82D0, 0x041F}, {0x076C, 0x07D1}, {0x0704, 0x09DD}, {0x8E34, 0x0793}, {0x076E, 0x07D3}, {0x8E38, 0x0796},
+    {0x066F, 0x09DD}, {0x82D4, 0x041F}, {0x82D8, 0x041F}, {0x06FC, 0x09DF}, {0x0718, 0x09DF}, {0x0775, 0x079B},
+    {0x8E3C, 0x079D}, {0x0777, 0x079C}, {0x8E40, 0x079F}, {0x82DC, 0x041F}, {0x82E0, 0x041F}, {0x077B, 0x07AE},
+    {0x8E44, 0x07A3}, {0x0678, 0x09DD}, {0x077E, 0x07B4}, {0x8E48, 0x07A6}, {0x0669, 0x09DD}, {0x82E4, 0x041F},
+    {0x82E8, 0x041F}, {0x067A, 0x09DD}, {0x06EF, 0x0794}, {0x0679, 0x09DE}, {0x06FA, 0x09E0}, {0x0787, 0x07CD},
+    {0x8E4C, 0x07AF}, {0x82EC, 0x041F}, {0x82F0, 0x041F}, {0x8E50, 0x0731}, {0x0715, 0x09E0}, {0x0673, 0x09DE},
+    {0x825B, 0x087B}, {0x8E52, 0x0731}, {0x8E54, 0x0916}, {0x82F4, 0x041F}, {0x82F8, 0x041F}, {0x0731, 0x0936},
+    {0x8E58, 0x07BB}, {0x8E6F, 0x0A1E}, {0x8E9A, 0x07D4}, {0x0789, 0x0AB6}, {0x0691, 0x09DE}, {0x82FC, 0x041F},
+    {0x8300, 0x041F}, {0x0733, 0x0AD2}, {0x8E92, 0x07C3}, {0x8724, 0x0A57}, {0x8E96, 0x07C3}, {0x06E2, 0x09DE},
+    {0x079E, 0x0AF8}, {0x872F, 0x0AFB}, {0x0BAF, 0x0082}, {0x0B00, 0x0082}, {0x8714, 0x0A5D}, {0x072A, 0x09E0},
+    {0x8E64, 0x0A1D}, {0x8B26, 0x0729}, {0x06D0, 0x09DE}, {0x06F6, 0x09DE}, {0x0735, 0x0B17}, {0x06FE, 0x09DE},
+    {0x0733, 0x0AD2}, {0x8714, 0x080A}, {0x825E, 0x087B}, {0x8724, 0x07D2}, {0x8728, 0x07D2}, {0x04C4, 0x0729},
+    {0x0755, 0x0B18}, {0x8E67, 0x0A1D}, {0x8E6B, 0x0A1D}, {0x8E74, 0x0A1E}, {0x0B39, 0x0082}, {0x0C1F, 0x0082},
+    {0x8EB2, 0x07DA}, {0x0BC9, 0x0082}, {0x8ECC, 0x0B52}, {0x8ECF, 0x0B5A}, {0x8ED2, 0x0B5A}, {0x8728, 0x0A57},
+    {0x871C, 0x0815}, {0x8ED5, 0x081E}, {0x1100, 0x0082}, {0x0EAA, 0x0082}, {0x11E1, 0x0082}, {0x8ED9, 0x0826},
+    {0x8718, 0x0A5D}, {0x8B29, 0x0729}, {0x8724, 0x082C}, {0x8981, 0x0729}, {0x8985, 0x0729}, {0x8714, 0x07C8},
+    {0x8989, 0x0729}, {0x898D, 0x0729}, {0x8EE5, 0x0997}, {0x8718, 0x080A}, {0x8991, 0x0729}, {0x8995, 0x0729},
+    {0x122A, 0x0082}, {0x8999, 0x0729}, {0x899D, 0x0729}, {0x89A1, 0x0729}, {0x89A5, 0x0729}, {0x89A9, 0x0729},
+    {0x8F1A, 0x073C}, {0x8F26, 0x073F}, {0x89AD, 0x0729}, {0x89B1, 0x0729}, {0x89B5, 0x0729}, {0x89B9, 0x0729},
+    {0x89BD, 0x0729}, {0x89C1, 0x0729}, {0x8720, 0x0815}, {0x89C5, 0x0729}, {0x89C9, 0x0729}, {0x8E5C, 0x0733},
+    {0x0782, 0x07BF}, {0x8E5E, 0x0733}, {0x8B2D, 0x0729}, {0x8F2A, 0x0740}, {0x8728, 0x082C}, {0x89CD, 0x0729},
+    {0x89D1, 0x0729}, {0x8718, 0x07C8}, {0x89D5, 0x0729}, {0x89D9, 0x0729}, {0x0783, 0x0972}, {0x0793, 0x07BF},
+    {0x89DD, 0x0729}, {0x89E1, 0x0729}, {0x8F3A, 0x0814}, {0x89E5, 0x0729}, {0x89E9, 0x0729}, {0x89ED, 0x0729},
+    {0x89F1, 0x0729}, {0x89F5, 0x0729}, {0x0753, 0x0B6A}, {0x8AA3, 0x0BC5}, {0x89F9, 0x0729}, {0x89FD, 0x0729},
+    {0x8A01, 0x0729}, {0x8A05, 0x0729}, {0x8A09, 0x0729}, {0x8A0D, 0x0729}, {0x0756, 0x0B6A}, {0x8A11, 0x0729},
+    {0x8A15, 0x0729}, {0x8783, 0x072A}, {0x079C, 0x0BDB}, {0x8783, 0x072A}, {0x079B, 0x07BF}, {0x8956, 0x0733},
+    {0x0315, 0x0729}, {0x8BA8, 0x0929}, {0x8738, 0x072A}, {0x8F55, 0x082A}, {0x8F07, 0x073A}, {0x8959, 0x0733},
+    {0x8F0B, 0x073A}, {0x8B30, 0x072A}, {0x001C, 0x0929}, {0x0419, 0x0929}, {0x041D, 0x0929}, {0x0420, 0x0929},
+    {0x042D, 0x0929}, {0x0430, 0x0929}, {0x043C, 0x0929}, {0x043F, 0x0929}, {0x044C, 0x0929}, {0x046B, 0x0929},
+    {0x8AA7, 0x0BFE}, {0x8F1E, 0x073D}, {0x8843, 0x0738}, {0x8F22, 0x073D}, {0x07B1, 0x0C14}, {0x8B34, 0x072A},
+    {0x8F89, 0x0844}, {0x8B38, 0x072A}, {0x8F94, 0x0C3A}, {0x8AAB, 0x0C44}, {0x873B, 0x072A}, {0x8EDD, 0x0738},
+    {0x07BA, 0x0C5A}, {0x895C, 0x0733}, {0x873E, 0x072A}, {0x8F98, 0x084C}, {0x882B, 0x0BEF}, {0x8741, 0x072A},
+    {0x8745, 0x072A}, {0x895F, 0x0733}, {0x8833, 0x0BB8}, {0x8F0F, 0x073B}, {0x8F12, 0x073B}, {0x07E1, 0x0C0D},
+    {0x8748, 0x072A}, {0x8F16, 0x073B}, {0x8837, 0x0BB8}, {0x07C7, 0x0C6F}, {0x8FA7, 0x085B}, {0x834C, 0x073A},
+    {0x874B, 0x072A}, {0x873B, 0x0C9F}, {0x874E, 0x072A}, {0x8752, 0x072A}, {0x8756, 0x072A}, {0x08AB, 0x0857},
+    {0x867C, 0x074A}, {0x882B, 0x0867}, {0x8A3A, 0x0750}, {0x0824, 0x0857}, {0x03C4, 0x072A}, {0x873E, 0x0CCD},
+    {0x8759, 0x072A}, {0x816D, 0x0C9F}, {0x817C, 0x090A}, {0x8745, 0x0CE0}, {0x875C, 0x072A}, {0x817C, 0x0752},
+    {0x882F, 0x0BEF}, {0x875F, 0x072A}, {0x8763, 0x072A}, {0x868A, 0x074E}, {0x883B, 0x0BB8}, {0x8173, 0x0CCD},
+    {0x8A3E, 0x0753}, {0x0836, 0x0ADD}, {0x8766, 0x072A}, {0x8179, 0x0CE0}, {0x883F, 0x0BB8}, {0x0775, 0x0732},
+    {0x0858, 0x0857}, {0x8769, 0x072A}, {0x876D, 0x072A}, {0x834F, 0x073B}, {0x8770, 0x072A}, {0x8774, 0x072A},
+    {0x8778, 0x072A}, {0x8BD4, 0x092A}, {0x8843, 0x0732}, {0x882F, 0x0867}, {0x8FD8, 0x0877}, {0x03FC, 0x072A},
+    {0x869B, 0x0755}, {0x031C, 0x072A}, {0x0475, 0x092A}, {0x0480, 0x092A}, {0x0481, 0x092A}, {0x0487, 0x092A},
+    {0x048A, 0x092A}, {0x048C, 0x092A}, {0x048D, 0x092A}, {0x0492, 0x092A}, {0x0494, 0x092A}, {0x0498, 0x092A},
+    {0x8C00, 0x092B}, {0x8846, 0x0732}, {0x8EE1, 0x0738}, {0x9001, 0x0759}, {0x0863, 0x0CB4}, {0x8748, 0x0D0D},
+    {0x8FC2, 0x074E}, {0x0499, 0x092B}, {0x049A, 0x092B}, {0x049B, 0x092B}, {0x049C, 0x092B}, {0x04A9, 0x092B},
+    {0x04B2, 0x092B}, {0x04B7, 0x092B}, {0x04BD, 0x092B}, {0x04BE, 0x092B}, {0x04C9, 0x092B}, {0x818E, 0x0D0D},
+    {0x83BE, 0x0BEB}, {0x8833, 0x087C}, {0x866B, 0x0898}, {0x8849, 0x0732}, {0x83C2, 0x0BEB}, {0x0809, 0x0D14},
+    {0x0872, 0x08AB}, {0x8837, 0x087C}, {0x8FC7, 0x074E}, {0x8663, 0x0CB5}, {0x0875, 0x08AB}, {0x8FCB, 0x074E},
+    {0x0878, 0x0D75}, {0x8663, 0x08AC}, {0x83C6, 0x0BEB}, {0x884C, 0x0732}, {0x0558, 0x072F}, {0x8FCF, 0x074E},
+    {0x8F2E, 0x0742}, {0x8F32, 0x0742}, {0x866B, 0x08B0}, {0x81E9, 0x072F}, {0x8EBC, 0x075E}, {0x8E7D, 0x0742},
+    {0x8F36, 0x0742}, {0x052A, 0x072F}, {0x8B5F, 0x072F}, {0x866B, 0x0D5C}, {0x866F, 0x0D5C}, {0x0428, 0x072F},
+    {0x9018, 0x0763}, {0x866B, 0x08F8}, {0x83CA, 0x0BEB}, {0x883B, 0x087C}, {0x866F, 0x0898}, {0x884F, 0x0732},
+    {0x83CE, 0x0BEB}, {0x03AB, 0x072A}, {0x03CF, 0x072A}, {0x883F, 0x087C}, {0x8F75, 0x075F}, {0x8667, 0x0CB5},
+    {0x8B63, 0x072F}, {0x8FF3, 0x0760}, {0x8B67, 0x072F}, {0x8667, 0x08AC}, {0x83D2, 0x0BEB}, {0x816D, 0x072F},
+    {0x901C, 0x0953}, {0x8170, 0x072F}, {0x035F, 0x072A}, {0x8173, 0x072F}, {0x866F, 0x08B0}, {0x8176, 0x072F},
+    {0x041F, 0x072A}, {0x8179, 0x072F}, {0x817C, 0x072F}, {0x8180, 0x072F}, {0x8184, 0x072F}, {0x8187, 0x072F},
+    {0x818B, 0x072F}, {0x818E, 0x072F}, {0x8191, 0x072F}, {0x866F, 0x08F8}, {0x8195, 0x072F}, {0x8198, 0x072F},
+    {0x874B, 0x0D56}, {0x819B, 0x072F}, {0x9021, 0x0913}, {0x81A1, 0x072F}, {0x83BE, 0x0863}, {0x81A5, 0x072F},
+    {0x81A8, 0x072F}, {0x838C, 0x075F}, {0x83C2, 0x0863}, {0x8FF3, 0x0760}, {0x04D1, 0x072F}, {0x04C2, 0x072F},
+    {0x819B, 0x0D56}, {0x81AB, 0x072F}, {0x044A, 0x072F}, {0x81AE, 0x072F}, {0x0880, 0x0D56}, {0x81B1, 0x072F},
+    {0x83C6, 0x0863}, {0x81B4, 0x072F}, {0x8756, 0x0A5E}, {0x81B7, 0x072F}, {0x81BA, 0x072F}, {0x81BE, 0x072F},
+    {0x81C2, 0x072F}, {0x81C5, 0x072F}, {0x81C9, 0x072F}, {0x81CC, 0x072F}, {0x81CF, 0x072F}, {0x9025, 0x091C},
+    {0x81D3, 0x072F}, {0x81D6, 0x072F}, {0x81A5, 0x0A5E}, {0x81D9, 0x072F}, {0x07B8, 0x0752}, {0x81DF, 0x072F},
+    {0x83CA, 0x0863}, {0x81E3, 0x072F}, {0x81E6, 0x072F}, {0x9018, 0x0765}, {0x83CE, 0x0863}, {0x8E8A, 0x0764},
+    {0x0531, 0x072F}, {0x0855, 0x09C6}, {0x0341, 0x072F}, {0x087A, 0x0D70}, {0x0710, 0x0732}, {0x863C, 0x0730},
+    {0x8663, 0x08B2}, {0x8667, 0x08B2}, {0x83D2, 0x0863}, {0x841C, 0x0DCE}, {0x087A, 0x09C6}, {0x0A9F, 0x0915},
+    {0x841F, 0x0DCE}, {0x8B6F, 0x0730}, {0x0001, 0x0730}, {0x8428, 0x0DCF}, {0x08A0, 0x0DD2}, {0x8FA3, 0x0764},
+    {0x8B76, 0x0730}, {0x0916, 0x0DD1}, {0x08C8, 0x0DD1}, {0x0002, 0x0730}, {0x0004, 0x0730}, {0x0806, 0x0730},
+    {0x085A, 0x0730}, {0x086B, 0x0730}, {0x04E5, 0x0730}, {0x04E6, 0x0730}, {0x04EB, 0x0730}, {0x04F6, 0x0730},
+    {0x04FF, 0x0730}, {0x8422, 0x0DCE}, {0x833E, 0x0922}, {0x8425, 0x0DCE}, {0x8499, 0x098E}, {0x842B, 0x0DCF},
+    {0x0724, 0x0732}, {0x84A5, 0x09B1}, {0x0500, 0x0730}, {0x0506, 0x0730}, {0x050B, 0x0730}, {0x050F, 0x0730},
+    {0x0514, 0x0730}, {0x051B, 0x0730}, {0x051E, 0x0730}, {0x0520, 0x0730}, {0x0523, 0x0730}, {0x0524, 0x0730},
+    {0x052B, 0x0730}, {0x052D, 0x0730}, {0x052E, 0x0730}, {0x0539, 0x0730}, {0x053A, 0x0730}, {0x053E, 0x0730},
+    {0x053F, 0x0730}, {0x0545, 0x0730}, {0x054C, 0x0730}, {0x055A, 0x0730}, {0x055C, 0x0730}, {0x0565, 0x0730},
+    {0x056F, 0x0730}, {0x057A, 0x0730}, {0x057B, 0x0730}, {0x057C, 0x0730}, {0x84A9, 0x09B2}, {0x08A7, 0x0764},
+    {0x83DE, 0x0926}, {0x83EA, 0x0926}, {0x03F6, 0x072F}, {0x065A, 0x072F}, {0x0586, 0x0730}, {0x058A, 0x0730},
+    {0x058E, 0x0730}, {0x058F, 0x0730}, {0x0594, 0x0730}, {0x0595, 0x0730}, {0x0597, 0x0730}, {0x059D, 0x0730},
+    {0x059F, 0x0730}, {0x05A0, 0x0730}, {0x05A1, 0x0730}, {0x05A2, 0x0730}, {0x05A3, 0x0730}, {0x05A5, 0x0730},
+    {0x05A7, 0x0730}, {0x05A9, 0x0730}, {0x05B4, 0x0730}, {0x05BA, 0x0730}, {0x05BD, 0x0730}, {0x05BE, 0x0730},
+    {0x05BF, 0x0730}, {0x05C0, 0x0730}, {0x05C3, 0x0730}, {0x05C4, 0x0730}, {0x05CA, 0x0730}, {0x05CD, 0x0730},
+    {0x0786, 0x0742}, {0x84AD, 0x09BA}, {0x08C6, 0x0DD7}, {0x0363, 0x072F}, {0x0393, 0x072F}, {0x05D4, 0x05F9},
+    {0x84B1, 0x0974}, {0x05E8, 0x05F9}, {0x05EA, 0x05F9}, {0x849D, 0x098F}, {0x05F4, 0x05F9}, {0x0606, 0x05F9},
+    {0x060F, 0x05F9}, {0x099E, 0x0DE1}, {0x0621, 0x05F9}, {0x903D, 0x0C83}, {0x0624, 0x05F9}, {0x0629, 0x05F9},
+    {0x85F1, 0x0D9C}, {0x062F, 0x05F9}, {0x063E, 0x05F9}, {0x065D, 0x05F9}, {0x0660, 0x05F9}, {0x06A6, 0x05F9},
+    {0x0607, 0x09DC}, {0x0610, 0x09DC}, {0x0633, 0x09DC}, {0x0A8B, 0x0DD4}, {0x089B, 0x0DD4}, {0x08EF, 0x0DD4},
+    {0x0620, 0x09DC}, {0x904D, 0x0C85}, {0x061E, 0x09DC}, {0x0664, 0x09DC}, {0x905D, 0x0C91}, {0x0630, 0x09DC},
+    {0x065B, 0x09DC}, {0x07C4, 0x0739}, {0x8EE9, 0x0739}, {0x8EEC, 0x0739}, {0x8EF0, 0x0739}, {0x8EF3, 0x0739},
+    {0x8EF7, 0x0739}, {0x8EFB, 0x0739}, {0x8EFF, 0x0739}, {0x8F03, 0x0739}, {0x0AF4, 0x0E21}, {0x0651, 0x09DC},
+    {0x0658, 0x09DC}, {0x8FFA, 0x0758}, {0x85F4, 0x0D9C}, {0x8A30, 0x074C}, {0x8AB8, 0x074C}, {0x8683, 0x074C},
+    {0x8645, 0x074F}, {0x84A1, 0x098F}, {0x065E, 0x09DC}, {0x064A, 0x09DC}, {0x8A37, 0x074F}, {0x0B0A, 0x0E63},
+    {0x868E, 0x074F}, {0x09A4, 0x0EA0}, {0x86A6, 0x0758}, {0x089C, 0x0DD5}, {0x08A2, 0x0DD5}, {0x065D, 0x09DC},
+    {0x0670, 0x09DC}, {0x88B4, 0x074C}, {0x83D6, 0x0925}, {0x83E2, 0x0925}, {0x85F1, 0x0E28}, {0x85F4, 0x0E28},
+    {0x08CA, 0x0DD5}, {0x0945, 0x0E42}, {0x0963, 0x0E42}, {0x0665, 0x09DC}, {0x8756, 0x0761}, {0x8F6D, 0x0758},
+    {0x8A2A, 0x0734}, {0x8FBF, 0x074C}, {0x8B30, 0x0734}, {0x81A5, 0x0761}, {0x8349, 0x0739}, {0x8759, 0x0ECF},
+    {0x0885, 0x0764}, {0x8B5F, 0x0734}, {0x0A91, 0x0EE2}, {0x8E87, 0x0761}, {0x85E1, 0x0D82}, {0x09BA, 0x0F01},
+    {0x8A2A, 0x0734}, {0x8E61, 0x0734}, {0x83DA, 0x0925}, {0x83E6, 0x0925}, {0x85E5, 0x0D82}, {0x81AB, 0x0ECF},
+    {0x8FFA, 0x0758}, {0x094E, 0x0F02}, {0x8FD3, 0x074F}, {0x8645, 0x074F}, {0x0A94, 0x09D3}, {0x85C3, 0x0DDF},
+    {0x0575, 0x0730}, {0x8E87, 0x0761}, {0x05FE, 0x0730}, {0x05D5, 0x0730}, {0x0906, 0x0730}, {0x06F8, 0x0730},
+    {0x072C, 0x0730}, {0x06E9, 0x0730}, {0x072D, 0x0730}, {0x8A7D, 0x0734}, {0x85C3, 0x0A21}, {0x8A2D, 0x0734},
+    {0x8A30, 0x0734}, {0x8A80, 0x0734}, {0x8A5D, 0x0770}, {0x8A37, 0x0734}, {0x8A3A, 0x0734}, {0x8A83, 0x0734},
+    {0x85E9, 0x0D82}, {0x8A3E, 0x0734}, {0x8A41, 0x0734}, {0x85F1, 0x0A46}, {0x8A44, 0x0734}, {0x8A86, 0x0734},
+    {0x85ED, 0x0D82}, {0x81A8, 0x0762}, {0x8A47, 0x0734}, {0x8A4A, 0x0734}, {0x8A4D, 0x0734}, {0x8A89, 0x0734},
+    {0x8FFD, 0x0758}, {0x85C6, 0x0DDF}, {0x86C2, 0x0762}, {0x81BA, 0x0B0A}, {0x838F, 0x0761}, {0x85E1, 0x09BB},
+    {0x85E9, 0x09BB}, {0x85E5, 0x09BC}, {0x85ED, 0x09BC}, {0x0D5C, 0x0E82}, {0x0D9D, 0x0E82}, {0x8A8C, 0x0734},
+    {0x85C6, 0x0A21}, {0x8A50, 0x0734}, {0x8A53, 0x0734}, {0x8A8F, 0x0734}, {0x88DB, 0x0762}, {0x8A5A, 0x0734},
+    {0x8A5D, 0x0734}, {0x8A92, 0x0734}, {0x9089, 0x0BCB}, {0x8A61, 0x0734}, {0x8A64, 0x0734}, {0x85F4, 0x0A46},
+    {0x8A67, 0x0734}, {0x8A95, 0x0734}, {0x84B5, 0x0735}, {0x8A6D, 0x0F33}, {0x8A6A, 0x0734}, {0x8A6D, 0x0734},
+    {0x8A70, 0x0734}, {0x8A98, 0x0734}, {0x8018, 0x0DC3}, {0x875C, 0x0F3C}, {0x8B76, 0x0735}, {0x8E52, 0x0735},
+    {0x83B4, 0x077F}, {0x8E5E, 0x0735}, {0x8E61, 0x0735}, {0x07AE, 0x0735}, {0x0778, 0x0735}, {0x8E79, 0x0735},
+    {0x83BE, 0x0C50}, {0x0993, 0x097F}, {0x8195, 0x075A}, {0x81B1, 0x0F3C}, {0x9014, 0x0762}, {0x0B05, 0x097F},
+    {0x0B5A, 0x097F}, {0x8A47, 0x075A}, {0x83C2, 0x0C50}, {0x9051, 0x0C87}, {0x8E7D, 0x0735}, {0x9055, 0x0C87},
+    {0x866B, 0x0EE8}, {0x866F, 0x0EE8}, {0x8E80, 0x0735}, {0x909B, 0x0783}, {0x9059, 0x0C87}, {0x8591, 0x0735},
+    {0x83C6, 0x0C50}, {0x80A8, 0x0E03}, {0x8AB8, 0x0735}, {0x8594, 0x0735}, {0x8039, 0x0DC3}, {0x88CF, 0x075A},
+    {0x8F71, 0x075A}, {0x859B, 0x0735}, {0x85C9, 0x0E29}, {0x85CF, 0x0E29}, {0x8E84, 0x0735}, {0x9041, 0x0C84},
+    {0x9045, 0x0C84}, {0x859E, 0x0735}, {0x83CA, 0x0C50}, {0x0A40, 0x097F}, {0x85CC, 0x0E29}, {0x85D2, 0x0E29},
+    {0x8763, 0x0F9A}, {0x85A1, 0x0735}, {0x099E, 0x097F}, {0x0A7E, 0x09AF}, {0x83CE, 0x0C50}, {0x8E87, 0x0735},
+    {0x8FED, 0x075A}, {0x0A7E, 0x09AF}, {0x8E8A, 0x0735}, {0x9005, 0x075A}, {0x858E, 0x0735}, {0x8E8E, 0x0735},
+    {0x81B7, 0x0F9A}, {0x85AA, 0x0735}, {0x83D2, 0x0C50}, {0x80AC, 0x0E03}, {0x8AED, 0x0735}, {0x85AD, 0x0735},
+    {0x8676, 0x0736}, {0x0772, 0x0736}, {0x09E4, 0x0DFB}, {0x85B4, 0x0735}, {0x8663, 0x09CB}, {0x8667, 0x09CB},
+    {0x8E84, 0x0735}, {0x0779, 0x0736}, {0x0854, 0x0761}, {0x85B7, 0x0735}, {0x9049, 0x0C84}, {0x80A8, 0x0B7A},
+    {0x8018, 0x0B7C}, {0x8342, 0x0736}, {0x8E9E, 0x0736}, {0x85BA, 0x0735}, {0x9029, 0x0A58}, {0x83D6, 0x0D11},
+    {0x90B7, 0x0BFB}, {0x8E87, 0x0735}, {0x8FED, 0x075A}, {0x83DA, 0x0D11}, {0x8A61, 0x0773}, {0x90BB, 0x0C08},
+    {0x9009, 0x075A}, {0x81BA, 0x0772}, {0x8EA2, 0x0736}, {0x8663, 0x0E41}, {0x8EA6, 0x0736}, {0x8EAA, 0x0736},
+    {0x8EAE, 0x0736}, {0x83DE, 0x0D11}, {0x8098, 0x0E00}, {0x8679, 0x0736}, {0x867C, 0x0736}, {0x8680, 0x0736},
+    {0x8683, 0x0736}, {0x8687, 0x0736}, {0x868A, 0x0736}, {0x868E, 0x0736}, {0x8691, 0x0736}, {0x8695, 0x0736},
+    {0x809C, 0x0E00}, {0x80AC, 0x0B7A}, {0x8039, 0x0B7C}, {0x869B, 0x0736}, {0x869F, 0x0736}, {0x86A3, 0x0736},
+    {0x86A6, 0x0736}, {0x83E2, 0x0D11}, {0x86AA, 0x0736}, {0x86AE, 0x0736}, {0x86B2, 0x0736}, {0x83E6, 0x0D11},
+    {0x85E1, 0x0A41}, {0x86B6, 0x0736}, {0x86BA, 0x0736}, {0x86BE, 0x0736}, {0x86C2, 0x0736}, {0x8667, 0x0E41},
+    {0x85E5, 0x0A41}, {0x85D5, 0x0D83}, {0x8342, 0x0736}, {0x83EA, 0x0D11}, {0x80A0, 0x0E00}, {0x86C5, 0x0736},
+    {0x86C8, 0x0736}, {0x86CC, 0x0736}, {0x86CF, 0x0736}, {0x86D3, 0x0736}, {0x86D6, 0x0736}, {0x86DA, 0x0736},
+    {0x86DD, 0x0736}, {0x86E1, 0x0736}, {0x80A4, 0x0E00}, {0x85D8, 0x0D83}, {0x866B, 0x0E4C}, {0x86EA, 0x0736},
+    {0x86EE, 0x0736}, {0x86F2, 0x0736}, {0x86F5, 0x0736}, {0x85A4, 0x0D83}, {0x86F9, 0x0736}, {0x86FD, 0x0736},
+    {0x8701, 0x0736}, {0x9080, 0x0773}, {0x85E9, 0x0A41}, {0x8705, 0x0736}, {0x8709, 0x0736}, {0x870D, 0x0736},
+    {0x8711, 0x0736}, {0x0AF9, 0x1042}, {0x85ED, 0x0A41}, {0x85DB, 0x0D83}, {0x90C3, 0x1084}, {0x8E79, 0x0737},
+    {0x06F3, 0x0736}, {0x8EB6, 0x0737}, {0x8184, 0x0754}, {0x8A4D, 0x075C}, {0x8AD7, 0x075C}, {0x86B2, 0x075C},
+    {0x8AD7, 0x075C}, {0x8A41, 0x0754}, {0x8E84, 0x0754}, {0x8663, 0x0A47}, {0x8ACA, 0x0754}, {0x85DE, 0x0D83},
+    {0x866F, 0x0E4C}, {0x866B, 0x0A4B}, {0x8EB6, 0x0737}, {0x8AA7, 0x0737}, {0x0B29, 0x10A4}, {0x85BD, 0x0D83},
+    {0x8A1E, 0x075C}, {0x88D5, 0x075C}, {0x8AB2, 0x0737}, {0x8EB8, 0x0737}, {0x8AB8, 0x0737}, {0x88C6, 0x0754},
+    {0x8F65, 0x0754}, {0x8ABE, 0x0737}, {0x8AC1, 0x0737}, {0x8AC4, 0x0737}, {0x073D, 0x0735}, {0x80B0, 0x0DCC},
+    {0x8ACA, 0x0737}, {0x9011, 0x075C}, {0x866B, 0x09C8}, {0x8ACD, 0x0737}, {0x0B3D, 0x0788}, {0x80B4, 0x0DCC},
+    {0x83F2, 0x075C}, {0x9029, 0x0BBF}, {0x8AD7, 0x0737}, {0x0836, 0x0754}, {0x8A7A, 0x0743}, {0x8667, 0x0A47},
+    {0x83D6, 0x091D}, {0x8766, 0x0FAA}, {0x8AE0, 0x0737}, {0x866F, 0x0A4B}, {0x83DA, 0x091D}, {0x8FDD, 0x0754},
+    {0x8EBC, 0x0737}, {0x8EBC, 0x0754}, {0x8789, 0x0EA4}, {0x8789, 0x09D6}, {0x8AE7, 0x0737}, {0x8EBE, 0x0737},
+    {0x8AED, 0x0737}, {0x81CC, 0x0FAA}, {0x83DE, 0x091D}, {0x8AF3, 0x0737}, {0x8AF6, 0x0737}, {0x8AF9, 0x0737},
+    {0x0A93, 0x0BC4}, {0x80B8, 0x0DCC}, {0x8AFF, 0x0737}, {0x8EC1, 0x0737}, {0x866F, 0x09C8}, {0x8B02, 0x0737},
+    {0x0714, 0x0736}, {0x80BC, 0x0DCC}, {0x8789, 0x0F45}, {0x070A, 0x0736}, {0x8B0C, 0x0737}, {0x8EC5, 0x0737},
+    {0x8EC8, 0x0737}, {0x8A7D, 0x0743}, {0x83E2, 0x091D}, {0x85C9, 0x0D8F}, {0x8B15, 0x0737}, {0x8A80, 0x0743},
+    {0x83E6, 0x091D}, {0x8E6F, 0x0D8F}, {0x872F, 0x0AF2}, {0x8A83, 0x0743}, {0x878C, 0x0EA4}, {0x878C, 0x09D6},
+    {0x0945, 0x0772}, {0x847D, 0x098D}, {0x8481, 0x098D}, {0x8A86, 0x0743}, {0x83EA, 0x091D}, {0x85CC, 0x0D8F},
+    {0x876D, 0x1002}, {0x8A1B, 0x0743}, {0x8A1E, 0x0743}, {0x8A89, 0x0743}, {0x8485, 0x098D}, {0x8489, 0x098D},
+    {0x848D, 0x098D}, {0x0719, 0x0736}, {0x0743, 0x0736}, {0x886F, 0x0744}, {0x878C, 0x0F45}, {0x8B34, 0x0744},
+    {0x81D9, 0x1002}, {0x8F3E, 0x0743}, {0x9031, 0x0C82}, {0x8A8C, 0x0743}, {0x8B63, 0x0744}, {0x85CF, 0x0D8F},
+    {0x9035, 0x0C82}, {0x8A8F, 0x0743}, {0x8491, 0x098D}, {0x8E74, 0x0D8F}, {0x8F42, 0x0744}, {0x8A92, 0x0743},
+    {0x8EB6, 0x0744}, {0x90A3, 0x0BF7}, {0x887E, 0x0C82}, {0x90A7, 0x0BF7}, {0x8F46, 0x0744}, {0x8A95, 0x0743},
+    {0x8FF3, 0x0780}, {0x85D2, 0x0D8F}, {0x9039, 0x0C82}, {0x8A21, 0x0743}, {0x8A24, 0x0743}, {0x8A98, 0x0743},
+    {0x0B8E, 0x1088}, {0x8F4A, 0x0744}, {0x8F4D, 0x0744}, {0x8F51, 0x0744}, {0x8495, 0x098D}, {0x0F7D, 0x10A3},
+    {0x0D82, 0x10A3}, {0x818B, 0x0756}, {0x88B1, 0x0744}, {0x88B4, 0x0744}, {0x88B7, 0x0744}, {0x8098, 0x0B78},
+    {0x8A44, 0x0756}, {0x86EA, 0x0775}, {0x8EC1, 0x0775}, {0x8250, 0x10CA}, {0x8501, 0x1024}, {0x88C6, 0x0744},
+    {0x85C9, 0x0A25}, {0x88C9, 0x0744}, {0x8501, 0x0B7F}, {0x809C, 0x0B78}, {0x8778, 0x0E20}, {0x88CF, 0x0744},
+    {0x88D2, 0x0744}, {0x88D5, 0x0744}, {0x8FF3, 0x0780}, {0x8098, 0x09AD}, {0x88C9, 0x0756}, {0x8F69, 0x0756},
+    {0x074E, 0x0737}, {0x88DB, 0x0744}, {0x85CC, 0x0A25}, {0x90E3, 0x0C61}, {0x81E3, 0x0E20}, {0x9098, 0x0780},
+    {0x8F4D, 0x0744}, {0x809C, 0x09AD}, {0x0735, 0x0737}, {0x8FDF, 0x0756}, {0x88E1, 0x0744}, {0x88E4, 0x0744},
+    {0x88E7, 0x0744}, {0x80A0, 0x0B78}, {0x90DB, 0x0C5F}, {0x8AA7, 0x0745}, {0x8FE2, 0x0756}, {0x8FE6, 0x0756},
+    {0x8505, 0x1024}, {0x88F9, 0x0744}, {0x85CF, 0x0A25}, {0x88FC, 0x0744}, {0x8505, 0x0B7F}, {0x80A4, 0x0B78},
+    {0x0798, 0x0737}, {0x8902, 0x0744}, {0x8905, 0x0744}, {0x8908, 0x0744}, {0x8F59, 0x0745}, {0x80A0, 0x09AD},
+    {0x8F5D, 0x0745}, {0x90DF, 0x0C5F}, {0x90E7, 0x0C6E}, {0x890E, 0x0744}, {0x85D2, 0x0A25}, {0x8F61, 0x0745},
+    {0x0B79, 0x09A0}, {0x8F61, 0x0745}, {0x0AFA, 0x09A0}, {0x80A4, 0x09AD}, {0x0A20, 0x09A0}, {0x0D03, 0x0AB1},
+    {0x0A0D, 0x09A0}, {0x8FFA, 0x0778}, {0x8F65, 0x0745}, {0x0B07, 0x0AB1}, {0x8F69, 0x0745}, {0x8860, 0x0745},
+    {0x8F6D, 0x0745}, {0x8FE6, 0x0756}, {0x8F71, 0x0745}, {0x0D30, 0x10D2}, {0x80B0, 0x0B8F}, {0x8863, 0x0745},
+    {0x8EC5, 0x0775}, {0x8F75, 0x0745}, {0x86F5, 0x0778}, {0x8E87, 0x0745}, {0x80B4, 0x0B8F}, {0x90AB, 0x0BF9},
+    {0x90AF, 0x0BF9}, {0x0B37, 0x09A0}, {0x8F79, 0x0745}, {0x8F7D, 0x0745}, {0x84CD, 0x0756}, {0x0AF9, 0x1134},
+    {0x0BDF, 0x0AB1}, {0x8F61, 0x0745}, {0x8F81, 0x0745}, {0x8F61, 0x0745}, {0x8330, 0x0746}, {0x8F6D, 0x0778},
+    {0x8B38, 0x0746}, {0x85D5, 0x0A26}, {0x8044, 0x0DFF}, {0x90EB, 0x0B93}, {0x81E6, 0x0782}, {0x8B67, 0x0746},
+    {0x8048, 0x0DFF}, {0x8866, 0x0745}, {0x8F6D, 0x0745}, {0x0E97, 0x1114}, {0x8F71, 0x0745}, {0x8711, 0x0782},
+    {0x80B8, 0x0B8F}, {0x8869, 0x0745}, {0x8F85, 0x0745}, {0x85D8, 0x0A26}, {0x804C, 0x0DFF}, {0x8E87, 0x0745},
+    {0x80BC, 0x0B8F}, {0x81D3, 0x077A}, {0x8F9C, 0x0747}, {0x85A4, 0x0A26}, {0x90C7, 0x0AC6}, {0x90B3, 0x0BF9},
+    {0x8A6A, 0x077A}, {0x890E, 0x0782}, {0x8F51, 0x0746}, {0x8F8D, 0x0746}, {0x8F91, 0x0746}, {0x0AE4, 0x07CB},
+    {0x0805, 0x0747}, {0x836E, 0x0746}, {0x8044, 0x0B76}, {0x85DB, 0x0A26}, {0x8050, 0x0DFF}, {0x8374, 0x0746},
+    {0x8048, 0x0B76}, {0x0A5F, 0x0AD8}, {0x8054, 0x0DFF}, {0x837D, 0x0746}, {0x8902, 0x077A}, {0x8F71, 0x077A},
+    {0x0A8C, 0x0AD8}, {0x0767, 0x0744}, {0x0B56, 0x0BB7}, {0x8383, 0x0746}, {0x804C, 0x0B76}, {0x85DE, 0x0A26},
+    {0x8058, 0x0DFF}, {0x099B, 0x0778}, {0x8FA0, 0x0747}, {0x8389, 0x0746}, {0x879E, 0x0747}, {0x85BD, 0x0A26},
+    {0x90CB, 0x0AC6}, {0x90CF, 0x0AC6}, {0x87AB, 0x0747}, {0x85F1, 0x108D}, {0x85C3, 0x10D0}, {0x85C3, 0x0DB3},
+    {0x87B5, 0x0747}, {0x8F8D, 0x0746}, {0x85F1, 0x0DD8}, {0x8396, 0x0746}, {0x8050, 0x0B76}, {0x079C, 0x0744},
+    {0x87C3, 0x0747}, {0x839C, 0x0746}, {0x8054, 0x0B76}, {0x8657, 0x076F}, {0x8271, 0x10C0}, {0x83A5, 0x0746},
+    {0x87CD, 0x0747}, {0x8A5A, 0x076F}, {0x0B55, 0x0BC6}, {0x86DA, 0x076F}, {0x87D8, 0x0747}, {0x83AB, 0x0746},
+    {0x8058, 0x0B76}, {0x8FA3, 0x0747}, {0x90EF, 0x0BE4}, {0x0865, 0x0747}, {0x81C9, 0x0776}, {0x83B1, 0x0746},
+    {0x87DF, 0x0747}, {0x080F, 0x0747}, {0x0B23, 0x07DE}, {0x8A67, 0x0776}, {0x87EC, 0x0747}, {0x85F4, 0x108D},
+    {0x85C6, 0x10D0}, {0x85C6, 0x0DB3}, {0x87F9, 0x0747}, {0x0A99, 0x0E5D}, {0x85F4, 0x0DD8}, {0x0B07, 0x0E5D},
+    {0x0B6A, 0x0BF0}, {0x09E6, 0x0E5D}, {0x8806, 0x0747}, {0x8509, 0x0FED}, {0x0788, 0x0745}, {0x873B, 0x0749},
+    {0x8275, 0x10C0}, {0x88FC, 0x0776}, {0x8819, 0x0747}, {0x850D, 0x0FED}, {0x816D, 0x0749}, {0x863F, 0x0749},
+    {0x8824, 0x0747}, {0x8846, 0x0749}, {0x09E2, 0x0E5D}, {0x8A7D, 0x0749}, {0x8591, 0x0749}, {0x8170, 0x074B},
+    {0x8657, 0x076F}, {0x078B, 0x0747}, {0x90D3, 0x0B34}, {0x8250, 0x0B34}, {0x8A2D, 0x074B}, {0x90D7, 0x0B34},
+    {0x8680, 0x074B}, {0x8EB8, 0x074B}, {0x07B6, 0x0745}, {0x8A53, 0x076C}, {0x8AED, 0x076C}, {0x86CF, 0x076C},
+    {0x8A7D, 0x0749}, {0x85F1, 0x1119}, {0x85F4, 0x1119}, {0x836E, 0x0749}, {0x90F3, 0x0BFA}, {0x8511, 0x0FED},
+    {0x8846, 0x0749}, {0x0E11, 0x1156}, {0x88B1, 0x074B}, {0x8F61, 0x074B}, {0x8FAB, 0x0749}, {0x8515, 0x0FED},
+    {0x0B7D, 0x0CA0}, {0x88E4, 0x076C}, {0x8F81, 0x076C}, {0x8FB0, 0x074B}, {0x0CEB, 0x1156}, {0x8FB4, 0x074B},
+    {0x0BA7, 0x0C24}, {0x8FD3, 0x076F}, {0x9083, 0x0776}, {0x873E, 0x074D}, {0x8509, 0x0B94}, {0x85E1, 0x1073},
+    {0x90F7, 0x0C2A}, {0x8FAE, 0x0749}, {0x8173, 0x074D}, {0x8FB8, 0x074B}, {0x850D, 0x0B94}, {0x85E5, 0x1073},
+    {0x0BA0, 0x0CA1}, {0x8A80, 0x074D}, {0x8594, 0x074D}, {0x8687, 0x074D}, {0x07A0, 0x0746}, {0x836E, 0x0749},
+    {0x8591, 0x0749}, {0x8002, 0x0749}, {0x0B8B, 0x1133}, {0x0BCA, 0x1133}, {0x8745, 0x0751}, {0x85E1, 0x0C3E},
+    {0x85E9, 0x0C3E}, {0x84E8, 0x0776}, {0x0791, 0x0746}, {0x8179, 0x0751}, {0x8A80, 0x074D}, {0x88B7, 0x074D},
+    {0x8F61, 0x074D}, {0x8374, 0x074D}, {0x8A83, 0x0751}, {0x859B, 0x0751}, {0x8695, 0x0751}, {0x0BCF, 0x0C36},
+    {0x8511, 0x0B94}, {0x85E9, 0x1073}, {0x099E, 0x0747}, {0x9064, 0x076C}, {0x9067, 0x076C}, {0x8FB8, 0x074B},
+    {0x8515, 0x0B94}, {0x85ED, 0x1073}, {0x8FBB, 0x074B}, {0x1008, 0x07CA}, {0x90FB, 0x0C4D}, {0x8A83, 0x0751},
+    {0x07BE, 0x0746}, {0x84C3, 0x0749}, {0x837D, 0x0751}, {0x0B87, 0x07E1}, {0x1052, 0x07CA}, {0x0AD9, 0x10EA},
+    {0x8EBE, 0x074B}, {0x0AB1, 0x10EA}, {0x0C85, 0x0C5D}, {0x1094, 0x07CA}, {0x85E5, 0x0C3F}, {0x85ED, 0x0C3F},
+    {0x8FF0, 0x075B}, {0x1137, 0x07CA}, {0x8FD5, 0x0751}, {0x8374, 0x074D}, {0x8594, 0x074D}, {0x8005, 0x074D},
+    {0x8198, 0x075B}, {0x8748, 0x0757}, {0x0AE7, 0x10EA}, {0x07CD, 0x0747}, {0x0B99, 0x11A4}, {0x8A4A, 0x075B},
+    {0x818E, 0x0757}, {0x86AE, 0x075B}, {0x86D6, 0x076E}, {0x85E1, 0x0DD3}, {0x8279, 0x10C3}, {0x8A86, 0x0757},
+    {0x859E, 0x0757}, {0x0BDB, 0x0C70}, {0x8ACD, 0x0757}, {0x85E5, 0x0DD3}, {0x837D, 0x0751}, {0x859B, 0x0751},
+    {0x8008, 0x0751}, {0x0EDB, 0x0C79}, {0x8A1B, 0x075B}, {0x88D2, 0x075B}, {0x0A98, 0x0E43}, {0x08E1, 0x0E43},
+    {0x09BB, 0x0E43}, {0x090D, 0x0E43}, {0x8A86, 0x0757}, {0x0976, 0x0E43}, {0x8FD5, 0x0751}, {0x8383, 0x0757},
+    {0x10C8, 0x1175}, {0x0F13, 0x1175}, {0x8C44, 0x0757}, {0x8248, 0x10F6}, {0x8FB8, 0x0757}, {0x0BB3, 0x11A6},
+    {0x8FEA, 0x0757}, {0x0909, 0x0E43}, {0x83EE, 0x075B}, {0x0BF4, 0x0C8F}, {0x8FF0, 0x075B}, {0x85E9, 0x0DD3},
+    {0x827C, 0x10C3}, {0x85C9, 0x1080}, {0x900D, 0x075B}, {0x906E, 0x076E}, {0x0CFF, 0x0C93}, {0x85ED, 0x0DD3},
+    {0x84CA, 0x0751}, {0x8FED, 0x0757}, {0x8FF0, 0x0757}, {0x07B7, 0x0749}, {0x0B35, 0x07DF}, {0x0B47, 0x07DF},
+    {0x0BC6, 0x11A7}, {0x8FF3, 0x0757}, {0x8FF6, 0x0757}, {0x85CC, 0x1080}, {0x0C24, 0x0CA2}, {0x8253, 0x10B6},
+    {0x9140, 0x0CCA}, {0x8383, 0x0757}, {0x859E, 0x0757}, {0x8012, 0x0757}, {0x9071, 0x076E}, {0x824C, 0x10F6},
+    {0x8FB8, 0x0757}, {0x9075, 0x076E}, {0x8248, 0x0F1D}, {0x85C9, 0x0DB7}, {0x9079, 0x076E}, {0x819E, 0x10B6},
+    {0x086C, 0x075D}, {0x086E, 0x075D}, {0x874B, 0x075D}, {0x85CF, 0x1080}, {0x9144, 0x0CCB}, {0x906E, 0x076E},
+    {0x8431, 0x1085}, {0x819B, 0x075D}, {0x8044, 0x0E64}, {0x8FED, 0x0757}, {0x8849, 0x075D}, {0x85CC, 0x0DB7},
+    {0x8A89, 0x075D}, {0x85A1, 0x075D}, {0x84F9, 0x1085}, {0x8FF3, 0x0757}, {0x8048, 0x0E64}, {0x85D2, 0x1080},
+    {0x85D5, 0x0E24}, {0x8257, 0x10B6}, {0x85FA, 0x0E24}, {0x84D0, 0x0757}, {0x0BEA, 0x0CA6}, {0x0C21, 0x0CA6},
+    {0x8435, 0x1085}, {0x07C1, 0x074D}, {0x804C, 0x0E64}, {0x8A89, 0x075D}, {0x824C, 0x0F1D}, {0x85CF, 0x0DB7},
+    {0x8389, 0x075D}, {0x81DC, 0x10B6}, {0x0C01, 0x11A8}, {0x863F, 0x075D}, {0x8018, 0x0E64}, {0x85C3, 0x0E24},
+    {0x85D8, 0x0E24}, {0x8642, 0x075D}, {0x8439, 0x1085}, {0x8645, 0x075D}, {0x8050, 0x0E64}, {0x8648, 0x075D},
+    {0x85A4, 0x0E24}, {0x85D2, 0x0DB7}, {0x07C5, 0x0751}, {0x0C47, 0x0CD4}, {0x84FD, 0x1085}, {0x864B, 0x075D},
+    {0x8054, 0x0E64}, {0x81C2, 0x0774}, {0x85DB, 0x0E24}, {0x825B, 0x0F21}, {0x85FD, 0x0E24}, {0x864E, 0x075D},
+    {0x8A64, 0x0774}, {0x8E84, 0x0774}, {0x843D, 0x1085}, {0x8AFF, 0x0774}, {0x8058, 0x0E64}, {0x0E75, 0x0CE1},
+    {0x0C11, 0x11AC}, {0x0C58, 0x0CF0}, {0x8389, 0x075D}, {0x85A1, 0x075D}, {0x8015, 0x075D}, {0x8651, 0x075D},
+    {0x8039, 0x0E64}, {0x85C6, 0x0E24}, {0x85DE, 0x0E24}, {0x8654, 0x075D}, {0x88F9, 0x0774}, {0x8657, 0x075D},
+    {0x85D5, 0x1074}, {0x865A, 0x075D}, {0x85BD, 0x0E24}, {0x8A70, 0x077C}, {0x8B0C, 0x077C}, {0x8701, 0x077C},
+    {0x8B0C, 0x077C}, {0x865D, 0x075D}, {0x0CAB, 0x0CF1}, {0x0C28, 0x11AD}, {0x90FF, 0x0C62}, {0x825E, 0x0F21},
+    {0x0CCD, 0x0D05}, {0x8660, 0x075D}, {0x85D8, 0x1074}, {0x8271, 0x0F3E}, {0x8238, 0x10F3}, {0x07F1, 0x0757},
+    {0x8A24, 0x077C}, {0x8908, 0x077C}, {0x85A4, 0x1074}, {0x0A26, 0x0766}, {0x84D3, 0x075D}, {0x9168, 0x0D79},
+    {0x07DF, 0x075D}, {0x0D44, 0x0DB4}, {0x823C, 0x10F3}, {0x9102, 0x0C62}, {0x8332, 0x0766}, {0x8336, 0x0766},
+    {0x9105, 0x0C62}, {0x833A, 0x0766}, {0x85DB, 0x1074}, {0x833E, 0x0766}, {0x8342, 0x0766}, {0x8EBC, 0x0766},
+    {0x8345, 0x0766}, {0x8349, 0x0766}, {0x834C, 0x0766}, {0x834F, 0x0766}, {0x8352, 0x0766}, {0x8356, 0x0766},
+    {0x835A, 0x0766}, {0x835E, 0x0766}, {0x8362, 0x0766}, {0x8366, 0x0766}, {0x85DE, 0x1074}, {0x8275, 0x0F3E},
+    {0x8240, 0x10F3}, {0x836A, 0x0766}, {0x8271, 0x0C28}, {0x9174, 0x0DF2}, {0x85BD, 0x1074}, {0x836E, 0x0766},
+    {0x8FDD, 0x0774}, {0x8371, 0x0766}, {0x8EBC, 0x0774}, {0x8374, 0x0766}, {0x8244, 0x10F3}, {0x8377, 0x0766},
+    {0x837A, 0x0766}, {0x837D, 0x0766}, {0x8380, 0x0766}, {0x9091, 0x077C}, {0x9178, 0x0DF3}, {0x8431, 0x1020},
+    {0x0C94, 0x0DB5}, {0x8383, 0x0766}, {0x83F2, 0x077C}, {0x84F9, 0x1020}, {0x0C88, 0x0D3E}, {0x8386, 0x0766},
+    {0x8431, 0x0B7B}, {0x8389, 0x0766}, {0x917C, 0x0D42}, {0x838C, 0x0766}, {0x84F9, 0x0B7B}, {0x838F, 0x0766},
+    {0x8392, 0x0766}, {0x8435, 0x1020}, {0x9160, 0x0D04}, {0x9164, 0x0D04}, {0x8275, 0x0C28}, {0x0D05, 0x0766},
+    {0x0CA6, 0x0DC5}, {0x8396, 0x0766}, {0x8435, 0x0B7B}, {0x8399, 0x0766}, {0x0CC9, 0x0D50}, {0x839C, 0x0766},
+    {0x0840, 0x075D}, {0x839F, 0x0766}, {0x83A2, 0x0766}, {0x83A5, 0x0766}, {0x83A8, 0x0766}, {0x9180, 0x0D54},
+    {0x0819, 0x075D}, {0x8439, 0x1020}, {0x0C80, 0x11B1}, {0x83AB, 0x0766}, {0x0CB1, 0x0D5E}, {0x84FD, 0x1020},
+    {0x0CE0, 0x0D60}, {0x83AE, 0x0766}, {0x8439, 0x0B7B}, {0x83B1, 0x0766}, {0x83F6, 0x0D4F}, {0x83B4, 0x0766},
+    {0x84FD, 0x0B7B}, {0x83B7, 0x0766}, {0x83BA, 0x0766}, {0x843D, 0x1020}, {0x9029, 0x0766}, {0x83F9, 0x0D4F},
+    {0x83FC, 0x0D4F}, {0x8400, 0x0D4F}, {0x0849, 0x0766}, {0x8403, 0x0D4F}, {0x843D, 0x0B7B}, {0x8406, 0x0D4F},
+    {0x840A, 0x0D4F}, {0x07F8, 0x075D}, {0x9184, 0x0D62}, {0x840D, 0x0D4F}, {0x8410, 0x0D4F}, {0x0C55, 0x0D08},
+    {0x0D1B, 0x0D08}, {0x0C9F, 0x11B2}, {0x8413, 0x0D4F}, {0x8416, 0x0D4F}, {0x8419, 0x0D4F}, {0x0CD1, 0x0D7B},
+    {0x8778, 0x0781}, {0x858E, 0x0767}, {0x097E, 0x0767}, {0x0A52, 0x0767}, {0x0CF1, 0x0D7F}, {0x81E3, 0x0781},
+    {0x9188, 0x0D84}, {0x8261, 0x10BF}, {0x902D, 0x0767}, {0x8872, 0x0767}, {0x8876, 0x0767}, {0x8E87, 0x0781},
+    {0x887A, 0x0767}, {0x8265, 0x10BF}, {0x887E, 0x0767}, {0x0AC0, 0x0767}, {0x0CFC, 0x0DA5}, {0x8882, 0x0767},
+    {0x8886, 0x0767}, {0x888A, 0x0767}, {0x888E, 0x0767}, {0x8892, 0x0767}, {0x8896, 0x0767}, {0x889A, 0x0767},
+    {0x889E, 0x0767}, {0x88A2, 0x0767}, {0x88A6, 0x0767}, {0x8E87, 0x0781}, {0x0935, 0x0767}, {0x8F4D, 0x0767},
+    {0x88AA, 0x0767}, {0x8F8D, 0x0767}, {0x9134, 0x0C9A}, {0x9138, 0x0C9A}, {0x8591, 0x0767}, {0x85C9, 0x111A},
+    {0x85CF, 0x111A}, {0x0CB0, 0x11B3}, {0x8594, 0x0767}, {0x8269, 0x10BF}, {0x8597, 0x0767}, {0x0CD9, 0x11B3},
+    {0x859B, 0x0767}, {0x85CC, 0x111A}, {0x85D2, 0x111A}, {0x826D, 0x10BF}, {0x913C, 0x0C9A}, {0x0DAA, 0x0D90},
+    {0x859E, 0x0767}, {0x916C, 0x0D7A}, {0x9170, 0x0D7A}, {0x0B86, 0x0B85}, {0x0C35, 0x11AF}, {0x0C5E, 0x11AF},
+    {0x85A1, 0x0767}, {0x0C70, 0x0B85}, {0x0DFB, 0x0B85}, {0x0D0A, 0x0DA9}, {0x85A7, 0x0767}, {0x8253, 0x0F1F},
+    {0x83B7, 0x0781}, {0x0D2C, 0x0DB9}, {0x8EBE, 0x0784}, {0x858E, 0x0767}, {0x858E, 0x0767}, {0x9198, 0x0DBD},
+    {0x85AA, 0x0767}, {0x09C1, 0x0768}, {0x0DBF, 0x0E53}, {0x0C70, 0x11AF}, {0x85AD, 0x0767}, {0x819E, 0x0F1F},
+    {0x85B0, 0x0767}, {0x919C, 0x0E73}, {0x85B4, 0x0767}, {0x91A0, 0x0E74}, {0x0A84, 0x0768}, {0x0D2C, 0x0E54},
+    {0x0878, 0x0D4F}, {0x08A0, 0x0D4F}, {0x85B7, 0x0767}, {0x086B, 0x0766}, {0x089A, 0x0766}, {0x0C29, 0x0B85},
+    {0x08D5, 0x0766}, {0x0916, 0x0766}, {0x85BA, 0x0767}, {0x08E0, 0x0766}, {0x0B89, 0x0B85}, {0x9029, 0x0784},
+    {0x85C0, 0x0767}, {0x8257, 0x0F1F}, {0x80FF, 0x09FF}, {0x8103, 0x09FF}, {0x8EBE, 0x0784}, {0x0988, 0x0767},
+    {0x0D25, 0x0DCD}, {0x08B3, 0x0767}, {0x8002, 0x0768}, {0x91A4, 0x0DE0}, {0x8107, 0x09FF}, {0x810B, 0x09FF},
+    {0x8005, 0x0768}, {0x81DC, 0x0F1F}, {0x8216, 0x1112}, {0x0D34, 0x0DFE}, {0x8008, 0x0768}, {0x0DBA, 0x0DE9},
+    {0x810F, 0x09FF}, {0x8113, 0x09FF}, {0x821A, 0x1112}, {0x800F, 0x0768}, {0x8012, 0x0768}, {0x9094, 0x0784},
+    {0x0C71, 0x0D15}, {0x0CA5, 0x0D15}, {0x8117, 0x09FF}, {0x811B, 0x09FF}, {0x8015, 0x0768}, {0x0D52, 0x0E01},
+    {0x801B, 0x0768}, {0x909F, 0x0784}, {0x801F, 0x0768}, {0x098C, 0x0784}, {0x811F, 0x09FF}, {0x8123, 0x09FF},
+    {0x0D09, 0x11B7}, {0x0B5B, 0x0768}, {0x0A31, 0x0768}, {0x0D17, 0x11B7}, {0x8023, 0x0768}, {0x09F2, 0x0768},
+    {0x8127, 0x09FF}, {0x812B, 0x09FF}, {0x8026, 0x0768}, {0x8238, 0x0F1B}, {0x8230, 0x1112}, {0x0D81, 0x0DF7},
+    {0x8029, 0x0768}, {0x91B4, 0x0E09}, {0x812F, 0x09FF}, {0x8133, 0x09FF}, {0x8234, 0x1112}, {0x8030, 0x0768},
+    {0x8033, 0x0768}, {0x823C, 0x0F1B}, {0x8572, 0x0B3A}, {0x8576, 0x0B3A}, {0x8137, 0x09FF}, {0x813B, 0x09FF},
+    {0x8036, 0x0768}, {0x0D39, 0x11BD}, {0x803C, 0x0768}, {0x0DBB, 0x0E17}, {0x8040, 0x0768}, {0x857A, 0x0B3A},
+    {0x91C0, 0x0E79}, {0x813F, 0x0A00}, {0x8143, 0x0A00}, {0x0D72, 0x11AE}, {0x0AA2, 0x0781}, {0x08D4, 0x0768},
+    {0x857E, 0x0B3A}, {0x8582, 0x0B3A}, {0x0C42, 0x0767}, {0x8147, 0x0A00}, {0x814B, 0x0A00}, {0x8240, 0x0F1B},
+    {0x090E, 0x0767}, {0x0994, 0x0767}, {0x8586, 0x0B3A}, {0x858A, 0x0B3A}, {0x918C, 0x0DAF}, {0x814F, 0x0A00},
+    {0x8153, 0x0A00}, {0x8759, 0x0769}, {0x0D7E, 0x0E1F}, {0x8244, 0x0F1B}, {0x8216, 0x0F1A}, {0x91C4, 0x0E30},
+    {0x81AB, 0x0769}, {0x8651, 0x0769}, {0x8157, 0x0A00}, {0x884C, 0x0769}, {0x821A, 0x0F1A}, {0x8A8C, 0x0769},
+    {0x85AA, 0x0769}, {0x0D89, 0x11B0}, {0x85D5, 0x0DB8}, {0x815B, 0x0A00}, {0x815F, 0x0A00}, {0x9190, 0x0DAF},
+    {0x9194, 0x0DAF}, {0x0A30, 0x076A}, {0x0903, 0x0767}, {0x0BFA, 0x0767}, {0x91A8, 0x0DEB}, {0x8163, 0x0A00},
+    {0x8167, 0x0A00}, {0x0D9E, 0x0E3B}, {0x8A8C, 0x0769}, {0x91AC, 0x0DEB}, {0x85D8, 0x0DB8}, {0x8396, 0x0769},
+    {0x0A5D, 0x076A}, {0x91B8, 0x0E78}, {0x86C8, 0x076A}, {0x91BC, 0x0E78}, {0x85A4, 0x0DB8}, {0x8261, 0x0F32},
+    {0x8230, 0x0F1A}, {0x0CE4, 0x11B5}, {0x0CED, 0x11B5}, {0x91C8, 0x0E47}, {0x8238, 0x0C1F}, {0x8265, 0x0F32},
+    {0x8234, 0x0F1A}, {0x91B0, 0x0DEB}, {0x81EC, 0x10F2}, {0x0DA1, 0x11BA}, {0x85DB, 0x0DB8}, {0x0B71, 0x0784},
+    {0x81F0, 0x10F2}, {0x0DAB, 0x0E5B}, {0x823C, 0x0C1F}, {0x863F, 0x076A}, {0x91CC, 0x0E5F}, {0x08FE, 0x0768},
+    {0x0C3A, 0x0768}, {0x8642, 0x076A}, {0x0DBD, 0x11BF}, {0x8645, 0x076A}, {0x81F4, 0x10F2}, {0x8648, 0x076A},
+    {0x85DE, 0x0DB8}, {0x8396, 0x0769}, {0x85AA, 0x0769}, {0x8023, 0x0769}, {0x884C, 0x0769}, {0x864B, 0x076A},
+    {0x85BD, 0x0DB8}, {0x8269, 0x0F32}, {0x9061, 0x0769}, {0x0D0B, 0x0DC4}, {0x0D34, 0x0DC4}, {0x864E, 0x076A},
+    {0x8240, 0x0C1F}, {0x826D, 0x0F32}, {0x0D9B, 0x0E19}, {0x0D9C, 0x0E19}, {0x81F8, 0x10F2}, {0x0DC5, 0x0E66},
+    {0x91D0, 0x0E7B}, {0x0DC1, 0x11C4}, {0x81FC, 0x10F2}, {0x0DCC, 0x0E7D}, {0x8244, 0x0C1F}, {0x8651, 0x076A},
+    {0x0943, 0x0768}, {0x91D4, 0x0E7F}, {0x0DC8, 0x11C9}, {0x8654, 0x076A}, {0x0DD3, 0x0E84}, {0x8657, 0x076A},
+    {0x8200, 0x10F2}, {0x865A, 0x076A}, {0x91D8, 0x0E86}, {0x84DE, 0x0769}, {0x0DCF, 0x11D0}, {0x0E0E, 0x0E8C},
+    {0x91DC, 0x0E8D}, {0x865D, 0x076A}, {0x0DD3, 0x11D1}, {0x0E13, 0x0E90}, {0x8FF0, 0x077B}, {0x91E0, 0x0E91},
+    {0x0DD9, 0x11D3}, {0x8660, 0x076A}, {0x0E17, 0x0E94}, {0x91E4, 0x0E96}, {0x81D6, 0x077B}, {0x0DDD, 0x11D5},
+    {0x0E19, 0x0E99}, {0x91E8, 0x0E9A}, {0x875C, 0x076D}, {0x8A6D, 0x077B}, {0x0DC1, 0x0F2A}, {0x86FD, 0x077B},
+    {0x08E3, 0x076A}, {0x81B1, 0x076D}, {0x0E23, 0x0E9E}, {0x0E06, 0x0EA2}, {0x0A93, 0x076B}, {0x91EC, 0x0E9A},
+    {0x8A8F, 0x076D}, {0x85AD, 0x076D}, {0x86D3, 0x076D}, {0x81AE, 0x076B}, {0x91F0, 0x0E9A}, {0x91FC, 0x0EA3},
+    {0x8A21, 0x077B}, {0x8905, 0x077B}, {0x8A50, 0x076B}, {0x91F4, 0x0E9A}, {0x86CC, 0x076B}, {0x8EBE, 0x076B},
+    {0x0E2F, 0x11D4}, {0x0E39, 0x0EB2}, {0x91F8, 0x0E9A}, {0x8A8F, 0x076D}, {0x88E7, 0x076D}, {0x8F61, 0x076D},
+    {0x839C, 0x076D}, {0x9200, 0x0EB3}, {0x0E37, 0x11D6}, {0x0ECC, 0x0EBA}, {0x0E39, 0x11D7}, {0x0E41, 0x0EBC},
+    {0x88E1, 0x076B}, {0x8F61, 0x076B}, {0x0E3E, 0x11D9}, {0x9214, 0x0EBD}, {0x0E7E, 0x0EC0}, {0x88AE, 0x076B},
+    {0x9218, 0x0EBD}, {0x88B1, 0x076B}, {0x88B4, 0x076B}, {0x88B7, 0x076B}, {0x0E48, 0x11DA}, {0x88BA, 0x076B},
+    {0x88BD, 0x076B}, {0x88C0, 0x076B}, {0x0E56, 0x0EC8}, {0x88C3, 0x076B}, {0x88C6, 0x076B}, {0x091D, 0x0769},
+    {0x88C9, 0x076B}, {0x88CC, 0x076B}, {0x0E4F, 0x11DB}, {0x1168, 0x0ED2}, {0x88CF, 0x076B}, {0x88D2, 0x076B},
+    {0x88D5, 0x076B}, {0x88D8, 0x076B}, {0x839C, 0x076D}, {0x85AD, 0x076D}, {0x8026, 0x076D}, {0x0E6B, 0x11DC},
+    {0x88DB, 0x076B}, {0x922C, 0x0ECC}, {0x83EE, 0x077B}, {0x906B, 0x076D}, {0x8FF0, 0x077B}, {0x9230, 0x0ECC},
+    {0x0910, 0x076A}, {0x88DE, 0x076B}, {0x908E, 0x077B}, {0x88E1, 0x076B}, {0x88E4, 0x076B}, {0x88E7, 0x076B},
+    {0x0984, 0x076A}, {0x88EA, 0x076B}, {0x88ED, 0x076B}, {0x88F0, 0x076B}, {0x88F3, 0x076B}, {0x88F6, 0x076B},
+    {0x88F9, 0x076B}, {0x0E67, 0x0EDB}, {0x88FC, 0x076B}, {0x88FF, 0x076B}, {0x9260, 0x0EEF}, {0x0E74, 0x11DD},
+    {0x8902, 0x076B}, {0x8905, 0x076B}, {0x8908, 0x076B}, {0x890B, 0x076B}, {0x1196, 0x0EF3}, {0x0E77, 0x11DE},
+    {0x8763, 0x0771}, {0x0E74, 0x0EF9}, {0x890E, 0x076B}, {0x9290, 0x0EFB}, {0x8EBE, 0x076B}, {0x81B7, 0x0771},
+    {0x921C, 0x0EC2}, {0x0911, 0x076A}, {0x0907, 0x076B}, {0x9220, 0x0EC2}, {0x8A92, 0x0771}, {0x85B4, 0x0771},
+    {0x86E1, 0x0771}, {0x0E89, 0x11DF}, {0x92DC, 0x0F0E}, {0x9224, 0x0EC2}, {0x8766, 0x0777}, {0x9148, 0x0CEF},
+    {0x914C, 0x0CEF}, {0x1177, 0x0F07}, {0x0E88, 0x0F07}, {0x81CC, 0x0777}, {0x9228, 0x0EC2}, {0x9150, 0x0CEF},
+    {0x0E94, 0x11E0}, {0x8A92, 0x0771}, {0x8A95, 0x0777}, {0x85B7, 0x0777}, {0x83A5, 0x0771}, {0x8B02, 0x0777},
+    {0x0E99, 0x0F12}, {0x0EF4, 0x0BA3}, {0x0DE3, 0x0BA3}, {0x0DC2, 0x0BA3}, {0x0E9A, 0x11E2}, {0x0C6F, 0x0BA3},
+    {0x0EB2, 0x0F1C}, {0x0D72, 0x0BA3}, {0x9154, 0x0CEF}, {0x0CA6, 0x0BA3}, {0x0EA4, 0x11E5}, {0x8A95, 0x0777},
+    {0x92E0, 0x0F18}, {0x92E4, 0x0F18}, {0x83AB, 0x0777}, {0x9158, 0x0CEF}, {0x0EB4, 0x0F22}, {0x8846, 0x0777},
+    {0x0DF0, 0x07E9}, {0x8FB8, 0x0777}, {0x0EB0, 0x11E6}, {0x915C, 0x0CEF}, {0x1154, 0x07E9}, {0x119B, 0x07E9},
+    {0x11A9, 0x07E9}, {0x11B8, 0x07E9}, {0x0E02, 0x0BA3}, {0x0959, 0x077B}, {0x0EB8, 0x0F2C}, {0x81EC, 0x0F19},
+    {0x83A5, 0x0771}, {0x85B4, 0x0771}, {0x8029, 0x0771}, {0x81F0, 0x0F19}, {0x8FED, 0x0777}, {0x92F0, 0x0F28},
+    {0x096F, 0x076D}, {0x8849, 0x0777}, {0x0CC8, 0x0BA3}, {0x92F4, 0x0F28}, {0x8FF3, 0x0777}, {0x92E8, 0x0F1E},
+    {0x907D, 0x0771}, {0x81F4, 0x0F19}, {0x92EC, 0x0F1E}, {0x0A5E, 0x076B}, {0x83AB, 0x0777}, {0x85B7, 0x0777},
+    {0x8033, 0x0777}, {0x884C, 0x0777}, {0x92F8, 0x0F34}, {0x8FB8, 0x0777}, {0x9204, 0x0EBB}, {0x9086, 0x0777},
+    {0x9208, 0x0EBB}, {0x920C, 0x0EBB}, {0x0ECD, 0x11F5}, {0x0F52, 0x0F50}, {0x0ED0, 0x1206}, {0x9210, 0x0EBB},
+    {0x0ED8, 0x0F52}, {0x81F8, 0x0F19}, {0x84E5, 0x0771}, {0x8843, 0x0777}, {0x92B0, 0x0F54}, {0x81FC, 0x0F19},
+    {0x8FED, 0x0777}, {0x8FF0, 0x0777}, {0x0EDA, 0x1210}, {0x884F, 0x0777}, {0x0EA8, 0x0F5C}, {0x8852, 0x0777},
+    {0x8FF3, 0x0777}, {0x8856, 0x0777}, {0x876D, 0x077D}, {0x8200, 0x0F19}, {0x92FC, 0x0F5E}, {0x0EE7, 0x1212},
+    {0x84EB, 0x0777}, {0x81D9, 0x077D}, {0x1014, 0x07E9}, {0x101E, 0x07E9}, {0x884F, 0x077D}, {0x0EB0, 0x0F65},
+    {0x8A98, 0x077D}, {0x85BA, 0x077D}, {0x9300, 0x0F6B}, {0x8EC5, 0x077D}, {0x9108, 0x0C7F}, {0x910C, 0x0C7F},
+    {0x9110, 0x0C7F}, {0x0EEF, 0x1229}, {0x0EE7, 0x0F73}, {0x9304, 0x0F74}, {0x0EF3, 0x122B}, {0x9114, 0x0C7F},
+    {0x0EE9, 0x0F76}, {0x9308, 0x0F78}, {0x0EFA, 0x123C}, {0x8A98, 0x077D}, {0x9118, 0x0C7F}, {0x911C, 0x0C7F},
+    {0x83B1, 0x077D}, {0x0EE3, 0x0F7A}, {0x0EFD, 0x123E}, {0x863F, 0x077D}, {0x0EDB, 0x0F80}, {0x9120, 0x0C7F},
+    {0x9318, 0x0F82}, {0x8642, 0x077D}, {0x9124, 0x0C7F}, {0x8645, 0x077D}, {0x931C, 0x0F82}, {0x8648, 0x077D},
+    {0x9128, 0x0C7F}, {0x912C, 0x0C7F}, {0x930C, 0x0F7F}, {0x0F0D, 0x1240}, {0x9130, 0x0C7F}, {0x864B, 0x077D},
+    {0x9320, 0x0F82}, {0x9310, 0x0F7F}, {0x0F04, 0x0F8D}, {0x8304, 0x0C8B}, {0x8308, 0x0C8B}, {0x864E, 0x077D},
+    {0x0F12, 0x1242}, {0x0F1F, 0x0F96}, {0x9314, 0x0F7F}, {0x0F18, 0x1244}, {0x099C, 0x0771}, {0x830C, 0x0C8B},
+    {0x8310, 0x0C8B}, {0x1007, 0x0F99}, {0x83B1, 0x077D}, {0x85BA, 0x077D}, {0x8036, 0x077D}, {0x8651, 0x077D},
+    {0x0F21, 0x1245}, {0x8314, 0x0C8B}, {0x8318, 0x0C8B}, {0x8654, 0x077D}, {0x0EF3, 0x0FA2}, {0x8657, 0x077D},
+    {0x9344, 0x0FA6}, {0x865A, 0x077D}, {0x0A39, 0x0777}, {0x8EC8, 0x077E}, {0x831C, 0x0C8B}, {0x9324, 0x0F92},
+    {0x0F2B, 0x1248}, {0x865D, 0x077D}, {0x0F58, 0x0FAE}, {0x0F31, 0x1249}, {0x9328, 0x0F92}, {0x8320, 0x0C8B},
+    {0x8324, 0x0C8B}, {0x8660, 0x077D}, {0x0FD4, 0x0FB1}, {0x932C, 0x0F92}, {0x0F35, 0x124A}, {0x9330, 0x0F92},
+    {0x0F25, 0x0FB8}, {0x8328, 0x0C8B}, {0x832C, 0x0C8B}, {0x88AE, 0x077E}, {0x84EE, 0x077D}, {0x88B1, 0x077E},
+    {0x88B4, 0x077E}, {0x88B7, 0x077E}, {0x0F41, 0x124D}, {0x88BA, 0x077E}, {0x88BD, 0x077E}, {0x88C0, 0x077E},
+    {0x1081, 0x0FC2}, {0x88C3, 0x077E}, {0x9334, 0x0F97}, {0x0F47, 0x124E}, {0x88C9, 0x077E}, {0x88CC, 0x077E},
+    {0x0F60, 0x0FC9}, {0x9338, 0x0F97}, {0x88CF, 0x077E}, {0x88D2, 0x077E}, {0x88D5, 0x077E}, {0x88D8, 0x077E},
+    {0x9264, 0x0F51}, {0x0F52, 0x124F}, {0x933C, 0x0F97}, {0x9268, 0x0F51}, {0x88DB, 0x077E}, {0x0F2E, 0x0FD3},
+    {0x9390, 0x0FBA}, {0x926C, 0x0F51}, {0x9380, 0x0FBA}, {0x9248, 0x0F51}, {0x93BC, 0x0FD7}, {0x88DE, 0x077E},
+    {0x9270, 0x0F51}, {0x88E1, 0x077E}, {0x88E4, 0x077E}, {0x88E7, 0x077E}, {0x0F6E, 0x1250}, {0x88EA, 0x077E},
+    {0x88ED, 0x077E}, {0x88F0, 0x077E}, {0x88F3, 0x077E}, {0x88F6, 0x077E}, {0x8EBC, 0x077E}, {0x93D4, 0x0FF4},
+    {0x88FC, 0x077E}, {0x88FF, 0x077E}, {0x0F74, 0x1247}, {0x0BAE, 0x0786}, {0x8902, 0x077E}, {0x8905, 0x077E},
+    {0x8908, 0x077E}, {0x890B, 0x077E}, {0x8EE1, 0x0786}, {0x0F9C, 0x0FE2}, {0x0F4B, 0x0FE2}, {0x93E4, 0x0FFA},
+    {0x890E, 0x077E}, {0x0F9B, 0x1251}, {0x9094, 0x077E}, {0x0F64, 0x0FEC}, {0x0F57, 0x0FEC}, {0x9360, 0x0FB0},
+    {0x9364, 0x0FB0}, {0x8542, 0x0B39}, {0x8546, 0x0B39}, {0x9368, 0x0FB0}, {0x93F4, 0x1022}, {0x936C, 0x0FB0},
+    {0x0A68, 0x077D}, {0x84C3, 0x0786}, {0x0F84, 0x1253}, {0x854A, 0x0B39}, {0x854E, 0x0B39}, {0x84C6, 0x0786},
+    {0x93E8, 0x1021}, {0x93D8, 0x0FF9}, {0x0F64, 0x1004}, {0x84CA, 0x0786}, {0x93F4, 0x100A}, {0x9370, 0x0FB0},
+    {0x93B0, 0x0FCC}, {0x93EC, 0x1021}, {0x84CD, 0x0786}, {0x84D0, 0x0786}, {0x93DC, 0x0FF9}, {0x93B4, 0x0FCC},
+    {0x0FA2, 0x1254}, {0x93B8, 0x0FCC}, {0x0F96, 0x1257}, {0x84D3, 0x0786}, {0x84D6, 0x0786}, {0x93E0, 0x0FF9},
+    {0x93F0, 0x1021}, {0x84DA, 0x0786}, {0x0FAC, 0x1016}, {0x8552, 0x0B39}, {0x8556, 0x0B39}, {0x0FAD, 0x1258},
+    {0x0CFC, 0x0786}, {0x0F60, 0x0FF7}, {0x0F59, 0x0FF7}, {0x84DE, 0x0786}, {0x0B03, 0x0786}, {0x855A, 0x0B39},
+    {0x855E, 0x0B39}, {0x84E1, 0x0786}, {0x0F99, 0x1014}, {0x0FAA, 0x1014}, {0x9408, 0x1029}, {0x84E5, 0x0786},
+    {0x940C, 0x1029}, {0x8562, 0x0B39}, {0x8566, 0x0B39}, {0x8250, 0x0C57}, {0x84E8, 0x0786}, {0x84EB, 0x0786},
+    {0x8E54, 0x0C57}, {0x10B4, 0x101F}, {0x11DD, 0x101F}, {0x856A, 0x0B39}, {0x856E, 0x0B39}, {0x84EE, 0x0786},
+    {0x84F1, 0x0786}, {0x0FBD, 0x1259}, {0x85D5, 0x1115}, {0x84F5, 0x0786}, {0x85FA, 0x1115}, {0x93C0, 0x0FF3},
+    {0x909F, 0x0786}, {0x93C4, 0x0FF3}, {0x90BF, 0x0786}, {0x93F8, 0x1028}, {0x09E5, 0x0786}, {0x0F8A, 0x1039},
+    {0x9420, 0x1043}, {0x93C8, 0x0FF3}, {0x8F94, 0x0C57}, {0x93FC, 0x1028}, {0x0FC8, 0x125A}, {0x873B, 0x0C57},
+    {0x93CC, 0x0FF3}, {0x85C3, 0x1115}, {0x85D8, 0x1115}, {0x873E, 0x0C57}, {0x0FA8, 0x1048}, {0x93D0, 0x0FF3},
+    {0x9454, 0x104E}, {0x8745, 0x0C57}, {0x85A4, 0x1115}, {0x9400, 0x1028}, {0x9414, 0x101C}, {0x9410, 0x1029},
+    {0x9404, 0x1028}, {0x8748, 0x0C57}, {0x0FD8, 0x125B}, {0x945C, 0x105F}, {0x85DB, 0x1115}, {0x9418, 0x101C},
+    {0x85FD, 0x1115}, {0x874B, 0x0C57}, {0x0FA9, 0x1058}, {0x0FD7, 0x1058}, {0x0FDE, 0x125C}, {0x8756, 0x0C57},
+    {0x9458, 0x104E}, {0x9438, 0x105E}, {0x0FAC, 0x1060}, {0x9460, 0x105E}, {0x9440, 0x1064}, {0x0FE8, 0x1260},
+    {0x90D3, 0x0C57}, {0x8759, 0x0C57}, {0x0FF8, 0x1261}, {0x85C6, 0x1115}, {0x85DE, 0x1115}, {0x875C, 0x0C57},
+    {0x0FE2, 0x1067}, {0x1009, 0x1067}, {0x0FF2, 0x1263}, {0x8763, 0x0C57}, {0x85BD, 0x1115}, {0x0BE3, 0x0C5E},
+    {0x0CBB, 0x0C5E}, {0x9374, 0x0FB6}, {0x9378, 0x0FB6}, {0x8766, 0x0C57}, {0x101E, 0x1070}, {0x937C, 0x0FB6},
+    {0x9380, 0x0FB6}, {0x0FFD, 0x1265}, {0x9384, 0x0FB6}, {0x876D, 0x0C57}, {0x0FD8, 0x106A}, {0x100D, 0x106A},
+    {0x0C56, 0x0C5E}, {0x8778, 0x0C57}, {0x9388, 0x0FB6}, {0x1009, 0x107B}, {0x0A0C, 0x0786}, {0x0C38, 0x0786},
+    {0x90D7, 0x0C57}, {0x9490, 0x107E}, {0x0A68, 0x0C57}, {0x938C, 0x0FB6}, {0x946C, 0x106E}, {0x9488, 0x106F},
+    {0x100F, 0x1239}, {0x0B84, 0x0C5E}, {0x949C, 0x107F}, {0x94A0, 0x107F}, {0x9390, 0x0FB6}, {0x9470, 0x106E},
+    {0x9494, 0x107E}, {0x8591, 0x0C5E}, {0x9498, 0x107E}, {0x0FEA, 0x108C}, {0x1012, 0x123A}, {0x8594, 0x0C5E},
+    {0x1082, 0x1096}, {0x8597, 0x0C5E}, {0x9474, 0x106E}, {0x859B, 0x0C5E}, {0x9478, 0x106E}, {0x947C, 0x106E},
+    {0x9480, 0x106E}, {0x101E, 0x1246}, {0x9484, 0x106E}, {0x859E, 0x0C5E}, {0x94C8, 0x1095}, {0x0A7D, 0x0786},
+    {0x0A3E, 0x0786}, {0x1028, 0x109F}, {0x94CC, 0x1095}, {0x85A1, 0x0C5E}, {0x9340, 0x0F9D}, {0x9344, 0x0F9D},
+    {0x94E0, 0x10A5}, {0x85A7, 0x0C5E}, {0x9348, 0x0F9D}, {0x934C, 0x0F9D}, {0x1032, 0x1255}, {0x9350, 0x0F9D},
+    {0x9354, 0x0F9D}, {0x94B8, 0x1083}, {0x94BC, 0x1083}, {0x85AA, 0x0C5E}, {0x948C, 0x106F}, {0x9358, 0x0F9D},
+    {0x0C5E, 0x0C63}, {0x85AD, 0x0C5E}, {0x1000, 0x10AE}, {0x85B0, 0x0C5E}, {0x947C, 0x10B8}, {0x85B4, 0x0C5E},
+    {0x935C, 0x0F9D}, {0x1038, 0x1264}, {0x101A, 0x10BD}, {0x0D38, 0x0C63}, {0x0B9D, 0x0C63}, {0x85B7, 0x0C5E},
+    {0x94BC, 0x10BE}, {0x0C27, 0x0C63}, {0x1048, 0x1268}, {0x94C0, 0x1083}, {0x94A4, 0x1078}, {0x85BA, 0x0C5E},
+    {0x94C4, 0x1083}, {0x94E4, 0x10CE}, {0x0A8F, 0x0C57}, {0x85C0, 0x0C5E}, {0x94A8, 0x1078}, {0x94AC, 0x1078},
+    {0x100F, 0x10C4}, {0x1026, 0x10C4}, {0x0B85, 0x0C5E}, {0x94E8, 0x10CF}, {0x0AB9, 0x0C5E}, {0x10D5, 0x0F68},
+    {0x1090, 0x1155}, {0x816D, 0x0C63}, {0x94B0, 0x1078}, {0x8170, 0x0C63}, {0x94B4, 0x1078}, {0x8173, 0x0C63},
+    {0x94EC, 0x1197}, {0x8176, 0x0C63}, {0x116E, 0x0F69}, {0x8179, 0x0C63}, {0x817C, 0x0C63}, {0x8180, 0x0C63},
+    {0x8184, 0x0C63}, {0x8187, 0x0C63}, {0x818B, 0x0C63}, {0x818E, 0x0C63}, {0x8191, 0x0C63}, {0x109E, 0x11EE},
+    {0x8195, 0x0C63}, {0x8198, 0x0C63}, {0x94F8, 0x1230}, {0x819B, 0x0C63}, {0x0BD7, 0x0C57}, {0x81A1, 0x0C63},
+    {0x105A, 0x115A}, {0x81A5, 0x0C63}, {0x81A8, 0x0C63}, {0x9504, 0x10EC}, {0x105C, 0x11C1}, {0x9508, 0x10F0},
+    {0x0E19, 0x0C63}, {0x0CC7, 0x0C63}, {0x90A3, 0x1141}, {0x81AB, 0x0C63}, {0x0C4C, 0x0C63}, {0x81AE, 0x0C63},
+    {0x1065, 0x117D}, {0x81B1, 0x0C63}, {0x950C, 0x10F8}, {0x81B4, 0x0C63}, {0x94EC, 0x10D3}, {0x81B7, 0x0C63},
+    {0x81BA, 0x0C63}, {0x81BE, 0x0C63}, {0x81C2, 0x0C63}, {0x81C5, 0x0C63}, {0x81C9, 0x0C63}, {0x81CC, 0x0C63},
+    {0x81CF, 0x0C63}, {0x1073, 0x11CB}, {0x81D3, 0x0C63}, {0x81D6, 0x0C63}, {0x9510, 0x1105}, {0x81D9, 0x0C63},
+    {0x1057, 0x1279}, {0x81DF, 0x0C63}, {0x8E92, 0x1142}, {0x81E3, 0x0C63}, {0x81E6, 0x0C63}, {0x9514, 0x110A},
+    {0x94F0, 0x10D4}, {0x94EC, 0x10D4}, {0x0D99, 0x0C63}, {0x94F4, 0x10D4}, {0x0AD7, 0x0C63}, {0x0FB6, 0x0C5E},
+    {0x8E96, 0x1144}, {0x90A7, 0x1143}, {0x81EC, 0x1157}, {0x0B6F, 0x0C5E}, {0x0CFD, 0x0C5E}, {0x825B, 0x1157},
+    {0x8282, 0x1157}, {0x8271, 0x1157}, {0x94FC, 0x10E5}, {0x94F8, 0x10E5}, {0x81F0, 0x1157}, {0x9500, 0x10E5},
+    {0x9394, 0x0FC6}, {0x108F, 0x11CA}, {0x9518, 0x1123}, {0x8253, 0x1157}, {0x9398, 0x0FC6}, {0x939C, 0x0FC6},
+    {0x93A0, 0x0FC6}, {0x93A4, 0x0FC6}, {0x81F4, 0x1157}, {0x8216, 0x1157}, {0x90DB, 0x11B8}, {0x94D0, 0x1098},
+    {0x8279, 0x1157}, {0x93A8, 0x0FC6}, {0x10A2, 0x11D8}, {0x94D4, 0x1098}, {0x819E, 0x1157}, {0x0B86, 0x0C5E},
+    {0x0B09, 0x0C5E}, {0x94F0, 0x10D3}, {0x93AC, 0x0FC6}, {0x951C, 0x1130}, {0x81F8, 0x1157}, {0x94D8, 0x1098},
+    {0x94DC, 0x1098}, {0x825E, 0x1157}, {0x8285, 0x1157}, {0x8275, 0x1157}, {0x1087, 0x127E}, {0x9520, 0x113E},
+    {0x81FC, 0x1157}, {0x1078, 0x1267}, {0x10DF, 0x1267}, {0x109B, 0x1267}, {0x10E9, 0x1267}, {0x8257, 0x1157},
+    {0x9035, 0x1280}, {0x9031, 0x127C}, {0x82C4, 0x0C8A}, {0x82C8, 0x0C8A}, {0x8200, 0x1157}, {0x8230, 0x1157},
+    {0x1095, 0x1281}, {0x9524, 0x114C}, {0x827C, 0x1157}, {0x90DF, 0x11CD}, {0x82CC, 0x0C8A}, {0x82D0, 0x0C8A},
+    {0x81DC, 0x1157}, {0x94F4, 0x10D3}, {0x9528, 0x118E}, {0x1008, 0x10D3}, {0x0B70, 0x0C63}, {0x1096, 0x0C63},
+    {0x82D4, 0x0C8A}, {0x82D8, 0x0C8A}, {0x105E, 0x1141}, {0x9534, 0x1194}, {0x941C, 0x1033}, {0x9538, 0x119D},
+    {0x9420, 0x1033}, {0x9424, 0x1033}, {0x82DC, 0x0C8A}, {0x82E0, 0x0C8A}, {0x9428, 0x1033}, {0x942C, 0x1033},
+    {0x90AB, 0x127C}, {0x952C, 0x1190}, {0x9530, 0x1190}, {0x10BE, 0x1299}, {0x82E4, 0x0C8A}, {0x82E8, 0x0C8A},
+    {0x9039, 0x128E}, {0x9430, 0x1033}, {0x9434, 0x1033}, {0x9438, 0x1033}, {0x943C, 0x1033}, {0x9440, 0x1033},
+    {0x82EC, 0x0C8A}, {0x82F0, 0x0C8A}, {0x90AF, 0x127D}, {0x9444, 0x1033}, {0x90C7, 0x127D}, {0x0BCE, 0x0C63},
+    {0x953C, 0x1167}, {0x10CC, 0x129B}, {0x82F4, 0x0C8A}, {0x82F8, 0x0C8A}, {0x8A2D, 0x0C67}, {0x8A30, 0x0C67},
+    {0x8A34, 0x0C67}, {0x106A, 0x1143}, {0x8A37, 0x0C67}, {0x8A3A, 0x0C67}, {0x82FC, 0x0C8A}, {0x8300, 0x0C8A},
+    {0x8A3E, 0x0C67}, {0x8A41, 0x0C67}, {0x9540, 0x1177}, {0x8A44, 0x0C67}, {0x8F51, 0x1187}, {0x10DE, 0x11F0},
+    {0x9544, 0x118D}, {0x8A47, 0x0C67}, {0x8A4A, 0x0C67}, {0x8A4D, 0x0C67}, {0x90CB, 0x129D}, {0x10F3, 0x11F0},
+    {0x10AB, 0x11ED}, {0x8F51, 0x1193}, {0x10C1, 0x11ED}, {0x9548, 0x1199}, {0x110E, 0x129F}, {0x10E8, 0x11FC},
+    {0x10C6, 0x11ED}, {0x94F8, 0x10DC}, {0x1108, 0x1192}, {0x1026, 0x10D3}, {0x90CF, 0x129E}, {0x10FC, 0x11FC},
+    {0x8A50, 0x0C67}, {0x8A53, 0x0C67}, {0x8A57, 0x0C67}, {0x10D2, 0x11ED}, {0x8A5A, 0x0C67}, {0x8A5D, 0x0C67},
+    {0x9528, 0x1196}, {0x90B3, 0x12A0}, {0x8A61, 0x0C67}, {0x8A64, 0x0C67}, {0x0BB4, 0x07E8}, {0x8A67, 0x0C67},
+    {0x0BD3, 0x07E8}, {0x0C1B, 0x07E8}, {0x0C18, 0x07E8}, {0x8A6A, 0x0C67}, {0x8A6D, 0x0C67}, {0x8A70, 0x0C67},
+    {0x0C34, 0x07E8}, {0x0C7E, 0x07E8}, {0x0D3F, 0x11BE}, {0x0D2E, 0x07E8}, {0x0D5B, 0x11BE}, {0x0CD8, 0x07E8},
+    {0x0CBC, 0x07E8}, {0x0D1F, 0x07E8}, {0x10FE, 0x12B2}, {0x0DCD, 0x07E8}, {0x954C, 0x11B4}, {0x0D65, 0x07E8},
+    {0x1084, 0x127D}, {0x1103, 0x1285}, {0x0D7B, 0x11BE}, {0x9550, 0x11B9}, {0x1108, 0x128A}, {0x0D66, 0x07E8},
+    {0x111E, 0x07E8}, {0x0D86, 0x11BE}, {0x9554, 0x11BC}, {0x1062, 0x1142}, {0x110B, 0x128F}, {0x9558, 0x11C2},
+    {0x0D9D, 0x11BE}, {0x1131, 0x124B}, {0x955C, 0x11C5}, {0x1114, 0x12B4}, {0x903D, 0x12A2}, {0x0DA4, 0x11BE},
+    {0x1095, 0x127C}, {0x1077, 0x1144}, {0x9560, 0x11C7}, {0x10A7, 0x128E}, {0x94FC, 0x10DC}, {0x111A, 0x12B5},
+    {0x0DAC, 0x11BE}, {0x0DB0, 0x11BE}, {0x9564, 0x11CF}, {0x0DB4, 0x11BE}, {0x0DD1, 0x0F2E}, {0x0DB9, 0x11BE},
+    {0x0DD9, 0x0F2E}, {0x0DDB, 0x0F2E}, {0x10A2, 0x127D}, {0x0DDF, 0x0F2E}, {0x0DE7, 0x0F2E}, {0x0DF1, 0x0F2E},
+    {0x0DFA, 0x0F2E}, {0x0E12, 0x0F2E}, {0x0E18, 0x0F2E}, {0x0E26, 0x0F2E}, {0x0E31, 0x0F2E}, {0x112B, 0x12B8},
+    {0x0E3B, 0x0F2E}, {0x9568, 0x11E1}, {0x112F, 0x12B9}, {0x0E41, 0x0F2E}, {0x0E4B, 0x0F2E}, {0x956C, 0x11E4},
+    {0x9234, 0x0ED3}, {0x1143, 0x12BC}, {0x9238, 0x0ED3}, {0x923C, 0x0ED3}, {0x9500, 0x10DC}, {0x1106, 0x128E},
+    {0x1019, 0x10DC}, {0x9240, 0x0ED3}, {0x10FF, 0x129D}, {0x9244, 0x0ED3}, {0x9248, 0x0ED3}, {0x924C, 0x0ED3},
+    {0x9250, 0x0ED3}, {0x0E6F, 0x0F2E}, {0x9254, 0x0ED3}, {0x92B4, 0x0F0D}, {0x9258, 0x0ED3}, {0x925C, 0x0ED3},
+    {0x92B8, 0x0F0D}, {0x9570, 0x11E9}, {0x110B, 0x129E}, {0x92BC, 0x0F0D}, {0x92C0, 0x0F0D}, {0x1149, 0x12BD},
+    {0x92C4, 0x0F0D}, {0x9574, 0x11FF}, {0x92C8, 0x0F0D}, {0x92CC, 0x0F0D}, {0x1151, 0x12BE}, {0x92D0, 0x0F0D},
+    {0x0E71, 0x0F2E}, {0x92D4, 0x0F0D}, {0x92D8, 0x0F0D}, {0x9578, 0x1204}, {0x1153, 0x12BF}, {0x957C, 0x120A},
+    {0x9045, 0x12A8}, {0x9041, 0x12A7}, {0x1157, 0x12AB}, {0x9580, 0x120E}, {0x0E7B, 0x0F2E}, {0x115C, 0x12AC},
+    {0x0E84, 0x0F2E}, {0x9260, 0x0ED3}, {0x9584, 0x1211}, {0x9264, 0x0ED3}, {0x9274, 0x0EF8}, {0x9268, 0x0ED3},
+    {0x9278, 0x0EF8}, {0x927C, 0x0EF8}, {0x926C, 0x0ED3}, {0x9280, 0x0EF8}, {0x9284, 0x0EF8}, {0x9288, 0x0EF8},
+    {0x9270, 0x0ED3}, {0x928C, 0x0EF8}, {0x9290, 0x0EF8}, {0x9294, 0x0EF8}, {0x9298, 0x0EF8}, {0x1174, 0x12B6},
+    {0x929C, 0x0EF8}, {0x92A0, 0x0EF8}, {0x92A4, 0x0EF8}, {0x92A8, 0x0EF8}, {0x92AC, 0x0EF8}, {0x0E92, 0x0F2F},
+    {0x90B7, 0x12A7}, {0x0E95, 0x0F2F}, {0x9588, 0x1223}, {0x1176, 0x12B7}, {0x958C, 0x122D}, {0x90E3, 0x1232},
+    {0x1034, 0x10DC}, {0x119D, 0x1252}, {0x1187, 0x12C9}, {0x1192, 0x1252}, {0x92B0, 0x0EF8}, {0x952C, 0x1231},
+    {0x90EB, 0x1232}, {0x9590, 0x1233}, {0x9049, 0x12CA}, {0x0FAB, 0x0F31}, {0x0FB5, 0x0F31}, {0x11A7, 0x12BB},
+    {0x0E99, 0x0F2F}, {0x119D, 0x12BB}, {0x0E9F, 0x0F2F}, {0x9530, 0x123B}, {0x0EAC, 0x0F2F}, {0x9590, 0x123D},
+    {0x0EB5, 0x0F2F}, {0x1194, 0x12CD}, {0x0EB8, 0x0F2F}, {0x0EC1, 0x0F2F}, {0x0FBE, 0x0F31}, {0x0F0B, 0x0F30},
+    {0x0ECD, 0x0F2F}, {0x0ED0, 0x0F2F}, {0x0ED7, 0x0F2F}, {0x1137, 0x12A2}, {0x9594, 0x1243}, {0x0EE1, 0x0F2F},
+    {0x0EE8, 0x0F2F}, {0x0EF2, 0x0F2F}, {0x0F01, 0x0F2F}, {0x0F16, 0x0F30}, {0x11A9, 0x12C9}, {0x0F23, 0x0F30},
+    {0x0F33, 0x0F30}, {0x0FCD, 0x0F31}, {0x11AA, 0x12CE}, {0x0F35, 0x0F30}, {0x0F3E, 0x0F30}, {0x0F58, 0x0F30},
+    {0x0F67, 0x0F30}, {0x0F77, 0x0F30}, {0x0F7F, 0x0F30}, {0x9448, 0x1034}, {0x944C, 0x1034}, {0x9450, 0x1034},
+    {0x0F86, 0x0F30}, {0x0F89, 0x0F30}, {0x9598, 0x1256}, {0x0F8F, 0x0F30}, {0x0FDC, 0x0F31}, {0x0F9A, 0x0F30},
+    {0x11B5, 0x12D0}, {0x10B1, 0x07EA}, {0x0FE3, 0x0F31}, {0x11F6, 0x07EA}, {0x1202, 0x07EA}, {0x1225, 0x07EA},
+    {0x11FB, 0x07EA}, {0x959C, 0x1266}, {0x11D6, 0x07EA}, {0x11FE, 0x07EA}, {0x11B9, 0x12D7}, {0x95A0, 0x1270},
+    {0x11BB, 0x12D8}, {0x95A4, 0x1272}, {0x11BD, 0x12D9}, {0x95A8, 0x1274}, {0x11C3, 0x12DA}, {0x9454, 0x1034},
+    {0x1219, 0x07EA}, {0x103E, 0x1269}, {0x9458, 0x1034}, {0x95AC, 0x1276}, {0x10E8, 0x1269}, {0x10F6, 0x1269},
+    {0x1072, 0x1269}, {0x1225, 0x126C}, {0x10E7, 0x1269}, {0x1080, 0x1269}, {0x945C, 0x1034}, {0x9460, 0x1034},
+    {0x904D, 0x127F}, {0x10ED, 0x126A}, {0x11F2, 0x1307}, {0x95B0, 0x1286}, {0x9464, 0x1034}, {0x122E, 0x126E},
+    {0x10F0, 0x126A}, {0x1232, 0x126E}, {0x1214, 0x07EA}, {0x9051, 0x1289}, {0x110B, 0x1269}, {0x10F6, 0x126A},
+    {0x1233, 0x126E}, {0x9055, 0x128B}, {0x9059, 0x1290}, {0x12A4, 0x126F}, {0x90EF, 0x1367}, {0x121D, 0x1386},
+    {0x9468, 0x1034}, {0x123D, 0x1386}, {0x11FC, 0x1386}, {0x109B, 0x1269}, {0x121D, 0x1386}, {0x10AB, 0x1269},
+    {0x955C, 0x1298}, {0x110E, 0x1269}, {0x111A, 0x1269}, {0x10B0, 0x1269}, {0x1125, 0x1269}, {0x95B0, 0x129A},
+    {0x1169, 0x126A}, {0x95B4, 0x12A6}, {0x1298, 0x1278}, {0x90E7, 0x135A}, {0x1218, 0x1386}, {0x11AE, 0x126B},
+    {0x11AD, 0x126B}, {0x9538, 0x12BA}, {0x95B4, 0x12C0}, {0x1142, 0x126B}, {0x1145, 0x126B}, {0x9504, 0x1295},
+    {0x9508, 0x1295}, {0x950C, 0x1295}, {0x9510, 0x1295}, {0x11E7, 0x128C}, {0x10E8, 0x1269}, {0x1209, 0x12B1},
+    {0x10FB, 0x126A}, {0x1103, 0x126A}, {0x1157, 0x126B}, {0x1161, 0x126B}, {0x1115, 0x126A}, {0x1118, 0x126A},
+    {0x1211, 0x137A}, {0x11B3, 0x12CA}, {0x111D, 0x126A}, {0x1133, 0x126A}, {0x1138, 0x126A}, {0x113E, 0x126A},
+    {0x1215, 0x137A}, {0x95B8, 0x12B3}, {0x8E58, 0x12A4}, {0x9518, 0x1297}, {0x951C, 0x1297}, {0x8E9A, 0x12A4},
+    {0x8EB2, 0x12A4}, {0x124C, 0x07F8}, {0x122F, 0x12E6}, {0x1170, 0x126B}, {0x11D9, 0x126B}, {0x8B6B, 0x1293},
+    {0x124A, 0x12C8}, {0x1177, 0x126B}, {0x118A, 0x126B}, {0x122F, 0x12CC}, {0x119A, 0x126B}, {0x124F, 0x12C7},
+    {0x1231, 0x12C7}, {0x8ED9, 0x1293}, {0x95BC, 0x12CF}, {0x9534, 0x1297}, {0x123E, 0x12E7}, {0x11A4, 0x126B},
+    {0x11A6, 0x126B}, {0x11A8, 0x126B}, {0x11AA, 0x126B}, {0x1257, 0x12D6}, {0x1238, 0x12DB}, {0x95C1, 0x12DC},
+    {0x8F3A, 0x1293}, {0x124B, 0x12EE}, {0x8F55, 0x1293}, {0x8F89, 0x1293}, {0x8F98, 0x1293}, {0x8FA7, 0x1293},
+    {0x9544, 0x1297}, {0x9548, 0x1297}, {0x11D8, 0x12D1}, {0x11E6, 0x12D1}, {0x1264, 0x12DF}, {0x1241, 0x12E8},
+    {0x1205, 0x12D2}, {0x120A, 0x12D2}, {0x120E, 0x12D2}, {0x1214, 0x12D2}, {0x11EF, 0x12D1}, {0x95C6, 0x12E9},
+    {0x95CB, 0x12E9}, {0x95D0, 0x12E9}, {0x95D5, 0x12E9}, {0x95DA, 0x12E9}, {0x9025, 0x12A4}, {0x1259, 0x12EA},
+    {0x1273, 0x12F5}, {0x905D, 0x12A4}, {0x1254, 0x12F6}, {0x95DF, 0x12F8}, {0x125E, 0x12EB}, {0x1277, 0x12FA},
+    {0x1258, 0x12FB}, {0x95E4, 0x12FC}, {0x1262, 0x12EC}, {0x127C, 0x12FE}, {0x9021, 0x1293}, {0x1254, 0x12FF},
+    {0x95E9, 0x1301}, {0x95EE, 0x1301}, {0x1268, 0x12ED}, {0x1281, 0x1304}, {0x125A, 0x1305}, {0x11F8, 0x127F},
+    {0x95F3, 0x1306}, {0x95F8, 0x1306}, {0x0000, 0xFFFF}, {0x0000, 0xFFFF}, {0x0000, 0xFFFF}, {0x0000, 0xFFFF},
+    {0x0000, 0xFFFF}, {0x0000, 0xFFFF}, {0x0000, 0xFFFF}, {0x0000, 0xFFFF}, {0x0000, 0xFFFF}, {0x0000, 0xFFFF},
+    {0x90BB, 0x12A4}, {0x0000, 0xFFFF}, {0x0000, 0xFFFF}, {0x0000, 0xFFFF}, {0x0000, 0xFFFF}, {0x0000, 0xFFFF},
+    {0x0000, 0xFFFF}, {0x0000, 0xFFFF}, {0x0000, 0xFFFF}, {0x0000, 0xFFFF}, {0x0000, 0xFFFF}, {0x0000, 0xFFFF},
+    {0x0000, 0xFFFF}, {0x0000, 0xFFFF}, {0x0000, 0xFFFF}, {0x0000, 0xFFFF}, {0x0000, 0xFFFF}, {0x0000, 0xFFFF},
+    {0x0000, 0xFFFF}, {0x0000, 0xFFFF}, {0x0000, 0xFFFF}, {0x0000, 0xFFFF}, {0x0000, 0xFFFF}, {0x0000, 0xFFFF},
+    {0x0000, 0xFFFF}, {0x0000, 0xFFFF}, {0x0000, 0xFFFF}, {0x0000, 0xFFFF}, {0x0000, 0xFFFF}, {0x0000, 0xFFFF},
+    {0x0000, 0xFFFF}, {0x0000, 0xFFFF}, {0x0000, 0xFFFF}, {0x0000, 0xFFFF}, {0x0000, 0xFFFF}, {0x0000, 0xFFFF},
+    {0x0000, 0xFFFF}, {0x0000, 0xFFFF}, {0x0000, 0xFFFF}, {0x0000, 0xFFFF}, {0x0000, 0xFFFF}, {0x0000, 0xFFFF},
+    {0x0000, 0xFFFF}, {0x0000, 0xFFFF}, {0x0000, 0xFFFF}, {0x0000, 0xFFFF}, {0x0000, 0xFFFF}, {0x0000, 0xFFFF},
+    {0x0000, 0xFFFF}, {0x0000, 0xFFFF}, {0x0000, 0xFFFF}, {0x0000, 0xFFFF}, {0x0000, 0xFFFF}, {0x0000, 0xFFFF},
+    {0x0000, 0xFFFF}, {0x0000, 0xFFFF}, {0x0000, 0xFFFF}, {0x0000, 0xFFFF}, {0x0000, 0xFFFF}, {0x0000, 0xFFFF},
+    {0x0000, 0xFFFF}, {0x0000, 0xFFFF}, {0x0000, 0xFFFF}, {0x0000, 0xFFFF}, {0x0000, 0xFFFF}, {0x0000, 0xFFFF},
+    {0x0000, 0xFFFF}, {0x0000, 0xFFFF}, {0x0000, 0xFFFF}, {0x0000, 0xFFFF}, {0x11FD, 0x12A4}, {0x0000, 0xFFFF},
+    {0x0000, 0xFFFF}, {0x0000, 0xFFFF}, {0x0000, 0xFFFF}, {0x0000, 0xFFFF}, {0x0000, 0xFFFF}, {0x0000, 0xFFFF},
+    {0x0000, 0xFFFF}, {0x0000, 0xFFFF}, {0x0000, 0xFFFF}, {0x0000, 0xFFFF}, {0x0000, 0xFFFF}, {0x11DD, 0x1293},
+    {0x0000, 0xFFFF}, {0x0000, 0xFFFF}, {0x0000, 0xFFFF}, {0x0000, 0xFFFF}, {0x0000, 0xFFFF}, {0x0000, 0xFFFF},
+    {0x0000, 0xFFFF}, {0x0000, 0xFFFF}, {0x0000, 0xFFFF}, {0x0000, 0xFFFF}, {0x0000, 0xFFFF}, {0x0000, 0xFFFF},
+    {0x0000, 0xFFFF}, {0x0000, 0xFFFF}, {0x0000, 0xFFFF}, {0x0000, 0xFFFF}, {0x0000, 0xFFFF}, {0x0000, 0xFFFF},
+    {0x1232, 0x12A4}, {0x0000, 0xFFFF}, {0x0000, 0xFFFF}, {0x0000, 0xFFFF}, {0x0000, 0xFFFF}, {0x0000, 0xFFFF},
+    {0x0000, 0xFFFF}, {0x0000, 0xFFFF}, {0x0000, 0xFFFF}, {0x0000, 0xFFFF}, {0x0000, 0xFFFF}, {0x0000, 0xFFFF},
+    {0x120F, 0x1293}, {0x0000, 0xFFFF}, {0x0000, 0xFFFF}, {0x0000, 0xFFFF}, {0x0000, 0xFFFF}, {0x0000, 0xFFFF},
+    {0x0000, 0xFFFF}, {0x0000, 0xFFFF}, {0x0000, 0xFFFF}, {0x0000, 0xFFFF}, {0x0000, 0xFFFF}, {0x0000, 0xFFFF},
+    {0x0000, 0xFFFF}, {0x0000, 0xFFFF}, {0x0000, 0xFFFF}, {0x0000, 0xFFFF}, {0x0000, 0xFFFF}, {0x0000, 0xFFFF},
+    {0x0000, 0xFFFF}, {0x0000, 0xFFFF}, {0x0000, 0xFFFF}, {0x0000, 0xFFFF}, {0x0000, 0xFFFF}, {0x0000, 0xFFFF},
+    {0x0000, 0xFFFF}, {0x0000, 0xFFFF}, {0x0000, 0xFFFF}, {0x0000, 0xFFFF}, {0x0000, 0xFFFF}, {0x0000, 0xFFFF},
+};
+
+const size_t caneta_compose_node_count = 5028;
+
+const uint8_t caneta_compose_results[] = {
+    0x01, 0x60, 0x02, 0xC3, 0x80, 0x02, 0xC3, 0x88, 0x02, 0xC3, 0x8C, 0x03,
+    0x4D, 0xCC, 0x80, 0x02, 0xC7, 0xB8, 0x02, 0xC3, 0x92, 0x02, 0xC3, 0x99,
+    0x02, 0xC7, 0x9B, 0x03, 0xE1, 0xBA, 0x80, 0x03, 0xE1, 0xBB, 0xB2, 0x02,
+    0xC3, 0xA0, 0x02, 0xC3, 0xA8, 0x02, 0xC3, 0xAC, 0x03, 0x6D, 0xCC, 0x80,
+    0x02, 0xC7, 0xB9, 0x02, 0xC3, 0xB2, 0x02, 0xC3, 0xB9, 0x02, 0xC7, 0x9C,
+    0x03, 0xE1, 0xBA, 0x81, 0x03, 0xE1, 0xBB, 0xB3, 0x03, 0xE1, 0xBA, 0xA6,
+    0x03, 0xE1, 0xBB, 0x80, 0x03, 0xE1, 0xBB, 0x92, 0x03, 0xE1, 0xBA, 0xA7,
+    0x03, 0xE1, 0xBB, 0x81, 0x03, 0xE1, 0xBB, 0x93, 0x05, 0x41, 0xCC, 0x83,
+    0xCC, 0x80, 0x05, 0x45, 0xCC, 0x83, 0xCC, 0x80, 0x05, 0x49, 0xCC, 0x83,
+    0xCC, 0x80, 0x05, 0x4F, 0xCC, 0x83, 0xCC, 0x80, 0x05, 0x55, 0xCC, 0x83,
+    0xCC, 0x80, 0x05, 0x61, 0xCC, 0x83, 0xCC, 0x80, 0x05, 0x65, 0xCC, 0x83,
+    0xCC, 0x80, 0x05, 0x69, 0xCC, 0x83, 0xCC, 0x80, 0x05, 0x6F, 0xCC, 0x83,
+    0xCC, 0x80, 0x05, 0x75, 0xCC, 0x83, 0xCC, 0x80, 0x03, 0xE1, 0xB8, 0x94,
+    0x03, 0xE1, 0xB9, 0x90, 0x03, 0xE1, 0xB8, 0x95, 0x03, 0xE1, 0xB9, 0x91,
+    0x03, 0xE1, 0xBA, 0xB0, 0x03, 0xE1, 0xBA, 0xB1, 0x03, 0xE1, 0xBB, 0x9C,
+    0x03, 0xE1, 0xBB, 0xAA, 0x03, 0xE1, 0xBB, 0x9D, 0x03, 0xE1, 0xBB, 0xAB,
+    0x02, 0xCC, 0x80, 0x04, 0xC6, 0x86, 0xCC, 0x80, 0x04, 0xC6, 0x8E, 0xCC,
+    0x80, 0x04, 0xC6, 0x90, 0xCC, 0x80, 0x04, 0xC6, 0x96, 0xCC, 0x80, 0x04,
+    0xC6, 0xB1, 0xCC, 0x80, 0x04, 0xC6, 0xB2, 0xCC, 0x80, 0x04, 0xC7, 0x9D,
+    0xCC, 0x80, 0x04, 0xC9, 0x94, 0xCC, 0x80, 0x04, 0xC9, 0x9B, 0xCC, 0x80,
+    0x04, 0xC9, 0xA9, 0xCC, 0x80, 0x04, 0xCA, 0x8A, 0xCC, 0x80, 0x04, 0xCA,
+    0x8B, 0xCC, 0x80, 0x03, 0xE1, 0xBC, 0x82, 0x03, 0xE1, 0xBC, 0x83, 0x03,
+    0xE1, 0xBC, 0x8A, 0x03, 0xE1, 0xBC, 0x8B, 0x03, 0xE1, 0xBC, 0x92, 0x03,
+    0xE1, 0xBC, 0x93, 0x03, 0xE1, 0xBC, 0x9A, 0x03, 0xE1, 0xBC, 0x9B, 0x03,
+    0xE1, 0xBC, 0xA2, 0x03, 0xE1, 0xBC, 0xA3, 0x03, 0xE1, 0xBC, 0xAA, 0x03,
+    0xE1, 0xBC, 0xAB, 0x03, 0xE1, 0xBC, 0xB2, 0x03, 0xE1, 0xBC, 0xB3, 0x03,
+    0xE1, 0xBC, 0xBA, 0x03, 0xE1, 0xBC, 0xBB, 0x03, 0xE1, 0xBD, 0x82, 0x03,
+    0xE1, 0xBD, 0x83, 0x03, 0xE1, 0xBD, 0x8A, 0x03, 0xE1, 0xBD, 0x8B, 0x03,
+    0xE1, 0xBD, 0x92, 0x03, 0xE1, 0xBD, 0x93, 0x03, 0xE1, 0xBD, 0x9B, 0x03,
+    0xE1, 0xBD, 0xA2, 0x03, 0xE1, 0xBD, 0xA3, 0x03, 0xE1, 0xBD, 0xAA, 0x03,
+    0xE1, 0xBD, 0xAB, 0x01, 0x27, 0x02, 0xC3, 0x81, 0x02, 0xC4, 0x86, 0x02,
+    0xC3, 0x89, 0x02, 0xC7, 0xB4, 0x02, 0xC3, 0x8D, 0x03, 0x4A, 0xCC, 0x81,
+    0x03, 0xE1, 0xB8, 0xB0, 0x02, 0xC4, 0xB9, 0x03, 0xE1, 0xB8, 0xBE, 0x02,
+    0xC5, 0x83, 0x02, 0xC3, 0x93, 0x03, 0xE1, 0xB9, 0x94, 0x02, 0xC5, 0x94,
+    0x02, 0xC5, 0x9A, 0x02, 0xC3, 0x9A, 0x02, 0xC7, 0x97, 0x03, 0xE1, 0xBA,
+    0x82, 0x02, 0xC3, 0x9D, 0x02, 0xC5, 0xB9, 0x02, 0xC3, 0xA1, 0x02, 0xC4,
+    0x87, 0x02, 0xC3, 0xA9, 0x02, 0xC7, 0xB5, 0x02, 0xC3, 0xAD, 0x03, 0x6A,
+    0xCC, 0x81, 0x03, 0xE1, 0xB8, 0xB1, 0x02, 0xC4, 0xBA, 0x03, 0xE1, 0xB8,
+    0xBF, 0x02, 0xC5, 0x84, 0x02, 0xC3, 0xB3, 0x03, 0xE1, 0xB9, 0x95, 0x02,
+    0xC5, 0x95, 0x02, 0xC5, 0x9B, 0x02, 0xC3, 0xBA, 0x02, 0xC7, 0x98, 0x03,
+    0xE1, 0xBA, 0x83, 0x02, 0xC3, 0xBD, 0x02, 0xC5, 0xBA, 0x02, 0xC2, 0xB4,
+    0x03, 0xE1, 0xBA, 0xA4, 0x03, 0xE1, 0xBA, 0xBE, 0x03, 0xE1, 0xBB, 0x90,
+    0x03, 0xE1, 0xBA, 0xA5, 0x03, 0xE1, 0xBA, 0xBF, 0x03, 0xE1, 0xBB, 0x91,
+    0x05, 0x41, 0xCC, 0x83, 0xCC, 0x81, 0x05, 0x45, 0xCC, 0x83, 0xCC, 0x81,
+    0x05, 0x49, 0xCC, 0x83, 0xCC, 0x81, 0x03, 0xE1, 0xB9, 0x8C, 0x03, 0xE1,
+    0xB9, 0xB8, 0x05, 0x61, 0xCC, 0x83, 0xCC, 0x81, 0x05, 0x65, 0xCC, 0x83,
+    0xCC, 0x81, 0x05, 0x69, 0xCC, 0x83, 0xCC, 0x81, 0x03, 0xE1, 0xB9, 0x8D,
+    0x03, 0xE1, 0xB9, 0xB9, 0x03, 0xE1, 0xB8, 0x96, 0x03, 0xE1, 0xB9, 0x92,
+    0x03, 0xE1, 0xB8, 0x97, 0x03, 0xE1, 0xB9, 0x93, 0x03, 0xE1, 0xBA, 0xAE,
+    0x03, 0xE1, 0xBA, 0xAF, 0x02, 0xCE, 0x85, 0x03, 0xE1, 0xB8, 0xAE, 0x03,
+    0xE1, 0xB8, 0xAF, 0x02, 0xC7, 0xBA, 0x02, 0xC7, 0xBB, 0x03, 0xE1, 0xBB,
+    0x9A, 0x03, 0xE1, 0xBB, 0xA8, 0x03, 0xE1, 0xBB, 0x9B, 0x03, 0xE1, 0xBB,
+    0xA9, 0x03, 0xE1, 0xB8, 0x88, 0x03, 0xE1, 0xB8, 0x89, 0x02, 0xC7, 0xBE,
+    0x02, 0xC7, 0xBF, 0x02, 0xCC, 0x81, 0x02, 0xC7, 0xBC, 0x02, 0xC7, 0xBD,
+    0x04, 0xC6, 0x86, 0xCC, 0x81, 0x04, 0xC6, 0x8E, 0xCC, 0x81, 0x04, 0xC6,
+    0x90, 0xCC, 0x81, 0x04, 0xC6, 0x96, 0xCC, 0x81, 0x04, 0xC6, 0xB1, 0xCC,
+    0x81, 0x04, 0xC6, 0xB2, 0xCC, 0x81, 0x04, 0xC7, 0x9D, 0xCC, 0x81, 0x04,
+    0xC9, 0x94, 0xCC, 0x81, 0x04, 0xC9, 0x9B, 0xCC, 0x81, 0x04, 0xC9, 0xA9,
+    0xCC, 0x81, 0x04, 0xCA, 0x8A, 0xCC, 0x81, 0x04, 0xCA, 0x8B, 0xCC, 0x81,
+    0x03, 0xE1, 0xBC, 0x84, 0x03, 0xE1, 0xBC, 0x85, 0x03, 0xE1, 0xBC, 0x8C,
+    0x03, 0xE1, 0xBC, 0x8D, 0x03, 0xE1, 0xBC, 0x94, 0x03, 0xE1, 0xBC, 0x95,
+    0x03, 0xE1, 0xBC, 0x9C, 0x03, 0xE1, 0xBC, 0x9D, 0x03, 0xE1, 0xBC, 0xA4,
+    0x03, 0xE1, 0xBC, 0xA5, 0x03, 0xE1, 0xBC, 0xAC, 0x03, 0xE1, 0xBC, 0xAD,
+    0x03, 0xE1, 0xBC, 0xB4, 0x03, 0xE1, 0xBC, 0xB5, 0x03, 0xE1, 0xBC, 0xBC,
+    0x03, 0xE1, 0xBC, 0xBD, 0x03, 0xE1, 0xBD, 0x84, 0x03, 0xE1, 0xBD, 0x85,
+    0x03, 0xE1, 0xBD, 0x8C, 0x03, 0xE1, 0xBD, 0x8D, 0x03, 0xE1, 0xBD, 0x94,
+    0x03, 0xE1, 0xBD, 0x95, 0x03, 0xE1, 0xBD, 0x9D, 0x03, 0xE1, 0xBD, 0xA4,
+    0x03, 0xE1, 0xBD, 0xA5, 0x03, 0xE1, 0xBD, 0xAC, 0x03, 0xE1, 0xBD, 0xAD,
+    0x01, 0x5E, 0x03, 0xE2, 0x81, 0xBD, 0x03, 0xE2, 0x81, 0xBE, 0x03, 0xE2,
+    0x81, 0xBA, 0x03, 0xE2, 0x81, 0xBB, 0x02, 0xC2, 0xB7, 0x03, 0xE2, 0x81,
+    0xB0, 0x02, 0xC2, 0xB9, 0x02, 0xC2, 0xB2, 0x02, 0xC2, 0xB3, 0x03, 0xE2,
+    0x81, 0xB4, 0x03, 0xE2, 0x81, 0xB5, 0x03, 0xE2, 0x81, 0xB6, 0x03, 0xE2,
+    0x81, 0xB7, 0x03, 0xE2, 0x81, 0xB8, 0x03, 0xE2, 0x81, 0xB9, 0x03, 0xE2,
+    0x81, 0xBC, 0x02, 0xC3, 0x82, 0x02, 0xC4, 0x88, 0x02, 0xC3, 0x8A, 0x02,
+    0xC4, 0x9C, 0x02, 0xC4, 0xA4, 0x02, 0xC3, 0x8E, 0x02, 0xC4, 0xB4, 0x02,
+    0xC3, 0x94, 0x02, 0xC5, 0x9C, 0x02, 0xC3, 0x9B, 0x02, 0xC5, 0xB4, 0x02,
+    0xC5, 0xB6, 0x03, 0xE1, 0xBA, 0x90, 0x02, 0xC3, 0xA2, 0x02, 0xC4, 0x89,
+    0x02, 0xC3, 0xAA, 0x02, 0xC4, 0x9D, 0x02, 0xC4, 0xA5, 0x02, 0xC3, 0xAE,
+    0x02, 0xC4, 0xB5, 0x02, 0xC3, 0xB4, 0x02, 0xC5, 0x9D, 0x02, 0xC3, 0xBB,
+    0x02, 0xC5, 0xB5, 0x02, 0xC5, 0xB7, 0x03, 0xE1, 0xBA, 0x91, 0x03, 0xE1,
+    0xBA, 0xA8, 0x03, 0xE1, 0xBB, 0x82, 0x03, 0xE1, 0xBB, 0x94, 0x03, 0xE1,
+    0xBA, 0xA9, 0x03, 0xE1, 0xBB, 0x83, 0x03, 0xE1, 0xBB, 0x95, 0x03, 0xE1,
+    0xBA, 0xAC, 0x03, 0xE1, 0xBB, 0x86, 0x03, 0xE1, 0xBB, 0x98, 0x03, 0xE1,
+    0xBA, 0xAD, 0x03, 0xE1, 0xBB, 0x87, 0x03, 0xE1, 0xBB, 0x99, 0x03, 0xE2,
+    0x84, 0xA0, 0x03, 0xE2, 0x84, 0xA2, 0x02, 0xC2, 0xAA, 0x02, 0xCA, 0xB0,
+    0x03, 0xE2, 0x81, 0xB1, 0x02, 0xCA, 0xB2, 0x02, 0xCB, 0xA1, 0x03, 0xE2,
+    0x81, 0xBF, 0x02, 0xC2, 0xBA, 0x02, 0xCA, 0xB3, 0x02, 0xCB, 0xA2, 0x02,
+    0xCA, 0xB7, 0x02, 0xCB, 0xA3, 0x02, 0xCA, 0xB8, 0x02, 0xCB, 0xA0, 0x02,
+    0xCA, 0xB1, 0x02, 0xCA, 0xB4, 0x02, 0xCA, 0xB5, 0x02, 0xCA, 0xB6, 0x02,
+    0xCB, 0xA4, 0x02, 0xCC, 0x82, 0x03, 0xE1, 0xBA, 0xAA, 0x03, 0xE1, 0xBB,
+    0x96, 0x03, 0xE1, 0xBA, 0xAB, 0x03, 0xE1, 0xBB, 0x97, 0x04, 0xC6, 0x86,
+    0xCC, 0x82, 0x04, 0xC6, 0x8E, 0xCC, 0x82, 0x04, 0xC6, 0x90, 0xCC, 0x82,
+    0x04, 0xC6, 0x96, 0xCC, 0x82, 0x04, 0xC6, 0xB1, 0xCC, 0x82, 0x04, 0xC6,
+    0xB2, 0xCC, 0x82, 0x04, 0xC7, 0x9D, 0xCC, 0x82, 0x04, 0xC9, 0x94, 0xCC,
+    0x82, 0x04, 0xC9, 0x9B, 0xCC, 0x82, 0x04, 0xC9, 0xA9, 0xCC, 0x82, 0x04,
+    0xCA, 0x8A, 0xCC, 0x82, 0x04, 0xCA, 0x8B, 0xCC, 0x82, 0x03, 0xE3, 0x86,
+    0x92, 0x03, 0xE3, 0x86, 0x9C, 0x03, 0xE3, 0x86, 0x94, 0x03, 0xE3, 0x86,
+    0x96, 0x03, 0xE3, 0x86, 0x98, 0x03, 0xE3, 0x86, 0x9B, 0x03, 0xE3, 0x86,
+    0x97, 0x03, 0xE3, 0x86, 0x9A, 0x03, 0xE3, 0x86, 0x93, 0x03, 0xE3, 0x86,
+    0x9F, 0x03, 0xE3, 0x86, 0x95, 0x03, 0xE3, 0x86, 0x9E, 0x03, 0xE3, 0x86,
+    0x9D, 0x03, 0xE3, 0x86, 0x99, 0x01, 0x7E, 0x03, 0xE2, 0x89, 0xB2, 0x03,
+    0xE2, 0x89, 0x83, 0x03, 0xE2, 0x89, 0xB3, 0x02, 0xC3, 0x83, 0x03, 0xE1,
+    0xBA, 0xBC, 0x02, 0xC4, 0xA8, 0x02, 0xC3, 0x91, 0x02, 0xC3, 0x95, 0x02,
+    0xC5, 0xA8, 0x03, 0xE1, 0xB9, 0xBC, 0x03, 0xE1, 0xBB, 0xB8, 0x02, 0xC3,
+    0xA3, 0x03, 0xE1, 0xBA, 0xBD, 0x02, 0xC4, 0xA9, 0x02, 0xC3, 0xB1, 0x02,
+    0xC3, 0xB5, 0x02, 0xC5, 0xA9, 0x03, 0xE1, 0xB9, 0xBD, 0x03, 0xE1, 0xBB,
+    0xB9, 0x03, 0xE1, 0xBB, 0x84, 0x03, 0xE1, 0xBB, 0x85, 0x03, 0xE1, 0xBA,
+    0xB4, 0x03, 0xE1, 0xBA, 0xB5, 0x03, 0xE1, 0xBB, 0xA0, 0x03, 0xE1, 0xBB,
+    0xAE, 0x03, 0xE1, 0xBB, 0xA1, 0x03, 0xE1, 0xBB, 0xAF, 0x02, 0xCC, 0x83,
+    0x03, 0xE1, 0xB9, 0x8E, 0x03, 0xE1, 0xB9, 0x8F, 0x04, 0xC6, 0x86, 0xCC,
+    0x83, 0x04, 0xC6, 0x8E, 0xCC, 0x83, 0x04, 0xC6, 0x90, 0xCC, 0x83, 0x04,
+    0xC7, 0x9D, 0xCC, 0x83, 0x04, 0xC9, 0x94, 0xCC, 0x83, 0x04, 0xC9, 0x9B,
+    0xCC, 0x83, 0x03, 0xE1, 0xBC, 0x86, 0x03, 0xE1, 0xBC, 0x87, 0x03, 0xE1,
+    0xBC, 0x8E, 0x03, 0xE1, 0xBC, 0x8F, 0x03, 0xE1, 0xBC, 0xA6, 0x03, 0xE1,
+    0xBC, 0xA7, 0x03, 0xE1, 0xBC, 0xAE, 0x03, 0xE1, 0xBC, 0xAF, 0x03, 0xE1,
+    0xBC, 0xB6, 0x03, 0xE1, 0xBC, 0xB7, 0x03, 0xE1, 0xBC, 0xBE, 0x03, 0xE1,
+    0xBC, 0xBF, 0x03, 0xE1, 0xBD, 0x96, 0x03, 0xE1, 0xBD, 0x97, 0x03, 0xE1,
+    0xBD, 0x9F, 0x03, 0xE1, 0xBD, 0xA6, 0x03, 0xE1, 0xBD, 0xA7, 0x03, 0xE1,
+    0xBD, 0xAE, 0x03, 0xE1, 0xBD, 0xAF, 0x02, 0xC2, 0xAF, 0x02, 0xC4, 0x80,
+    0x02, 0xC4, 0x92, 0x03, 0xE1, 0xB8, 0xA0, 0x02, 0xC4, 0xAA, 0x02, 0xC5,
+    0x8C, 0x02, 0xC5, 0xAA, 0x02, 0xC7, 0x95, 0x02, 0xC8, 0xB2, 0x02, 0xC4,
+    0x81, 0x02, 0xC4, 0x93, 0x03, 0xE1, 0xB8, 0xA1, 0x02, 0xC4, 0xAB, 0x02,
+    0xC5, 0x8D, 0x02, 0xC5, 0xAB, 0x02, 0xC7, 0x96, 0x02, 0xC8, 0xB3, 0x02,
+    0xC8, 0xAC, 0x02, 0xC8, 0xAD, 0x02, 0xC7, 0xA0, 0x02, 0xC8, 0xB0, 0x02,
+    0xC7, 0xA1, 0x02, 0xC8, 0xB1, 0x02, 0xC7, 0x9E, 0x02, 0xC8, 0xAA, 0x02,
+    0xC7, 0x9F, 0x02, 0xC8, 0xAB, 0x03, 0xE1, 0xB8, 0xB8, 0x03, 0xE1, 0xB9,
+    0x9C, 0x03, 0xE1, 0xB8, 0xB9, 0x03, 0xE1, 0xB9, 0x9D, 0x02, 0xC7, 0xAC,
+    0x02, 0xC7, 0xAD, 0x02, 0xCC, 0x84, 0x02, 0xC7, 0xA2, 0x02, 0xC7, 0xA3,
+    0x04, 0xC6, 0x86, 0xCC, 0x84, 0x04, 0xC6, 0x8E, 0xCC, 0x84, 0x04, 0xC6,
+    0x90, 0xCC, 0x84, 0x04, 0xC6, 0x96, 0xCC, 0x84, 0x04, 0xC6, 0xB1, 0xCC,
+    0x84, 0x04, 0xC6, 0xB2, 0xCC, 0x84, 0x04, 0xC7, 0x9D, 0xCC, 0x84, 0x04,
+    0xC9, 0x94, 0xCC, 0x84, 0x04, 0xC9, 0x9B, 0xCC, 0x84, 0x04, 0xC9, 0xA9,
+    0xCC, 0x84, 0x04, 0xCA, 0x8A, 0xCC, 0x84, 0x04, 0xCA, 0x8B, 0xCC, 0x84,
+    0x02, 0xCB, 0x98, 0x02, 0xC4, 0x82, 0x02, 0xC4, 0x94, 0x02, 0xC4, 0x9E,
+    0x02, 0xC4, 0xAC, 0x02, 0xC5, 0x8E, 0x02, 0xC5, 0xAC, 0x02, 0xC4, 0x83,
+    0x02, 0xC4, 0x95, 0x02, 0xC4, 0x9F, 0x02, 0xC4, 0xAD, 0x02, 0xC5, 0x8F,
+    0x02, 0xC5, 0xAD, 0x03, 0xE1, 0xBA, 0xB6, 0x03, 0xE1, 0xBA, 0xB7, 0x03,
+    0xE1, 0xB8, 0x9C, 0x03, 0xE1, 0xB8, 0x9D, 0x02, 0xCC, 0x86, 0x02, 0xCB,
+    0x99, 0x02, 0xC8, 0xA6, 0x03, 0xE1, 0xB8, 0x82, 0x02, 0xC4, 0x8A, 0x03,
+    0xE1, 0xB8, 0x8A, 0x02, 0xC4, 0x96, 0x03, 0xE1, 0xB8, 0x9E, 0x02, 0xC4,
+    0xA0, 0x03, 0xE1, 0xB8, 0xA2, 0x02, 0xC4, 0xB0, 0x02, 0xC4, 0xBF, 0x03,
+    0xE1, 0xB9, 0x80, 0x03, 0xE1, 0xB9, 0x84, 0x02, 0xC8, 0xAE, 0x03, 0xE1,
+    0xB9, 0x96, 0x03, 0xE1, 0xB9, 0x98, 0x03, 0xE1, 0xB9, 0xA0, 0x03, 0xE1,
+    0xB9, 0xAA, 0x03, 0xE1, 0xBA, 0x86, 0x03, 0xE1, 0xBA, 0x8A, 0x03, 0xE1,
+    0xBA, 0x8E, 0x02, 0xC5, 0xBB, 0x02, 0xC8, 0xA7, 0x03, 0xE1, 0xB8, 0x83,
+    0x02, 0xC4, 0x8B, 0x03, 0xE1, 0xB8, 0x8B, 0x02, 0xC4, 0x97, 0x03, 0xE1,
+    0xB8, 0x9F, 0x02, 0xC4, 0xA1, 0x03, 0xE1, 0xB8, 0xA3, 0x02, 0xC4, 0xB1,
+    0x02, 0xC8, 0xB7, 0x02, 0xC5, 0x80, 0x03, 0xE1, 0xB9, 0x81, 0x03, 0xE1,
+    0xB9, 0x85, 0x02, 0xC8, 0xAF, 0x03, 0xE1, 0xB9, 0x97, 0x03, 0xE1, 0xB9,
+    0x99, 0x03, 0xE1, 0xB9, 0xA1, 0x03, 0xE1, 0xB9, 0xAB, 0x03, 0xE1, 0xBA,
+    0x87, 0x03, 0xE1, 0xBA, 0x8B, 0x03, 0xE1, 0xBA, 0x8F, 0x02, 0xC5, 0xBC,
+    0x03, 0xE1, 0xB9, 0xA4, 0x03, 0xE1, 0xB9, 0xA5, 0x03, 0xE1, 0xB9, 0xA6,
+    0x03, 0xE1, 0xB9, 0xA7, 0x03, 0xE1, 0xB9, 0xA8, 0x03, 0xE1, 0xB9, 0xA9,
+    0x02, 0xC9, 0x9F, 0x03, 0xE1, 0xBA, 0x9B, 0x02, 0xCC, 0x87, 0x01, 0x22,
+    0x02, 0xCD, 0x84, 0x02, 0xC3, 0x84, 0x02, 0xC3, 0x8B, 0x03, 0xE1, 0xB8,
+    0xA6, 0x02, 0xC3, 0x8F, 0x02, 0xC3, 0x96, 0x02, 0xC3, 0x9C, 0x03, 0xE1,
+    0xBA, 0x84, 0x03, 0xE1, 0xBA, 0x8C, 0x02, 0xC5, 0xB8, 0x02, 0xC3, 0xA4,
+    0x02, 0xC3, 0xAB, 0x03, 0xE1, 0xB8, 0xA7, 0x02, 0xC3, 0xAF, 0x02, 0xC3,
+    0xB6, 0x03, 0xE1, 0xBA, 0x97, 0x02, 0xC3, 0xBC, 0x03, 0xE1, 0xBA, 0x85,
+    0x03, 0xE1, 0xBA, 0x8D, 0x02, 0xC3, 0xBF, 0x03, 0xE1, 0xB9, 0xBA, 0x03,
+    0xE1, 0xB9, 0xBB, 0x02, 0xC2, 0xA8, 0x02, 0xCC, 0x88, 0x02, 0xC7, 0x99,
+    0x02, 0xC7, 0x9A, 0x02, 0xD3, 0x9A, 0x02, 0xD3, 0x9B, 0x02, 0xD3, 0xAA,
+    0x02, 0xD3, 0xAB, 0x02, 0xCC, 0x89, 0x03, 0xE1, 0xBA, 0xA2, 0x02, 0xC6,
+    0x81, 0x02, 0xC6, 0x87, 0x02, 0xC6, 0x8A, 0x03, 0xE1, 0xBA, 0xBA, 0x02,
+    0xC6, 0x91, 0x02, 0xC6, 0x93, 0x03, 0xE1, 0xBB, 0x88, 0x02, 0xC6, 0x98,
+    0x03, 0xE2, 0xB1, 0xAE, 0x02, 0xC6, 0x9D, 0x03, 0xE1, 0xBB, 0x8E, 0x02,
+    0xC6, 0xA4, 0x02, 0xC6, 0xAC, 0x03, 0xE1, 0xBB, 0xA6, 0x02, 0xC6, 0xB2,
+    0x03, 0xE2, 0xB1, 0xB2, 0x03, 0xE1, 0xBB, 0xB6, 0x02, 0xC8, 0xA4, 0x03,
+    0xE1, 0xBA, 0xA3, 0x02, 0xC9, 0x93, 0x02, 0xC6, 0x88, 0x02, 0xC9, 0x97,
+    0x03, 0xE1, 0xBA, 0xBB, 0x02, 0xC6, 0x92, 0x02, 0xC9, 0xA0, 0x02, 0xC9,
+    0xA6, 0x03, 0xE1, 0xBB, 0x89, 0x02, 0xC6, 0x99, 0x02, 0xC9, 0xB1, 0x02,
+    0xC9, 0xB2, 0x03, 0xE1, 0xBB, 0x8F, 0x02, 0xC6, 0xA5, 0x02, 0xCA, 0xA0,
+    0x02, 0xC9, 0xBC, 0x02, 0xCA, 0x82, 0x02, 0xC6, 0xAD, 0x03, 0xE1, 0xBB,
+    0xA7, 0x02, 0xCA, 0x8B, 0x03, 0xE2, 0xB1, 0xB3, 0x03, 0xE1, 0xBB, 0xB7,
+    0x02, 0xC8, 0xA5, 0x03, 0xE1, 0xBA, 0xB2, 0x03, 0xE1, 0xBA, 0xB3, 0x03,
+    0xE1, 0xBB, 0x9E, 0x03, 0xE1, 0xBB, 0xAC, 0x03, 0xE1, 0xBB, 0x9F, 0x03,
+    0xE1, 0xBB, 0xAD, 0x02, 0xC2, 0xB0, 0x02, 0xC3, 0x85, 0x02, 0xC5, 0xAE,
+    0x02, 0xC3, 0xA5, 0x02, 0xC5, 0xAF, 0x03, 0xE1, 0xBA, 0x98, 0x03, 0xE1,
+    0xBA, 0x99, 0x02, 0xCC, 0x8A, 0x02, 0xCB, 0x9D, 0x02, 0xC5, 0x90, 0x02,
+    0xC5, 0xB0, 0x02, 0xC5, 0x91, 0x02, 0xC5, 0xB1, 0x02, 0xCC, 0x8B, 0x02,
+    0xCB, 0x87, 0x03, 0xE2, 0x82, 0x8D, 0x03, 0xE2, 0x82, 0x8E, 0x03, 0xE2,
+    0x82, 0x8A, 0x03, 0xE2, 0x82, 0x8B, 0x03, 0xE2, 0x82, 0x80, 0x03, 0xE2,
+    0x82, 0x81, 0x03, 0xE2, 0x82, 0x82, 0x03, 0xE2, 0x82, 0x83, 0x03, 0xE2,
+    0x82, 0x84, 0x03, 0xE2, 0x82, 0x85, 0x03, 0xE2, 0x82, 0x86, 0x03, 0xE2,
+    0x82, 0x87, 0x03, 0xE2, 0x82, 0x88, 0x03, 0xE2, 0x82, 0x89, 0x03, 0xE2,
+    0x82, 0x8C, 0x02, 0xC7, 0x8D, 0x02, 0xC4, 0x8C, 0x02, 0xC4, 0x8E, 0x02,
+    0xC4, 0x9A, 0x02, 0xC7, 0xA6, 0x02, 0xC8, 0x9E, 0x02, 0xC7, 0x8F, 0x02,
+    0xC7, 0xA8, 0x02, 0xC4, 0xBD, 0x02, 0xC5, 0x87, 0x02, 0xC7, 0x91, 0x02,
+    0xC5, 0x98, 0x02, 0xC5, 0xA0, 0x02, 0xC5, 0xA4, 0x02, 0xC7, 0x93, 0x02,
+    0xC5, 0xBD, 0x02, 0xC7, 0x8E, 0x02, 0xC4, 0x8D, 0x02, 0xC4, 0x8F, 0x02,
+    0xC4, 0x9B, 0x02, 0xC7, 0xA7, 0x02, 0xC8, 0x9F, 0x02, 0xC7, 0x90, 0x02,
+    0xC7, 0xB0, 0x02, 0xC7, 0xA9, 0x02, 0xC4, 0xBE, 0x02, 0xC5, 0x88, 0x02,
+    0xC7, 0x92, 0x02, 0xC5, 0x99, 0x02, 0xC5, 0xA1, 0x02, 0xC5, 0xA5, 0x02,
+    0xC7, 0x94, 0x02, 0xC5, 0xBE, 0x02, 0xCC, 0x8C, 0x04, 0xC6, 0x86, 0xCC,
+    0x8C, 0x04, 0xC6, 0x8E, 0xCC, 0x8C, 0x04, 0xC6, 0x90, 0xCC, 0x8C, 0x04,
+    0xC6, 0x96, 0xCC, 0x8C, 0x04, 0xC6, 0xB1, 0xCC, 0x8C, 0x04, 0xC6, 0xB2,
+    0xCC, 0x8C, 0x04, 0xC7, 0x9D, 0xCC, 0x8C, 0x02, 0xC7, 0x85, 0x04, 0xC9,
+    0x94, 0xCC, 0x8C, 0x04, 0xC9, 0x9B, 0xCC, 0x8C, 0x04, 0xC9, 0xA9, 0xCC,
+    0x8C, 0x04, 0xCA, 0x8A, 0xCC, 0x8C, 0x04, 0xCA, 0x8B, 0xCC, 0x8C, 0x02,
+    0xCC, 0x9B, 0x02, 0xC6, 0xA0, 0x02, 0xC6, 0xAF, 0x02, 0xC6, 0xA1, 0x02,
+    0xC6, 0xB0, 0x03, 0xE1, 0xBB, 0xA2, 0x03, 0xE1, 0xBB, 0xB0, 0x03, 0xE1,
+    0xBB, 0xA3, 0x03, 0xE1, 0xBB, 0xB1, 0x02, 0xCC, 0xA3, 0x03, 0xE2, 0xA8,
+    0xA5, 0x03, 0xE2, 0xA8, 0xAA, 0x03, 0xE2, 0xA9, 0xA6, 0x03, 0xE1, 0xBA,
+    0xA0, 0x03, 0xE1, 0xB8, 0x84, 0x03, 0xE1, 0xB8, 0x8C, 0x03, 0xE1, 0xBA,
+    0xB8, 0x03, 0xE1, 0xB8, 0xA4, 0x03, 0xE1, 0xBB, 0x8A, 0x03, 0xE1, 0xB8,
+    0xB2, 0x03, 0xE1, 0xB8, 0xB6, 0x03, 0xE1, 0xB9, 0x82, 0x03, 0xE1, 0xB9,
+    0x86, 0x03, 0xE1, 0xBB, 0x8C, 0x03, 0xE1, 0xB9, 0x9A, 0x03, 0xE1, 0xB9,
+    0xA2, 0x03, 0xE1, 0xB9, 0xAC, 0x03, 0xE1, 0xBB, 0xA4, 0x03, 0xE1, 0xB9,
+    0xBE, 0x03, 0xE1, 0xBA, 0x88, 0x03, 0xE1, 0xBB, 0xB4, 0x03, 0xE1, 0xBA,
+    0x92, 0x03, 0xE1, 0xBA, 0xA1, 0x03, 0xE1, 0xB8, 0x85, 0x03, 0xE1, 0xB8,
+    0x8D, 0x03, 0xE1, 0xBA, 0xB9, 0x03, 0xE1, 0xB8, 0xA5, 0x03, 0xE1, 0xBB,
+    0x8B, 0x03, 0xE1, 0xB8, 0xB3, 0x03, 0xE1, 0xB8, 0xB7, 0x03, 0xE1, 0xB9,
+    0x83, 0x03, 0xE1, 0xB9, 0x87, 0x03, 0xE1, 0xBB, 0x8D, 0x03, 0xE1, 0xB9,
+    0x9B, 0x03, 0xE1, 0xB9, 0xA3, 0x03, 0xE1, 0xB9, 0xAD, 0x03, 0xE1, 0xBB,
+    0xA5, 0x03, 0xE1, 0xB9, 0xBF, 0x03, 0xE1, 0xBA, 0x89, 0x03, 0xE1, 0xBB,
+    0xB5, 0x03, 0xE1, 0xBA, 0x93, 0x01, 0x2C, 0x02, 0xC8, 0x98, 0x02, 0xC8,
+    0x9A, 0x02, 0xC8, 0x99, 0x02, 0xC8, 0x9B, 0x02, 0xCC, 0xA6, 0x02, 0xC2,
+    0xB8, 0x02, 0xC3, 0x87, 0x03, 0xE1, 0xB8, 0x90, 0x02, 0xC8, 0xA8, 0x02,
+    0xC4, 0xA2, 0x03, 0xE1, 0xB8, 0xA8, 0x02, 0xC4, 0xB6, 0x02, 0xC4, 0xBB,
+    0x02, 0xC5, 0x85, 0x02, 0xC5, 0x96, 0x02, 0xC5, 0x9E, 0x02, 0xC5, 0xA2,
+    0x02, 0xC3, 0xA7, 0x03, 0xE1, 0xB8, 0x91, 0x02, 0xC8, 0xA9, 0x02, 0xC4,
+    0xA3, 0x03, 0xE1, 0xB8, 0xA9, 0x02, 0xC4, 0xB7, 0x02, 0xC4, 0xBC, 0x02,
+    0xC5, 0x86, 0x02, 0xC5, 0x97, 0x02, 0xC5, 0x9F, 0x02, 0xC5, 0xA3, 0x02,
+    0xCC, 0xA7, 0x03, 0xE2, 0x82, 0xB5, 0x02, 0xCB, 0x9B, 0x02, 0xC4, 0x84,
+    0x02, 0xC4, 0x98, 0x02, 0xC4, 0xAE, 0x02, 0xC7, 0xAA, 0x02, 0xC5, 0xB2,
+    0x02, 0xC4, 0x85, 0x02, 0xC4, 0x99, 0x02, 0xC4, 0xAF, 0x02, 0xC7, 0xAB,
+    0x02, 0xC5, 0xB3, 0x02, 0xCC, 0xA8, 0x01, 0x2F, 0x02, 0xC6, 0xBB, 0x03,
+    0xE2, 0x89, 0xAE, 0x03, 0xE2, 0x89, 0xA0, 0x03, 0xE2, 0x89, 0xAF, 0x02,
+    0xC8, 0xBA, 0x02, 0xC9, 0x83, 0x02, 0xC8, 0xBB, 0x02, 0xC4, 0x90, 0x02,
+    0xC9, 0x86, 0x02, 0xC7, 0xA4, 0x02, 0xC4, 0xA6, 0x02, 0xC6, 0x97, 0x02,
+    0xC9, 0x88, 0x02, 0xC5, 0x81, 0x02, 0xC3, 0x98, 0x03, 0xE2, 0xB1, 0xA3,
+    0x02, 0xC9, 0x8C, 0x02, 0xC5, 0xA6, 0x02, 0xC9, 0x84, 0x02, 0xC9, 0x8E,
+    0x02, 0xC6, 0xB5, 0x03, 0xE2, 0xB1, 0xA5, 0x02, 0xC6, 0x80, 0x02, 0xC8,
+    0xBC, 0x02, 0xC4, 0x91, 0x02, 0xC9, 0x87, 0x02, 0xC7, 0xA5, 0x02, 0xC4,
+    0xA7, 0x02, 0xC9, 0xA8, 0x02, 0xC9, 0x89, 0x02, 0xC5, 0x82, 0x02, 0xC3,
+    0xB8, 0x03, 0xE1, 0xB5, 0xBD, 0x02, 0xC9, 0x8D, 0x02, 0xC5, 0xA7, 0x02,
+    0xCA, 0x89, 0x02, 0xC9, 0x8F, 0x02, 0xC6, 0xB6, 0x02, 0xCC, 0xB8, 0x03,
+    0xE1, 0xB5, 0xBC, 0x02, 0xC2, 0xA0, 0x03, 0xE2, 0x80, 0x88, 0x02, 0xC2,
+    0xA1, 0x03, 0xE2, 0x80, 0xBD, 0x02, 0xC2, 0xA6, 0x03, 0xE2, 0x80, 0x9E,
+    0x03, 0xE2, 0x80, 0x9C, 0x03, 0xE2, 0x80, 0x9D, 0x02, 0xCF, 0x94, 0x03,
+    0xE2, 0x99, 0xAF, 0x03, 0xE2, 0x99, 0xAB, 0x03, 0xE2, 0x99, 0xAC, 0x03,
+    0xE2, 0x99, 0xAD, 0x03, 0xE2, 0x99, 0xAA, 0x03, 0xE2, 0x99, 0xAE, 0x03,
+    0xE2, 0x99, 0xA9, 0x03, 0xE2, 0x80, 0xB0, 0x03, 0xE2, 0x80, 0x9A, 0x03,
+    0xE2, 0x80, 0x98, 0x03, 0xE2, 0x80, 0x99, 0x03, 0xE2, 0x8D, 0x9E, 0x01,
+    0x5B, 0x04, 0xF0, 0x9F, 0x84, 0xAF, 0x01, 0x7B, 0x03, 0xE2, 0x93, 0xAA,
+    0x03, 0xE2, 0x91, 0xA0, 0x03, 0xE2, 0x91, 0xA9, 0x03, 0xE2, 0x91, 0xAA,
+    0x03, 0xE2, 0x91, 0xAB, 0x03, 0xE2, 0x91, 0xAC, 0x03, 0xE2, 0x91, 0xAD,
+    0x03, 0xE2, 0x91, 0xAE, 0x03, 0xE2, 0x91, 0xAF, 0x03, 0xE2, 0x91, 0xB0,
+    0x03, 0xE2, 0x91, 0xB1, 0x03, 0xE2, 0x91, 0xB2, 0x03, 0xE2, 0x91, 0xA1,
+    0x03, 0xE2, 0x91, 0xB3, 0x03, 0xE3, 0x89, 0x91, 0x03, 0xE3, 0x89, 0x92,
+    0x03, 0xE3, 0x89, 0x93, 0x03, 0xE3, 0x89, 0x94, 0x03, 0xE3, 0x89, 0x95,
+    0x03, 0xE3, 0x89, 0x96, 0x03, 0xE3, 0x89, 0x97, 0x03, 0xE3, 0x89, 0x98,
+    0x03, 0xE3, 0x89, 0x99, 0x03, 0xE2, 0x91, 0xA2, 0x03, 0xE3, 0x89, 0x9A,
+    0x03, 0xE3, 0x89, 0x9B, 0x03, 0xE3, 0x89, 0x9C, 0x03, 0xE3, 0x89, 0x9D,
+    0x03, 0xE3, 0x89, 0x9E, 0x03, 0xE3, 0x89, 0x9F, 0x03, 0xE3, 0x8A, 0xB1,
+    0x03, 0xE3, 0x8A, 0xB2, 0x03, 0xE3, 0x8A, 0xB3, 0x03, 0xE3, 0x8A, 0xB4,
+    0x03, 0xE2, 0x91, 0xA3, 0x03, 0xE3, 0x8A, 0xB5, 0x03, 0xE3, 0x8A, 0xB6,
+    0x03, 0xE3, 0x8A, 0xB7, 0x03, 0xE3, 0x8A, 0xB8, 0x03, 0xE3, 0x8A, 0xB9,
+    0x03, 0xE3, 0x8A, 0xBA, 0x03, 0xE3, 0x8A, 0xBB, 0x03, 0xE3, 0x8A, 0xBC,
+    0x03, 0xE3, 0x8A, 0xBD, 0x03, 0xE3, 0x8A, 0xBE, 0x03, 0xE2, 0x91, 0xA4,
+    0x03, 0xE3, 0x8A, 0xBF, 0x03, 0xE2, 0x91, 0xA5, 0x03, 0xE2, 0x91, 0xA6,
+    0x03, 0xE2, 0x91, 0xA7, 0x03, 0xE2, 0x91, 0xA8, 0x03, 0xE2, 0x92, 0xB6,
+    0x03, 0xE2, 0x92, 0xB7, 0x03, 0xE2, 0x92, 0xB8, 0x03, 0xE2, 0x92, 0xB9,
+    0x03, 0xE2, 0x92, 0xBA, 0x03, 0xE2, 0x92, 0xBB, 0x03, 0xE2, 0x92, 0xBC,
+    0x03, 0xE2, 0x92, 0xBD, 0x03, 0xE2, 0x92, 0xBE, 0x03, 0xE2, 0x92, 0xBF,
+    0x03, 0xE2, 0x93, 0x80, 0x03, 0xE2, 0x93, 0x81, 0x03, 0xE2, 0x93, 0x82,
+    0x03, 0xE2, 0x93, 0x83, 0x03, 0xE2, 0x93, 0x84, 0x03, 0xE2, 0x93, 0x85,
+    0x03, 0xE2, 0x93, 0x86, 0x03, 0xE2, 0x93, 0x87, 0x03, 0xE2, 0x93, 0x88,
+    0x03, 0xE2, 0x93, 0x89, 0x03, 0xE2, 0x93, 0x8A, 0x03, 0xE2, 0x93, 0x8B,
+    0x03, 0xE2, 0x93, 0x8C, 0x03, 0xE2, 0x93, 0x8D, 0x03, 0xE2, 0x93, 0x8E,
+    0x03, 0xE2, 0x93, 0x8F, 0x03, 0xE2, 0x93, 0x90, 0x03, 0xE2, 0x93, 0x91,
+    0x03, 0xE2, 0x93, 0x92, 0x03, 0xE2, 0x93, 0x93, 0x03, 0xE2, 0x93, 0x94,
+    0x03, 0xE2, 0x93, 0x95, 0x03, 0xE2, 0x93, 0x96, 0x03, 0xE2, 0x93, 0x97,
+    0x03, 0xE2, 0x93, 0x98, 0x03, 0xE2, 0x93, 0x99, 0x03, 0xE2, 0x93, 0x9A,
+    0x03, 0xE2, 0x93, 0x9B, 0x03, 0xE2, 0x93, 0x9C, 0x03, 0xE2, 0x93, 0x9D,
+    0x03, 0xE2, 0x93, 0x9E, 0x03, 0xE2, 0x93, 0x9F, 0x03, 0xE2, 0x93, 0xA0,
+    0x03, 0xE2, 0x93, 0xA1, 0x03, 0xE2, 0x93, 0xA2, 0x03, 0xE2, 0x93, 0xA3,
+    0x03, 0xE2, 0x93, 0xA4, 0x03, 0xE2, 0x93, 0xA5, 0x03, 0xE2, 0x93, 0xA6,
+    0x03, 0xE2, 0x93, 0xA7, 0x03, 0xE2, 0x93, 0xA8, 0x03, 0xE2, 0x93, 0xA9,
+    0x03, 0xE3, 0x89, 0xA0, 0x03, 0xE3, 0x89, 0xAE, 0x03, 0xE3, 0x89, 0xA1,
+    0x03, 0xE3, 0x89, 0xAF, 0x03, 0xE3, 0x89, 0xA2, 0x03, 0xE3, 0x89, 0xB0,
+    0x03, 0xE3, 0x89, 0xA3, 0x03, 0xE3, 0x89, 0xB1, 0x03, 0xE3, 0x89, 0xA4,
+    0x03, 0xE3, 0x89, 0xB2, 0x03, 0xE3, 0x89, 0xA5, 0x03, 0xE3, 0x89, 0xB3,
+    0x03, 0xE3, 0x89, 0xA6, 0x03, 0xE3, 0x89, 0xB4, 0x03, 0xE3, 0x89, 0xA7,
+    0x03, 0xE3, 0x89, 0xB5, 0x03, 0xE3, 0x89, 0xA8, 0x03, 0xE3, 0x89, 0xB6,
+    0x03, 0xE3, 0x89, 0xA9, 0x03, 0xE3, 0x89, 0xB7, 0x03, 0xE3, 0x89, 0xAA,
+    0x03, 0xE3, 0x89, 0xB8, 0x03, 0xE3, 0x89, 0xAB, 0x03, 0xE3, 0x89, 0xB9,
+    0x03, 0xE3, 0x89, 0xAC, 0x03, 0xE3, 0x89, 0xBA, 0x03, 0xE3, 0x89, 0xAD,
+    0x03, 0xE3, 0x89, 0xBB, 0x03, 0xE3, 0x8B, 0xBC, 0x03, 0xE3, 0x8B, 0xBD,
+    0x03, 0xE3, 0x8A, 0x80, 0x03, 0xE3, 0x8A, 0x86, 0x03, 0xE3, 0x8A, 0x82,
+    0x03, 0xE3, 0x8A, 0xA4, 0x03, 0xE3, 0x8A, 0xA6, 0x03, 0xE3, 0x8A, 0xA5,
+    0x03, 0xE3, 0x8A, 0x88, 0x03, 0xE3, 0x8A, 0x81, 0x03, 0xE3, 0x8A, 0x84,
+    0x03, 0xE3, 0x8A, 0xAD, 0x03, 0xE3, 0x8A, 0xA1, 0x03, 0xE3, 0x8A, 0x9D,
+    0x03, 0xE3, 0x8A, 0x87, 0x03, 0xE3, 0x8A, 0x85, 0x03, 0xE3, 0x8A, 0xA2,
+    0x03, 0xE3, 0x8A, 0x98, 0x03, 0xE3, 0x8A, 0xA9, 0x03, 0xE3, 0x8A, 0x89,
+    0x03, 0xE3, 0x8A, 0xAF, 0x03, 0xE3, 0x8A, 0x9E, 0x03, 0xE3, 0x8A, 0xA8,
+    0x03, 0xE3, 0x8A, 0x94, 0x03, 0xE3, 0x8A, 0x83, 0x03, 0xE3, 0x8A, 0x8F,
+    0x03, 0xE3, 0x8A, 0xB0, 0x03, 0xE3, 0x8A, 0x9B, 0x03, 0xE3, 0x8A, 0xAB,
+    0x03, 0xE3, 0x8A, 0xAA, 0x03, 0xE3, 0x8A, 0xA7, 0x03, 0xE3, 0x8A, 0x90,
+    0x03, 0xE3, 0x8A, 0x8A, 0x03, 0xE3, 0x8A, 0x92, 0x03, 0xE3, 0x8A, 0x8D,
+    0x03, 0xE3, 0x8A, 0x91, 0x03, 0xE3, 0x8A, 0xA3, 0x03, 0xE3, 0x8A, 0x8C,
+    0x03, 0xE3, 0x8A, 0x9F, 0x03, 0xE3, 0x8A, 0x8B, 0x03, 0xE3, 0x8A, 0x95,
+    0x03, 0xE3, 0x8A, 0x9A, 0x03, 0xE3, 0x8A, 0xAC, 0x03, 0xE3, 0x8A, 0x93,
+    0x03, 0xE3, 0x8A, 0x97, 0x03, 0xE3, 0x8A, 0x99, 0x03, 0xE3, 0x8A, 0x96,
+    0x03, 0xE3, 0x8A, 0xAE, 0x03, 0xE3, 0x8A, 0x9C, 0x03, 0xE3, 0x8A, 0x8E,
+    0x03, 0xE3, 0x8A, 0xA0, 0x01, 0x5D, 0x01, 0x7D, 0x03, 0xE2, 0x8D, 0xA3,
+    0x03, 0xE2, 0x8D, 0x9F, 0x01, 0x23, 0x02, 0xC2, 0xB1, 0x02, 0xC2, 0xAC,
+    0x02, 0xC2, 0xAD, 0x03, 0xE2, 0x80, 0x94, 0x03, 0xE2, 0x80, 0x93, 0x04,
+    0xC4, 0x96, 0xCC, 0x84, 0x04, 0xC4, 0x97, 0xCC, 0x84, 0x03, 0xE2, 0x8C,
+    0xBF, 0x02, 0xC3, 0xB7, 0x03, 0xE2, 0x86, 0x92, 0x02, 0xC2, 0xA3, 0x02,
+    0xC2, 0xA5, 0x03, 0xE2, 0x8D, 0x80, 0x03, 0xE2, 0x88, 0x92, 0x03, 0xE2,
+    0x8D, 0x8F, 0x03, 0xE2, 0x8D, 0x96, 0x03, 0xE2, 0x8A, 0x96, 0x03, 0xE2,
+    0x80, 0xA6, 0x03, 0xE2, 0x88, 0xB5, 0x03, 0xE2, 0x80, 0xB9, 0x03, 0xE2,
+    0x80, 0xA2, 0x03, 0xE2, 0x80, 0xBA, 0x03, 0xE2, 0x8A, 0x99, 0x01, 0x5C,
+    0x03, 0xE2, 0x82, 0xA1, 0x01, 0x7C, 0x02, 0xC2, 0xA2, 0x03, 0xE2, 0x82,
+    0xA5, 0x02, 0xC2, 0xB5, 0x03, 0xE2, 0x88, 0x9A, 0x02, 0xCA, 0xA1, 0x02,
+    0xD2, 0xB0, 0x02, 0xD2, 0xB1, 0x03, 0xE2, 0x86, 0xAE, 0x03, 0xE2, 0x8D,
+    0x81, 0x03, 0xE2, 0x86, 0x89, 0x03, 0xE2, 0x8D, 0xAC, 0x03, 0xE2, 0x85,
+    0x92, 0x02, 0xC2, 0xBD, 0x03, 0xE2, 0x85, 0x93, 0x02, 0xC2, 0xBC, 0x03,
+    0xE2, 0x85, 0x95, 0x03, 0xE2, 0x85, 0x99, 0x03, 0xE2, 0x85, 0x90, 0x03,
+    0xE2, 0x85, 0x9B, 0x03, 0xE2, 0x85, 0x91, 0x03, 0xE2, 0x85, 0x94, 0x03,
+    0xE2, 0x85, 0x96, 0x02, 0xC2, 0xBE, 0x03, 0xE2, 0x85, 0x97, 0x03, 0xE2,
+    0x85, 0x9C, 0x03, 0xE2, 0x85, 0x98, 0x03, 0xE2, 0x85, 0x9A, 0x03, 0xE2,
+    0x85, 0x9D, 0x03, 0xE2, 0x85, 0x9E, 0x03, 0xE2, 0x88, 0x9E, 0x03, 0xE2,
+    0x98, 0xB9, 0x03, 0xE2, 0x98, 0xBA, 0x03, 0xE2, 0x88, 0xB4, 0x03, 0xE2,
+    0x8D, 0xA0, 0x03, 0xE2, 0x8D, 0xAE, 0x03, 0xE2, 0x86, 0x90, 0x03, 0xE2,
+    0x99, 0xA5, 0x02, 0xC2, 0xAB, 0x03, 0xE2, 0x89, 0xA4, 0x03, 0xE2, 0x8B,
+    0x84, 0x03, 0xE2, 0x8D, 0x83, 0x03, 0xE2, 0x87, 0x90, 0x03, 0xE2, 0x87,
+    0x92, 0x03, 0xE2, 0x82, 0xAC, 0x03, 0xE2, 0x82, 0xA4, 0x03, 0xE2, 0x82,
+    0xA6, 0x03, 0xE2, 0x82, 0xBD, 0x03, 0xE2, 0x82, 0xB9, 0x03, 0xE2, 0x82,
+    0xA9, 0x03, 0xE2, 0x87, 0x91, 0x03, 0xE2, 0x89, 0xA1, 0x03, 0xE2, 0x82,
+    0xAB, 0x03, 0xE2, 0x87, 0x93, 0x03, 0xE2, 0x8C, 0xB8, 0x03, 0xE2, 0x89,
+    0xA5, 0x02, 0xC2, 0xBB, 0x03, 0xE2, 0x8D, 0xA9, 0x03, 0xE2, 0x8D, 0x84,
+    0x03, 0xE2, 0xB8, 0x98, 0x02, 0xC2, 0xBF, 0x03, 0xE2, 0x98, 0xAD, 0x03,
+    0xE2, 0x8D, 0xB0, 0x02, 0xC3, 0x86, 0x01, 0x40, 0x03, 0xE2, 0x84, 0x82,
+    0x03, 0xE2, 0x82, 0xA0, 0x02, 0xC2, 0xA9, 0x03, 0xE2, 0x82, 0xA2, 0x02,
+    0xC3, 0x90, 0x04, 0xF0, 0x9F, 0x96, 0x95, 0x03, 0xEF, 0xAC, 0x83, 0x03,
+    0xEF, 0xAC, 0x84, 0x03, 0xE2, 0x82, 0xA3, 0x01, 0x3E, 0x02, 0xC4, 0xB2,
+    0x04, 0xF0, 0x9F, 0x96, 0x96, 0x01, 0x3C, 0x02, 0xC5, 0x8A, 0x03, 0xE2,
+    0x84, 0x95, 0x03, 0xE2, 0x84, 0x96, 0x02, 0xC5, 0x92, 0x02, 0xC2, 0xAE,
+    0x02, 0xC2, 0xA7, 0x02, 0xC2, 0xA4, 0x03, 0xE2, 0x98, 0xAE, 0x02, 0xC2,
+    0xB6, 0x03, 0xE2, 0x82, 0xA7, 0x03, 0xE2, 0x84, 0x9A, 0x03, 0xE2, 0x84,
+    0x9D, 0x03, 0xE2, 0x82, 0xA8, 0x03, 0xE1, 0xBA, 0x9E, 0x02, 0xC3, 0x9E,
+    0x03, 0xE2, 0x84, 0xA4, 0x03, 0xE2, 0x8C, 0xB7, 0x04, 0xF0, 0x9F, 0x99,
+    0x8C, 0x03, 0xE2, 0x8D, 0x82, 0x03, 0xE2, 0x8D, 0x89, 0x03, 0xE2, 0x86,
+    0x91, 0x03, 0xE2, 0x8D, 0x98, 0x03, 0xE2, 0x8D, 0x99, 0x03, 0xE2, 0x8D,
+    0xB7, 0x03, 0xE2, 0x8D, 0x9B, 0x03, 0xE2, 0x89, 0xA2, 0x03, 0xE2, 0x8A,
+    0x86, 0x03, 0xE2, 0x8A, 0x87, 0x03, 0xE2, 0x8D, 0x8A, 0x03, 0xE2, 0x8D,
+    0x9A, 0x03, 0xE2, 0x8D, 0xB8, 0x03, 0xE2, 0x8D, 0xB9, 0x03, 0xE2, 0x8D,
+    0xB6, 0x03, 0xE2, 0x8D, 0x9C, 0x02, 0xC3, 0xA6, 0x02, 0xC3, 0xB0, 0x03,
+    0xE2, 0x8C, 0x80, 0x02, 0xC9, 0x99, 0x02, 0xC5, 0xBF, 0x03, 0xEF, 0xAC,
+    0x80, 0x03, 0xEF, 0xAC, 0x81, 0x03, 0xEF, 0xAC, 0x82, 0x02, 0xC4, 0xB3,
+    0x02, 0xC4, 0xB8, 0x02, 0xC5, 0x8B, 0x02, 0xC5, 0x93, 0x04, 0xF0, 0x9F,
+    0x92, 0xA9, 0x02, 0xC3, 0x9F, 0x02, 0xC3, 0xBE, 0x03, 0xE2, 0x86, 0x93,
+    0x02, 0xC3, 0x97, 0x03, 0xE2, 0x88, 0x85, 0x03, 0xE2, 0x8D, 0xAD, 0x03,
+    0xE2, 0x8D, 0x85, 0x03, 0xE2, 0x8D, 0x86, 0x03, 0xE2, 0x8D, 0x8B, 0x03,
+    0xE2, 0x8D, 0x92, 0x03, 0xE2, 0x8D, 0xA6, 0x03, 0xE2, 0x8D, 0xA7, 0x03,
+    0xE2, 0x8C, 0xBD, 0x03, 0xE2, 0x89, 0x88, 0x03, 0xE2, 0x8D, 0xA8, 0x03,
+    0xE2, 0x8D, 0xAB, 0x03, 0xE2, 0x8D, 0xB2, 0x03, 0xE2, 0x8D, 0xB1, 0x03,
+    0xE1, 0xBF, 0xAD, 0x03, 0xE1, 0xBF, 0x81, 0x03, 0xE2, 0x8D, 0xA2, 0x03,
+    0xE2, 0x8D, 0xA4, 0x03, 0xE2, 0x8D, 0xA1, 0x03, 0xE2, 0x8D, 0xA5, 0x03,
+    0xE2, 0x8D, 0x91, 0x03, 0xE2, 0x8C, 0xB9, 0x03, 0xEF, 0xAC, 0x9F, 0x03,
+    0xEF, 0xAC, 0xAC, 0x03, 0xEF, 0xAC, 0xAD, 0x02, 0xDB, 0x82, 0x02, 0xDB,
+    0x93, 0x02, 0xDB, 0x80, 0x03, 0xE0, 0xA5, 0x98, 0x03, 0xE0, 0xA5, 0x99,
+    0x03, 0xE0, 0xA5, 0x9A, 0x03, 0xE0, 0xA5, 0x9B, 0x03, 0xE0, 0xA5, 0x9C,
+    0x03, 0xE0, 0xA5, 0x9D, 0x03, 0xE0, 0xA4, 0xA9, 0x03, 0xE0, 0xA5, 0x9E,
+    0x03, 0xE0, 0xA5, 0x9F, 0x03, 0xE0, 0xA4, 0xB1, 0x03, 0xE0, 0xA4, 0xB4,
+    0x03, 0xE0, 0xA7, 0x9C, 0x03, 0xE0, 0xA7, 0x9D, 0x03, 0xE0, 0xA7, 0x9F,
+    0x03, 0xE0, 0xA7, 0x8B, 0x03, 0xE0, 0xA7, 0x8C, 0x03, 0xE0, 0xA9, 0x99,
+    0x03, 0xE0, 0xA9, 0x9A, 0x03, 0xE0, 0xA9, 0x9B, 0x03, 0xE0, 0xA9, 0x9E,
+    0x03, 0xE0, 0xA8, 0xB3, 0x03, 0xE0, 0xA8, 0xB6, 0x03, 0xE0, 0xAD, 0x9C,
+    0x03, 0xE0, 0xAD, 0x9D, 0x03, 0xE0, 0xAD, 0x8B, 0x03, 0xE0, 0xAD, 0x88,
+    0x03, 0xE0, 0xAD, 0x8C, 0x03, 0xE0, 0xAF, 0x8A, 0x03, 0xE0, 0xAF, 0x8C,
+    0x03, 0xE0, 0xAF, 0x8B, 0x03, 0xE0, 0xAE, 0x94, 0x03, 0xE0, 0xB1, 0x88,
+    0x03, 0xE0, 0xB3, 0x80, 0x03, 0xE0, 0xB3, 0x8A, 0x03, 0xE0, 0xB3, 0x87,
+    0x03, 0xE0, 0xB3, 0x88, 0x03, 0xE0, 0xB3, 0x8B, 0x03, 0xE0, 0xB5, 0x8A,
+    0x03, 0xE0, 0xB5, 0x8C, 0x03, 0xE0, 0xB5, 0x8B, 0x03, 0xE0, 0xB7, 0x9A,
+    0x03, 0xE0, 0xB7, 0x9C, 0x03, 0xE0, 0xB7, 0x9E, 0x03, 0xE0, 0xB7, 0x9D,
+    0x03, 0xE0, 0xBD, 0xB3, 0x03, 0xE0, 0xBD, 0xB5, 0x03, 0xE0, 0xBE, 0x81,
+    0x03, 0xE0, 0xBE, 0xB9, 0x03, 0xE0, 0xBE, 0x93, 0x03, 0xE0, 0xBE, 0x9D,
+    0x03, 0xE0, 0xBE, 0xA2, 0x03, 0xE0, 0xBE, 0xA7, 0x03, 0xE0, 0xBE, 0xAC,
+    0x03, 0xE0, 0xBD, 0xB6, 0x03, 0xE0, 0xBD, 0xB8, 0x03, 0xE0, 0xBD, 0xA9,
+    0x03, 0xE0, 0xBD, 0x83, 0x03, 0xE0, 0xBD, 0x8D, 0x03, 0xE0, 0xBD, 0x92,
+    0x03, 0xE0, 0xBD, 0x97, 0x03, 0xE0, 0xBD, 0x9C, 0x03, 0xE1, 0x80, 0xA6,
+    0x03, 0xE1, 0x84, 0x81, 0x03, 0xE1, 0x84, 0x93, 0x03, 0xE1, 0x84, 0x94,
+    0x03, 0xE1, 0x84, 0x95, 0x03, 0xE1, 0x84, 0x96, 0x03, 0xE1, 0x84, 0x97,
+    0x03, 0xE1, 0x84, 0x84, 0x03, 0xE1, 0x84, 0x98, 0x03, 0xE1, 0x84, 0x99,
+    0x03, 0xE1, 0x84, 0x9B, 0x03, 0xE1, 0x84, 0x9A, 0x03, 0xE1, 0x84, 0x9C,
+    0x03, 0xE1, 0x84, 0x9D, 0x03, 0xE1, 0x84, 0x9E, 0x03, 0xE1, 0x84, 0x9F,
+    0x03, 0xE1, 0x84, 0xA0, 0x03, 0xE1, 0x84, 0x88, 0x03, 0xE1, 0x84, 0xA1,
+    0x03, 0xE1, 0x84, 0xA5, 0x03, 0xE1, 0x84, 0xAB, 0x03, 0xE1, 0x84, 0xA7,
+    0x03, 0xE1, 0x84, 0xA8, 0x03, 0xE1, 0x84, 0xA9, 0x03, 0xE1, 0x84, 0xAA,
+    0x03, 0xE1, 0x84, 0xAC, 0x03, 0xE1, 0x84, 0xA2, 0x03, 0xE1, 0x84, 0xA3,
+    0x03, 0xE1, 0x84, 0xA4, 0x03, 0xE1, 0x84, 0xA6, 0x03, 0xE1, 0x84, 0xAD,
+    0x03, 0xE1, 0x84, 0xAE, 0x03, 0xE1, 0x84, 0xAF, 0x03, 0xE1, 0x84, 0xB0,
+    0x03, 0xE1, 0x84, 0xB1, 0x03, 0xE1, 0x84, 0xB2, 0x03, 0xE1, 0x84, 0x8A,
+    0x03, 0xE1, 0x84, 0xB4, 0x03, 0xE1, 0x84, 0xB5, 0x03, 0xE1, 0x84, 0xB6,
+    0x03, 0xE1, 0x84, 0xB7, 0x03, 0xE1, 0x84, 0xB8, 0x03, 0xE1, 0x84, 0xB9,
+    0x03, 0xE1, 0x84, 0xBA, 0x03, 0xE1, 0x84, 0xBB, 0x03, 0xE1, 0x84, 0xB3,
+    0x03, 0xE1, 0x85, 0x81, 0x03, 0xE1, 0x85, 0x82, 0x03, 0xE1, 0x85, 0x83,
+    0x03, 0xE1, 0x85, 0x84, 0x03, 0xE1, 0x85, 0x85, 0x03, 0xE1, 0x85, 0x87,
+    0x03, 0xE1, 0x85, 0x88, 0x03, 0xE1, 0x85, 0x89, 0x03, 0xE1, 0x85, 0x8A,
+    0x03, 0xE1, 0x85, 0x8B, 0x03, 0xE1, 0x85, 0x86, 0x03, 0xE1, 0x85, 0x8D,
+    0x03, 0xE1, 0x84, 0x8D, 0x03, 0xE1, 0x85, 0x92, 0x03, 0xE1, 0x85, 0x93,
+    0x03, 0xE1, 0x85, 0x96, 0x03, 0xE1, 0x85, 0x97, 0x03, 0xE1, 0x85, 0x98,
+    0x03, 0xE1, 0x84, 0xBD, 0x03, 0xE1, 0x84, 0xBF, 0x03, 0xE1, 0x85, 0x8F,
+    0x03, 0xE1, 0x85, 0x91, 0x03, 0xE1, 0x85, 0xB6, 0x03, 0xE1, 0x85, 0xB7,
+    0x03, 0xE1, 0x85, 0xA2, 0x03, 0xE1, 0x85, 0xB8, 0x03, 0xE1, 0x85, 0xB9,
+    0x03, 0xE1, 0x85, 0xA4, 0x03, 0xE1, 0x85, 0xBA, 0x03, 0xE1, 0x85, 0xBB,
+    0x03, 0xE1, 0x85, 0xBC, 0x03, 0xE1, 0x85, 0xA6, 0x03, 0xE1, 0x85, 0xBD,
+    0x03, 0xE1, 0x85, 0xBE, 0x03, 0xE1, 0x85, 0xA8, 0x03, 0xE1, 0x85, 0xAA,
+    0x03, 0xE1, 0x85, 0xAB, 0x03, 0xE1, 0x85, 0xBF, 0x03, 0xE1, 0x86, 0x80,
+    0x03, 0xE1, 0x86, 0x81, 0x03, 0xE1, 0x86, 0x82, 0x03, 0xE1, 0x86, 0x83,
+    0x03, 0xE1, 0x85, 0xAC, 0x03, 0xE1, 0x86, 0x84, 0x03, 0xE1, 0x86, 0x85,
+    0x03, 0xE1, 0x86, 0x86, 0x03, 0xE1, 0x86, 0x87, 0x03, 0xE1, 0x86, 0x88,
+    0x03, 0xE1, 0x86, 0x89, 0x03, 0xE1, 0x86, 0x8A, 0x03, 0xE1, 0x85, 0xAF,
+    0x03, 0xE1, 0x85, 0xB0, 0x03, 0xE1, 0x86, 0x8C, 0x03, 0xE1, 0x86, 0x8D,
+    0x03, 0xE1, 0x85, 0xB1, 0x03, 0xE1, 0x86, 0x8B, 0x03, 0xE1, 0x86, 0x8E,
+    0x03, 0xE1, 0x86, 0x8F, 0x03, 0xE1, 0x86, 0x90, 0x03, 0xE1, 0x86, 0x91,
+    0x03, 0xE1, 0x86, 0x92, 0x03, 0xE1, 0x86, 0x93, 0x03, 0xE1, 0x86, 0x94,
+    0x03, 0xE1, 0x86, 0x95, 0x03, 0xE1, 0x86, 0x96, 0x03, 0xE1, 0x85, 0xB4,
+    0x03, 0xE1, 0x86, 0x97, 0x03, 0xE1, 0x86, 0x98, 0x03, 0xE1, 0x86, 0x99,
+    0x03, 0xE1, 0x86, 0x9A, 0x03, 0xE1, 0x86, 0x9B, 0x03, 0xE1, 0x86, 0x9C,
+    0x03, 0xE1, 0x86, 0x9D, 0x03, 0xE1, 0x86, 0x9F, 0x03, 0xE1, 0x86, 0xA0,
+    0x03, 0xE1, 0x86, 0xA1, 0x03, 0xE1, 0x86, 0xA2, 0x03, 0xE1, 0x86, 0xA9,
+    0x03, 0xE1, 0x87, 0x83, 0x03, 0xE1, 0x86, 0xAA, 0x03, 0xE1, 0x87, 0x84,
+    0x03, 0xE1, 0x87, 0x85, 0x03, 0xE1, 0x87, 0x86, 0x03, 0xE1, 0x87, 0x87,
+    0x03, 0xE1, 0x86, 0xAC, 0x03, 0xE1, 0x87, 0x89, 0x03, 0xE1, 0x86, 0xAD,
+    0x03, 0xE1, 0x87, 0x88, 0x03, 0xE1, 0x87, 0x8A, 0x03, 0xE1, 0x87, 0x8B,
+    0x03, 0xE1, 0x86, 0xB0, 0x03, 0xE1, 0x87, 0x8C, 0x03, 0xE1, 0x87, 0x8D,
+    0x03, 0xE1, 0x87, 0x8E, 0x03, 0xE1, 0x87, 0x90, 0x03, 0xE1, 0x86, 0xB1,
+    0x03, 0xE1, 0x86, 0xB2, 0x03, 0xE1, 0x87, 0x93, 0x03, 0xE1, 0x86, 0xB3,
+    0x03, 0xE1, 0x87, 0x96, 0x03, 0xE1, 0x87, 0x98, 0x03, 0xE1, 0x86, 0xB4,
+    0x03, 0xE1, 0x86, 0xB5, 0x03, 0xE1, 0x86, 0xB6, 0x03, 0xE1, 0x87, 0x91,
+    0x03, 0xE1, 0x87, 0x92, 0x03, 0xE1, 0x87, 0x94, 0x03, 0xE1, 0x87, 0x95,
+    0x03, 0xE1, 0x87, 0x97, 0x03, 0xE1, 0x87, 0x99, 0x03, 0xE1, 0x87, 0x9A,
+    0x03, 0xE1, 0x87, 0x9B, 0x03, 0xE1, 0x87, 0x9C, 0x03, 0xE1, 0x87, 0x9D,
+    0x03, 0xE1, 0x87, 0x9E, 0x03, 0xE1, 0x87, 0xA2, 0x03, 0xE1, 0x87, 0xA0,
+    0x03, 0xE1, 0x87, 0xA1, 0x03, 0xE1, 0x87, 0x9F, 0x03, 0xE1, 0x87, 0xA3,
+    0x03, 0xE1, 0x86, 0xB9, 0x03, 0xE1, 0x87, 0xA6, 0x03, 0xE1, 0x87, 0xA4,
+    0x03, 0xE1, 0x87, 0xA5, 0x03, 0xE1, 0x87, 0xA7, 0x03, 0xE1, 0x87, 0xA8,
+    0x03, 0xE1, 0x87, 0xA9, 0x03, 0xE1, 0x87, 0xAA, 0x03, 0xE1, 0x86, 0xBB,
+    0x03, 0xE1, 0x87, 0xAC, 0x03, 0xE1, 0x87, 0xAD, 0x03, 0xE1, 0x87, 0xAE,
+    0x03, 0xE1, 0x87, 0xAF, 0x03, 0xE1, 0x87, 0xB3, 0x03, 0xE1, 0x87, 0xB4,
+    0x03, 0xE1, 0x87, 0xB5, 0x03, 0xE1, 0x87, 0xB6, 0x03, 0xE1, 0x87, 0xB7,
+    0x03, 0xE1, 0x87, 0xB8, 0x03, 0xE1, 0x87, 0x8F, 0x03, 0xE1, 0x87, 0xB1,
+    0x03, 0xE1, 0x87, 0xB2, 0x03, 0xE1, 0xBF, 0x8E, 0x03, 0xE1, 0xBF, 0x8D,
+    0x03, 0xE1, 0xBF, 0x8F, 0x03, 0xE1, 0xBF, 0x9E, 0x03, 0xE1, 0xBF, 0x9D,
+    0x03, 0xE1, 0xBF, 0x9F, 0x03, 0xE2, 0x8D, 0x87, 0x03, 0xE2, 0x8D, 0x90,
+    0x03, 0xE2, 0x8D, 0x88, 0x03, 0xE2, 0x8D, 0x97, 0x03, 0xE2, 0x88, 0x84,
+    0x03, 0xE2, 0x8D, 0x8D, 0x03, 0xE2, 0x8D, 0x94, 0x03, 0xE2, 0x88, 0x89,
+    0x03, 0xE2, 0x88, 0x8C, 0x03, 0xE2, 0x8D, 0x9D, 0x03, 0xE2, 0x8D, 0x95,
+    0x03, 0xE2, 0x8D, 0x8E, 0x03, 0xE2, 0x8C, 0xBB, 0x03, 0xE2, 0x8C, 0xBE,
+    0x03, 0xE2, 0x88, 0xA4, 0x03, 0xE2, 0x88, 0xA6, 0x03, 0xE2, 0x8D, 0x93,
+    0x03, 0xE2, 0x8D, 0x8C, 0x03, 0xE2, 0x89, 0x81, 0x03, 0xE2, 0x89, 0x84,
+    0x03, 0xE2, 0x89, 0x89, 0x03, 0xE2, 0x89, 0xAD, 0x03, 0xE2, 0x8D, 0xAF,
+    0x03, 0xE2, 0x89, 0xB4, 0x03, 0xE2, 0x89, 0xB5, 0x03, 0xE2, 0x89, 0xB8,
+    0x03, 0xE2, 0x89, 0xB9, 0x03, 0xE2, 0x8A, 0x80, 0x03, 0xE2, 0x8A, 0x81,
+    0x03, 0xE2, 0x8B, 0xA0, 0x03, 0xE2, 0x8B, 0xA1, 0x03, 0xE2, 0x8A, 0x88,
+    0x03, 0xE2, 0x8A, 0x89, 0x03, 0xE2, 0x8B, 0xA2, 0x03, 0xE2, 0x8B, 0xA3,
+    0x03, 0xE2, 0x8C, 0xB6, 0x03, 0xE2, 0x8A, 0xAD, 0x03, 0xE2, 0x8A, 0xAE,
+    0x03, 0xE2, 0x8A, 0xAF, 0x03, 0xE2, 0x8B, 0xAA, 0x03, 0xE2, 0x8B, 0xAB,
+    0x03, 0xE2, 0x8B, 0xAC, 0x03, 0xE2, 0x8B, 0xAD, 0x03, 0xE2, 0x8C, 0xBA,
+    0x03, 0xE2, 0x8C, 0xBC, 0x03, 0xE2, 0xAB, 0x9C, 0x04, 0xF0, 0x9D, 0x85,
+    0x9E, 0x04, 0xF0, 0x9D, 0x85, 0x9F, 0x04, 0xF0, 0x9D, 0x85, 0xA0, 0x04,
+    0xF0, 0x9D, 0x85, 0xA1, 0x04, 0xF0, 0x9D, 0x85, 0xA2, 0x04, 0xF0, 0x9D,
+    0x85, 0xA3, 0x04, 0xF0, 0x9D, 0x85, 0xA4, 0x04, 0xF0, 0x9D, 0x86, 0xBB,
+    0x04, 0xF0, 0x9D, 0x86, 0xBC, 0x04, 0xF0, 0x9D, 0x86, 0xBD, 0x04, 0xF0,
+    0x9D, 0x86, 0xBF, 0x04, 0xF0, 0x9D, 0x86, 0xBE, 0x04, 0xF0, 0x9D, 0x87,
+    0x80,
+};
+
+const size_t caneta_compose_sequence_count = 3459;
@@ -0,0 +1,129 @@
+// caneta_gatt.c
+// HID over GATT report routing table
+
+#include "caneta_gatt.h"
+#include <string.h>
+
+#define LAYOUT_MAGIC 0xC6
+#define LAYOUT_VERSION 1
+#define REPORT_SIZE 5
+
+void caneta_gatt_layout_init(caneta_gatt_layout_t* layout) {
+    layout->count = 0;
+    layout->map_len = 0;
+}
+
+// Index of the first report whose value handle is not below handle
+static uint8_t lower_bound(const caneta_gatt_layout_t* layout, uint16_t handle) {
+    uint8_t low = 0;
+    uint8_t high = layout->count;
+    while (low < high) {
+        uint8_t mid = (uint8_t)((low + high) / 2);
+        if (layout->reports[mid].value_handle < handle) {
+            low = mid + 1;
+        } else {
+            high = mid;
+        }
+    }
+    return low;
+}
+
+bool caneta_gatt_layout_add(caneta_gatt_layout_t* layout, uint16_t value_handle, uint16_t cccd_handle,
+                            uint8_t report_id) {
+    if (layout->count == CANETA_GATT_REPORTS_MAX) return false;
+    uint8_t at = lower_bound(layout, value_handle);
+    if (at < layout->count && layout->reports[at].value_handle == value_handle) return false;
+
+    memmove(&layout->reports[at + 1], &layout->reports[at], (size_t)(layout->count - at) * sizeof(caneta_gatt_report_t));
+    layout->reports[at].value_handle = value_handle;
+    layout->reports[at].cccd_handle = cccd_handle;
+    layout->reports[at].report_id = report_id;
+    layout->count++;
+    return true;
+}
+
+bool caneta_gatt_layout_set_map(caneta_gatt_layout_t* layout, const uint8_t* map, size_t map_len) {
+    if (map_len > CANETA_GATT_REPORT_MAP_MAX) {
+        layout->map_len = 0;
+        return false;
+    }
+    if (map_len > 0) memcpy(layout->map, map, map_len);
+    layout->map_len = (uint16_t)map_len;
+    return true;
+}
+
+const caneta_gatt_report_t* caneta_gatt_layout_route(const caneta_gatt_layout_t* layout, uint16_t value_handle) {
+    uint8_t at = lower_bound(layout, value_handle);
+    if (at < layout->count && layout->reports[at].value_handle == value_handle) return &layout->reports[at];
+    return NULL;
+}
+
+// Fletcher-16: catches any single flipped bit and swapped bytes
+static uint16_t fletcher16(const uint8_t* data, size_t len) {
+    uint16_t a = 0;
+    uint16_t b = 0;
+    for (size_t i = 0; i < len; i++) {
+        a = (uint16_t)((a + data[i]) % 255);
+        b = (uint16_t)((b + a) % 255);
+    }
+    return (uint16_t)(b << 8 | a);
+}
+
+static void put16(uint8_t* p, uint16_t value) {
+    p[0] = (uint8_t)value;
+    p[1] = (uint8_t)(value >> 8);
+}
+
+static uint16_t get16(const uint8_t* p) {
+    return (uint16_t)(p[0] | p[1] << 8);
+}
+
+size_t caneta_gatt_layout_save(const caneta_gatt_layout_t* layout, uint8_t* blob, size_t blob_len) {
+    size_t len = 3 + layout->count * REPORT_SIZE + 2 + layout->map_len + 2;
+    if (blob_len < len) return 0;
+
+    uint8_t* p = blob;
+    *p++ = LAYOUT_MAGIC;
+    *p++ = LAYOUT_VERSION;
+    *p++ = layout->count;
+    for (uint8_t i = 0; i < layout->count; i++) {
+        put16(p, layout->reports[i].value_handle);
+        put16(p + 2, layout->reports[i].cccd_handle);
+        p[4] = layout->reports[i].report_id;
+        p += REPORT_SIZE;
+    }
+    put16(p, layout->map_len);
+    p += 2;
+    memcpy(p, layout->map, layout->map_len);
+    p += layout->map_len;
+    put16(p, fletcher16(blob, (size_t)(p - blob)));
+    return len;
+}
+
+bool caneta_gatt_layout_load(caneta_gatt_layout_t* layout, const uint8_t* blob, size_t blob_len) {
+    caneta_gatt_layout_init(layout);
+    if (!blob || blob_len < 3 + 2 + 2 || blob[0] != LAYOUT_MAGIC || blob[1] != LAYOUT_VERSION ||
+        blob[2] > CANETA_GATT_REPORTS_MAX) {
+        return false;
+    }
+    uint8_t count = blob[2];
+    size_t map_at = 3 + count * REPORT_SIZE;
+    if (blob_len < map_at + 2 + 2) return false;
+    uint16_t map_len = get16(blob + map_at);
+    size_t len = map_at + 2 + map_len + 2;
+    if (map_len > CANETA_GATT_REPORT_MAP_MAX || blob_len != len ||
+        get16(blob + len - 2) != fletcher16(blob, len - 2)) {
+        return false;
+    }
+
+    const uint8_t* p = blob + 3;
+    for (uint8_t i = 0; i < count; i++, p += REPORT_SIZE) {
+        // Rebuilding through add keeps the table sorted and free of repeats
+        if (!caneta_gatt_layout_add(layout, get16(p), get16(p + 2), p[4])) {
+            caneta_gatt_layout_init(layout);
+            return false;
+        }
+    }
+    caneta_gatt_layout_set_map(layout, blob + map_at + 2, map_len);
+    return true;
+}
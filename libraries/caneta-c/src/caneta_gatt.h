@@ -0,0 +1,76 @@
+// caneta_gatt.h
+// HID over GATT report routing, cached per keyboard
+//
+// A BLE keyboard may expose several Input Report characteristics (a keyboard
+// report, consumer keys, an NKRO report), each tagged with a report ID by its
+// Report Reference descriptor. The layout maps each characteristic's value
+// handle to its report ID, so a notification is routed with one lookup, and
+// it carries the handles of the CCCDs to write to subscribe. Together with
+// the report map it is all a host needs to start decoding, so saving it per
+// bonded keyboard lets a reconnect skip service discovery entirely.
+//
+// The layout is fixed-size and never allocates.
+
+#ifndef CANETA_GATT_H
+#define CANETA_GATT_H
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+// Input reports routed per keyboard
+#define CANETA_GATT_REPORTS_MAX 8
+
+// Longest report map that is cached. HID over GATT allows 512 bytes.
+#define CANETA_GATT_REPORT_MAP_MAX 512
+
+// Bytes caneta_gatt_layout_save may write: magic, version, count, the
+// reports, map length, the map, and a 16-bit checksum
+#define CANETA_GATT_BLOB_MAX (3 + CANETA_GATT_REPORTS_MAX * 5 + 2 + CANETA_GATT_REPORT_MAP_MAX + 2)
+
+typedef struct {
+  uint16_t value_handle;  // Input Report characteristic value
+  uint16_t cccd_handle;   // Its Client Characteristic Configuration descriptor
+  uint8_t report_id;      // From its Report Reference descriptor (0 if none)
+} caneta_gatt_report_t;
+
+// Treat the fields as private
+typedef struct {
+  uint8_t count;
+  caneta_gatt_report_t reports[CANETA_GATT_REPORTS_MAX];  // Sorted by value_handle
+  uint16_t map_len;       // 0 if the keyboard has no report map, or it was too long
+  uint8_t map[CANETA_GATT_REPORT_MAP_MAX];
+} caneta_gatt_layout_t;
+
+void caneta_gatt_layout_init(caneta_gatt_layout_t* layout);
+
+// Add an input report. Returns false if the layout is full or already routes
+// value_handle.
+bool caneta_gatt_layout_add(caneta_gatt_layout_t* layout, uint16_t value_handle, uint16_t cccd_handle,
+                            uint8_t report_id);
+
+// Keep the report map. Returns false, keeping none, if it is longer than
+// CANETA_GATT_REPORT_MAP_MAX.
+bool caneta_gatt_layout_set_map(caneta_gatt_layout_t* layout, const uint8_t* map, size_t map_len);
+
+// The input report a notification on value_handle belongs to, or NULL
+const caneta_gatt_report_t* caneta_gatt_layout_route(const caneta_gatt_layout_t* layout, uint16_t value_handle);
+
+// Serialize into blob (at least CANETA_GATT_BLOB_MAX bytes). Returns the bytes
+// written, or 0 if blob is too small.
+size_t caneta_gatt_layout_save(const caneta_gatt_layout_t* layout, uint8_t* blob, size_t blob_len);
+
+// Restore a saved layout. A truncated or corrupt blob leaves the layout empty
+// and returns false.
+bool caneta_gatt_layout_load(caneta_gatt_layout_t* layout, const uint8_t* blob, size_t blob_len);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif //CANETA_GATT_H
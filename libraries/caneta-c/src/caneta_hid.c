@@ -0,0 +1,515 @@
+// caneta_hid.c
+// HID report descriptor compiler and bitmap keyboard decoder
+
+#include "caneta_hid.h"
+#include <string.h>
+
+// Item types and tags from the HID 1.11 specification, section 6.2.2
+#define ITEM_MAIN   0
+#define ITEM_GLOBAL 1
+#define ITEM_LOCAL  2
+
+#define MAIN_INPUT          0x8
+#define MAIN_OUTPUT         0x9
+#define MAIN_COLLECTION     0xA
+#define MAIN_FEATURE        0xB
+#define MAIN_END_COLLECTION 0xC
+
+#define GLOBAL_USAGE_PAGE   0x0
+#define GLOBAL_LOGICAL_MIN  0x1
+#define GLOBAL_LOGICAL_MAX  0x2
+#define GLOBAL_REPORT_SIZE  0x7
+#define GLOBAL_REPORT_ID    0x8
+#define GLOBAL_REPORT_COUNT 0x9
+#define GLOBAL_PUSH         0xA
+#define GLOBAL_POP          0xB
+
+#define LOCAL_USAGE         0x0
+#define LOCAL_USAGE_MIN     0x1
+#define LOCAL_USAGE_MAX     0x2
+
+#define INPUT_CONSTANT 0x01
+#define INPUT_VARIABLE 0x02
+
+#define USAGE_PAGE_KEYBOARD 0x07
+#define LONG_ITEM_PREFIX    0xFE
+
+// Keyboard page usages that are not keys (HID usage tables, section 10)
+#define USAGE_ERROR_ROLLOVER 0x01
+
+#define MAX_USAGES      16  // Local usages remembered per main item
+#define MAX_REPORT_IDS  16  // Report IDs whose input offsets are tracked
+#define GLOBAL_STACK    4
+
+typedef struct {
+    uint16_t usage_page;
+    int32_t logical_min;
+    uint32_t report_size;
+    uint32_t report_count;
+    uint8_t report_id;
+} globals_t;
+
+typedef struct {
+    uint32_t usages[MAX_USAGES];  // Page in the high 16 bits if given with the usage
+    uint8_t usage_count;
+    uint32_t usage_min;
+    uint32_t usage_max;
+    bool has_min;
+    bool has_max;
+} locals_t;
+
+typedef struct {
+    caneta_hid_plan_t* plan;
+    uint8_t ids[MAX_REPORT_IDS];
+    uint32_t offsets[MAX_REPORT_IDS];  // Input bits so far in each report
+    uint8_t id_count;
+} compiler_t;
+
+static uint32_t* input_offset(compiler_t* c, uint8_t report_id) {
+    for (uint8_t i = 0; i < c->id_count; i++) {
+        if (c->ids[i] == report_id) return &c->offsets[i];
+    }
+    if (c->id_count == MAX_REPORT_IDS) return NULL;
+    c->ids[c->id_count] = report_id;
+    c->offsets[c->id_count] = 0;
+    return &c->offsets[c->id_count++];
+}
+
+static caneta_hid_layout_t* layout_for(caneta_hid_plan_t* plan, uint8_t report_id) {
+    for (uint8_t i = 0; i < plan->layout_count; i++) {
+        if (plan->layouts[i].report_id == report_id) return &plan->layouts[i];
+    }
+    if (plan->layout_count == CANETA_HID_MAX_REPORTS) return NULL;
+    caneta_hid_layout_t* layout = &plan->layouts[plan->layout_count++];
+    memset(layout, 0, sizeof(*layout));
+    layout->report_id = report_id;
+    return layout;
+}
+
+static bool add_field(caneta_hid_layout_t* layout, const caneta_hid_field_t* field) {
+    caneta_hid_field_t* added = NULL;
+
+    // Consecutive bitmap bits with consecutive usages extend the previous field
+    if (layout->field_count > 0) {
+        caneta_hid_field_t* last = &layout->fields[layout->field_count - 1];
+        if (field->kind == CANETA_HID_FIELD_BITMAP && last->kind == CANETA_HID_FIELD_BITMAP &&
+            last->bit_offset + last->count == field->bit_offset &&
+            last->usage_min + last->count == field->usage_min) {
+            last->count += field->count;
+            added = last;
+        }
+    }
+    if (!added) {
+        if (layout->field_count == CANETA_HID_MAX_FIELDS) return false;
+        added = &layout->fields[layout->field_count++];
+        *added = *field;
+    }
+
+    // A field that ends past the longest report can't be read
+    uint64_t end_bits = added->bit_offset + (uint64_t)added->count * added->bits;
+    uint64_t end = (end_bits + 7) / 8;
+    if (end > 255) return false;
+    if (end > layout->min_len) layout->min_len = (uint8_t)end;
+    return true;
+}
+
+// Keyboard-page usage for field index i of a main item, or -1 if it has none
+static int32_t field_usage(const globals_t* g, const locals_t* l, uint32_t i) {
+    uint32_t usage;
+    if (l->usage_count > 0) {
+        usage = l->usages[i < l->usage_count ? i : l->usage_count - 1u];
+    } else if (l->has_min) {
+        usage = l->usage_min + i;
+        if (l->has_max && (usage & 0xFFFF) > (l->usage_max & 0xFFFF)) return -1;
+    } else {
+        return -1;
+    }
+
+    uint16_t page = (usage >> 16) ? (uint16_t)(usage >> 16) : g->usage_page;
+    usage &= 0xFFFF;
+    if (page != USAGE_PAGE_KEYBOARD || usage > 0xFF) return -1;
+    return (int32_t)usage;
+}
+
+static bool compile_input(compiler_t* c, const globals_t* g, const locals_t* l, uint32_t flags) {
+    uint32_t* offset = input_offset(c, g->report_id);
+    if (!offset) return false;
+
+    // Longer than a report can be. Sizes are checked before they multiply,
+    // so a crafted count can't wrap the offset back into range.
+    if (g->report_size > 32 || g->report_count > 8 * 255) return false;
+    uint32_t start = *offset;
+    uint64_t bits = (uint64_t)g->report_size * g->report_count;
+    if (start + bits > 8 * 255) return false;
+    *offset = start + (uint32_t)bits;
+
+    if (flags & INPUT_CONSTANT || bits == 0) return true;
+
+    if (flags & INPUT_VARIABLE) {
+        // One field per usage; keys are the 1-bit ones (modifiers and NKRO bitmaps)
+        if (g->report_size != 1) return true;
+        for (uint32_t i = 0; i < g->report_count; i++) {
+            int32_t usage = field_usage(g, l, i);
+            if (usage < 0) continue;
+            caneta_hid_layout_t* layout = layout_for(c->plan, g->report_id);
+            caneta_hid_field_t field = {
+                .bit_offset = (uint16_t)(start + i), .count = 1, .kind = CANETA_HID_FIELD_BITMAP,
+                .bits = 1, .usage_min = (uint8_t)usage, .logical_min = 0,
+            };
+            if (!layout || !add_field(layout, &field)) return false;
+        }
+        return true;
+    }
+
+    // Array: every slot holds the index of a pressed key's usage
+    int32_t usage_min = field_usage(g, l, 0);
+    if (usage_min < 0) return true;
+    if (g->report_size > 16) return false;
+    caneta_hid_layout_t* layout = layout_for(c->plan, g->report_id);
+    caneta_hid_field_t field = {
+        .bit_offset = (uint16_t)start, .count = (uint16_t)g->report_count, .kind = CANETA_HID_FIELD_ARRAY,
+        .bits = (uint8_t)g->report_size, .usage_min = (uint8_t)usage_min, .logical_min = (int16_t)g->logical_min,
+    };
+    return layout && add_field(layout, &field);
+}
+
+bool caneta_hid_compile(const uint8_t* desc, size_t desc_len, caneta_hid_plan_t* plan) {
+    memset(plan, 0, sizeof(*plan));
+    if (!desc) return false;
+
+    compiler_t c = { .plan = plan };
+    globals_t g = {0};
+    globals_t stack[GLOBAL_STACK];
+    uint8_t depth = 0;
+    locals_t l = {0};
+
+    const uint8_t* p = desc;
+    const uint8_t* end = desc + desc_len;
+    bool ok = true;
+
+    while (ok && p < end) {
+        uint8_t prefix = *p++;
+
+        if (prefix == LONG_ITEM_PREFIX) {
+            // Long items carry no keyboard layout; skip the payload
+            if (end - p < 2) { ok = false; break; }
+            size_t skip = 2u + p[0];
+            if ((size_t)(end - p) < skip) { ok = false; break; }
+            p += skip;
+            continue;
+        }
+
+        uint8_t size = prefix & 0x03;
+        if (size == 3) size = 4;
+        if ((size_t)(end - p) < size) { ok = false; break; }
+
+        uint32_t data = 0;
+        for (uint8_t i = 0; i < size; i++) {
+            data |= (uint32_t)p[i] << (8 * i);
+        }
+        int32_t sdata = (int32_t)data;
+        if (size == 1) sdata = (int8_t)data;
+        if (size == 2) sdata = (int16_t)data;
+        p += size;
+
+        uint8_t type = (prefix >> 2) & 0x03;
+        uint8_t tag = prefix >> 4;
+
+        if (type == ITEM_MAIN) {
+            if (tag == MAIN_INPUT) {
+                ok = compile_input(&c, &g, &l, data);
+            }
+            // Output, feature and collection items only end the local state
+            memset(&l, 0, sizeof(l));
+        } else if (type == ITEM_GLOBAL) {
+            switch (tag) {
+                case GLOBAL_USAGE_PAGE:   g.usage_page = (uint16_t)data; break;
+                case GLOBAL_LOGICAL_MIN:  g.logical_min = sdata; break;
+                case GLOBAL_REPORT_SIZE:  g.report_size = data; break;
+                case GLOBAL_REPORT_COUNT: g.report_count = data; break;
+                case GLOBAL_REPORT_ID:
+                    if (data == 0 || data > 0xFF) { ok = false; break; }
+                    g.report_id = (uint8_t)data;
+                    plan->report_ids = true;
+                    break;
+                case GLOBAL_PUSH:
+                    if (depth == GLOBAL_STACK) { ok = false; break; }
+                    stack[depth++] = g;
+                    break;
+                case GLOBAL_POP:
+                    if (depth == 0) { ok = false; break; }
+                    g = stack[--depth];
+                    break;
+                default: break;
+            }
+        } else if (type == ITEM_LOCAL) {
+            // A 4-byte usage carries its own usage page in the high half
+            uint32_t usage = size == 4 ? data : ((uint32_t)g.usage_page << 16) | data;
+            switch (tag) {
+                case LOCAL_USAGE:
+                    if (l.usage_count < MAX_USAGES) l.usages[l.usage_count++] = usage;
+                    break;
+                case LOCAL_USAGE_MIN: l.usage_min = usage; l.has_min = true; break;
+                case LOCAL_USAGE_MAX: l.usage_max = usage; l.has_max = true; break;
+                default: break;
+            }
+        }
+    }
+
+    // A report ID applies to every report once one is declared
+    if (ok && plan->report_ids) {
+        for (uint8_t i = 0; i < plan->layout_count; i++) {
+            if (plan->layouts[i].report_id == 0) ok = false;
+        }
+    }
+
+    if (!ok || plan->layout_count == 0) {
+        memset(plan, 0, sizeof(*plan));
+        return false;
+    }
+    return true;
+}
+
+bool caneta_hid_plan_is_boot(const caneta_hid_plan_t* plan) {
+    if (plan->layout_count != 1 || plan->report_ids) return false;
+
+    const caneta_hid_layout_t* layout = &plan->layouts[0];
+    if (layout->field_count != 2) return false;
+
+    const caneta_hid_field_t* mods = &layout->fields[0];
+    const caneta_hid_field_t* keys = &layout->fields[1];
+    return mods->kind == CANETA_HID_FIELD_BITMAP && mods->bit_offset == 0 &&
+           mods->count == 8 && mods->usage_min == 0xE0 &&
+           keys->kind == CANETA_HID_FIELD_ARRAY && keys->bit_offset == 16 &&
+           keys->count == 6 && keys->bits == 8 &&
+           keys->usage_min == 0 && keys->logical_min == 0;
+}
+
+bool caneta_hid_decoder_init(caneta_hid_decoder_t* decoder, const uint8_t* desc, size_t desc_len) {
+    memset(decoder, 0, sizeof(*decoder));
+    caneta_decoder_init(&decoder->boot_decoder);
+    decoder->boot = !caneta_hid_compile(desc, desc_len, &decoder->plan) ||
+                    caneta_hid_plan_is_boot(&decoder->plan);
+    return !decoder->boot;
+}
+
+void caneta_hid_decoder_reset(caneta_hid_decoder_t* decoder) {
+    caneta_decoder_reset(&decoder->boot_decoder);
+    memset(decoder->keys, 0, sizeof(decoder->keys));
+    memset(decoder->layout_keys, 0, sizeof(decoder->layout_keys));
+    decoder->pending_usage = 0;
+    decoder->pending_offset = 0;
+}
+
+// Modifier usages 0xE0-0xE7 are bits 32-39 of the last bitmap word, in the
+// same order as the boot report modifier byte
+#define MODIFIER_WORD  3
+#define MODIFIER_SHIFT 32
+#define MODIFIER_BITS  (0xFFULL << MODIFIER_SHIFT)
+
+static inline unsigned lowest_bit(uint64_t mask) {
+#if defined(__GNUC__)
+    return (unsigned)__builtin_ctzll(mask);
+#else
+    unsigned bit = 0;
+    while (!(mask & 1u)) { mask >>= 1; bit++; }
+    return bit;
+#endif
+}
+
+void caneta_hid_decoder_state(const caneta_hid_decoder_t* decoder, kbd_state_t* state) {
+    if (decoder->boot) {
+        *state = *caneta_decoder_state(&decoder->boot_decoder);
+        return;
+    }
+
+    memset(state, 0, sizeof(*state));
+    state->modifiers = (uint8_t)(decoder->keys[MODIFIER_WORD] >> MODIFIER_SHIFT);
+    state->locks = decoder->boot_decoder.kbd.locks;
+    unsigned slot = 0;
+    for (unsigned w = 0; w < 4 && slot < 6; w++) {
+        uint64_t held = decoder->keys[w];
+        if (w == MODIFIER_WORD) held &= ~MODIFIER_BITS;
+        for (; held && slot < 6; held &= held - 1) {
+            state->last_keys[slot++] = (uint8_t)(w * 64 + lowest_bit(held));
+        }
+    }
+}
+
+// Up to 16 bits starting at bit_offset, little-endian bit order as in HID reports
+static inline uint32_t read_bits(const uint8_t* data, uint32_t bit_offset, uint8_t bits) {
+    uint32_t byte = bit_offset / 8;
+    uint32_t value = data[byte];
+    if ((bit_offset % 8) + bits > 8) value |= (uint32_t)data[byte + 1] << 8;
+    if ((bit_offset % 8) + bits > 16) value |= (uint32_t)data[byte + 2] << 16;
+    return (value >> (bit_offset % 8)) & ((1u << bits) - 1);
+}
+
+// Up to 64 bits starting at bit_offset, in a report of len bytes. Where a whole
+// word is in bounds it is loaded at once (every target is little-endian);
+// otherwise the bytes are assembled one at a time.
+static inline uint64_t read_bits64(const uint8_t* data, size_t len, uint32_t bit_offset, uint32_t bits) {
+    const uint8_t* p = data + bit_offset / 8;
+    uint32_t shift = bit_offset % 8;
+    uint32_t bytes = (shift + bits + 7) / 8;
+    uint64_t value = 0;
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+    if (bytes <= 8 && bit_offset / 8 + 8 <= len) {
+        memcpy(&value, p, 8);
+        value >>= shift;
+        return bits < 64 ? value & ((1ULL << bits) - 1) : value;
+    }
+#else
+    (void)len;
+#endif
+    for (uint32_t i = 0; i < bytes && i < 8; i++) {
+        value |= (uint64_t)p[i] << (8 * i);
+    }
+    value >>= shift;
+    if (bytes > 8) value |= (uint64_t)p[8] << (64 - shift);
+    return bits < 64 ? value & ((1ULL << bits) - 1) : value;
+}
+
+static inline void set_bits(uint64_t* keys, uint32_t usage, uint64_t value) {
+    keys[usage / 64] |= value << (usage % 64);
+    if (usage % 64 && usage / 64 < 3) {
+        keys[usage / 64 + 1] |= value >> (64 - usage % 64);
+    }
+}
+
+// Build the key bitmap for a report. Returns false for ErrorRollOver reports.
+static bool extract_keys(const caneta_hid_layout_t* layout, const uint8_t* data, size_t len, uint64_t* keys) {
+    for (uint8_t f = 0; f < layout->field_count; f++) {
+        const caneta_hid_field_t* field = &layout->fields[f];
+
+        if (field->kind == CANETA_HID_FIELD_BITMAP) {
+            // Bitmaps are copied up to a word at a time; usages past 0xFF fall off the end
+            uint32_t count = field->count;
+            if (field->usage_min + count > 0x100) count = 0x100 - field->usage_min;
+            for (uint32_t i = 0; i < count; i += 64) {
+                uint32_t n = count - i < 64 ? count - i : 64;
+                set_bits(keys, field->usage_min + i, read_bits64(data, len, field->bit_offset + i, n));
+            }
+        } else {
+            for (uint32_t i = 0; i < field->count; i++) {
+                int32_t index = (int32_t)read_bits(data, field->bit_offset + i * field->bits, field->bits);
+                int32_t usage = field->usage_min + index - field->logical_min;
+                if (usage == USAGE_ERROR_ROLLOVER) return false;
+                if (usage > 0 && usage <= 0xFF) {
+                    keys[usage / 64] |= 1ULL << (usage % 64);
+                }
+            }
+        }
+    }
+
+    // Usages 0x00-0x03 are "no event" and error codes, never keys
+    if (keys[0] & (1ULL << USAGE_ERROR_ROLLOVER)) return false;
+    keys[0] &= ~0x0FULL;
+    return true;
+}
+
+size_t caneta_hid_decoder_translate(caneta_hid_decoder_t* decoder, uint8_t report_id,
+                                    const uint8_t* data, size_t len,
+                                    uint8_t* out, size_t out_len, bool* complete) {
+    *complete = true;
+
+    if (decoder->boot) {
+        if (len < CANETA_REPORT_SIZE) return 0;
+        size_t used;
+        size_t written = caneta_translate_reports(&decoder->boot_decoder, data, 1, out, out_len, &used);
+        *complete = used == 1;
+        return written;
+    }
+
+    uint8_t index = 0;
+    while (index < decoder->plan.layout_count && decoder->plan.layouts[index].report_id != report_id) {
+        index++;
+    }
+    if (index == decoder->plan.layout_count) return 0;
+    const caneta_hid_layout_t* layout = &decoder->plan.layouts[index];
+    if (len < layout->min_len) return 0;
+
+    uint64_t report_keys[4] = {0, 0, 0, 0};
+    if (!extract_keys(layout, data, len, report_keys)) return 0;
+
+    // The report replaces its own layout's keys; the other report IDs keep
+    // theirs, so a key held on one of them is neither released nor pressed again
+    uint64_t keys[4];
+    for (unsigned w = 0; w < 4; w++) {
+        keys[w] = report_keys[w];
+        for (uint8_t i = 0; i < decoder->plan.layout_count; i++) {
+            if (i != index) keys[w] |= decoder->layout_keys[i][w];
+        }
+    }
+
+    uint8_t modifiers = (uint8_t)(keys[MODIFIER_WORD] >> MODIFIER_SHIFT);
+    size_t written = 0;
+
+    // Newly pressed usages, lowest first, resuming where the last call stopped
+    for (unsigned w = decoder->pending_usage / 64; w < 4; w++) {
+        uint64_t pressed = keys[w] & ~decoder->keys[w];
+        if (w == MODIFIER_WORD) pressed &= ~MODIFIER_BITS;
+        if (w == decoder->pending_usage / 64u) pressed &= ~0ULL << (decoder->pending_usage % 64);
+
+        while (pressed) {
+            uint8_t usage = (uint8_t)(w * 64 + lowest_bit(pressed));
+            pressed &= pressed - 1;
+
+            // The lock and compose states live in the boot decoder, idle in
+            // report protocol. Compose moves on once the key's output is out.
+            uint8_t* locks = &decoder->boot_decoder.kbd.locks;
+            *locks = caneta_locks_press(*locks, usage);
+
+            uint8_t seq[CANETA_KEY_OUTPUT_MAX];
+            uint16_t compose = decoder->boot_decoder.compose;
+            size_t n = caneta_translate_key_compose(usage, modifiers, *locks, &compose, seq);
+            size_t offset = decoder->pending_offset;
+            size_t room = out_len - written;
+
+            if (n - offset > room) {
+                // Output buffer is full: emit what fits and remember where we stopped
+                memcpy(out + written, seq + offset, room);
+                written += room;
+                decoder->pending_usage = usage;
+                decoder->pending_offset = (uint8_t)(offset + room);
+                *complete = false;
+                return written;
+            }
+
+            memcpy(out + written, seq + offset, n - offset);
+            written += n - offset;
+            decoder->pending_offset = 0;
+            decoder->boot_decoder.compose = compose;
+        }
+    }
+
+    // Report fully emitted: save it for the next comparison
+    decoder->pending_usage = 0;
+    memcpy(decoder->layout_keys[index], report_keys, sizeof(report_keys));
+    memcpy(decoder->keys, keys, sizeof(keys));
+    return written;
+}
+
+void caneta_hid_decoder_stream_id(caneta_hid_decoder_t* decoder, uint8_t report_id,
+                                  const uint8_t* data, size_t len,
+                                  const caneta_sink_t* sink) {
+    uint8_t out[CANETA_STREAM_CHUNK];
+    bool complete;
+    do {
+        size_t n = caneta_hid_decoder_translate(decoder, report_id, data, len, out, sizeof(out), &complete);
+        if (n > 0) {
+            sink->write(sink->ctx, out, n);
+        }
+    } while (!complete);
+}
+
+void caneta_hid_decoder_stream(caneta_hid_decoder_t* decoder,
+                               const uint8_t* report, size_t len,
+                               const caneta_sink_t* sink) {
+    if (decoder->plan.report_ids) {
+        if (len < 1) return;
+        caneta_hid_decoder_stream_id(decoder, report[0], report + 1, len - 1, sink);
+    } else {
+        caneta_hid_decoder_stream_id(decoder, 0, report, len, sink);
+    }
+}
@@ -0,0 +1,115 @@
+// caneta_hid.h
+// Report-protocol keyboards: HID report descriptor compiler and bitmap decoder
+//
+// A keyboard's report descriptor is compiled once, when the device is mounted,
+// into a plan that says where the modifier bits, key arrays and NKRO key
+// bitmaps sit in each report. Reports are then decoded against the plan
+// without touching the descriptor again.
+
+#ifndef CANETA_HID_H
+#define CANETA_HID_H
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "caneta.h"
+
+// Keyboard reports (report IDs) a plan can hold, and keyboard fields per report
+#define CANETA_HID_MAX_REPORTS 4
+#define CANETA_HID_MAX_FIELDS 4
+
+enum {
+  CANETA_HID_FIELD_BITMAP = 1,  // One bit per usage (modifiers, NKRO keys)
+  CANETA_HID_FIELD_ARRAY = 2    // count slots, each holding a usage index (6KRO keys)
+};
+
+// One keyboard-page input field, positioned relative to the report data
+// (after the report ID byte, if the device uses report IDs)
+typedef struct {
+  uint16_t bit_offset;
+  uint16_t count;        // Bits in a bitmap, slots in an array
+  uint8_t kind;          // CANETA_HID_FIELD_*
+  uint8_t bits;          // Bits per array slot
+  uint8_t usage_min;     // Usage of bitmap bit 0, or of array value logical_min
+  int16_t logical_min;   // Array slot value that means usage_min
+} caneta_hid_field_t;
+
+typedef struct {
+  uint8_t report_id;     // 0 when the device does not use report IDs
+  uint8_t field_count;
+  uint8_t min_len;       // Data bytes needed to read every field
+  caneta_hid_field_t fields[CANETA_HID_MAX_FIELDS];
+} caneta_hid_layout_t;
+
+// Extraction plan for every keyboard report of one HID interface
+typedef struct {
+  uint8_t layout_count;
+  bool report_ids;       // Reports start with a report ID byte
+  caneta_hid_layout_t layouts[CANETA_HID_MAX_REPORTS];
+} caneta_hid_plan_t;
+
+// Compile a report descriptor into a plan. Returns false if the descriptor is
+// malformed or describes no keyboard input (the plan is then empty).
+bool caneta_hid_compile(const uint8_t* desc, size_t desc_len, caneta_hid_plan_t* plan);
+
+// True if the plan is exactly the boot keyboard layout, so the device can be
+// switched to boot protocol and decoded by caneta_decoder_t
+bool caneta_hid_plan_is_boot(const caneta_hid_plan_t* plan);
+
+// Decoder for one HID interface. Keyboards described by a non-boot plan are
+// decoded from a 256-bit key bitmap, diffed a word at a time; everything else
+// goes through the boot report decoder. Each report ID only speaks for its own
+// keys: a key stays down while any report ID holds it. As with
+// caneta_decoder_t, treat the fields as private.
+typedef struct {
+  caneta_hid_plan_t plan;
+  bool boot;                // Decode as boot reports
+  caneta_decoder_t boot_decoder;
+  uint64_t keys[4];         // Usages down on any report ID (the union of layout_keys)
+  uint64_t layout_keys[CANETA_HID_MAX_REPORTS][4];  // Usages down per plan layout
+  uint8_t pending_usage;    // Usage to resume at in a partially translated report
+  uint8_t pending_offset;   // Bytes of that key's output already written
+} caneta_hid_decoder_t;
+
+// Prepare a decoder for a device with the given report descriptor (may be
+// NULL). Returns true if the device should be used in report protocol, false
+// if it should be switched to boot protocol.
+bool caneta_hid_decoder_init(caneta_hid_decoder_t* decoder, const uint8_t* desc, size_t desc_len);
+
+// Forget all pressed keys and modifiers, keeping the plan
+void caneta_hid_decoder_reset(caneta_hid_decoder_t* decoder);
+
+// Modifier byte (boot layout bits) and up to six held keys, lowest usage first
+void caneta_hid_decoder_state(const caneta_hid_decoder_t* decoder, kbd_state_t* state);
+
+// Translate one report's data (without the report ID byte), writing at most
+// out_len bytes. Returns the bytes written. *complete is false if out filled
+// first: call again with the same report and output resumes where it stopped.
+// Reports with an unknown ID, too short for their layout, or signalling
+// ErrorRollOver produce nothing and leave the state unchanged.
+size_t caneta_hid_decoder_translate(caneta_hid_decoder_t* decoder, uint8_t report_id,
+                                    const uint8_t* data, size_t len,
+                                    uint8_t* out, size_t out_len, bool* complete);
+
+// Translate one report as received over USB (starting with the report ID
+// byte if the plan uses report IDs) and deliver the output to sink
+void caneta_hid_decoder_stream(caneta_hid_decoder_t* decoder,
+                               const uint8_t* report, size_t len,
+                               const caneta_sink_t* sink);
+
+// Translate one report whose ID arrives separately (BLE report characteristics)
+void caneta_hid_decoder_stream_id(caneta_hid_decoder_t* decoder, uint8_t report_id,
+                                  const uint8_t* data, size_t len,
+                                  const caneta_sink_t* sink);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif //CANETA_HID_H
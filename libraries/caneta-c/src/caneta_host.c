@@ -0,0 +1,94 @@
+// caneta_host.c
+// USB host keyboards decoded behind a report ring
+
+#include "caneta_host.h"
+
+static bool interface_valid(uint8_t dev_addr, uint8_t instance) {
+    return dev_addr != 0 && dev_addr <= CANETA_HOST_MAX_DEVICES && instance < CANETA_HOST_MAX_INTERFACES;
+}
+
+bool caneta_host_post_report(caneta_ring_t* ring, uint8_t dev_addr, uint8_t instance,
+                             const uint8_t* report, size_t len) {
+    return caneta_ring_push(ring, CANETA_HOST_REPORT, dev_addr, instance, report, len);
+}
+
+bool caneta_host_post_mount(caneta_ring_t* ring, uint8_t dev_addr, uint8_t instance,
+                            const uint8_t* desc, size_t desc_len) {
+    return caneta_ring_push(ring, CANETA_HOST_MOUNT, dev_addr, instance, desc, desc_len);
+}
+
+bool caneta_host_post_unmount(caneta_ring_t* ring, uint8_t dev_addr) {
+    return caneta_ring_push(ring, CANETA_HOST_UNMOUNT, dev_addr, 0, NULL, 0);
+}
+
+void caneta_host_init(caneta_host_t* host, const caneta_repeat_config_t* repeat) {
+    for (uint8_t dev = 0; dev < CANETA_HOST_MAX_DEVICES; dev++) {
+        for (uint8_t instance = 0; instance < CANETA_HOST_MAX_INTERFACES; instance++) {
+            caneta_hid_decoder_init(&host->decoders[dev][instance], NULL, 0);
+            caneta_repeat_init(&host->repeats[dev][instance], repeat);
+        }
+    }
+}
+
+static void handle_record(caneta_host_t* host, const caneta_ring_record_t* record, uint32_t now_ms,
+                          const caneta_sink_t* sink) {
+    uint8_t dev = record->dev_addr - 1;
+    const uint8_t* data = caneta_ring_data(record);
+
+    switch (record->kind) {
+        case CANETA_HOST_REPORT: {
+            if (!interface_valid(record->dev_addr, record->instance)) return;
+            caneta_hid_decoder_t* decoder = &host->decoders[dev][record->instance];
+            caneta_hid_decoder_stream(decoder, data, record->len, sink);
+
+            kbd_state_t state;
+            caneta_hid_decoder_state(decoder, &state);
+            caneta_repeat_update(&host->repeats[dev][record->instance], &state, now_ms);
+            break;
+        }
+        case CANETA_HOST_MOUNT:
+            if (!interface_valid(record->dev_addr, record->instance)) return;
+            caneta_hid_decoder_init(&host->decoders[dev][record->instance], data, record->len);
+            caneta_repeat_reset(&host->repeats[dev][record->instance]);
+            break;
+        case CANETA_HOST_UNMOUNT:
+            if (!interface_valid(record->dev_addr, 0)) return;
+            // Back to boot decoders, in case the next device's mount is dropped
+            for (uint8_t instance = 0; instance < CANETA_HOST_MAX_INTERFACES; instance++) {
+                caneta_hid_decoder_init(&host->decoders[dev][instance], NULL, 0);
+                caneta_repeat_reset(&host->repeats[dev][instance]);
+            }
+            break;
+    }
+}
+
+size_t caneta_host_drain(caneta_host_t* host, caneta_ring_t* ring, uint32_t now_ms,
+                         const caneta_sink_t* sink) {
+    size_t handled = 0;
+    const caneta_ring_record_t* record;
+    while ((record = caneta_ring_peek(ring)) != NULL) {
+        handle_record(host, record, now_ms, sink);
+        caneta_ring_release(ring);
+        handled++;
+    }
+    return handled;
+}
+
+bool caneta_host_run_repeats(caneta_host_t* host, uint32_t now_ms, const caneta_sink_t* sink,
+                             uint32_t* deadline_ms) {
+    bool pending = false;
+    for (uint8_t dev = 0; dev < CANETA_HOST_MAX_DEVICES; dev++) {
+        for (uint8_t instance = 0; instance < CANETA_HOST_MAX_INTERFACES; instance++) {
+            caneta_repeat_t* repeat = &host->repeats[dev][instance];
+            caneta_repeat_stream(repeat, now_ms, sink);
+
+            uint32_t deadline;
+            if (caneta_repeat_next_deadline(repeat, &deadline) &&
+                (!pending || (int32_t)(deadline - *deadline_ms) < 0)) {
+                *deadline_ms = deadline;
+                pending = true;
+            }
+        }
+    }
+    return pending;
+}
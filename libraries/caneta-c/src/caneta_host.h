@@ -0,0 +1,76 @@
+// caneta_host.h
+// USB host keyboards decoded behind a report ring
+//
+// The USB host stack posts raw reports, mounts and unmounts into a
+// caneta_ring_t and never waits on translation or output. The consumer side
+// owns a decoder and a repeat engine per HID interface and drains the ring
+// into a sink, so slow output (a UART at 115200 baud) only ever backs up the
+// ring, never the USB host.
+
+#ifndef CANETA_HOST_H
+#define CANETA_HOST_H
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "caneta.h"
+#include "caneta_hid.h"
+#include "caneta_repeat.h"
+#include "caneta_ring.h"
+
+// Device addresses (starting at 1) and HID interfaces per device. Firmware
+// sets these from its USB host configuration.
+#ifndef CANETA_HOST_MAX_DEVICES
+#define CANETA_HOST_MAX_DEVICES 5
+#endif
+#ifndef CANETA_HOST_MAX_INTERFACES
+#define CANETA_HOST_MAX_INTERFACES 2
+#endif
+
+// Ring record kinds
+enum {
+  CANETA_HOST_REPORT = 1,   // Raw input report, as received
+  CANETA_HOST_MOUNT = 2,    // Report descriptor of a newly mounted interface
+  CANETA_HOST_UNMOUNT = 3   // Device gone; instance is ignored
+};
+
+// Consumer-side state. As with caneta_decoder_t, treat the fields as private.
+typedef struct {
+  caneta_hid_decoder_t decoders[CANETA_HOST_MAX_DEVICES][CANETA_HOST_MAX_INTERFACES];
+  caneta_repeat_t repeats[CANETA_HOST_MAX_DEVICES][CANETA_HOST_MAX_INTERFACES];
+} caneta_host_t;
+
+// Producer: queue a report, a mount or an unmount. Each returns false if the
+// record was dropped (counted by the ring). A dropped mount leaves the
+// interface on the boot decoder, so the device should be put in boot protocol.
+bool caneta_host_post_report(caneta_ring_t* ring, uint8_t dev_addr, uint8_t instance,
+                             const uint8_t* report, size_t len);
+bool caneta_host_post_mount(caneta_ring_t* ring, uint8_t dev_addr, uint8_t instance,
+                            const uint8_t* desc, size_t desc_len);
+bool caneta_host_post_unmount(caneta_ring_t* ring, uint8_t dev_addr);
+
+// Consumer: prepare every interface as a boot keyboard with the given repeat
+// settings (NULL for the defaults)
+void caneta_host_init(caneta_host_t* host, const caneta_repeat_config_t* repeat);
+
+// Consumer: handle every queued record, delivering output to sink. Repeat
+// timers of newly held keys start at now_ms. Returns the records handled.
+size_t caneta_host_drain(caneta_host_t* host, caneta_ring_t* ring, uint32_t now_ms,
+                         const caneta_sink_t* sink);
+
+// Consumer: fire every repeat due at or before now_ms. Returns false if no
+// key is repeating; otherwise *deadline_ms is when the next one is due.
+bool caneta_host_run_repeats(caneta_host_t* host, uint32_t now_ms, const caneta_sink_t* sink,
+                             uint32_t* deadline_ms);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif //CANETA_HOST_H
@@ -0,0 +1,27 @@
+// caneta_layout.c
+// Keyboard layout selection; the tables are in the generated caneta_layouts.c
+
+#include "caneta_layout.h"
+#include <string.h>
+
+#if !defined(__GNUC__)
+#error "caneta_layout needs the GCC/Clang __atomic builtins"
+#endif
+
+static const caneta_layout_t* active = &caneta_layouts[0];
+
+const caneta_layout_t* caneta_layout_find(const char* name) {
+    for (size_t i = 0; i < caneta_layout_count; i++) {
+        if (strcmp(caneta_layouts[i].name, name) == 0) return &caneta_layouts[i];
+    }
+    return NULL;
+}
+
+void caneta_layout_select(const caneta_layout_t* layout) {
+    __atomic_store_n(&active, layout ? layout : &caneta_layouts[0], __ATOMIC_RELAXED);
+}
+
+const caneta_layout_t* caneta_layout_active(void) {
+    // The tables are const, so there is nothing to order against
+    return __atomic_load_n(&active, __ATOMIC_RELAXED);
+}
@@ -0,0 +1,73 @@
+// caneta_layout.h
+// Keyboard layouts: the text each key types
+//
+// A layout maps a key's usage and level to UTF-8 text. The layouts are
+// described in layouts/*.layout and compiled by tools/caneta_layoutc.c into
+// caneta_layouts.c: const tables the linker leaves in flash. Every layout has
+// the same shape, so a lookup is one index into the active table whichever
+// layout it is, and selecting another layout swaps a pointer.
+//
+// There are four levels: base, Shift, AltGr and Shift+AltGr. AltGr is the
+// right Alt key on layouts that have it, and plain Alt elsewhere. Keypad keys
+// type their layout's digits and decimal separator while NumLock is on and act
+// as the navigation keys while it is off; each decoder keeps its keyboard's
+// NumLock in kbd_state_t.locks. Dead keys and the Compose key start
+// sequences, see caneta_compose.h.
+
+#ifndef CANETA_LAYOUT_H
+#define CANETA_LAYOUT_H
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+// Usages a layout covers: the main block, keypad and non-US keys, up to
+// Keypad = (0x67)
+#define CANETA_LAYOUT_USAGES 0x68
+
+// UTF-8 bytes per key and level, NUL padded: one code point
+#define CANETA_LAYOUT_CELL 4
+
+enum {
+  CANETA_LEVEL_BASE = 0,
+  CANETA_LEVEL_SHIFT = 1,
+  CANETA_LEVEL_ALTGR = 2,
+  CANETA_LEVEL_SHIFT_ALTGR = 3,
+  CANETA_LAYOUT_LEVELS
+};
+
+// Layout flags
+#define CANETA_LAYOUT_ALTGR 0x01  // Right Alt selects the AltGr levels
+
+typedef struct {
+  const char* name;         // Short name: "us", "de", ...
+  const char* description;
+  uint8_t flags;            // CANETA_LAYOUT_*
+  char keys[CANETA_LAYOUT_USAGES][CANETA_LAYOUT_LEVELS][CANETA_LAYOUT_CELL];
+} caneta_layout_t;
+
+// Every compiled layout, US first (generated)
+extern const caneta_layout_t caneta_layouts[];
+extern const size_t caneta_layout_count;
+
+// The layout with this name, or NULL
+const caneta_layout_t* caneta_layout_find(const char* name);
+
+// Make layout the one every decoder types with (NULL for US, the default).
+// Safe to call while another thread or core is decoding: keys already being
+// translated finish with the old layout.
+void caneta_layout_select(const caneta_layout_t* layout);
+
+// The layout keys are translated with
+const caneta_layout_t* caneta_layout_active(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif //CANETA_LAYOUT_H
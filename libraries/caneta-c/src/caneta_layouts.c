@@ -0,0 +1,549 @@
+// caneta_layouts.c
+// Keyboard layout tables. Generated by tools/caneta_layoutc.c from
+// layouts/*.layout; do not edit. Regenerate with the caneta-layouts target.
+
+#include "caneta_layout.h"
+
+const caneta_layout_t caneta_layouts[] = {
+    {
+        "us", "English (US)", 0,
+        {
+            [0x04] = {"a", "A"},
+            [0x05] = {"b", "B"},
+            [0x06] = {"c", "C"},
+            [0x07] = {"d", "D"},
+            [0x08] = {"e", "E"},
+            [0x09] = {"f", "F"},
+            [0x0A] = {"g", "G"},
+            [0x0B] = {"h", "H"},
+            [0x0C] = {"i", "I"},
+            [0x0D] = {"j", "J"},
+            [0x0E] = {"k", "K"},
+            [0x0F] = {"l", "L"},
+            [0x10] = {"m", "M"},
+            [0x11] = {"n", "N"},
+            [0x12] = {"o", "O"},
+            [0x13] = {"p", "P"},
+            [0x14] = {"q", "Q"},
+            [0x15] = {"r", "R"},
+            [0x16] = {"s", "S"},
+            [0x17] = {"t", "T"},
+            [0x18] = {"u", "U"},
+            [0x19] = {"v", "V"},
+            [0x1A] = {"w", "W"},
+            [0x1B] = {"x", "X"},
+            [0x1C] = {"y", "Y"},
+            [0x1D] = {"z", "Z"},
+            [0x1E] = {"1", "!"},
+            [0x1F] = {"2", "@"},
+            [0x20] = {"3", "#"},
+            [0x21] = {"4", "$"},
+            [0x22] = {"5", "%"},
+            [0x23] = {"6", "^"},
+            [0x24] = {"7", "&"},
+            [0x25] = {"8", "*"},
+            [0x26] = {"9", "("},
+            [0x27] = {"0", ")"},
+            [0x28] = {"\x0D", "\x0D"},
+            [0x29] = {"\x1B", "\x1B"},
+            [0x2A] = {"\x08", "\x08"},
+            [0x2B] = {"\x09", "\x09"},
+            [0x2C] = {" ", " "},
+            [0x2D] = {"-", "_"},
+            [0x2E] = {"=", "+"},
+            [0x2F] = {"[", "{"},
+            [0x30] = {"]", "}"},
+            [0x31] = {"\\", "|"},
+            [0x32] = {"\\", "|"},
+            [0x33] = {";", ":"},
+            [0x34] = {"'", "\""},
+            [0x35] = {"`", "~"},
+            [0x36] = {",", "<"},
+            [0x37] = {".", ">"},
+            [0x38] = {"/", "?"},
+            [0x54] = {"/", "/"},
+            [0x55] = {"*", "*"},
+            [0x56] = {"-", "-"},
+            [0x57] = {"+", "+"},
+            [0x58] = {"\x0D", "\x0D"},
+            [0x59] = {"1", "1"},
+            [0x5A] = {"2", "2"},
+            [0x5B] = {"3", "3"},
+            [0x5C] = {"4", "4"},
+            [0x5D] = {"5", "5"},
+            [0x5E] = {"6", "6"},
+            [0x5F] = {"7", "7"},
+            [0x60] = {"8", "8"},
+            [0x61] = {"9", "9"},
+            [0x62] = {"0", "0"},
+            [0x63] = {".", "."},
+            [0x64] = {"\\", "|"},
+            [0x65] = {"\x81", "\x81", "\x81", "\x81"},
+            [0x67] = {"=", "="},
+        },
+    },
+    {
+        "de", "German", CANETA_LAYOUT_ALTGR,
+        {
+            [0x04] = {"a", "A"},
+            [0x05] = {"b", "B"},
+            [0x06] = {"c", "C"},
+            [0x07] = {"d", "D"},
+            [0x08] = {"e", "E", "\xE2\x82\xAC"},
+            [0x09] = {"f", "F"},
+            [0x0A] = {"g", "G"},
+            [0x0B] = {"h", "H"},
+            [0x0C] = {"i", "I"},
+            [0x0D] = {"j", "J"},
+            [0x0E] = {"k", "K"},
+            [0x0F] = {"l", "L"},
+            [0x10] = {"m", "M", "\xC2\xB5"},
+            [0x11] = {"n", "N"},
+            [0x12] = {"o", "O"},
+            [0x13] = {"p", "P"},
+            [0x14] = {"q", "Q", "@"},
+            [0x15] = {"r", "R"},
+            [0x16] = {"s", "S"},
+            [0x17] = {"t", "T"},
+            [0x18] = {"u", "U"},
+            [0x19] = {"v", "V"},
+            [0x1A] = {"w", "W"},
+            [0x1B] = {"x", "X"},
+            [0x1C] = {"z", "Z"},
+            [0x1D] = {"y", "Y"},
+            [0x1E] = {"1", "!"},
+            [0x1F] = {"2", "\"", "\xC2\xB2"},
+            [0x20] = {"3", "\xC2\xA7", "\xC2\xB3"},
+            [0x21] = {"4", "$"},
+            [0x22] = {"5", "%"},
+            [0x23] = {"6", "&"},
+            [0x24] = {"7", "/", "{"},
+            [0x25] = {"8", "(", "["},
+            [0x26] = {"9", ")", "]"},
+            [0x27] = {"0", "=", "}"},
+            [0x28] = {"\x0D", "\x0D"},
+            [0x29] = {"\x1B", "\x1B"},
+            [0x2A] = {"\x08", "\x08"},
+            [0x2B] = {"\x09", "\x09"},
+            [0x2C] = {" ", " "},
+            [0x2D] = {"\xC3\x9F", "?", "\\"},
+            [0x2E] = {"\x80\xCC\x81", "\x80\xCC\x80"},
+            [0x2F] = {"\xC3\xBC", "\xC3\x9C"},
+            [0x30] = {"+", "*", "~"},
+            [0x31] = {"#", "'"},
+            [0x32] = {"#", "'"},
+            [0x33] = {"\xC3\xB6", "\xC3\x96"},
+            [0x34] = {"\xC3\xA4", "\xC3\x84"},
+            [0x35] = {"\x80\xCC\x82", "\xC2\xB0"},
+            [0x36] = {",", ";"},
+            [0x37] = {".", ":"},
+            [0x38] = {"-", "_"},
+            [0x54] = {"/", "/"},
+            [0x55] = {"*", "*"},
+            [0x56] = {"-", "-"},
+            [0x57] = {"+", "+"},
+            [0x58] = {"\x0D", "\x0D"},
+            [0x59] = {"1", "1"},
+            [0x5A] = {"2", "2"},
+            [0x5B] = {"3", "3"},
+            [0x5C] = {"4", "4"},
+            [0x5D] = {"5", "5"},
+            [0x5E] = {"6", "6"},
+            [0x5F] = {"7", "7"},
+            [0x60] = {"8", "8"},
+            [0x61] = {"9", "9"},
+            [0x62] = {"0", "0"},
+            [0x63] = {",", ","},
+            [0x64] = {"<", ">", "|"},
+            [0x65] = {"\x81", "\x81", "\x81", "\x81"},
+            [0x67] = {"=", "="},
+        },
+    },
+    {
+        "dk", "Danish", CANETA_LAYOUT_ALTGR,
+        {
+            [0x04] = {"a", "A"},
+            [0x05] = {"b", "B"},
+            [0x06] = {"c", "C"},
+            [0x07] = {"d", "D"},
+            [0x08] = {"e", "E", "\xE2\x82\xAC"},
+            [0x09] = {"f", "F"},
+            [0x0A] = {"g", "G"},
+            [0x0B] = {"h", "H"},
+            [0x0C] = {"i", "I"},
+            [0x0D] = {"j", "J"},
+            [0x0E] = {"k", "K"},
+            [0x0F] = {"l", "L"},
+            [0x10] = {"m", "M", "\xC2\xB5"},
+            [0x11] = {"n", "N"},
+            [0x12] = {"o", "O"},
+            [0x13] = {"p", "P"},
+            [0x14] = {"q", "Q"},
+            [0x15] = {"r", "R"},
+            [0x16] = {"s", "S"},
+            [0x17] = {"t", "T"},
+            [0x18] = {"u", "U"},
+            [0x19] = {"v", "V"},
+            [0x1A] = {"w", "W"},
+            [0x1B] = {"x", "X"},
+            [0x1C] = {"y", "Y"},
+            [0x1D] = {"z", "Z"},
+            [0x1E] = {"1", "!"},
+            [0x1F] = {"2", "\"", "@"},
+            [0x20] = {"3", "#", "\xC2\xA3"},
+            [0x21] = {"4", "\xC2\xA4", "$"},
+            [0x22] = {"5", "%", "\xE2\x82\xAC"},
+            [0x23] = {"6", "&"},
+            [0x24] = {"7", "/", "{"},
+            [0x25] = {"8", "(", "["},
+            [0x26] = {"9", ")", "]"},
+            [0x27] = {"0", "=", "}"},
+            [0x28] = {"\x0D", "\x0D"},
+            [0x29] = {"\x1B", "\x1B"},
+            [0x2A] = {"\x08", "\x08"},
+            [0x2B] = {"\x09", "\x09"},
+            [0x2C] = {" ", " "},
+            [0x2D] = {"+", "?"},
+            [0x2E] = {"\x80\xCC\x81", "\x80\xCC\x80", "|"},
+            [0x2F] = {"\xC3\xA5", "\xC3\x85"},
+            [0x30] = {"\x80\xCC\x88", "\x80\xCC\x82", "\x80\xCC\x83"},
+            [0x31] = {"'", "*"},
+            [0x32] = {"'", "*"},
+            [0x33] = {"\xC3\xA6", "\xC3\x86"},
+            [0x34] = {"\xC3\xB8", "\xC3\x98"},
+            [0x35] = {"\xC2\xBD", "\xC2\xA7"},
+            [0x36] = {",", ";"},
+            [0x37] = {".", ":"},
+            [0x38] = {"-", "_"},
+            [0x54] = {"/", "/"},
+            [0x55] = {"*", "*"},
+            [0x56] = {"-", "-"},
+            [0x57] = {"+", "+"},
+            [0x58] = {"\x0D", "\x0D"},
+            [0x59] = {"1", "1"},
+            [0x5A] = {"2", "2"},
+            [0x5B] = {"3", "3"},
+            [0x5C] = {"4", "4"},
+            [0x5D] = {"5", "5"},
+            [0x5E] = {"6", "6"},
+            [0x5F] = {"7", "7"},
+            [0x60] = {"8", "8"},
+            [0x61] = {"9", "9"},
+            [0x62] = {"0", "0"},
+            [0x63] = {",", ","},
+            [0x64] = {"<", ">", "\\"},
+            [0x65] = {"\x81", "\x81", "\x81", "\x81"},
+            [0x67] = {"=", "="},
+        },
+    },
+    {
+        "fi", "Finnish", CANETA_LAYOUT_ALTGR,
+        {
+            [0x04] = {"a", "A"},
+            [0x05] = {"b", "B"},
+            [0x06] = {"c", "C"},
+            [0x07] = {"d", "D"},
+            [0x08] = {"e", "E", "\xE2\x82\xAC"},
+            [0x09] = {"f", "F"},
+            [0x0A] = {"g", "G"},
+            [0x0B] = {"h", "H"},
+            [0x0C] = {"i", "I"},
+            [0x0D] = {"j", "J"},
+            [0x0E] = {"k", "K"},
+            [0x0F] = {"l", "L"},
+            [0x10] = {"m", "M", "\xC2\xB5"},
+            [0x11] = {"n", "N"},
+            [0x12] = {"o", "O"},
+            [0x13] = {"p", "P"},
+            [0x14] = {"q", "Q"},
+            [0x15] = {"r", "R"},
+            [0x16] = {"s", "S"},
+            [0x17] = {"t", "T"},
+            [0x18] = {"u", "U"},
+            [0x19] = {"v", "V"},
+            [0x1A] = {"w", "W"},
+            [0x1B] = {"x", "X"},
+            [0x1C] = {"y", "Y"},
+            [0x1D] = {"z", "Z"},
+            [0x1E] = {"1", "!"},
+            [0x1F] = {"2", "\"", "@"},
+            [0x20] = {"3", "#", "\xC2\xA3"},
+            [0x21] = {"4", "\xC2\xA4", "$"},
+            [0x22] = {"5", "%", "\xE2\x82\xAC"},
+            [0x23] = {"6", "&"},
+            [0x24] = {"7", "/", "{"},
+            [0x25] = {"8", "(", "["},
+            [0x26] = {"9", ")", "]"},
+            [0x27] = {"0", "=", "}"},
+            [0x28] = {"\x0D", "\x0D"},
+            [0x29] = {"\x1B", "\x1B"},
+            [0x2A] = {"\x08", "\x08"},
+            [0x2B] = {"\x09", "\x09"},
+            [0x2C] = {" ", " "},
+            [0x2D] = {"+", "?", "\\"},
+            [0x2E] = {"\x80\xCC\x81", "\x80\xCC\x80"},
+            [0x2F] = {"\xC3\xA5", "\xC3\x85"},
+            [0x30] = {"\x80\xCC\x88", "\x80\xCC\x82", "\x80\xCC\x83"},
+            [0x31] = {"'", "*"},
+            [0x32] = {"'", "*"},
+            [0x33] = {"\xC3\xB6", "\xC3\x96"},
+            [0x34] = {"\xC3\xA4", "\xC3\x84"},
+            [0x35] = {"\xC2\xA7", "\xC2\xBD"},
+            [0x36] = {",", ";"},
+            [0x37] = {".", ":"},
+            [0x38] = {"-", "_"},
+            [0x54] = {"/", "/"},
+            [0x55] = {"*", "*"},
+            [0x56] = {"-", "-"},
+            [0x57] = {"+", "+"},
+            [0x58] = {"\x0D", "\x0D"},
+            [0x59] = {"1", "1"},
+            [0x5A] = {"2", "2"},
+            [0x5B] = {"3", "3"},
+            [0x5C] = {"4", "4"},
+            [0x5D] = {"5", "5"},
+            [0x5E] = {"6", "6"},
+            [0x5F] = {"7", "7"},
+            [0x60] = {"8", "8"},
+            [0x61] = {"9", "9"},
+            [0x62] = {"0", "0"},
+            [0x63] = {",", ","},
+            [0x64] = {"<", ">", "|"},
+            [0x65] = {"\x81", "\x81", "\x81", "\x81"},
+            [0x67] = {"=", "="},
+        },
+    },
+    {
+        "fr", "French", CANETA_LAYOUT_ALTGR,
+        {
+            [0x04] = {"q", "Q"},
+            [0x05] = {"b", "B"},
+            [0x06] = {"c", "C"},
+            [0x07] = {"d", "D"},
+            [0x08] = {"e", "E", "\xE2\x82\xAC"},
+            [0x09] = {"f", "F"},
+            [0x0A] = {"g", "G"},
+            [0x0B] = {"h", "H"},
+            [0x0C] = {"i", "I"},
+            [0x0D] = {"j", "J"},
+            [0x0E] = {"k", "K"},
+            [0x0F] = {"l", "L"},
+            [0x10] = {",", "?"},
+            [0x11] = {"n", "N"},
+            [0x12] = {"o", "O"},
+            [0x13] = {"p", "P"},
+            [0x14] = {"a", "A"},
+            [0x15] = {"r", "R"},
+            [0x16] = {"s", "S"},
+            [0x17] = {"t", "T"},
+            [0x18] = {"u", "U"},
+            [0x19] = {"v", "V"},
+            [0x1A] = {"z", "Z"},
+            [0x1B] = {"x", "X"},
+            [0x1C] = {"y", "Y"},
+            [0x1D] = {"w", "W"},
+            [0x1E] = {"&", "1"},
+            [0x1F] = {"\xC3\xA9", "2", "\x80\xCC\x83"},
+            [0x20] = {"\"", "3", "#"},
+            [0x21] = {"'", "4", "{"},
+            [0x22] = {"(", "5", "["},
+            [0x23] = {"-", "6", "|"},
+            [0x24] = {"\xC3\xA8", "7", "\x80\xCC\x80"},
+            [0x25] = {"_", "8", "\\"},
+            [0x26] = {"\xC3\xA7", "9", "^"},
+            [0x27] = {"\xC3\xA0", "0", "@"},
+            [0x28] = {"\x0D", "\x0D"},
+            [0x29] = {"\x1B", "\x1B"},
+            [0x2A] = {"\x08", "\x08"},
+            [0x2B] = {"\x09", "\x09"},
+            [0x2C] = {" ", " "},
+            [0x2D] = {")", "\xC2\xB0", "]"},
+            [0x2E] = {"=", "+", "}"},
+            [0x2F] = {"\x80\xCC\x82", "\x80\xCC\x88"},
+            [0x30] = {"$", "\xC2\xA3", "\xC2\xA4"},
+            [0x31] = {"*", "\xC2\xB5"},
+            [0x32] = {"*", "\xC2\xB5"},
+            [0x33] = {"m", "M"},
+            [0x34] = {"\xC3\xB9", "%"},
+            [0x35] = {"\xC2\xB2"},
+            [0x36] = {";", "."},
+            [0x37] = {":", "/"},
+            [0x38] = {"!", "\xC2\xA7"},
+            [0x54] = {"/", "/"},
+            [0x55] = {"*", "*"},
+            [0x56] = {"-", "-"},
+            [0x57] = {"+", "+"},
+            [0x58] = {"\x0D", "\x0D"},
+            [0x59] = {"1", "1"},
+            [0x5A] = {"2", "2"},
+            [0x5B] = {"3", "3"},
+            [0x5C] = {"4", "4"},
+            [0x5D] = {"5", "5"},
+            [0x5E] = {"6", "6"},
+            [0x5F] = {"7", "7"},
+            [0x60] = {"8", "8"},
+            [0x61] = {"9", "9"},
+            [0x62] = {"0", "0"},
+            [0x63] = {".", "."},
+            [0x64] = {"<", ">"},
+            [0x65] = {"\x81", "\x81", "\x81", "\x81"},
+            [0x67] = {"=", "="},
+        },
+    },
+    {
+        "no", "Norwegian", CANETA_LAYOUT_ALTGR,
+        {
+            [0x04] = {"a", "A"},
+            [0x05] = {"b", "B"},
+            [0x06] = {"c", "C"},
+            [0x07] = {"d", "D"},
+            [0x08] = {"e", "E", "\xE2\x82\xAC"},
+            [0x09] = {"f", "F"},
+            [0x0A] = {"g", "G"},
+            [0x0B] = {"h", "H"},
+            [0x0C] = {"i", "I"},
+            [0x0D] = {"j", "J"},
+            [0x0E] = {"k", "K"},
+            [0x0F] = {"l", "L"},
+            [0x10] = {"m", "M", "\xC2\xB5"},
+            [0x11] = {"n", "N"},
+            [0x12] = {"o", "O"},
+            [0x13] = {"p", "P"},
+            [0x14] = {"q", "Q"},
+            [0x15] = {"r", "R"},
+            [0x16] = {"s", "S"},
+            [0x17] = {"t", "T"},
+            [0x18] = {"u", "U"},
+            [0x19] = {"v", "V"},
+            [0x1A] = {"w", "W"},
+            [0x1B] = {"x", "X"},
+            [0x1C] = {"y", "Y"},
+            [0x1D] = {"z", "Z"},
+            [0x1E] = {"1", "!"},
+            [0x1F] = {"2", "\"", "@"},
+            [0x20] = {"3", "#", "\xC2\xA3"},
+            [0x21] = {"4", "\xC2\xA4", "$"},
+            [0x22] = {"5", "%", "\xE2\x82\xAC"},
+            [0x23] = {"6", "&"},
+            [0x24] = {"7", "/", "{"},
+            [0x25] = {"8", "(", "["},
+            [0x26] = {"9", ")", "]"},
+            [0x27] = {"0", "=", "}"},
+            [0x28] = {"\x0D", "\x0D"},
+            [0x29] = {"\x1B", "\x1B"},
+            [0x2A] = {"\x08", "\x08"},
+            [0x2B] = {"\x09", "\x09"},
+            [0x2C] = {" ", " "},
+            [0x2D] = {"+", "?"},
+            [0x2E] = {"\\", "\x80\xCC\x80", "\x80\xCC\x81"},
+            [0x2F] = {"\xC3\xA5", "\xC3\x85"},
+            [0x30] = {"\x80\xCC\x88", "\x80\xCC\x82", "\x80\xCC\x83"},
+            [0x31] = {"'", "*"},
+            [0x32] = {"'", "*"},
+            [0x33] = {"\xC3\xB8", "\xC3\x98"},
+            [0x34] = {"\xC3\xA6", "\xC3\x86"},
+            [0x35] = {"|", "\xC2\xA7"},
+            [0x36] = {",", ";"},
+            [0x37] = {".", ":"},
+            [0x38] = {"-", "_"},
+            [0x54] = {"/", "/"},
+            [0x55] = {"*", "*"},
+            [0x56] = {"-", "-"},
+            [0x57] = {"+", "+"},
+            [0x58] = {"\x0D", "\x0D"},
+            [0x59] = {"1", "1"},
+            [0x5A] = {"2", "2"},
+            [0x5B] = {"3", "3"},
+            [0x5C] = {"4", "4"},
+            [0x5D] = {"5", "5"},
+            [0x5E] = {"6", "6"},
+            [0x5F] = {"7", "7"},
+            [0x60] = {"8", "8"},
+            [0x61] = {"9", "9"},
+            [0x62] = {"0", "0"},
+            [0x63] = {",", ","},
+            [0x64] = {"<", ">"},
+            [0x65] = {"\x81", "\x81", "\x81", "\x81"},
+            [0x67] = {"=", "="},
+        },
+    },
+    {
+        "se", "Swedish", CANETA_LAYOUT_ALTGR,
+        {
+            [0x04] = {"a", "A"},
+            [0x05] = {"b", "B"},
+            [0x06] = {"c", "C"},
+            [0x07] = {"d", "D"},
+            [0x08] = {"e", "E", "\xE2\x82\xAC"},
+            [0x09] = {"f", "F"},
+            [0x0A] = {"g", "G"},
+            [0x0B] = {"h", "H"},
+            [0x0C] = {"i", "I"},
+            [0x0D] = {"j", "J"},
+            [0x0E] = {"k", "K"},
+            [0x0F] = {"l", "L"},
+            [0x10] = {"m", "M", "\xC2\xB5"},
+            [0x11] = {"n", "N"},
+            [0x12] = {"o", "O"},
+            [0x13] = {"p", "P"},
+            [0x14] = {"q", "Q"},
+            [0x15] = {"r", "R"},
+            [0x16] = {"s", "S"},
+            [0x17] = {"t", "T"},
+            [0x18] = {"u", "U"},
+            [0x19] = {"v", "V"},
+            [0x1A] = {"w", "W"},
+            [0x1B] = {"x", "X"},
+            [0x1C] = {"y", "Y"},
+            [0x1D] = {"z", "Z"},
+            [0x1E] = {"1", "!"},
+            [0x1F] = {"2", "\"", "@"},
+            [0x20] = {"3", "#", "\xC2\xA3"},
+            [0x21] = {"4", "\xC2\xA4", "$"},
+            [0x22] = {"5", "%", "\xE2\x82\xAC"},
+            [0x23] = {"6", "&"},
+            [0x24] = {"7", "/", "{"},
+            [0x25] = {"8", "(", "["},
+            [0x26] = {"9", ")", "]"},
+            [0x27] = {"0", "=", "}"},
+            [0x28] = {"\x0D", "\x0D"},
+            [0x29] = {"\x1B", "\x1B"},
+            [0x2A] = {"\x08", "\x08"},
+            [0x2B] = {"\x09", "\x09"},
+            [0x2C] = {" ", " "},
+            [0x2D] = {"+", "?", "\\"},
+            [0x2E] = {"\x80\xCC\x81", "\x80\xCC\x80"},
+            [0x2F] = {"\xC3\xA5", "\xC3\x85"},
+            [0x30] = {"\x80\xCC\x88", "\x80\xCC\x82", "\x80\xCC\x83"},
+            [0x31] = {"'", "*"},
+            [0x32] = {"'", "*"},
+            [0x33] = {"\xC3\xB6", "\xC3\x96"},
+            [0x34] = {"\xC3\xA4", "\xC3\x84"},
+            [0x35] = {"\xC2\xA7", "\xC2\xBD"},
+            [0x36] = {",", ";"},
+            [0x37] = {".", ":"},
+            [0x38] = {"-", "_"},
+            [0x54] = {"/", "/"},
+            [0x55] = {"*", "*"},
+            [0x56] = {"-", "-"},
+            [0x57] = {"+", "+"},
+            [0x58] = {"\x0D", "\x0D"},
+            [0x59] = {"1", "1"},
+            [0x5A] = {"2", "2"},
+            [0x5B] = {"3", "3"},
+            [0x5C] = {"4", "4"},
+            [0x5D] = {"5", "5"},
+            [0x5E] = {"6", "6"},
+            [0x5F] = {"7", "7"},
+            [0x60] = {"8", "8"},
+            [0x61] = {"9", "9"},
+            [0x62] = {"0", "0"},
+            [0x63] = {",", ","},
+            [0x64] = {"<", ">", "|"},
+            [0x65] = {"\x81", "\x81", "\x81", "\x81"},
+            [0x67] = {"=", "="},
+        },
+    },
+};
+
+const size_t caneta_layout_count = 7;
@@ -0,0 +1,110 @@
+// caneta_link.c
+// Connection parameter profiles and report arrival jitter
+
+#include "caneta_link.h"
+#include <string.h>
+
+#define INTERVAL_MIN 6
+#define INTERVAL_MAX 3200
+#define LATENCY_MAX 499
+#define TIMEOUT_MIN 10
+#define TIMEOUT_MAX 3200
+
+// Histogram bins are interval units, so a gap lands in the nearest one
+#define HALF_UNIT_US (CANETA_LINK_INTERVAL_US / 2)
+
+bool caneta_link_params_for(caneta_link_profile_t profile, caneta_link_params_t* params) {
+    switch (profile) {
+        case CANETA_LINK_TYPING:
+            *params = (caneta_link_params_t){6, 12, 0, 200};
+            return true;
+        case CANETA_LINK_BALANCED:
+            *params = (caneta_link_params_t){12, 24, 0, 400};
+            return true;
+        case CANETA_LINK_LOW_POWER:
+            *params = (caneta_link_params_t){24, 40, 4, 600};
+            return true;
+        case CANETA_LINK_KEYBOARD:
+            break;
+    }
+    return false;
+}
+
+bool caneta_link_params_valid(const caneta_link_params_t* params) {
+    if (params->min_interval < INTERVAL_MIN || params->max_interval > INTERVAL_MAX ||
+        params->min_interval > params->max_interval || params->latency > LATENCY_MAX ||
+        params->timeout < TIMEOUT_MIN || params->timeout > TIMEOUT_MAX) {
+        return false;
+    }
+
+    // timeout * 10 ms > (1 + latency) * max_interval * 1.25 ms * 2
+    return (uint32_t)params->timeout * 4 > (1u + params->latency) * params->max_interval;
+}
+
+void caneta_jitter_init(caneta_jitter_t* jitter, uint32_t interval_us) {
+    memset(jitter, 0, sizeof(*jitter));
+    jitter->interval_us = interval_us;
+}
+
+void caneta_jitter_record(caneta_jitter_t* jitter, uint32_t now_us) {
+    uint32_t gap = now_us - jitter->last_us;
+    jitter->last_us = now_us;
+    if (jitter->count++ == 0) return;
+
+    // Reports sent in the same connection event, and pauses in typing, say
+    // nothing about the interval
+    uint32_t bin = (gap + HALF_UNIT_US) / CANETA_LINK_INTERVAL_US;
+    if (bin == 0 || bin >= CANETA_JITTER_BINS) return;
+
+    // Halve the histogram rather than let a bin saturate, so it keeps its shape
+    if (jitter->hist[bin] == UINT16_MAX) {
+        jitter->gaps = 0;
+        for (int i = 0; i < CANETA_JITTER_BINS; i++) {
+            jitter->hist[i] /= 2;
+            jitter->gaps += jitter->hist[i];
+        }
+    }
+    jitter->hist[bin]++;
+    jitter->gaps++;
+
+    if (jitter->interval_us > 0) {
+        uint32_t off = gap % jitter->interval_us;
+        if (off > jitter->interval_us - off) off = jitter->interval_us - off;
+        if (off > jitter->max_jitter_us) jitter->max_jitter_us = off;
+        jitter->jitter_sum_us += off;
+        jitter->jitter_count++;
+    }
+}
+
+uint32_t caneta_jitter_mean_us(const caneta_jitter_t* jitter) {
+    return jitter->jitter_count ? (uint32_t)(jitter->jitter_sum_us / jitter->jitter_count) : 0;
+}
+
+uint32_t caneta_jitter_max_us(const caneta_jitter_t* jitter) {
+    return jitter->max_jitter_us;
+}
+
+uint32_t caneta_jitter_estimate_us(const caneta_jitter_t* jitter) {
+    if (jitter->gaps < CANETA_JITTER_MIN_GAPS) return 0;
+
+    // Longest first: every multiple of the true interval fits too, but no
+    // longer interval fits most gaps
+    for (uint32_t candidate = CANETA_JITTER_BINS - 1; candidate >= INTERVAL_MIN; candidate--) {
+        uint32_t fit = 0;
+        for (uint32_t bin = 1; bin < CANETA_JITTER_BINS; bin++) {
+            uint32_t multiple = (bin + candidate / 2) / candidate;
+            if (multiple == 0) continue;
+            uint32_t grid = multiple * candidate;
+            if (bin + 1 >= grid && bin <= grid + 1) fit += jitter->hist[bin];
+        }
+        if ((uint64_t)fit * 10 >= (uint64_t)jitter->gaps * 9) return candidate * CANETA_LINK_INTERVAL_US;
+    }
+    return 0;
+}
+
+bool caneta_jitter_in_effect(const caneta_jitter_t* jitter) {
+    uint32_t estimate = caneta_jitter_estimate_us(jitter);
+    if (estimate == 0 || jitter->interval_us == 0) return false;
+    uint32_t diff = estimate > jitter->interval_us ? estimate - jitter->interval_us : jitter->interval_us - estimate;
+    return diff <= CANETA_LINK_INTERVAL_US;
+}
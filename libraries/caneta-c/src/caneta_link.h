@@ -0,0 +1,99 @@
+// caneta_link.h
+// Bluetooth LE connection parameters for keyboards, and checking them
+//
+// A keyboard's report can only cross the link at a connection event, so a
+// keystroke waits up to a whole connection interval. Keyboards tend to
+// offer 30-50 ms; a typing host wants the 7.5 ms minimum and no slave
+// latency, a battery-minded one something in between. A profile names the
+// parameters to request after connecting.
+//
+// The peer may refuse or the controller may settle on something else, so the
+// jitter tracker checks what is really in effect: reports arrive on a grid of
+// connection events, and the gaps between them are whole numbers of the
+// interval. It keeps a histogram of the gaps (fixed size, no allocation),
+// measures how far they sit from the expected grid, and estimates the
+// interval actually in use. Times are passed in microseconds and may wrap.
+
+#ifndef CANETA_LINK_H
+#define CANETA_LINK_H
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+// Connection parameter units: intervals in 1.25 ms, the supervision timeout
+// in 10 ms
+#define CANETA_LINK_INTERVAL_US 1250
+#define CANETA_LINK_TIMEOUT_MS 10
+
+// Gap histogram: one bin per interval unit, covering gaps up to 320 ms.
+// Longer gaps are pauses in typing and say nothing about the interval.
+#define CANETA_JITTER_BINS 256
+
+// Gaps needed before the interval is estimated
+#define CANETA_JITTER_MIN_GAPS 32
+
+typedef enum {
+  CANETA_LINK_KEYBOARD,    // Keep whatever the keyboard offers
+  CANETA_LINK_TYPING,      // 7.5-15 ms, no slave latency: lowest keystroke latency
+  CANETA_LINK_BALANCED,    // 15-30 ms, no slave latency
+  CANETA_LINK_LOW_POWER    // 30-50 ms, slave latency 4: the keyboard may sleep through events
+} caneta_link_profile_t;
+
+typedef struct {
+  uint16_t min_interval; // 1.25 ms units, 6 (7.5 ms) to 3200 (4 s)
+  uint16_t max_interval;
+  uint16_t latency;      // Connection events the keyboard may skip, at most 499
+  uint16_t timeout;      // Supervision timeout in 10 ms units, 10 (100 ms) to 3200 (32 s)
+} caneta_link_params_t;
+
+// The parameters a profile requests. Returns false for CANETA_LINK_KEYBOARD,
+// which requests nothing.
+bool caneta_link_params_for(caneta_link_profile_t profile, caneta_link_params_t* params);
+
+// True if the parameters are within the Bluetooth limits, including a
+// supervision timeout longer than two of the longest possible gaps between
+// the keyboard's connection events
+bool caneta_link_params_valid(const caneta_link_params_t* params);
+
+// Treat the fields as private
+typedef struct {
+  uint32_t interval_us;  // Expected connection interval; 0 if unknown
+  uint32_t count;        // Reports recorded
+  uint32_t last_us;      // Arrival of the last report
+  uint32_t gaps;         // Gaps in the histogram
+  uint32_t max_jitter_us;
+  uint64_t jitter_sum_us;
+  uint32_t jitter_count;
+  uint16_t hist[CANETA_JITTER_BINS];  // Gaps by nearest whole interval unit
+} caneta_jitter_t;
+
+// Start over, expecting the given connection interval (0 if not known yet)
+void caneta_jitter_init(caneta_jitter_t* jitter, uint32_t interval_us);
+
+// Record a report's arrival
+void caneta_jitter_record(caneta_jitter_t* jitter, uint32_t now_us);
+
+// Distance of the gaps from a whole number of expected intervals: the mean
+// and the largest. 0 until two reports have arrived with an interval known.
+uint32_t caneta_jitter_mean_us(const caneta_jitter_t* jitter);
+uint32_t caneta_jitter_max_us(const caneta_jitter_t* jitter);
+
+// The longest connection interval (at least 7.5 ms) that nine in ten of the
+// gaps are a whole number of, to within one unit. 0 until
+// CANETA_JITTER_MIN_GAPS gaps have been recorded.
+uint32_t caneta_jitter_estimate_us(const caneta_jitter_t* jitter);
+
+// True once the estimated interval matches the expected one to within one unit
+bool caneta_jitter_in_effect(const caneta_jitter_t* jitter);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif //CANETA_LINK_H
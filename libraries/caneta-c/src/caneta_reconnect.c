@@ -0,0 +1,189 @@
+// caneta_reconnect.c
+// Bond cache, scan filter and reconnect plan for Bluetooth LE keyboards
+
+#include "caneta_reconnect.h"
+#include <string.h>
+
+#define BONDS_MAGIC 0xCB
+#define BONDS_VERSION 1
+#define PEER_SIZE (CANETA_BLE_ADDR_LEN + 1)
+
+#define SEEN_MASK (CANETA_SCAN_SEEN_SLOTS - 1)
+
+_Static_assert((CANETA_SCAN_SEEN_SLOTS & SEEN_MASK) == 0, "CANETA_SCAN_SEEN_SLOTS must be a power of two");
+_Static_assert(CANETA_SCAN_SEEN_MAX < CANETA_SCAN_SEEN_SLOTS, "the seen table needs an empty slot to end each probe");
+
+enum {
+    PHASE_CONNECTED,
+    PHASE_DIRECT,      // Trying bonded keyboards in turn
+    PHASE_SCANNING,    // A scan was handed out
+    PHASE_PAUSED       // Waiting for resume_ms
+};
+
+static bool same_addr(const uint8_t* a, const uint8_t* b) {
+    return memcmp(a, b, CANETA_BLE_ADDR_LEN) == 0;
+}
+
+static int find_index(const caneta_bonds_t* bonds, const uint8_t* addr) {
+    for (int i = 0; i < bonds->count; i++) {
+        if (same_addr(bonds->peers[i].addr, addr)) return i;
+    }
+    return -1;
+}
+
+void caneta_bonds_init(caneta_bonds_t* bonds) {
+    memset(bonds, 0, sizeof(*bonds));
+}
+
+bool caneta_bonds_touch(caneta_bonds_t* bonds, const caneta_peer_t* peer) {
+    int index = find_index(bonds, peer->addr);
+    if (index == 0 && bonds->peers[0].addr_type == peer->addr_type) return false;
+
+    // Shift the more recent keyboards down over the old entry (or off the end)
+    int last = index >= 0 ? index : (bonds->count < CANETA_BONDS_MAX ? bonds->count++ : CANETA_BONDS_MAX - 1);
+    memmove(&bonds->peers[1], &bonds->peers[0], (size_t)last * sizeof(caneta_peer_t));
+    bonds->peers[0] = *peer;
+    return true;
+}
+
+bool caneta_bonds_forget(caneta_bonds_t* bonds, const uint8_t addr[CANETA_BLE_ADDR_LEN]) {
+    int index = find_index(bonds, addr);
+    if (index < 0) return false;
+    bonds->count--;
+    memmove(&bonds->peers[index], &bonds->peers[index + 1], (size_t)(bonds->count - index) * sizeof(caneta_peer_t));
+    return true;
+}
+
+const caneta_peer_t* caneta_bonds_find(const caneta_bonds_t* bonds, const uint8_t addr[CANETA_BLE_ADDR_LEN]) {
+    int index = find_index(bonds, addr);
+    return index >= 0 ? &bonds->peers[index] : NULL;
+}
+
+static uint8_t checksum(const uint8_t* data, size_t len) {
+    uint8_t sum = 0;
+    for (size_t i = 0; i < len; i++) {
+        sum = (uint8_t)((sum << 1 | sum >> 7) ^ data[i]);
+    }
+    return sum;
+}
+
+size_t caneta_bonds_save(const caneta_bonds_t* bonds, uint8_t* blob, size_t blob_len) {
+    if (blob_len < CANETA_BONDS_BLOB_SIZE) return 0;
+    memset(blob, 0, CANETA_BONDS_BLOB_SIZE);
+    blob[0] = BONDS_MAGIC;
+    blob[1] = BONDS_VERSION;
+    blob[2] = bonds->count;
+    for (int i = 0; i < bonds->count; i++) {
+        memcpy(blob + 3 + i * PEER_SIZE, bonds->peers[i].addr, CANETA_BLE_ADDR_LEN);
+        blob[3 + i * PEER_SIZE + CANETA_BLE_ADDR_LEN] = bonds->peers[i].addr_type;
+    }
+    blob[CANETA_BONDS_BLOB_SIZE - 1] = checksum(blob, CANETA_BONDS_BLOB_SIZE - 1);
+    return CANETA_BONDS_BLOB_SIZE;
+}
+
+bool caneta_bonds_load(caneta_bonds_t* bonds, const uint8_t* blob, size_t blob_len) {
+    caneta_bonds_init(bonds);
+    if (!blob || blob_len < CANETA_BONDS_BLOB_SIZE || blob[0] != BONDS_MAGIC || blob[1] != BONDS_VERSION ||
+        blob[2] > CANETA_BONDS_MAX || blob[CANETA_BONDS_BLOB_SIZE - 1] != checksum(blob, CANETA_BONDS_BLOB_SIZE - 1)) {
+        return false;
+    }
+    bonds->count = blob[2];
+    for (int i = 0; i < bonds->count; i++) {
+        memcpy(bonds->peers[i].addr, blob + 3 + i * PEER_SIZE, CANETA_BLE_ADDR_LEN);
+        bonds->peers[i].addr_type = blob[3 + i * PEER_SIZE + CANETA_BLE_ADDR_LEN];
+    }
+    return true;
+}
+
+void caneta_scan_filter_init(caneta_scan_filter_t* filter, const caneta_bonds_t* bonds, bool bonded_only) {
+    filter->bonds = bonds;
+    filter->bonded_only = bonded_only;
+    caneta_scan_filter_reset(filter);
+}
+
+void caneta_scan_filter_reset(caneta_scan_filter_t* filter) {
+    filter->seen_count = 0;
+    memset(filter->seen, 0, sizeof(filter->seen));
+}
+
+caneta_scan_verdict_t caneta_scan_filter_check(caneta_scan_filter_t* filter,
+                                               const uint8_t addr[CANETA_BLE_ADDR_LEN], bool has_hid) {
+    uint64_t key = 1;
+    for (int i = 0; i < CANETA_BLE_ADDR_LEN; i++) {
+        key += (uint64_t)addr[i] << (8 * i);
+    }
+
+    // Open addressing with linear probing; the table is never more than half
+    // full, so a probe ends at an empty slot within a few steps
+    uint32_t index = (uint32_t)((key * 0x9E3779B97F4A7C15ull) >> 32) & SEEN_MASK;
+    while (filter->seen[index] != 0) {
+        if (filter->seen[index] == key) return CANETA_SCAN_DUPLICATE;
+        index = (index + 1) & SEEN_MASK;
+    }
+
+    if (caneta_bonds_find(filter->bonds, addr)) return CANETA_SCAN_CONNECT;
+    if (has_hid && !filter->bonded_only) return CANETA_SCAN_CONNECT;
+
+    if (filter->seen_count < CANETA_SCAN_SEEN_MAX) {
+        filter->seen[index] = key;
+        filter->seen_count++;
+    }
+    return CANETA_SCAN_IGNORE;
+}
+
+void caneta_reconnect_init(caneta_reconnect_t* reconnect, const caneta_reconnect_config_t* config) {
+    if (config) {
+        reconnect->config = *config;
+    } else {
+        reconnect->config.direct_ms = CANETA_RECONNECT_DEFAULT_DIRECT_MS;
+        reconnect->config.scan_ms = CANETA_RECONNECT_DEFAULT_SCAN_MS;
+        reconnect->config.retry_ms = CANETA_RECONNECT_DEFAULT_RETRY_MS;
+    }
+    caneta_reconnect_lost(reconnect);
+}
+
+void caneta_reconnect_lost(caneta_reconnect_t* reconnect) {
+    reconnect->phase = PHASE_DIRECT;
+    reconnect->next_peer = 0;
+}
+
+void caneta_reconnect_connected(caneta_reconnect_t* reconnect) {
+    reconnect->phase = PHASE_CONNECTED;
+}
+
+bool caneta_reconnect_next(caneta_reconnect_t* reconnect, const caneta_bonds_t* bonds, uint32_t now_ms,
+                           caneta_reconnect_action_t* action) {
+    memset(action, 0, sizeof(*action));
+
+    switch (reconnect->phase) {
+        case PHASE_CONNECTED:
+            return false;
+
+        case PHASE_SCANNING:
+            // The scan ended without a keyboard
+            reconnect->phase = PHASE_PAUSED;
+            reconnect->resume_ms = now_ms + reconnect->config.retry_ms;
+            // fall through
+        case PHASE_PAUSED:
+            if ((int32_t)(now_ms - reconnect->resume_ms) < 0) {
+                action->op = CANETA_RECONNECT_WAIT;
+                action->deadline_ms = reconnect->resume_ms;
+                return true;
+            }
+            caneta_reconnect_lost(reconnect);
+            // fall through
+        case PHASE_DIRECT:
+            if (reconnect->next_peer < bonds->count) {
+                action->op = CANETA_RECONNECT_CONNECT;
+                action->peer = bonds->peers[reconnect->next_peer++];
+                action->timeout_ms = reconnect->config.direct_ms;
+                return true;
+            }
+            break;
+    }
+
+    reconnect->phase = PHASE_SCANNING;
+    action->op = CANETA_RECONNECT_SCAN;
+    action->timeout_ms = reconnect->config.scan_ms;
+    return true;
+}
@@ -0,0 +1,154 @@
+// caneta_reconnect.h
+// Reconnecting to Bluetooth LE keyboards: bond cache, scan filter and the
+// order of reconnect attempts
+//
+// A keyboard that drops its link usually comes back within a few hundred
+// milliseconds, advertising to the host it was bonded with. Connecting to
+// its known address straight away beats waiting for a scan to stumble on it,
+// so the host keeps the keyboards it has bonded with (most recent first, in a
+// blob the caller stores in flash) and tries each of them directly before it
+// scans. While scanning, the filter picks out bonded keyboards and HID
+// devices, and answers repeat advertisements from everything else with a
+// single table lookup.
+//
+// Nothing here touches a radio: the caller performs the connects and scans
+// the plan asks for and reports back, passing the time in milliseconds (it
+// may wrap). That keeps the policy identical on the ESP32 and in a simulated
+// BLE world on the host.
+
+#ifndef CANETA_RECONNECT_H
+#define CANETA_RECONNECT_H
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+#define CANETA_BLE_ADDR_LEN 6
+
+// Keyboards remembered for direct reconnects
+#define CANETA_BONDS_MAX 4
+
+// Bytes caneta_bonds_save writes: magic, version, count, the peers, checksum
+#define CANETA_BONDS_BLOB_SIZE (3 + CANETA_BONDS_MAX * (CANETA_BLE_ADDR_LEN + 1) + 1)
+
+// Addresses the scan filter remembers turning down during one scan, in a
+// table of twice as many slots. Advertisers beyond that only cost a repeated
+// check, never a wrong answer.
+#define CANETA_SCAN_SEEN_MAX 32
+#define CANETA_SCAN_SEEN_SLOTS 64
+
+// A direct attempt gets long enough for a keyboard's fast reconnect
+// advertising to start; a scan lasts as long as the original pairing scan
+#define CANETA_RECONNECT_DEFAULT_DIRECT_MS 1000
+#define CANETA_RECONNECT_DEFAULT_SCAN_MS 30000
+#define CANETA_RECONNECT_DEFAULT_RETRY_MS 1000
+
+typedef struct {
+  uint8_t addr[CANETA_BLE_ADDR_LEN];
+  uint8_t addr_type;     // As the BLE stack reports it (public, random, ...)
+} caneta_peer_t;
+
+// Bonded keyboards, most recently connected first. Treat the fields as private.
+typedef struct {
+  uint8_t count;
+  caneta_peer_t peers[CANETA_BONDS_MAX];
+} caneta_bonds_t;
+
+void caneta_bonds_init(caneta_bonds_t* bonds);
+
+// Record a successful connection: peer moves to the front, evicting the least
+// recent keyboard if the cache is full. Returns true if the cache changed
+// (and should be saved).
+bool caneta_bonds_touch(caneta_bonds_t* bonds, const caneta_peer_t* peer);
+
+// Forget one keyboard. Returns true if it was known.
+bool caneta_bonds_forget(caneta_bonds_t* bonds, const uint8_t addr[CANETA_BLE_ADDR_LEN]);
+
+// The bonded keyboard with this address, or NULL
+const caneta_peer_t* caneta_bonds_find(const caneta_bonds_t* bonds, const uint8_t addr[CANETA_BLE_ADDR_LEN]);
+
+// Serialize into blob (at least CANETA_BONDS_BLOB_SIZE bytes). Returns the
+// bytes written.
+size_t caneta_bonds_save(const caneta_bonds_t* bonds, uint8_t* blob, size_t blob_len);
+
+// Restore a saved cache. A missing, truncated or corrupt blob leaves the
+// cache empty and returns false.
+bool caneta_bonds_load(caneta_bonds_t* bonds, const uint8_t* blob, size_t blob_len);
+
+typedef enum {
+  CANETA_SCAN_CONNECT,   // A bonded keyboard, or a HID device we may pair with
+  CANETA_SCAN_IGNORE,    // Not a keyboard for us; remembered for this scan
+  CANETA_SCAN_DUPLICATE  // Turned down already during this scan
+} caneta_scan_verdict_t;
+
+// Treat the fields as private
+typedef struct {
+  const caneta_bonds_t* bonds;
+  bool bonded_only;      // Accept only bonded keyboards (a whitelist)
+  uint8_t seen_count;
+  uint64_t seen[CANETA_SCAN_SEEN_SLOTS];  // Turned-down addresses, plus one; 0 is empty
+} caneta_scan_filter_t;
+
+// bonds must outlive the filter. With bonded_only, HID devices that are not
+// bonded are turned down, so only known keyboards ever connect.
+void caneta_scan_filter_init(caneta_scan_filter_t* filter, const caneta_bonds_t* bonds, bool bonded_only);
+
+// Forget what was turned down; call when a scan starts
+void caneta_scan_filter_reset(caneta_scan_filter_t* filter);
+
+// Judge one advertisement. has_hid says whether it lists the HID service.
+caneta_scan_verdict_t caneta_scan_filter_check(caneta_scan_filter_t* filter,
+                                               const uint8_t addr[CANETA_BLE_ADDR_LEN], bool has_hid);
+
+typedef struct {
+  uint32_t direct_ms;    // Longest a direct connection attempt may take
+  uint32_t scan_ms;      // Longest scan
+  uint32_t retry_ms;     // Pause after a fruitless scan before starting over
+} caneta_reconnect_config_t;
+
+typedef enum {
+  CANETA_RECONNECT_WAIT,     // Nothing to do until deadline_ms
+  CANETA_RECONNECT_CONNECT,  // Connect to peer, giving up after timeout_ms
+  CANETA_RECONNECT_SCAN      // Scan for timeout_ms, connecting to what the filter accepts
+} caneta_reconnect_op_t;
+
+typedef struct {
+  caneta_reconnect_op_t op;
+  caneta_peer_t peer;    // CONNECT
+  uint32_t timeout_ms;   // CONNECT, SCAN
+  uint32_t deadline_ms;  // WAIT
+} caneta_reconnect_action_t;
+
+// Treat the fields as private
+typedef struct {
+  caneta_reconnect_config_t config;
+  uint8_t phase;
+  uint8_t next_peer;     // Next bonded keyboard to try directly
+  uint32_t resume_ms;    // End of the pause after a scan
+} caneta_reconnect_t;
+
+// Prepare a plan with no link up, so the first action tries the bonded
+// keyboards. config may be NULL for the defaults.
+void caneta_reconnect_init(caneta_reconnect_t* reconnect, const caneta_reconnect_config_t* config);
+
+// The link dropped: start over with the bonded keyboards, most recent first
+void caneta_reconnect_lost(caneta_reconnect_t* reconnect);
+
+// A keyboard is connected; the plan stays idle until caneta_reconnect_lost
+void caneta_reconnect_connected(caneta_reconnect_t* reconnect);
+
+// What to do next, once the previous action has finished without a
+// connection. Returns false while a keyboard is connected.
+bool caneta_reconnect_next(caneta_reconnect_t* reconnect, const caneta_bonds_t* bonds, uint32_t now_ms,
+                           caneta_reconnect_action_t* action);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif //CANETA_RECONNECT_H
@@ -0,0 +1,185 @@
+// caneta_repeat.c
+// Typematic auto-repeat on a hashed timer wheel
+
+#include "caneta_repeat.h"
+#include <string.h>
+
+#define NO_TIMER 0xFF
+#define WHEEL_SLOT(time) ((time) % CANETA_REPEAT_WHEEL_SLOTS)
+
+_Static_assert(CANETA_REPEAT_MAX_KEYS < NO_TIMER, "timer indexes must fit a uint8_t");
+
+// Wrap-safe: true if time is at or after deadline
+static inline bool reached(uint32_t time, uint32_t deadline) {
+    return (int32_t)(time - deadline) >= 0;
+}
+
+static void wheel_insert(caneta_repeat_t* repeat, uint8_t timer) {
+    uint8_t* head = &repeat->wheel[WHEEL_SLOT(repeat->timers[timer].deadline)];
+    repeat->timers[timer].next = *head;
+    *head = timer;
+}
+
+static void wheel_remove(caneta_repeat_t* repeat, uint8_t timer) {
+    uint8_t* link = &repeat->wheel[WHEEL_SLOT(repeat->timers[timer].deadline)];
+    while (*link != timer) {
+        link = &repeat->timers[*link].next;
+    }
+    *link = repeat->timers[timer].next;
+}
+
+static bool key_held(const kbd_state_t* state, uint8_t keycode) {
+    for (int i = 0; i < 6; i++) {
+        if (state->last_keys[i] == keycode) return true;
+    }
+    return false;
+}
+
+void caneta_repeat_init(caneta_repeat_t* repeat, const caneta_repeat_config_t* config) {
+    if (config) {
+        repeat->config = *config;
+    } else {
+        repeat->config.delay_ms = CANETA_REPEAT_DEFAULT_DELAY_MS;
+        repeat->config.interval_ms = CANETA_REPEAT_DEFAULT_INTERVAL_MS;
+    }
+    // A key's first repeat can't share the millisecond it went down in
+    if (repeat->config.delay_ms == 0) repeat->config.delay_ms = 1;
+    repeat->now = 0;
+    caneta_repeat_reset(repeat);
+}
+
+void caneta_repeat_reset(caneta_repeat_t* repeat) {
+    repeat->modifiers = 0;
+    repeat->locks = CANETA_LOCK_NUM;
+    repeat->active = 0;
+    memset(repeat->wheel, NO_TIMER, sizeof(repeat->wheel));
+    memset(repeat->timers, 0, sizeof(repeat->timers));
+}
+
+void caneta_repeat_update(caneta_repeat_t* repeat, const kbd_state_t* state, uint32_t now_ms) {
+    // With nothing pending the wheel can jump straight to the present
+    if (repeat->active == 0) repeat->now = now_ms;
+    repeat->modifiers = state->modifiers;
+    repeat->locks = state->locks;
+
+    for (uint8_t i = 0; i < CANETA_REPEAT_MAX_KEYS; i++) {
+        caneta_repeat_timer_t* timer = &repeat->timers[i];
+        if (timer->keycode && !key_held(state, timer->keycode)) {
+            wheel_remove(repeat, i);
+            timer->keycode = 0;
+            repeat->active--;
+        }
+    }
+
+    if (repeat->config.interval_ms == 0) return;
+
+    for (int k = 0; k < 6; k++) {
+        uint8_t keycode = state->last_keys[k];
+        if (keycode == 0) continue;
+
+        uint8_t free_timer = NO_TIMER;
+        bool running = false;
+        for (uint8_t i = 0; i < CANETA_REPEAT_MAX_KEYS; i++) {
+            if (repeat->timers[i].keycode == keycode) {
+                running = true;
+                break;
+            }
+            if (repeat->timers[i].keycode == 0 && free_timer == NO_TIMER) free_timer = i;
+        }
+
+        // Keys that produce nothing (modifier-only, unmapped) never wake anyone up
+        uint8_t scratch[CANETA_KEY_OUTPUT_MAX];
+        if (running || free_timer == NO_TIMER || caneta_translate_key_locks(keycode, state->modifiers, state->locks, scratch) == 0) {
+            continue;
+        }
+
+        // The wheel has already run the slot for repeat->now, so the first
+        // repeat can be no earlier than the slot after it
+        uint32_t deadline = now_ms + repeat->config.delay_ms;
+        if (!reached(deadline, repeat->now + 1)) deadline = repeat->now + 1;
+
+        repeat->timers[free_timer].keycode = keycode;
+        repeat->timers[free_timer].deadline = deadline;
+        wheel_insert(repeat, free_timer);
+        repeat->active++;
+    }
+}
+
+bool caneta_repeat_next_deadline(const caneta_repeat_t* repeat, uint32_t* deadline_ms) {
+    if (repeat->active == 0) return false;
+
+    bool found = false;
+    uint32_t next = 0;
+    for (uint8_t i = 0; i < CANETA_REPEAT_MAX_KEYS; i++) {
+        const caneta_repeat_timer_t* timer = &repeat->timers[i];
+        if (timer->keycode && (!found || !reached(timer->deadline, next))) {
+            next = timer->deadline;
+            found = true;
+        }
+    }
+    *deadline_ms = next;
+    return found;
+}
+
+size_t caneta_repeat_run(caneta_repeat_t* repeat, uint32_t now_ms,
+                         uint8_t* out, size_t out_len, bool* complete) {
+    *complete = true;
+    if (repeat->active == 0) {
+        repeat->now = now_ms;
+        return 0;
+    }
+    if (reached(repeat->now, now_ms)) return 0;
+
+    // Visit each slot between the last run and now once; after a long sleep
+    // that is every slot, and the deadline check sorts out which timers are due
+    uint32_t elapsed = now_ms - repeat->now;
+    uint32_t visits = elapsed < CANETA_REPEAT_WHEEL_SLOTS ? elapsed : CANETA_REPEAT_WHEEL_SLOTS;
+    size_t written = 0;
+
+    for (uint32_t v = 1; v <= visits; v++) {
+        uint8_t* head = &repeat->wheel[WHEEL_SLOT(repeat->now + v)];
+        uint8_t timer = *head;
+        *head = NO_TIMER;
+
+        while (timer != NO_TIMER) {
+            caneta_repeat_timer_t* t = &repeat->timers[timer];
+            uint8_t next = t->next;
+
+            if (reached(now_ms, t->deadline)) {
+                if (out_len - written < CANETA_KEY_OUTPUT_MAX) {
+                    // Out of room: put this slot back as it was and resume here next call
+                    while (timer != NO_TIMER) {
+                        next = repeat->timers[timer].next;
+                        wheel_insert(repeat, timer);
+                        timer = next;
+                    }
+                    repeat->now += v - 1;
+                    *complete = false;
+                    return written;
+                }
+
+                written += caneta_translate_key_locks(t->keycode, repeat->modifiers, repeat->locks, out + written);
+                t->deadline += repeat->config.interval_ms;
+                if (reached(now_ms, t->deadline)) {
+                    t->deadline = now_ms + repeat->config.interval_ms;
+                }
+            }
+            wheel_insert(repeat, timer);
+            timer = next;
+        }
+    }
+
+    repeat->now = now_ms;
+    return written;
+}
+
+void caneta_repeat_stream(caneta_repeat_t* repeat, uint32_t now_ms, const caneta_sink_t* sink) {
+    uint8_t out[CANETA_STREAM_CHUNK];
+    bool complete;
+    do {
+        size_t n = caneta_repeat_run(repeat, now_ms, out, sizeof(out), &complete);
+        if (n > 0) {
+            sink->write(sink->ctx, out, n);
+        }
+    } while (!complete);
+}
@@ -0,0 +1,88 @@
+// caneta_repeat.h
+// Typematic auto-repeat: held keys repeat after a delay, at a fixed rate
+//
+// Keyboards only report which keys are down, so a held key produces output
+// once. The repeat engine keeps a timer per held key in a hashed timer wheel
+// and reports a single next deadline, so the caller can sleep until then
+// instead of polling. Time is passed in by the caller (milliseconds, allowed
+// to wrap), so the engine runs the same against a hardware timer or a
+// virtual clock.
+
+#ifndef CANETA_REPEAT_H
+#define CANETA_REPEAT_H
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "caneta.h"
+
+// Typical PC typematic defaults: half a second, then 30 characters a second
+#define CANETA_REPEAT_DEFAULT_DELAY_MS 500
+#define CANETA_REPEAT_DEFAULT_INTERVAL_MS 33
+
+// Wheel slots, one millisecond each. Timers further out than one turn of the
+// wheel share a slot with nearer ones and are skipped until they are due.
+#define CANETA_REPEAT_WHEEL_SLOTS 32
+
+// One timer per key slot of kbd_state_t
+#define CANETA_REPEAT_MAX_KEYS 6
+
+typedef struct {
+  uint16_t delay_ms;     // Hold time before the first repeat (at least 1)
+  uint16_t interval_ms;  // Time between repeats; 0 disables repeat
+} caneta_repeat_config_t;
+
+typedef struct {
+  uint32_t deadline;     // Time of the next repeat
+  uint8_t keycode;       // 0 when the timer is free
+  uint8_t next;          // Next timer in the same wheel slot
+} caneta_repeat_timer_t;
+
+// Repeat state for one keyboard. As with caneta_decoder_t, treat the fields
+// as private.
+typedef struct {
+  caneta_repeat_config_t config;
+  uint32_t now;          // Every slot up to this time has been run
+  uint8_t modifiers;     // Modifiers applied to repeated keys
+  uint8_t locks;         // And the locks (CANETA_LOCK_*)
+  uint8_t active;        // Timers in use
+  uint8_t wheel[CANETA_REPEAT_WHEEL_SLOTS];
+  caneta_repeat_timer_t timers[CANETA_REPEAT_MAX_KEYS];
+} caneta_repeat_t;
+
+// Prepare a repeat engine. config may be NULL for the defaults.
+void caneta_repeat_init(caneta_repeat_t* repeat, const caneta_repeat_config_t* config);
+
+// Stop every timer (e.g. when the keyboard disconnects)
+void caneta_repeat_reset(caneta_repeat_t* repeat);
+
+// Tell the engine which keys are held after a report. Newly held keys that
+// produce output start repeating delay_ms from now_ms; released keys stop.
+// Repeats use the modifiers and locks of the latest state.
+void caneta_repeat_update(caneta_repeat_t* repeat, const kbd_state_t* state, uint32_t now_ms);
+
+// Time of the earliest pending repeat. Returns false if no key is repeating,
+// in which case there is nothing to wake up for.
+bool caneta_repeat_next_deadline(const caneta_repeat_t* repeat, uint32_t* deadline_ms);
+
+// Fire every repeat due at or before now_ms, writing at most out_len bytes
+// (out must hold at least CANETA_KEY_OUTPUT_MAX). Returns the bytes written.
+// *complete is false if out filled first: call again to fire the rest.
+// A caller that falls behind gets one repeat per key, not a burst.
+size_t caneta_repeat_run(caneta_repeat_t* repeat, uint32_t now_ms,
+                         uint8_t* out, size_t out_len, bool* complete);
+
+// Fire every repeat due at or before now_ms and deliver the output to sink
+void caneta_repeat_stream(caneta_repeat_t* repeat, uint32_t now_ms, const caneta_sink_t* sink);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif //CANETA_REPEAT_H
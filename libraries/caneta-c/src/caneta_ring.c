@@ -0,0 +1,114 @@
+// caneta_ring.c
+// Lock-free single-producer, single-consumer record ring
+
+#include "caneta_ring.h"
+#include <string.h>
+
+// Each index has a single writer, so plain atomic loads and stores are enough;
+// no read-modify-write is needed (Cortex-M0+ has none).
+#if !defined(__GNUC__)
+#error "caneta_ring needs the GCC/Clang __atomic builtins"
+#endif
+
+#define RING_MASK (CANETA_RING_SIZE - 1)
+#define RING_PAD 0
+
+_Static_assert((CANETA_RING_SIZE & RING_MASK) == 0, "CANETA_RING_SIZE must be a power of two");
+_Static_assert(sizeof(caneta_ring_record_t) == CANETA_RING_ALIGN, "a record header is one alignment unit");
+
+static inline uint32_t load_acquire(const uint32_t* index) {
+    return __atomic_load_n(index, __ATOMIC_ACQUIRE);
+}
+
+static inline void store_release(uint32_t* index, uint32_t value) {
+    __atomic_store_n(index, value, __ATOMIC_RELEASE);
+}
+
+// Counters are only written by the producer
+static inline void count(uint32_t* counter) {
+    __atomic_store_n(counter, __atomic_load_n(counter, __ATOMIC_RELAXED) + 1, __ATOMIC_RELAXED);
+}
+
+static inline caneta_ring_record_t* record_at(caneta_ring_t* ring, uint32_t index) {
+    return (caneta_ring_record_t*)((uint8_t*)ring->buffer + (index & RING_MASK));
+}
+
+void caneta_ring_init(caneta_ring_t* ring) {
+    ring->head = 0;
+    ring->tail = 0;
+    ring->overflows = 0;
+    ring->oversize = 0;
+}
+
+bool caneta_ring_push(caneta_ring_t* ring, uint8_t kind, uint8_t dev_addr, uint8_t instance,
+                      const uint8_t* data, size_t len) {
+    if (len > CANETA_RING_DATA_MAX) {
+        count(&ring->oversize);
+        return false;
+    }
+
+    uint32_t size = (uint32_t)((sizeof(caneta_ring_record_t) + len + CANETA_RING_ALIGN - 1) &
+                               ~(size_t)(CANETA_RING_ALIGN - 1));
+    uint32_t head = ring->head;
+    uint32_t tail = load_acquire(&ring->tail);
+
+    // A record never wraps: if it doesn't fit before the end of the buffer,
+    // the rest of the buffer becomes padding and the record starts at 0
+    uint32_t to_end = CANETA_RING_SIZE - (head & RING_MASK);
+    uint32_t pad = to_end < size ? to_end : 0;
+    if (CANETA_RING_SIZE - (head - tail) < pad + size) {
+        count(&ring->overflows);
+        return false;
+    }
+
+    if (pad) {
+        caneta_ring_record_t* filler = record_at(ring, head);
+        filler->kind = RING_PAD;
+        filler->len = (uint16_t)(pad - sizeof(caneta_ring_record_t));
+        head += pad;
+    }
+
+    caneta_ring_record_t* record = record_at(ring, head);
+    record->len = (uint16_t)len;
+    record->kind = kind;
+    record->dev_addr = dev_addr;
+    record->instance = instance;
+    if (len > 0) {
+        memcpy(record + 1, data, len);
+    }
+
+    // Publish the padding and the record together
+    store_release(&ring->head, head + size);
+    return true;
+}
+
+const caneta_ring_record_t* caneta_ring_peek(caneta_ring_t* ring) {
+    uint32_t tail = ring->tail;
+    uint32_t head = load_acquire(&ring->head);
+    if (tail == head) return NULL;
+
+    caneta_ring_record_t* record = record_at(ring, tail);
+    if (record->kind == RING_PAD) {
+        // Padding always runs to the end of the buffer and is followed by a record
+        tail += CANETA_RING_SIZE - (tail & RING_MASK);
+        store_release(&ring->tail, tail);
+        record = record_at(ring, tail);
+    }
+    return record;
+}
+
+void caneta_ring_release(caneta_ring_t* ring) {
+    uint32_t tail = ring->tail;
+    const caneta_ring_record_t* record = record_at(ring, tail);
+    uint32_t size = (uint32_t)((sizeof(caneta_ring_record_t) + record->len + CANETA_RING_ALIGN - 1) &
+                               ~(size_t)(CANETA_RING_ALIGN - 1));
+    store_release(&ring->tail, tail + size);
+}
+
+uint32_t caneta_ring_overflows(const caneta_ring_t* ring) {
+    return __atomic_load_n(&ring->overflows, __ATOMIC_RELAXED);
+}
+
+uint32_t caneta_ring_oversize(const caneta_ring_t* ring) {
+    return __atomic_load_n(&ring->oversize, __ATOMIC_RELAXED);
+}
@@ -0,0 +1,79 @@
+// caneta_ring.h
+// Lock-free single-producer, single-consumer ring of variable-length records
+//
+// Hands raw HID reports from the USB host (one core or thread) to the decoder
+// (another) without locks. Exactly one context may push and exactly one may
+// peek and release. Records are copied into the ring on push and read in
+// place by the consumer.
+
+#ifndef CANETA_RING_H
+#define CANETA_RING_H
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+// Ring capacity in bytes; must be a power of two
+#ifndef CANETA_RING_SIZE
+#define CANETA_RING_SIZE 2048
+#endif
+
+// Every record starts on this boundary, so a header never straddles the end
+#define CANETA_RING_ALIGN 8
+
+// Largest record payload the ring accepts
+#define CANETA_RING_DATA_MAX (CANETA_RING_SIZE / 2 - sizeof(caneta_ring_record_t))
+
+typedef struct {
+  uint16_t len;          // Payload bytes following the header
+  uint8_t kind;          // Caller-defined; 0 is reserved for padding
+  uint8_t dev_addr;
+  uint8_t instance;
+  uint8_t reserved[3];
+} caneta_ring_record_t;
+
+// Ring state. The producer owns head and the counters, the consumer owns
+// tail; each side only reads the other's index. Treat the fields as private.
+typedef struct {
+  uint32_t head;         // Bytes ever pushed, including padding
+  uint32_t tail;         // Bytes ever released
+  uint32_t overflows;    // Records dropped because the ring was full
+  uint32_t oversize;     // Records dropped because they exceed CANETA_RING_DATA_MAX
+  uint64_t buffer[CANETA_RING_SIZE / CANETA_RING_ALIGN];  // Records, on 8-byte boundaries
+} caneta_ring_t;
+
+// Prepare an empty ring. Not safe while either side is running.
+void caneta_ring_init(caneta_ring_t* ring);
+
+// Producer: copy a record into the ring. Returns false, and counts the drop,
+// if the ring is full or the payload is too long; nothing is queued then.
+bool caneta_ring_push(caneta_ring_t* ring, uint8_t kind, uint8_t dev_addr, uint8_t instance,
+                      const uint8_t* data, size_t len);
+
+// Consumer: the oldest record, or NULL if the ring is empty. The payload
+// follows the header (caneta_ring_data). The record stays valid until
+// caneta_ring_release.
+const caneta_ring_record_t* caneta_ring_peek(caneta_ring_t* ring);
+
+// Consumer: drop the record returned by the last caneta_ring_peek
+void caneta_ring_release(caneta_ring_t* ring);
+
+static inline const uint8_t* caneta_ring_data(const caneta_ring_record_t* record) {
+  return (const uint8_t*)(record + 1);
+}
+
+// Either side: records dropped so far because the ring was full, and
+// because they were too long
+uint32_t caneta_ring_overflows(const caneta_ring_t* ring);
+uint32_t caneta_ring_oversize(const caneta_ring_t* ring);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif //CANETA_RING_H
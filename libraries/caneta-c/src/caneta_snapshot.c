@@ -0,0 +1,66 @@
+// caneta_snapshot.c
+// Sequence-locked keyboard state snapshots
+
+#include "caneta_snapshot.h"
+#include <string.h>
+
+// Loads and stores of single words, no read-modify-write, so it works on
+// Cortex-M0+ as well. No standalone fences either, which ThreadSanitizer
+// cannot follow.
+#if !defined(__GNUC__)
+#error "caneta_snapshot needs the GCC/Clang __atomic builtins"
+#endif
+
+_Static_assert(sizeof(kbd_state_t) % sizeof(uint32_t) == 0, "kbd_state_t must be a whole number of words");
+
+void caneta_snapshot_init(caneta_snapshot_t* snapshot) {
+    memset(snapshot, 0, sizeof(*snapshot));
+}
+
+void caneta_snapshot_publish(caneta_snapshot_t* snapshot, const kbd_state_t* state) {
+    caneta_seqlock_publish(&snapshot->seq, snapshot->words, CANETA_SNAPSHOT_WORDS, state);
+}
+
+bool caneta_snapshot_try_read(const caneta_snapshot_t* snapshot, kbd_state_t* state) {
+    uint32_t words[CANETA_SNAPSHOT_WORDS];
+    if (!caneta_seqlock_try_read(&snapshot->seq, snapshot->words, CANETA_SNAPSHOT_WORDS, words)) return false;
+    memcpy(state, words, sizeof(words));
+    return true;
+}
+
+void caneta_snapshot_read(const caneta_snapshot_t* snapshot, kbd_state_t* state) {
+    while (!caneta_snapshot_try_read(snapshot, state)) {
+    }
+}
+
+uint32_t caneta_snapshot_version(const caneta_snapshot_t* snapshot) {
+    return __atomic_load_n(&snapshot->seq, __ATOMIC_ACQUIRE) / 2;
+}
+
+void caneta_seqlock_publish(uint32_t* seq, uint32_t* words, size_t word_count, const void* data) {
+    const uint8_t* bytes = (const uint8_t*)data;
+
+    // Only this context writes seq, so it can be read without ordering. The
+    // words are release stores so none of them lands before seq is odd.
+    uint32_t n = __atomic_load_n(seq, __ATOMIC_RELAXED);
+    __atomic_store_n(seq, n + 1, __ATOMIC_RELAXED);
+    for (size_t i = 0; i < word_count; i++) {
+        uint32_t word;
+        memcpy(&word, bytes + i * sizeof(word), sizeof(word));
+        __atomic_store_n(&words[i], word, __ATOMIC_RELEASE);
+    }
+    __atomic_store_n(seq, n + 2, __ATOMIC_RELEASE);
+}
+
+bool caneta_seqlock_try_read(const uint32_t* seq, const uint32_t* words, size_t word_count, void* data) {
+    uint8_t* bytes = (uint8_t*)data;
+
+    uint32_t before = __atomic_load_n(seq, __ATOMIC_ACQUIRE);
+    if (before & 1) return false;
+    // Acquire loads, so seq is read again only after the words
+    for (size_t i = 0; i < word_count; i++) {
+        uint32_t word = __atomic_load_n(&words[i], __ATOMIC_ACQUIRE);
+        memcpy(bytes + i * sizeof(word), &word, sizeof(word));
+    }
+    return __atomic_load_n(seq, __ATOMIC_RELAXED) == before;
+}
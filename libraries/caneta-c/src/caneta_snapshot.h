@@ -0,0 +1,73 @@
+// caneta_snapshot.h
+// Keyboard state published by the decoding context for readers anywhere
+//
+// The decoder's kbd_state_t belongs to the context that feeds it; anything
+// else reading it (a status loop, a UI on the other core) would race with the
+// next report and could see the modifiers of one report with the keys of
+// another. The decoding context publishes a copy into a snapshot instead, and
+// readers on any thread or core take consistent copies out of it without
+// locking.
+//
+// It is a sequence lock: the writer makes the sequence number odd, stores the
+// state and makes it even again; a reader copies the state between two reads
+// of the sequence and tries again if it changed or was odd. Publishing never
+// waits, so it is safe from the decoding task or an interrupt handler.
+// Exactly one context may publish.
+
+#ifndef CANETA_SNAPSHOT_H
+#define CANETA_SNAPSHOT_H
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "caneta.h"
+
+// Words of kbd_state_t, stored as atomics so no access is a data race
+#define CANETA_SNAPSHOT_WORDS (sizeof(kbd_state_t) / sizeof(uint32_t))
+
+// Treat the fields as private
+typedef struct {
+  uint32_t seq;          // Odd while a publish is in progress
+  uint32_t words[CANETA_SNAPSHOT_WORDS];
+} caneta_snapshot_t;
+
+// Start with a released keyboard. Not safe while readers are running.
+void caneta_snapshot_init(caneta_snapshot_t* snapshot);
+
+// Writer: publish a new state
+void caneta_snapshot_publish(caneta_snapshot_t* snapshot, const kbd_state_t* state);
+
+// Reader: one attempt at a copy. Returns false, leaving *state untouched, if a
+// publish got in the way.
+bool caneta_snapshot_try_read(const caneta_snapshot_t* snapshot, kbd_state_t* state);
+
+// Reader: a consistent copy, retrying until no publish gets in the way. A
+// reader that can preempt the writer on its own core (an interrupt handler,
+// a higher priority task) must use caneta_snapshot_try_read instead: it would
+// wait forever on a publish that cannot finish.
+void caneta_snapshot_read(const caneta_snapshot_t* snapshot, kbd_state_t* state);
+
+// Publishes so far, for telling whether the state changed since a read
+uint32_t caneta_snapshot_version(const caneta_snapshot_t* snapshot);
+
+// The same sequence lock over any state that is a whole number of words
+// (word_count), for whatever else one context publishes: link statistics, a
+// device name. seq and words start zeroed and are only touched through these.
+// caneta::Snapshot in caneta.hpp wraps them for C++ types.
+void caneta_seqlock_publish(uint32_t* seq, uint32_t* words, size_t word_count, const void* data);
+
+// One attempt at a copy into data. Returns false if a publish got in the way,
+// in which case data may hold a partial copy.
+bool caneta_seqlock_try_read(const uint32_t* seq, const uint32_t* words, size_t word_count, void* data);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif //CANETA_SNAPSHOT_H
@@ -0,0 +1,68 @@
+// caneta_tx.c
+// Transmit ring for background-drained serial output
+
+#include "caneta_tx.h"
+#include <string.h>
+
+// As in caneta_ring.c, each index has a single writer, so atomic loads and
+// stores are enough
+#if !defined(__GNUC__)
+#error "caneta_tx needs the GCC/Clang __atomic builtins"
+#endif
+
+#define TX_MASK (CANETA_TX_SIZE - 1)
+
+_Static_assert((CANETA_TX_SIZE & TX_MASK) == 0, "CANETA_TX_SIZE must be a power of two");
+
+void caneta_tx_init(caneta_tx_t* tx) {
+    tx->head = 0;
+    tx->tail = 0;
+    tx->dropped = 0;
+}
+
+size_t caneta_tx_space(const caneta_tx_t* tx) {
+    return CANETA_TX_SIZE - (tx->head - __atomic_load_n(&tx->tail, __ATOMIC_ACQUIRE));
+}
+
+bool caneta_tx_try_write(caneta_tx_t* tx, const uint8_t* data, size_t len) {
+    if (len > caneta_tx_space(tx)) return false;
+    if (len == 0) return true;
+
+    uint32_t head = tx->head;
+    size_t offset = head & TX_MASK;
+    size_t first = CANETA_TX_SIZE - offset;
+    if (first > len) first = len;
+    memcpy(tx->buffer + offset, data, first);
+    memcpy(tx->buffer, data + first, len - first);
+
+    __atomic_store_n(&tx->head, head + (uint32_t)len, __ATOMIC_RELEASE);
+    return true;
+}
+
+bool caneta_tx_write(caneta_tx_t* tx, const uint8_t* data, size_t len) {
+    if (caneta_tx_try_write(tx, data, len)) return true;
+    __atomic_store_n(&tx->dropped, __atomic_load_n(&tx->dropped, __ATOMIC_RELAXED) + 1, __ATOMIC_RELAXED);
+    return false;
+}
+
+size_t caneta_tx_queued(const caneta_tx_t* tx) {
+    return __atomic_load_n(&tx->head, __ATOMIC_ACQUIRE) - tx->tail;
+}
+
+size_t caneta_tx_peek(caneta_tx_t* tx, const uint8_t** data) {
+    uint32_t tail = tx->tail;
+    size_t queued = __atomic_load_n(&tx->head, __ATOMIC_ACQUIRE) - tail;
+    size_t offset = tail & TX_MASK;
+    size_t to_end = CANETA_TX_SIZE - offset;
+
+    *data = tx->buffer + offset;
+    return queued < to_end ? queued : to_end;
+}
+
+void caneta_tx_consume(caneta_tx_t* tx, size_t len) {
+    __atomic_store_n(&tx->tail, tx->tail + (uint32_t)len, __ATOMIC_RELEASE);
+}
+
+uint32_t caneta_tx_dropped(const caneta_tx_t* tx) {
+    return __atomic_load_n(&tx->dropped, __ATOMIC_RELAXED);
+}
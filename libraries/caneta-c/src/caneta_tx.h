@@ -0,0 +1,70 @@
+// caneta_tx.h
+// Transmit ring: output queued for a serial port drained in the background
+//
+// Writers queue whole sequences (a character, an escape sequence, a debug
+// line) and never wait for the wire; a DMA channel or a FIFO interrupt
+// drains the ring in contiguous chunks. A sequence is queued entirely or not
+// at all, so the terminal never sees half an escape sequence. What to do
+// when the ring is full is up to the writer: caneta_tx_write drops the
+// sequence and counts it, caneta_tx_try_write leaves the caller to wait for
+// the drain and retry (backpressure).
+//
+// One writer and one drain may run concurrently; several writers must be
+// serialized by the caller.
+
+#ifndef CANETA_TX_H
+#define CANETA_TX_H
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+// Ring capacity in bytes; must be a power of two. Also the longest sequence
+// that can ever be queued.
+#ifndef CANETA_TX_SIZE
+#define CANETA_TX_SIZE 1024
+#endif
+
+// Treat the fields as private
+typedef struct {
+  uint32_t head;         // Bytes ever queued
+  uint32_t tail;         // Bytes ever drained
+  uint32_t dropped;      // Sequences dropped by caneta_tx_write
+  uint8_t buffer[CANETA_TX_SIZE];
+} caneta_tx_t;
+
+void caneta_tx_init(caneta_tx_t* tx);
+
+// Writer: queue data if all of it fits. Returns false, queueing nothing,
+// otherwise.
+bool caneta_tx_try_write(caneta_tx_t* tx, const uint8_t* data, size_t len);
+
+// Writer: queue data if all of it fits, otherwise drop it and count the drop
+bool caneta_tx_write(caneta_tx_t* tx, const uint8_t* data, size_t len);
+
+// Writer: bytes that can be queued right now
+size_t caneta_tx_space(const caneta_tx_t* tx);
+
+// Drain: bytes queued and not yet consumed
+size_t caneta_tx_queued(const caneta_tx_t* tx);
+
+// Drain: the longest contiguous run of queued bytes, or 0 if the ring is empty.
+// The bytes stay valid until caneta_tx_consume.
+size_t caneta_tx_peek(caneta_tx_t* tx, const uint8_t** data);
+
+// Drain: mark len bytes returned by caneta_tx_peek as sent
+void caneta_tx_consume(caneta_tx_t* tx, size_t len);
+
+// Sequences dropped so far
+uint32_t caneta_tx_dropped(const caneta_tx_t* tx);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif //CANETA_TX_H
@@ -0,0 +1,360 @@
+// caneta_composec.c
+// Compiles compose sequences into caneta_compose_table.c
+//
+//   caneta-composec OUTPUT.c COMPOSE.compose...
+//
+// The input is XCompose syntax, one sequence per line:
+//
+//   <dead_acute> <e>                : "é"   eacute
+//   <Multi_key> <quotedbl> <o>      : "ö"   odiaeresis
+//   <Multi_key> <C> <equal>         : "€"   EuroSign
+//
+// Keys are dead keys, Multi_key, single letters and digits, the names of the
+// ASCII and Latin-1 characters, or <UXXXX>. Anything after the result string
+// is ignored, and # starts a comment. A later definition of a sequence
+// replaces an earlier one, as in XCompose.
+//
+// Sequences have to start with a dead key or Multi_key, so every other key
+// types at once, and their results must fit a key's output. Sequences with
+// other keysyms (keypad, Greek, ...) are skipped and counted: a keyboard
+// bridge cannot type them. A sequence that is a prefix of another is an error.
+//
+// The sequences become a double-array trie over the keys' UTF-8 text, laid out
+// as in caneta_compose.h.
+
+#include <ctype.h>
+#include <errno.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "../src/caneta.h"
+#include "../src/caneta_compose.h"
+#include "caneta_tools.h"
+
+#define MAX_KEYS 8
+#define KEY_BYTES (MAX_KEYS * 4)
+
+typedef struct {
+    uint8_t key[KEY_BYTES];  // The keys' text, concatenated
+    uint8_t key_len;
+    uint8_t result[CANETA_KEY_OUTPUT_MAX];
+    uint8_t result_len;
+    const char* path;
+    int line;
+    size_t order;  // Definition order, so later ones win
+} sequence_t;
+
+static sequence_t* sequences;
+static size_t sequence_count;
+static size_t sequence_capacity;
+static size_t skipped;
+
+static caneta_compose_node_t* nodes;
+static size_t node_capacity;
+static size_t node_count;  // Highest slot used + 1
+
+static size_t first_free = 1;  // No free slot below this
+
+static uint8_t* results;
+static size_t results_len;
+
+static void fail(const char* path, int line, const char* message, const char* detail) {
+    if (line > 0) {
+        fprintf(stderr, "%s:%d: %s%s%s\n", path, line, message, detail ? ": " : "", detail ? detail : "");
+    } else {
+        fprintf(stderr, "%s: %s%s%s\n", path, message, detail ? ": " : "", detail ? detail : "");
+    }
+    exit(1);
+}
+
+static void* grow(void* p, size_t count, size_t size) {
+    p = realloc(p, count * size);
+    if (!p) {
+        fprintf(stderr, "out of memory\n");
+        exit(1);
+    }
+    return p;
+}
+
+// The text a key types into out; returns its length, or 0 for keysyms
+// no key types
+static size_t key_text(const char* name, uint8_t* out) {
+    const keysym_t* keysym;
+    uint32_t cp;
+
+    if (strcmp(name, "Multi_key") == 0) {
+        out[0] = CANETA_COMPOSE_KEY;
+        return 1;
+    } else if ((keysym = find_dead_keysym(name)) != NULL) {
+        out[0] = CANETA_COMPOSE_DEAD;
+        return 1 + encode_utf8(keysym->cp, (char*)out + 1);
+    } else if (isalnum((unsigned char)name[0]) && name[1] == '\0') {
+        cp = (unsigned char)name[0];
+    } else if ((keysym = find_char_keysym(name)) != NULL) {
+        cp = keysym->cp;
+    } else if (name[0] == 'U' && isxdigit((unsigned char)name[1])) {
+        char* end;
+        unsigned long value = strtoul(name + 1, &end, 16);
+        if (*end != '\0' || value < 0x20 || value > 0x10FFFF || (value >= 0x7F && value < 0xA0) ||
+            (value >= 0xD800 && value <= 0xDFFF)) {
+            return 0;
+        }
+        cp = (uint32_t)value;
+    } else {
+        return 0;
+    }
+    return encode_utf8(cp, (char*)out);
+}
+
+// The quoted result string at *p; returns false if it cannot be typed
+static bool parse_result(char** p, sequence_t* sequence, const char* path, int line) {
+    char* s = *p;
+    if (*s != '"') fail(path, line, "expected a result string", s);
+    s++;
+
+    uint8_t text[64 + 1];
+    size_t len = 0;
+    while (*s != '"') {
+        if (*s == '\0' || *s == '\n') fail(path, line, "unterminated string", NULL);
+        if (*s == '\\') {
+            s++;
+            if (*s != '"' && *s != '\\') fail(path, line, "unsupported escape in string", NULL);
+        }
+        if (len == sizeof(text) - 1) fail(path, line, "result too long", NULL);
+        text[len++] = (uint8_t)*s++;
+    }
+    *p = s + 1;
+
+    // Printable UTF-8 that fits one key's output
+    text[len] = '\0';
+    if (len == 0 || len > CANETA_KEY_OUTPUT_MAX) return false;
+    for (size_t i = 0; i < len;) {
+        uint32_t cp;
+        size_t n = decode_utf8(&text[i], &cp);
+        if (n == 0) fail(path, line, "malformed UTF-8", NULL);
+        if (cp < 0x20 || cp == 0x7F) return false;
+        i += n;
+    }
+    memcpy(sequence->result, text, len);
+    sequence->result_len = (uint8_t)len;
+    return true;
+}
+
+static void parse_file(const char* path) {
+    FILE* f = fopen(path, "r");
+    if (!f) fail(path, 0, "cannot open", strerror(errno));
+
+    char buf[512];
+    int line = 0;
+    while (fgets(buf, sizeof(buf), f)) {
+        line++;
+        if (strchr(buf, '\n') == NULL && !feof(f)) fail(path, line, "line too long", NULL);
+
+        char* p = buf;
+        while (isspace((unsigned char)*p)) p++;
+        if (*p == '\0' || *p == '#') continue;
+        if (*p != '<') fail(path, line, "expected a sequence", p);
+
+        sequence_t sequence = {.path = path, .line = line};
+        bool typeable = true;
+        int keys = 0;
+        while (*p == '<') {
+            char* end = strchr(p, '>');
+            if (!end) fail(path, line, "unterminated keysym", p);
+            *end = '\0';
+            if (++keys > MAX_KEYS) fail(path, line, "sequence too long", NULL);
+
+            size_t n = key_text(p + 1, sequence.key + sequence.key_len);
+            if (n == 0) typeable = false;
+            sequence.key_len = (uint8_t)(sequence.key_len + n);
+            p = end + 1;
+            while (isspace((unsigned char)*p)) p++;
+        }
+        if (*p != ':') fail(path, line, "expected ':'", p);
+        p++;
+        while (isspace((unsigned char)*p)) p++;
+        if (!parse_result(&p, &sequence, path, line)) typeable = false;
+
+        // Ordinary keys must not wait for a possible sequence
+        if (typeable && !caneta_compose_marker(sequence.key[0])) typeable = false;
+        if (!typeable || keys < 2) {
+            skipped++;
+            continue;
+        }
+
+        if (sequence_count == sequence_capacity) {
+            sequence_capacity = sequence_capacity ? 2 * sequence_capacity : 1024;
+            sequences = grow(sequences, sequence_capacity, sizeof(*sequences));
+        }
+        sequence.order = sequence_count;
+        sequences[sequence_count++] = sequence;
+    }
+    fclose(f);
+}
+
+static int compare_keys(const sequence_t* a, const sequence_t* b) {
+    size_t len = a->key_len < b->key_len ? a->key_len : b->key_len;
+    int c = memcmp(a->key, b->key, len);
+    return c ? c : (int)a->key_len - (int)b->key_len;
+}
+
+static int compare_sequences(const void* a, const void* b) {
+    int c = compare_keys(a, b);
+    if (c) return c;
+    const sequence_t* sa = a;
+    const sequence_t* sb = b;
+    return sa->order < sb->order ? -1 : sa->order > sb->order;
+}
+
+// Sorts the sequences, keeping the last definition of each
+static void dedupe(void) {
+    qsort(sequences, sequence_count, sizeof(*sequences), compare_sequences);
+    size_t kept = 0;
+    for (size_t i = 0; i < sequence_count; i++) {
+        if (kept > 0 && compare_keys(&sequences[kept - 1], &sequences[i]) == 0) {
+            sequences[kept - 1] = sequences[i];
+        } else {
+            sequences[kept++] = sequences[i];
+        }
+    }
+    sequence_count = kept;
+
+    // Sorted, a prefix comes right before the first sequence it begins
+    for (size_t i = 1; i < sequence_count; i++) {
+        const sequence_t* a = &sequences[i - 1];
+        const sequence_t* b = &sequences[i];
+        if (a->key_len < b->key_len && memcmp(a->key, b->key, a->key_len) == 0) {
+            fail(b->path, b->line, "sequence starts with a shorter one", NULL);
+        }
+    }
+}
+
+static void reserve_nodes(size_t count) {
+    if (count <= node_capacity) return;
+    size_t capacity = node_capacity ? node_capacity : 4096;
+    while (capacity < count) capacity *= 2;
+    nodes = grow(nodes, capacity, sizeof(*nodes));
+    for (size_t i = node_capacity; i < capacity; i++) {
+        nodes[i].base = 0;
+        nodes[i].check = CANETA_COMPOSE_NONE;
+    }
+    node_capacity = capacity;
+}
+
+static uint16_t add_result(const sequence_t* sequence) {
+    // Many sequences share a result
+    for (size_t i = 0; i < results_len; i += 1 + results[i]) {
+        if (results[i] == sequence->result_len && memcmp(&results[i + 1], sequence->result, results[i]) == 0) {
+            return (uint16_t)i;
+        }
+    }
+    if (results_len + 1 + sequence->result_len > CANETA_COMPOSE_RESULT) {
+        fail(sequence->path, 0, "too many results for the trie's offsets", NULL);
+    }
+    size_t offset = results_len;
+    results = grow(results, results_len + 1 + sequence->result_len, 1);
+    results[results_len++] = sequence->result_len;
+    memcpy(&results[results_len], sequence->result, sequence->result_len);
+    results_len += sequence->result_len;
+    return (uint16_t)offset;
+}
+
+// Places the node at slot s for the sequences [first, last), which share
+// their first depth bytes. The first base that fits all children wins.
+static void place(size_t s, size_t first, size_t last, size_t depth) {
+    if (sequences[first].key_len == depth) {
+        nodes[s].base = (uint16_t)(CANETA_COMPOSE_RESULT | add_result(&sequences[first]));
+        return;
+    }
+
+    uint8_t labels[256];
+    size_t label_count = 0;
+    for (size_t i = first; i < last; i++) {
+        uint8_t b = sequences[i].key[depth];
+        if (label_count == 0 || labels[label_count - 1] != b) labels[label_count++] = b;
+    }
+
+    size_t base = first_free > labels[0] ? first_free - labels[0] : 1;
+    for (;; base++) {
+        reserve_nodes(base + 256);
+        bool fits = true;
+        for (size_t i = 0; i < label_count && fits; i++) {
+            fits = nodes[base + labels[i]].check == CANETA_COMPOSE_NONE;
+        }
+        if (fits) break;
+    }
+    if (base + 0xFF >= CANETA_COMPOSE_RESULT) fail(sequences[first].path, 0, "too many sequences for the trie", NULL);
+
+    nodes[s].base = (uint16_t)base;
+    for (size_t i = 0; i < label_count; i++) {
+        nodes[base + labels[i]].check = (uint16_t)s;
+        if (base + labels[i] + 1 > node_count) node_count = base + labels[i] + 1;
+    }
+    // Every transition from here lands inside the array
+    if (base + 0x100 > node_count) node_count = base + 0x100;
+    while (nodes[first_free].check != CANETA_COMPOSE_NONE) first_free++;
+
+    for (size_t i = first; i < last;) {
+        uint8_t b = sequences[i].key[depth];
+        size_t j = i;
+        while (j < last && sequences[j].key[depth] == b) j++;
+        place(base + b, i, j, depth + 1);
+        i = j;
+    }
+}
+
+static void write_output(const char* path) {
+    FILE* out = fopen(path, "w");
+    if (!out) fail(path, 0, "cannot create", strerror(errno));
+
+    fprintf(out, "// caneta_compose_table.c\n");
+    fprintf(out, "// Compose sequences. Generated by tools/caneta_composec.c from\n");
+    fprintf(out, "// compose/*.compose; do not edit. Regenerate with the caneta-compose target.\n\n");
+    fprintf(out, "#include \"caneta_compose.h\"\n\n");
+
+    fprintf(out, "const caneta_compose_node_t caneta_compose_nodes[] = {");
+    for (size_t i = 0; i < node_count; i++) {
+        fprintf(out, "%s{0x%04X, 0x%04X},", i % 6 ? " " : "\n    ", nodes[i].base, nodes[i].check);
+    }
+    fprintf(out, "\n};\n\n");
+    fprintf(out, "const size_t caneta_compose_node_count = %zu;\n\n", node_count);
+
+    fprintf(out, "const uint8_t caneta_compose_results[] = {");
+    for (size_t i = 0; i < results_len; i++) {
+        fprintf(out, "%s0x%02X,", i % 12 ? " " : "\n    ", results[i]);
+    }
+    fprintf(out, "\n};\n\n");
+    fprintf(out, "const size_t caneta_compose_sequence_count = %zu;\n", sequence_count);
+
+    if (fclose(out) != 0) fail(path, 0, "write failed", strerror(errno));
+}
+
+int main(int argc, char** argv) {
+    if (argc < 3) {
+        fprintf(stderr, "usage: %s OUTPUT.c COMPOSE.compose...\n", argv[0]);
+        return 2;
+    }
+    for (int i = 2; i < argc; i++) {
+        parse_file(argv[i]);
+    }
+    if (sequence_count == 0) {
+        fprintf(stderr, "%s: no sequences\n", argv[0]);
+        return 1;
+    }
+    dedupe();
+
+    // The root is slot 0, which is also the idle state
+    reserve_nodes(256);
+    nodes[0].check = 0;
+    node_count = 1;
+    place(0, 0, sequence_count, 0);
+
+    write_output(argv[1]);
+    if (skipped) {
+        fprintf(stderr, "%s: skipped %zu sequences no keyboard types\n", argv[0], skipped);
+    }
+    return 0;
+}
@@ -0,0 +1,310 @@
+// caneta_layoutc.c
+// Compiles keyboard layout descriptions into caneta_layouts.c
+//
+//   caneta-layoutc OUTPUT.c LAYOUT.layout...
+//
+// A layout file describes what each key types, one key per line:
+//
+//   name        de
+//   description German
+//   base        us        # start from another layout's keys
+//   altgr                 # right Alt selects the AltGr levels
+//   # usage  base  shift  altgr  shift+altgr
+//   0x1F     2     "      ²
+//   0x2D     ß     ?      \\      # backslash on AltGr
+//   0x2E     dead_acute  dead_grave
+//
+// A key line replaces every level the base layout gave that usage. Each level
+// is one character, written as itself (UTF-8), as U+XXXX, as an escape (\r \t
+// \b \e, \s for space, \\ \# \-), as a dead key (dead_acute, ...), as
+// Multi_key for the Compose key, or as - for nothing; missing levels type
+// nothing. # starts a comment.
+//
+// The output holds every layout as const tables of the same shape, US first
+// (the default) and the rest by name. It is committed, so builds that compile
+// caneta-c's sources directly need nothing but a C compiler.
+
+#include <ctype.h>
+#include <errno.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "../src/caneta_compose.h"
+#include "../src/caneta_layout.h"
+#include "caneta_tools.h"
+
+#define MAX_LAYOUTS 32
+#define NAME_MAX_LEN 15
+#define DESCRIPTION_MAX_LEN 63
+
+typedef struct {
+    const char* path;
+    char name[NAME_MAX_LEN + 1];
+    char description[DESCRIPTION_MAX_LEN + 1];
+    char base[NAME_MAX_LEN + 1];
+    uint8_t flags;
+    bool defined[CANETA_LAYOUT_USAGES];
+    char keys[CANETA_LAYOUT_USAGES][CANETA_LAYOUT_LEVELS][CANETA_LAYOUT_CELL + 1];
+
+    // Filled in by resolve()
+    int state;  // 0 unresolved, 1 resolving, 2 resolved
+    uint8_t resolved_flags;
+    char resolved[CANETA_LAYOUT_USAGES][CANETA_LAYOUT_LEVELS][CANETA_LAYOUT_CELL + 1];
+} layout_t;
+
+static layout_t layouts[MAX_LAYOUTS];
+static int layout_count;
+
+static void fail(const char* path, int line, const char* message, const char* detail) {
+    if (line > 0) {
+        fprintf(stderr, "%s:%d: %s%s%s\n", path, line, message, detail ? ": " : "", detail ? detail : "");
+    } else {
+        fprintf(stderr, "%s: %s%s%s\n", path, message, detail ? ": " : "", detail ? detail : "");
+    }
+    exit(1);
+}
+
+// One level of a key line into cell (NUL-terminated UTF-8)
+static void parse_level(const char* token, char* cell, const char* path, int line) {
+    uint32_t cp;
+    memset(cell, 0, CANETA_LAYOUT_CELL + 1);
+
+    if (strcmp(token, "-") == 0) {
+        return;
+    } else if (strcmp(token, "Multi_key") == 0) {
+        cell[0] = (char)CANETA_COMPOSE_KEY;
+        return;
+    } else if (strncmp(token, "dead_", 5) == 0) {
+        const keysym_t* dead = find_dead_keysym(token);
+        if (!dead) fail(path, line, "unknown dead key", token);
+        cell[0] = (char)CANETA_COMPOSE_DEAD;
+        encode_utf8(dead->cp, cell + 1);
+        return;
+    } else if (token[0] == '\\' && token[1] != '\0' && token[2] == '\0') {
+        switch (token[1]) {
+            case 'r': cp = '\r'; break;
+            case 't': cp = '\t'; break;
+            case 'b': cp = '\b'; break;
+            case 'e': cp = 0x1B; break;
+            case 's': cp = ' '; break;
+            case '\\': case '#': case '-': cp = (unsigned char)token[1]; break;
+            default: fail(path, line, "unknown escape", token);
+        }
+    } else if (token[0] == 'U' && token[1] == '+' && token[2] != '\0') {
+        char* end;
+        errno = 0;
+        unsigned long value = strtoul(token + 2, &end, 16);
+        if (errno != 0 || *end != '\0') fail(path, line, "bad code point", token);
+        cp = (uint32_t)value;
+    } else {
+        size_t len = decode_utf8((const unsigned char*)token, &cp);
+        if (len == 0) fail(path, line, "malformed UTF-8", token);
+        if (token[len] != '\0') fail(path, line, "more than one character", token);
+    }
+
+    if (cp == 0 || cp > 0x10FFFF || (cp >= 0xD800 && cp <= 0xDFFF)) fail(path, line, "bad code point", token);
+    encode_utf8(cp, cell);
+}
+
+// Splits line into whitespace-separated tokens, stopping at a comment
+static int tokenize(char* line, char** tokens, int max_tokens) {
+    int count = 0;
+    char* p = line;
+    for (;;) {
+        while (*p && isspace((unsigned char)*p)) p++;
+        if (*p == '\0' || *p == '#') break;
+        if (count == max_tokens) return max_tokens + 1;
+        tokens[count++] = p;
+        while (*p && !isspace((unsigned char)*p)) p++;
+        if (*p) *p++ = '\0';
+    }
+    return count;
+}
+
+static void copy_name(char* dst, size_t max_len, const char* src, const char* path, int line) {
+    if (strlen(src) > max_len) fail(path, line, "too long", src);
+    strcpy(dst, src);
+}
+
+static void parse_file(layout_t* layout, const char* path) {
+    FILE* f = fopen(path, "r");
+    if (!f) fail(path, 0, "cannot open", strerror(errno));
+    layout->path = path;
+
+    char buf[512];
+    int line = 0;
+    while (fgets(buf, sizeof(buf), f)) {
+        line++;
+        if (strchr(buf, '\n') == NULL && !feof(f)) fail(path, line, "line too long", NULL);
+
+        // The description is the rest of the line, spaces included
+        char* rest = buf;
+        while (isspace((unsigned char)*rest)) rest++;
+        if (strncmp(rest, "description", 11) == 0 && isspace((unsigned char)rest[11])) {
+            rest += 11;
+            while (isspace((unsigned char)*rest)) rest++;
+            size_t len = strlen(rest);
+            while (len > 0 && isspace((unsigned char)rest[len - 1])) rest[--len] = '\0';
+            copy_name(layout->description, DESCRIPTION_MAX_LEN, rest, path, line);
+            continue;
+        }
+
+        char* tokens[1 + CANETA_LAYOUT_LEVELS];
+        int count = tokenize(buf, tokens, 1 + CANETA_LAYOUT_LEVELS);
+        if (count == 0) continue;
+        if (count > 1 + CANETA_LAYOUT_LEVELS) fail(path, line, "too many levels", NULL);
+
+        if (strcmp(tokens[0], "name") == 0 && count == 2) {
+            copy_name(layout->name, NAME_MAX_LEN, tokens[1], path, line);
+        } else if (strcmp(tokens[0], "base") == 0 && count == 2) {
+            copy_name(layout->base, NAME_MAX_LEN, tokens[1], path, line);
+        } else if (strcmp(tokens[0], "altgr") == 0 && count == 1) {
+            layout->flags |= CANETA_LAYOUT_ALTGR;
+        } else if (strncmp(tokens[0], "0x", 2) == 0) {
+            char* end;
+            unsigned long usage = strtoul(tokens[0] + 2, &end, 16);
+            if (*end != '\0' || end == tokens[0] + 2) fail(path, line, "bad usage", tokens[0]);
+            if (usage == 0 || usage >= CANETA_LAYOUT_USAGES) fail(path, line, "usage out of range", tokens[0]);
+            if (layout->defined[usage]) fail(path, line, "usage defined twice", tokens[0]);
+            layout->defined[usage] = true;
+            for (int level = 0; level < CANETA_LAYOUT_LEVELS; level++) {
+                if (level + 1 < count) {
+                    parse_level(tokens[level + 1], layout->keys[usage][level], path, line);
+                }
+            }
+        } else {
+            fail(path, line, "unknown line", tokens[0]);
+        }
+    }
+    fclose(f);
+
+    if (layout->name[0] == '\0') fail(path, 0, "no name", NULL);
+    for (const char* c = layout->name; *c; c++) {
+        if (!islower((unsigned char)*c) && !isdigit((unsigned char)*c) && *c != '_') {
+            fail(path, 0, "names are lowercase letters, digits and _", layout->name);
+        }
+    }
+    if (layout->description[0] == '\0') strcpy(layout->description, layout->name);
+}
+
+static layout_t* find(const char* name) {
+    for (int i = 0; i < layout_count; i++) {
+        if (strcmp(layouts[i].name, name) == 0) return &layouts[i];
+    }
+    return NULL;
+}
+
+static void resolve(layout_t* layout) {
+    if (layout->state == 2) return;
+    if (layout->state == 1) fail(layout->path, 0, "base layouts form a cycle", layout->name);
+    layout->state = 1;
+
+    if (layout->base[0]) {
+        layout_t* base = find(layout->base);
+        if (!base) fail(layout->path, 0, "unknown base layout", layout->base);
+        resolve(base);
+        memcpy(layout->resolved, base->resolved, sizeof(layout->resolved));
+        layout->resolved_flags = base->resolved_flags;
+    }
+    layout->resolved_flags |= layout->flags;
+    for (int usage = 0; usage < CANETA_LAYOUT_USAGES; usage++) {
+        if (layout->defined[usage]) {
+            memcpy(layout->resolved[usage], layout->keys[usage], sizeof(layout->keys[usage]));
+        }
+    }
+    layout->state = 2;
+}
+
+static int compare_layouts(const void* a, const void* b) {
+    const layout_t* la = a;
+    const layout_t* lb = b;
+    // US first: it is the default
+    bool us_a = strcmp(la->name, "us") == 0;
+    bool us_b = strcmp(lb->name, "us") == 0;
+    if (us_a != us_b) return us_a ? -1 : 1;
+    return strcmp(la->name, lb->name);
+}
+
+static void write_string(FILE* out, const char* s) {
+    fputc('"', out);
+    for (const unsigned char* c = (const unsigned char*)s; *c; c++) {
+        if (*c == '"' || *c == '\\') {
+            fprintf(out, "\\%c", *c);
+        } else if (*c >= 0x20 && *c < 0x7F) {
+            fputc(*c, out);
+        } else {
+            fprintf(out, "\\x%02X", *c);
+        }
+    }
+    fputc('"', out);
+}
+
+static void write_output(const char* path) {
+    FILE* out = fopen(path, "w");
+    if (!out) fail(path, 0, "cannot create", strerror(errno));
+
+    fprintf(out, "// caneta_layouts.c\n");
+    fprintf(out, "// Keyboard layout tables. Generated by tools/caneta_layoutc.c from\n");
+    fprintf(out, "// layouts/*.layout; do not edit. Regenerate with the caneta-layouts target.\n\n");
+    fprintf(out, "#include \"caneta_layout.h\"\n\n");
+    fprintf(out, "const caneta_layout_t caneta_layouts[] = {\n");
+    for (int i = 0; i < layout_count; i++) {
+        const layout_t* layout = &layouts[i];
+        fprintf(out, "    {\n        ");
+        write_string(out, layout->name);
+        fprintf(out, ", ");
+        write_string(out, layout->description);
+        fprintf(out, ", %s,\n        {\n", layout->resolved_flags & CANETA_LAYOUT_ALTGR ? "CANETA_LAYOUT_ALTGR" : "0");
+        for (int usage = 0; usage < CANETA_LAYOUT_USAGES; usage++) {
+            int levels = CANETA_LAYOUT_LEVELS;
+            while (levels > 0 && layout->resolved[usage][levels - 1][0] == '\0') levels--;
+            if (levels == 0) continue;
+            fprintf(out, "            [0x%02X] = {", usage);
+            for (int level = 0; level < levels; level++) {
+                if (level > 0) fprintf(out, ", ");
+                write_string(out, layout->resolved[usage][level]);
+            }
+            fprintf(out, "},\n");
+        }
+        fprintf(out, "        },\n    },\n");
+    }
+    fprintf(out, "};\n\n");
+    fprintf(out, "const size_t caneta_layout_count = %d;\n", layout_count);
+
+    if (fclose(out) != 0) fail(path, 0, "write failed", strerror(errno));
+}
+
+int main(int argc, char** argv) {
+    if (argc < 3) {
+        fprintf(stderr, "usage: %s OUTPUT.c LAYOUT.layout...\n", argv[0]);
+        return 2;
+    }
+    if (argc - 2 > MAX_LAYOUTS) {
+        fprintf(stderr, "%s: at most %d layouts\n", argv[0], MAX_LAYOUTS);
+        return 1;
+    }
+
+    for (int i = 2; i < argc; i++) {
+        layout_t* layout = &layouts[layout_count++];
+        parse_file(layout, argv[i]);
+        for (int j = 0; j < layout_count - 1; j++) {
+            if (strcmp(layouts[j].name, layout->name) == 0) fail(argv[i], 0, "layout defined twice", layout->name);
+        }
+    }
+    if (!find("us")) {
+        fprintf(stderr, "%s: the us layout is required, it is the default\n", argv[0]);
+        return 1;
+    }
+
+    // Bases are looked up by name, so resolve before sorting moves them
+    for (int i = 0; i < layout_count; i++) {
+        resolve(&layouts[i]);
+    }
+    qsort(layouts, (size_t)layout_count, sizeof(layouts[0]), compare_layouts);
+
+    write_output(argv[1]);
+    return 0;
+}
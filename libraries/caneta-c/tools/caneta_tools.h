@@ -0,0 +1,128 @@
+// caneta_tools.h
+// Shared by the table compilers: UTF-8, and the X keysym names they
+// understand. Those are the dead keys, Multi_key (the Compose key), and the
+// names of the ASCII and Latin-1 characters; other characters are written
+// <UXXXX> in compose files.
+
+#ifndef CANETA_TOOLS_H
+#define CANETA_TOOLS_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+static size_t encode_utf8(uint32_t cp, char* out) {
+    if (cp < 0x80) {
+        out[0] = (char)cp;
+        return 1;
+    }
+    if (cp < 0x800) {
+        out[0] = (char)(0xC0 | cp >> 6);
+        out[1] = (char)(0x80 | (cp & 0x3F));
+        return 2;
+    }
+    if (cp < 0x10000) {
+        out[0] = (char)(0xE0 | cp >> 12);
+        out[1] = (char)(0x80 | (cp >> 6 & 0x3F));
+        out[2] = (char)(0x80 | (cp & 0x3F));
+        return 3;
+    }
+    out[0] = (char)(0xF0 | cp >> 18);
+    out[1] = (char)(0x80 | (cp >> 12 & 0x3F));
+    out[2] = (char)(0x80 | (cp >> 6 & 0x3F));
+    out[3] = (char)(0x80 | (cp & 0x3F));
+    return 4;
+}
+
+// Decodes one UTF-8 code point; returns its length, or 0 if malformed
+static size_t decode_utf8(const unsigned char* s, uint32_t* cp) {
+    size_t len;
+    if (s[0] < 0x80) {
+        *cp = s[0];
+        return s[0] ? 1 : 0;
+    } else if ((s[0] & 0xE0) == 0xC0) {
+        *cp = s[0] & 0x1F;
+        len = 2;
+    } else if ((s[0] & 0xF0) == 0xE0) {
+        *cp = s[0] & 0x0F;
+        len = 3;
+    } else if ((s[0] & 0xF8) == 0xF0) {
+        *cp = s[0] & 0x07;
+        len = 4;
+    } else {
+        return 0;
+    }
+    for (size_t i = 1; i < len; i++) {
+        if ((s[i] & 0xC0) != 0x80) return 0;
+        *cp = *cp << 6 | (s[i] & 0x3F);
+    }
+    // Overlong forms
+    static const uint32_t min_cp[5] = {0, 0, 0x80, 0x800, 0x10000};
+    return *cp >= min_cp[len] ? len : 0;
+}
+
+
+typedef struct {
+    const char* name;
+    uint32_t cp;  // For dead keys, the combining mark they stand for
+} keysym_t;
+
+static const keysym_t dead_keysyms[] = {
+    {"dead_grave", 0x0300},      {"dead_acute", 0x0301},      {"dead_circumflex", 0x0302},
+    {"dead_tilde", 0x0303},      {"dead_macron", 0x0304},     {"dead_breve", 0x0306},
+    {"dead_abovedot", 0x0307},   {"dead_diaeresis", 0x0308},  {"dead_hook", 0x0309},
+    {"dead_abovering", 0x030A},  {"dead_doubleacute", 0x030B}, {"dead_caron", 0x030C},
+    {"dead_horn", 0x031B},       {"dead_belowdot", 0x0323},   {"dead_belowcomma", 0x0326},
+    {"dead_cedilla", 0x0327},    {"dead_ogonek", 0x0328},     {"dead_stroke", 0x0335},
+};
+
+static const keysym_t char_keysyms[] = {
+    {"space", 0x20}, {"exclam", 0x21}, {"quotedbl", 0x22}, {"numbersign", 0x23},
+    {"dollar", 0x24}, {"percent", 0x25}, {"ampersand", 0x26}, {"apostrophe", 0x27},
+    {"quoteright", 0x27}, {"parenleft", 0x28}, {"parenright", 0x29}, {"asterisk", 0x2A},
+    {"plus", 0x2B}, {"comma", 0x2C}, {"minus", 0x2D}, {"period", 0x2E},
+    {"slash", 0x2F}, {"colon", 0x3A}, {"semicolon", 0x3B}, {"less", 0x3C},
+    {"equal", 0x3D}, {"greater", 0x3E}, {"question", 0x3F}, {"at", 0x40},
+    {"bracketleft", 0x5B}, {"backslash", 0x5C}, {"bracketright", 0x5D}, {"asciicircum", 0x5E},
+    {"underscore", 0x5F}, {"grave", 0x60}, {"quoteleft", 0x60}, {"braceleft", 0x7B},
+    {"bar", 0x7C}, {"braceright", 0x7D}, {"asciitilde", 0x7E},
+    {"nobreakspace", 0xA0}, {"exclamdown", 0xA1}, {"cent", 0xA2}, {"sterling", 0xA3},
+    {"currency", 0xA4}, {"yen", 0xA5}, {"brokenbar", 0xA6}, {"section", 0xA7},
+    {"diaeresis", 0xA8}, {"copyright", 0xA9}, {"ordfeminine", 0xAA}, {"guillemotleft", 0xAB},
+    {"guillemetleft", 0xAB}, {"notsign", 0xAC}, {"hyphen", 0xAD}, {"registered", 0xAE},
+    {"macron", 0xAF}, {"degree", 0xB0}, {"plusminus", 0xB1}, {"twosuperior", 0xB2},
+    {"threesuperior", 0xB3}, {"acute", 0xB4}, {"mu", 0xB5}, {"paragraph", 0xB6},
+    {"periodcentered", 0xB7}, {"cedilla", 0xB8}, {"onesuperior", 0xB9}, {"masculine", 0xBA},
+    {"ordmasculine", 0xBA}, {"guillemotright", 0xBB}, {"guillemetright", 0xBB}, {"onequarter", 0xBC},
+    {"onehalf", 0xBD}, {"threequarters", 0xBE}, {"questiondown", 0xBF},
+    {"Agrave", 0xC0}, {"Aacute", 0xC1}, {"Acircumflex", 0xC2}, {"Atilde", 0xC3},
+    {"Adiaeresis", 0xC4}, {"Aring", 0xC5}, {"AE", 0xC6}, {"Ccedilla", 0xC7},
+    {"Egrave", 0xC8}, {"Eacute", 0xC9}, {"Ecircumflex", 0xCA}, {"Ediaeresis", 0xCB},
+    {"Igrave", 0xCC}, {"Iacute", 0xCD}, {"Icircumflex", 0xCE}, {"Idiaeresis", 0xCF},
+    {"ETH", 0xD0}, {"Eth", 0xD0}, {"Ntilde", 0xD1}, {"Ograve", 0xD2},
+    {"Oacute", 0xD3}, {"Ocircumflex", 0xD4}, {"Otilde", 0xD5}, {"Odiaeresis", 0xD6},
+    {"multiply", 0xD7}, {"Oslash", 0xD8}, {"Ooblique", 0xD8}, {"Ugrave", 0xD9},
+    {"Uacute", 0xDA}, {"Ucircumflex", 0xDB}, {"Udiaeresis", 0xDC}, {"Yacute", 0xDD},
+    {"THORN", 0xDE}, {"Thorn", 0xDE}, {"ssharp", 0xDF},
+    {"agrave", 0xE0}, {"aacute", 0xE1}, {"acircumflex", 0xE2}, {"atilde", 0xE3},
+    {"adiaeresis", 0xE4}, {"aring", 0xE5}, {"ae", 0xE6}, {"ccedilla", 0xE7},
+    {"egrave", 0xE8}, {"eacute", 0xE9}, {"ecircumflex", 0xEA}, {"ediaeresis", 0xEB},
+    {"igrave", 0xEC}, {"iacute", 0xED}, {"icircumflex", 0xEE}, {"idiaeresis", 0xEF},
+    {"eth", 0xF0}, {"ntilde", 0xF1}, {"ograve", 0xF2}, {"oacute", 0xF3},
+    {"ocircumflex", 0xF4}, {"otilde", 0xF5}, {"odiaeresis", 0xF6}, {"division", 0xF7},
+    {"oslash", 0xF8}, {"ooblique", 0xF8}, {"ugrave", 0xF9}, {"uacute", 0xFA},
+    {"ucircumflex", 0xFB}, {"udiaeresis", 0xFC}, {"yacute", 0xFD}, {"thorn", 0xFE},
+    {"ydiaeresis", 0xFF}, {"EuroSign", 0x20AC},
+};
+
+static const keysym_t* find_keysym(const keysym_t* table, size_t count, const char* name) {
+    for (size_t i = 0; i < count; i++) {
+        if (strcmp(table[i].name, name) == 0) return &table[i];
+    }
+    return NULL;
+}
+
+#define find_dead_keysym(name) find_keysym(dead_keysyms, sizeof(dead_keysyms) / sizeof(dead_keysyms[0]), name)
+#define find_char_keysym(name) find_keysym(char_keysyms, sizeof(char_keysyms) / sizeof(char_keysyms[0]), name)
+
+#endif //CANETA_TOOLS_H
@@ -0,0 +1,462 @@
+// caneta_capture.c
+// Capture writer, memory-mapped reader and replay
+
+#define _POSIX_C_SOURCE 200809L
+
+#include "caneta_capture.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#define FILE_MAGIC "CANETCAP"
+#define INDEX_MAGIC "CANETIDX"
+#define MAGIC_SIZE 8
+
+#define HEADER_SIZE 24
+#define BLOCK_HEADER_SIZE 16
+#define INDEX_ENTRY_SIZE 24
+#define TRAILER_SIZE 32
+
+// Offsets of the seek keys within an index entry
+#define INDEX_FIRST_RECORD 8
+#define INDEX_BASE_TIME 16
+
+// Longest encoded record: 10-byte varint, source, report
+#define MAX_RECORD_SIZE (10 + 1 + CANETA_CAPTURE_REPORT_SIZE)
+
+// Little-endian helpers; the format does not depend on host byte order
+
+static void put_u16(uint8_t* p, uint16_t v) {
+    p[0] = (uint8_t)v;
+    p[1] = (uint8_t)(v >> 8);
+}
+
+static void put_u32(uint8_t* p, uint32_t v) {
+    for (int i = 0; i < 4; i++) p[i] = (uint8_t)(v >> (8 * i));
+}
+
+static void put_u64(uint8_t* p, uint64_t v) {
+    for (int i = 0; i < 8; i++) p[i] = (uint8_t)(v >> (8 * i));
+}
+
+static uint16_t get_u16(const uint8_t* p) {
+    return (uint16_t)(p[0] | p[1] << 8);
+}
+
+static uint32_t get_u32(const uint8_t* p) {
+    uint32_t v = 0;
+    for (int i = 3; i >= 0; i--) v = v << 8 | p[i];
+    return v;
+}
+
+static uint64_t get_u64(const uint8_t* p) {
+    uint64_t v = 0;
+    for (int i = 7; i >= 0; i--) v = v << 8 | p[i];
+    return v;
+}
+
+uint64_t caneta_capture_now_us(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000u + (uint64_t)ts.tv_nsec / 1000u;
+}
+
+// Writer
+
+typedef struct {
+    uint64_t offset;
+    uint64_t first_record;
+    uint64_t base_time_us;
+} index_entry_t;
+
+struct caneta_capture_writer {
+    FILE* file;
+    uint64_t offset;          // File offset of the next block
+    uint64_t record_count;
+    uint64_t last_time_us;
+
+    // Block being assembled
+    uint64_t block_base_us;
+    uint32_t block_records;
+    size_t payload_len;
+    uint8_t payload[CANETA_CAPTURE_BLOCK_RECORDS * MAX_RECORD_SIZE];
+
+    // Block index, written at close
+    index_entry_t* index;
+    size_t index_len;
+    size_t index_cap;
+};
+
+caneta_capture_writer_t* caneta_capture_open_write(const char* path) {
+    caneta_capture_writer_t* writer = calloc(1, sizeof(*writer));
+    if (!writer) return NULL;
+
+    writer->file = fopen(path, "wb");
+    if (!writer->file) {
+        free(writer);
+        return NULL;
+    }
+
+    uint8_t header[HEADER_SIZE] = {0};
+    memcpy(header, FILE_MAGIC, MAGIC_SIZE);
+    put_u16(header + 8, CANETA_CAPTURE_VERSION);
+    put_u16(header + 10, HEADER_SIZE);
+    put_u32(header + 12, CANETA_CAPTURE_BLOCK_RECORDS);
+    if (fwrite(header, 1, sizeof(header), writer->file) != sizeof(header)) {
+        fclose(writer->file);
+        free(writer);
+        return NULL;
+    }
+
+    writer->offset = HEADER_SIZE;
+    return writer;
+}
+
+static bool flush_block(caneta_capture_writer_t* writer) {
+    if (writer->block_records == 0) return true;
+
+    if (writer->index_len == writer->index_cap) {
+        size_t cap = writer->index_cap ? writer->index_cap * 2 : 256;
+        index_entry_t* index = realloc(writer->index, cap * sizeof(*index));
+        if (!index) return false;
+        writer->index = index;
+        writer->index_cap = cap;
+    }
+    writer->index[writer->index_len++] = (index_entry_t){
+        writer->offset,
+        writer->record_count - writer->block_records,
+        writer->block_base_us,
+    };
+
+    uint8_t header[BLOCK_HEADER_SIZE];
+    put_u64(header, writer->block_base_us);
+    put_u32(header + 8, writer->block_records);
+    put_u32(header + 12, (uint32_t)writer->payload_len);
+    if (fwrite(header, 1, sizeof(header), writer->file) != sizeof(header) ||
+        fwrite(writer->payload, 1, writer->payload_len, writer->file) != writer->payload_len) {
+        return false;
+    }
+
+    writer->offset += BLOCK_HEADER_SIZE + writer->payload_len;
+    writer->block_records = 0;
+    writer->payload_len = 0;
+    return true;
+}
+
+bool caneta_capture_write(caneta_capture_writer_t* writer, uint64_t time_us, uint8_t source,
+                          const uint8_t* report, size_t len) {
+    if (len > CANETA_CAPTURE_REPORT_SIZE) return false;
+    if (writer->block_records == CANETA_CAPTURE_BLOCK_RECORDS && !flush_block(writer)) {
+        return false;
+    }
+
+    if (time_us < writer->last_time_us) {
+        time_us = writer->last_time_us;
+    }
+    if (writer->block_records == 0) {
+        writer->block_base_us = time_us;
+        writer->last_time_us = time_us;
+    }
+
+    uint8_t* p = writer->payload + writer->payload_len;
+
+    // Varint delta from the previous record in this block
+    uint64_t delta = time_us - writer->last_time_us;
+    while (delta >= 0x80) {
+        *p++ = (uint8_t)(delta | 0x80);
+        delta >>= 7;
+    }
+    *p++ = (uint8_t)delta;
+
+    *p++ = source;
+    memcpy(p, report, len);
+    memset(p + len, 0, CANETA_CAPTURE_REPORT_SIZE - len);
+    p += CANETA_CAPTURE_REPORT_SIZE;
+
+    writer->payload_len = (size_t)(p - writer->payload);
+    writer->block_records++;
+    writer->record_count++;
+    writer->last_time_us = time_us;
+    return true;
+}
+
+bool caneta_capture_close_write(caneta_capture_writer_t* writer) {
+    bool ok = flush_block(writer);
+
+    uint64_t index_offset = writer->offset;
+    for (size_t i = 0; ok && i < writer->index_len; i++) {
+        uint8_t entry[INDEX_ENTRY_SIZE];
+        put_u64(entry, writer->index[i].offset);
+        put_u64(entry + 8, writer->index[i].first_record);
+        put_u64(entry + 16, writer->index[i].base_time_us);
+        ok = fwrite(entry, 1, sizeof(entry), writer->file) == sizeof(entry);
+    }
+
+    uint8_t trailer[TRAILER_SIZE];
+    memcpy(trailer, INDEX_MAGIC, MAGIC_SIZE);
+    put_u64(trailer + 8, index_offset);
+    put_u64(trailer + 16, writer->index_len);
+    put_u64(trailer + 24, writer->record_count);
+    ok = ok && fwrite(trailer, 1, sizeof(trailer), writer->file) == sizeof(trailer);
+
+    ok = fclose(writer->file) == 0 && ok;
+    free(writer->index);
+    free(writer);
+    return ok;
+}
+
+// Reader
+
+struct caneta_capture_reader {
+    const uint8_t* data;
+    size_t size;
+    const uint8_t* blocks;      // First block, after the header
+    const uint8_t* blocks_end;  // First byte after the last block
+    const uint8_t* index;       // In-place index entries, NULL if the file has none
+    uint64_t block_count;
+    uint64_t record_count;
+};
+
+// Validates the block header at p and returns its payload end, or NULL
+static const uint8_t* block_payload_end(const caneta_capture_reader_t* reader, const uint8_t* p) {
+    if (p > reader->blocks_end || (size_t)(reader->blocks_end - p) < BLOCK_HEADER_SIZE) return NULL;
+    uint32_t payload = get_u32(p + 12);
+    if ((size_t)(reader->blocks_end - p) - BLOCK_HEADER_SIZE < payload) return NULL;
+    return p + BLOCK_HEADER_SIZE + payload;
+}
+
+caneta_capture_reader_t* caneta_capture_open_read(const char* path) {
+    int fd = open(path, O_RDONLY);
+    if (fd < 0) return NULL;
+
+    struct stat st;
+    if (fstat(fd, &st) != 0 || (size_t)st.st_size < HEADER_SIZE) {
+        close(fd);
+        return NULL;
+    }
+
+    size_t size = (size_t)st.st_size;
+    void* map = mmap(NULL, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);  // The mapping keeps the file alive
+    if (map == MAP_FAILED) return NULL;
+
+    const uint8_t* data = map;
+    size_t header_size = get_u16(data + 10);
+    if (memcmp(data, FILE_MAGIC, MAGIC_SIZE) != 0 || get_u16(data + 8) != CANETA_CAPTURE_VERSION ||
+        header_size < HEADER_SIZE || header_size > size) {
+        munmap(map, size);
+        return NULL;
+    }
+
+    caneta_capture_reader_t* reader = calloc(1, sizeof(*reader));
+    if (!reader) {
+        munmap(map, size);
+        return NULL;
+    }
+    reader->data = data;
+    reader->size = size;
+    reader->blocks = data + header_size;
+    reader->blocks_end = data + size;
+
+    // Use the index if the writer closed the file cleanly
+    const uint8_t* trailer = data + size - TRAILER_SIZE;
+    if (size >= HEADER_SIZE + TRAILER_SIZE && memcmp(trailer, INDEX_MAGIC, MAGIC_SIZE) == 0) {
+        uint64_t index_offset = get_u64(trailer + 8);
+        uint64_t block_count = get_u64(trailer + 16);
+        if (index_offset >= header_size && index_offset <= size - TRAILER_SIZE &&
+            block_count == (size - TRAILER_SIZE - index_offset) / INDEX_ENTRY_SIZE) {
+            reader->blocks_end = data + index_offset;
+            reader->index = data + index_offset;
+            reader->block_count = block_count;
+            reader->record_count = get_u64(trailer + 24);
+        }
+
+        // Seeks jump straight to the offsets the index gives, so every one
+        // must point at a block
+        for (uint64_t i = 0; reader->index && i < block_count; i++) {
+            uint64_t offset = get_u64(reader->index + i * INDEX_ENTRY_SIZE);
+            if (offset < header_size || offset >= index_offset) {
+                caneta_capture_close_read(reader);
+                return NULL;
+            }
+        }
+    }
+
+    // Otherwise (a capture cut short) count what is there by walking the block headers
+    if (!reader->index) {
+        const uint8_t* p = reader->blocks;
+        const uint8_t* end;
+        while ((end = block_payload_end(reader, p)) != NULL) {
+            reader->block_count++;
+            reader->record_count += get_u32(p + 8);
+            p = end;
+        }
+        reader->blocks_end = p;
+    }
+
+    posix_madvise(map, size, POSIX_MADV_SEQUENTIAL);
+    return reader;
+}
+
+void caneta_capture_close_read(caneta_capture_reader_t* reader) {
+    if (!reader) return;
+    munmap((void*)reader->data, reader->size);
+    free(reader);
+}
+
+uint64_t caneta_capture_record_count(const caneta_capture_reader_t* reader) {
+    return reader->record_count;
+}
+
+uint64_t caneta_capture_block_count(const caneta_capture_reader_t* reader) {
+    return reader->block_count;
+}
+
+// Point cursor at the start of the block whose header is at p
+static bool enter_block(const caneta_capture_reader_t* reader, const uint8_t* p,
+                        caneta_capture_cursor_t* cursor) {
+    const uint8_t* end = block_payload_end(reader, p);
+    if (!end) return false;
+    cursor->pos = p + BLOCK_HEADER_SIZE;
+    cursor->block_end = end;
+    cursor->block_remaining = get_u32(p + 8);
+    cursor->time_us = get_u64(p);
+    return true;
+}
+
+// Finds the last block whose index key (first record or base time) is <= key
+// and returns its header, or the first block if key precedes them all.
+static const uint8_t* find_block(const caneta_capture_reader_t* reader, size_t key_offset, uint64_t key,
+                                 uint64_t* first_record) {
+    if (reader->block_count == 0) return NULL;
+
+    if (reader->index) {
+        uint64_t lo = 0;
+        uint64_t hi = reader->block_count;
+        while (hi - lo > 1) {
+            uint64_t mid = lo + (hi - lo) / 2;
+            if (get_u64(reader->index + mid * INDEX_ENTRY_SIZE + key_offset) <= key) {
+                lo = mid;
+            } else {
+                hi = mid;
+            }
+        }
+        const uint8_t* entry = reader->index + lo * INDEX_ENTRY_SIZE;
+        *first_record = get_u64(entry + INDEX_FIRST_RECORD);
+        return reader->data + get_u64(entry);
+    }
+
+    // No index: walk the block headers
+    const uint8_t* p = reader->blocks;
+    uint64_t record = 0;
+    *first_record = 0;
+    const uint8_t* found = p;
+    for (const uint8_t* end; (end = block_payload_end(reader, p)) != NULL; p = end) {
+        uint64_t block_key = key_offset == INDEX_FIRST_RECORD ? record : get_u64(p);
+        if (block_key > key) break;
+        found = p;
+        *first_record = record;
+        record += get_u32(p + 8);
+    }
+    return found;
+}
+
+bool caneta_capture_seek_record(const caneta_capture_reader_t* reader, uint64_t index,
+                                caneta_capture_cursor_t* cursor) {
+    if (index >= reader->record_count) return false;
+
+    uint64_t record;
+    const uint8_t* block = find_block(reader, INDEX_FIRST_RECORD, index, &record);
+    if (!block || !enter_block(reader, block, cursor)) return false;
+
+    caneta_capture_record_t skipped;
+    for (; record < index; record++) {
+        if (!caneta_capture_next(reader, cursor, &skipped)) return false;
+    }
+    return true;
+}
+
+bool caneta_capture_seek_time(const caneta_capture_reader_t* reader, uint64_t time_us,
+                              caneta_capture_cursor_t* cursor) {
+    uint64_t record;
+    const uint8_t* block = find_block(reader, INDEX_BASE_TIME, time_us, &record);
+    if (!block || !enter_block(reader, block, cursor)) return false;
+
+    // Stop just before the first record at or after time_us
+    caneta_capture_cursor_t before = *cursor;
+    caneta_capture_record_t next;
+    while (caneta_capture_next(reader, cursor, &next)) {
+        if (next.time_us >= time_us) {
+            *cursor = before;
+            return true;
+        }
+        before = *cursor;
+    }
+    return false;
+}
+
+bool caneta_capture_next(const caneta_capture_reader_t* reader, caneta_capture_cursor_t* cursor,
+                         caneta_capture_record_t* record) {
+    // Move on to the next block, skipping any that are empty
+    while (cursor->block_remaining == 0) {
+        if (cursor->block_end >= reader->blocks_end || !enter_block(reader, cursor->block_end, cursor)) {
+            return false;
+        }
+    }
+
+    const uint8_t* p = cursor->pos;
+    uint64_t delta = 0;
+    for (int shift = 0; ; shift += 7) {
+        if (p >= cursor->block_end || shift > 63) return false;
+        uint8_t byte = *p++;
+        delta |= (uint64_t)(byte & 0x7F) << shift;
+        if (!(byte & 0x80)) break;
+    }
+    if ((size_t)(cursor->block_end - p) < 1 + CANETA_CAPTURE_REPORT_SIZE) return false;
+
+    cursor->time_us += delta;
+    record->time_us = cursor->time_us;
+    record->source = *p++;
+    memcpy(record->report, p, CANETA_CAPTURE_REPORT_SIZE);
+
+    cursor->pos = p + CANETA_CAPTURE_REPORT_SIZE;
+    cursor->block_remaining--;
+    return true;
+}
+
+uint64_t caneta_capture_replay(const caneta_capture_reader_t* reader, caneta_capture_cursor_t* cursor,
+                               bool realtime, caneta_capture_replay_fn fn, void* ctx) {
+    caneta_capture_record_t record;
+    uint64_t replayed = 0;
+    uint64_t wall_start = 0;
+    uint64_t capture_start = 0;
+
+    while (caneta_capture_next(reader, cursor, &record)) {
+        if (realtime) {
+            if (replayed == 0) {
+                wall_start = caneta_capture_now_us();
+                capture_start = record.time_us;
+            }
+
+            // Sleep until this record is due relative to the first one
+            uint64_t due = wall_start + (record.time_us - capture_start);
+            uint64_t now = caneta_capture_now_us();
+            if (due > now) {
+                uint64_t wait = due - now;
+                struct timespec ts = { (time_t)(wait / 1000000u), (long)(wait % 1000000u) * 1000 };
+                nanosleep(&ts, NULL);
+            }
+        }
+
+        fn(ctx, &record);
+        replayed++;
+    }
+
+    return replayed;
+}
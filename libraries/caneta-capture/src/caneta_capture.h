@@ -0,0 +1,107 @@
+// caneta_capture.h
+// Binary capture format for recording and replaying HID keyboard traffic
+//
+// A capture is a sequence of timestamped 8-byte boot reports. Records are
+// grouped into blocks; within a block each record stores its time as a
+// varint delta from the previous record, so typing costs about 10 bytes per
+// report. A block index at the end of the file maps record numbers and
+// timestamps to block offsets, so readers can seek without scanning.
+//
+// Layout (all integers little-endian):
+//   header   "CANETCAP", u16 version, u16 header size, u32 records per block,
+//            u64 reserved
+//   block    u64 base time (us), u32 record count, u32 payload bytes, payload
+//   record   varint delta time (us), u8 source, 8 report bytes
+//   index    per block: u64 file offset, u64 first record, u64 base time
+//   trailer  "CANETIDX", u64 index offset, u64 block count, u64 record count
+//
+// Readers map the file read-only and decode records in place, so captures of
+// any size open without being copied into memory.
+
+#ifndef CANETA_CAPTURE_H
+#define CANETA_CAPTURE_H
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+#define CANETA_CAPTURE_VERSION 1
+#define CANETA_CAPTURE_REPORT_SIZE 8
+#define CANETA_CAPTURE_BLOCK_RECORDS 4096
+
+typedef struct {
+  uint64_t time_us;  // Capture clock, microseconds
+  uint8_t source;    // Which keyboard produced the report (e.g. HID instance)
+  uint8_t report[CANETA_CAPTURE_REPORT_SIZE];
+} caneta_capture_record_t;
+
+// Monotonic microsecond clock for timestamping records
+uint64_t caneta_capture_now_us(void);
+
+// Writer
+
+typedef struct caneta_capture_writer caneta_capture_writer_t;
+
+// Create (or truncate) a capture file. Returns NULL on failure.
+caneta_capture_writer_t* caneta_capture_open_write(const char* path);
+
+// Append one report. Shorter reports than 8 bytes are zero-padded; longer
+// ones (NKRO, or a report ID ahead of the boot layout) are refused rather
+// than cut short, returning false. Timestamps that go backwards are recorded
+// as a zero delta.
+bool caneta_capture_write(caneta_capture_writer_t* writer, uint64_t time_us, uint8_t source,
+                          const uint8_t* report, size_t len);
+
+// Flush the last block, write the index and close the file. Always frees the writer.
+bool caneta_capture_close_write(caneta_capture_writer_t* writer);
+
+// Reader
+
+typedef struct caneta_capture_reader caneta_capture_reader_t;
+
+// Position within a mapped capture. Obtain one from a seek function.
+typedef struct {
+  const uint8_t* pos;         // Next record
+  const uint8_t* block_end;   // End of the current block's payload
+  uint32_t block_remaining;   // Records left in the current block
+  uint64_t time_us;           // Time of the previous record
+} caneta_capture_cursor_t;
+
+// Map a capture file read-only. Returns NULL if it is missing or malformed:
+// every offset in the header and index is checked against the file here, so
+// a crafted file can't make the seek and decode functions read outside it.
+caneta_capture_reader_t* caneta_capture_open_read(const char* path);
+void caneta_capture_close_read(caneta_capture_reader_t* reader);
+
+uint64_t caneta_capture_record_count(const caneta_capture_reader_t* reader);
+uint64_t caneta_capture_block_count(const caneta_capture_reader_t* reader);
+
+// Position cursor at record number index, or at the first record at or after
+// time_us. Both use the block index and decode at most one block. Return false
+// if the position is past the end of the capture.
+bool caneta_capture_seek_record(const caneta_capture_reader_t* reader, uint64_t index,
+                                caneta_capture_cursor_t* cursor);
+bool caneta_capture_seek_time(const caneta_capture_reader_t* reader, uint64_t time_us,
+                              caneta_capture_cursor_t* cursor);
+
+// Decode the record at cursor and advance. Returns false at the end of the capture.
+bool caneta_capture_next(const caneta_capture_reader_t* reader, caneta_capture_cursor_t* cursor,
+                         caneta_capture_record_t* record);
+
+// Replay records from cursor to the end, calling fn for each one. With
+// realtime set, sleeps so records are delivered with their original spacing;
+// otherwise delivers them as fast as fn returns. Returns the number replayed.
+typedef void (*caneta_capture_replay_fn)(void* ctx, const caneta_capture_record_t* record);
+uint64_t caneta_capture_replay(const caneta_capture_reader_t* reader, caneta_capture_cursor_t* cursor,
+                               bool realtime, caneta_capture_replay_fn fn, void* ctx);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // CANETA_CAPTURE_H
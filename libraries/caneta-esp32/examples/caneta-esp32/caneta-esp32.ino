@@ -26,19 +26,16 @@ void setup() {
         return;
     }
 
-    // Set up callbacks
-    keyboard.setKeyEventCallback([](char ascii_char) {
-        // Send regular characters to UART
-        Serial1.write(ascii_char);
-        Serial.printf("Key: 0x%02X ('%c')\n", ascii_char,
-                     (ascii_char >= 32 && ascii_char <= 126) ? ascii_char : '?');
-    });
+    // Ask each keyboard for a 7.5 ms connection interval (the default);
+    // CANETA_LINK_LOW_POWER trades keystroke latency for keyboard battery
+    keyboard.setLinkProfile(CANETA_LINK_TYPING);
 
-    keyboard.setEscapeSequenceCallback([](const char* sequence) {
-        // Send VT100 escape sequences to UART
-        Serial1.write('\x1B'); // ESC
-        Serial1.print(sequence);
-        Serial.printf("Escape: ESC%s\n", sequence);
+    // Set up callbacks
+    keyboard.setOutputCallback([](const uint8_t* data, size_t len) {
+        // Characters and VT100 escape sequences for every key since the last
+        // call, in one UART write. This runs on the report task: logging each
+        // key to Serial here would hold up the keys behind it.
+        Serial1.write(data, len);
     });
 
     keyboard.setConnectionCallback([](bool connected, const char* device_name) {
@@ -46,39 +43,55 @@ void setup() {
             Serial.printf("✓ Connected to keyboard: %s\n", device_name);
         } else {
             Serial.printf("✗ Disconnected from keyboard: %s\n", device_name);
-            Serial.println("Will automatically scan for new keyboards...");
+            Serial.println("Reconnecting...");
         }
     });
 
-    // Start scanning for BLE keyboards
-    Serial.println("Starting scan for BLE HID keyboards...");
-    Serial.println("Put your Bluetooth keyboard in pairing mode.");
-    keyboard.startScan(30); // Scan for 30 seconds initially
+    // keyboard.update() reconnects to the last keyboards used, then scans
+    // for new ones
+    Serial.println("Put a new Bluetooth keyboard in pairing mode.");
 }
 
 void loop() {
     static unsigned long last_status = 0;
 
-    // Update Bluetooth keyboard handler (important!)
+    // Update Bluetooth keyboard handler (important: this is what connects)
     keyboard.update();
 
     // Print status every 10 seconds
     if (millis() - last_status > 10000) {
         last_status = millis();
 
-        if (keyboard.isConnected()) {
-            Serial.printf("Status: Connected to %s\n", keyboard.getConnectedDeviceName());
+        if (!keyboard.isConnected()) {
+            Serial.println("Status: No keyboard connected - waiting for pairing");
+        }
+        for (size_t i = 0; i < CANETA_BLE_MAX_KEYBOARDS; i++) {
+            if (!keyboard.isConnected(i)) {
+                continue;
+            }
+            Serial.printf("Status: Keyboard %u connected: %s\n", static_cast<unsigned>(i),
+                         keyboard.getConnectedDeviceName(i).c_str());
+
+            // Reports arrive on the connection interval's grid; this shows
+            // whether the typing profile's 7.5 ms interval took effect
+            caneta_jitter_t jitter = keyboard.getReportJitter(i);
+            uint32_t estimate = caneta_jitter_estimate_us(&jitter);
+            if (estimate != 0) {
+                Serial.printf("Reports every %lu us (%s), jitter %lu us mean, %lu us max\n",
+                             static_cast<unsigned long>(estimate),
+                             caneta_jitter_in_effect(&jitter) ? "as negotiated" : "not as negotiated",
+                             static_cast<unsigned long>(caneta_jitter_mean_us(&jitter)),
+                             static_cast<unsigned long>(caneta_jitter_max_us(&jitter)));
+            }
 
             // Print current modifier state
-            const auto& state = keyboard.getKeyboardState();
-            if (state.shift_pressed || state.ctrl_pressed || state.alt_pressed) {
+            const auto& state = keyboard.getKeyboardState(i);
+            if (kbd_state_shift(&state) || kbd_state_ctrl(&state) || kbd_state_alt(&state)) {
                 Serial.printf("Modifiers: %s%s%s\n",
-                             state.shift_pressed ? "SHIFT " : "",
-                             state.ctrl_pressed ? "CTRL " : "",
-                             state.alt_pressed ? "ALT " : "");
+                             kbd_state_shift(&state) ? "SHIFT " : "",
+                             kbd_state_ctrl(&state) ? "CTRL " : "",
+                             kbd_state_alt(&state) ? "ALT " : "");
             }
-        } else {
-            Serial.println("Status: No keyboard connected - waiting for pairing");
         }
     }
 
@@ -1,35 +1,68 @@
 #include "CanetaBluetooth.h"
 #include <cstring>
 #include <Arduino.h>
-
-// Static instance pointer for callback routing
-CanetaBluetooth* CanetaBluetooth::instance_ = nullptr;
+#include <Preferences.h>
+#include <esp_gattc_api.h>
+#include <esp_gap_ble_api.h>
+#include <esp_timer.h>
+
+// Called with every raw HID report before it is decoded. Host simulation
+// builds define this to record captures; on hardware it compiles away.
+#ifndef CANETA_REPORT_HOOK
+#define CANETA_REPORT_HOOK(report, len) ((void)0)
+#endif
+
+// Where the bond cache is kept in NVS. Each bonded keyboard's GATT layout
+// is stored under "g" and its address in hex.
+#define BONDS_NAMESPACE "caneta"
+#define BONDS_KEY "bonds"
+
+#define CCCD_UUID ((uint16_t)0x2902)
+#define REPORT_TYPE_INPUT 1
+
+// The Bluedroid host runs on one core; decoding and output get the other.
+// Above the Arduino loop's priority, so keys never wait behind reconnects.
+#if portNUM_PROCESSORS > 1 && defined(CONFIG_BT_BLUEDROID_PINNED_TO_CORE)
+#define REPORT_TASK_CORE (1 - CONFIG_BT_BLUEDROID_PINNED_TO_CORE)
+#else
+#define REPORT_TASK_CORE tskNO_AFFINITY
+#endif
+#define REPORT_TASK_PRIORITY 2
+#define REPORT_TASK_STACK 4096
+
+CanetaBluetooth::Link* CanetaBluetooth::registry_[CANETA_BLE_REGISTRY_SIZE] = {};
 
 CanetaBluetooth::CanetaBluetooth()
-    : client_(nullptr)
-    , scan_(nullptr)
-    , hid_service_(nullptr)
-    , hid_report_char_(nullptr)
+    : scan_(nullptr)
     , initialized_(false)
-    , connected_(false)
     , scanning_(false)
-    , key_event_callback_(nullptr)
-    , escape_sequence_callback_(nullptr)
+    , scan_end_ms_(0)
+    , reports_(OutputSink{this})
+    , report_task_(nullptr)
+    , dropped_(0)
+    , link_profile_(CANETA_LINK_TYPING)
+    , bonded_only_(false)
+    , candidate_ready_(false)
+    , output_callback_(nullptr)
     , connection_callback_(nullptr)
 {
     memset(device_name_, 0, sizeof(device_name_));
-    memset(connected_device_name_, 0, sizeof(connected_device_name_));
-    memset(&kbd_state, 0, sizeof(kbd_state));
-
-    // Set static instance pointer for callback routing
-    instance_ = this;
+    memset(candidate_name_, 0, sizeof(candidate_name_));
+    memset(&candidate_, 0, sizeof(candidate_));
+
+    for (uint8_t i = 0; i < CANETA_BLE_MAX_KEYBOARDS; i++) {
+        links_[i].owner = this;
+        links_[i].index = i;
+        caneta_gatt_layout_init(&links_[i].layout);
+        reset_jitter(links_[i], 0);
+    }
+    caneta_bonds_init(&bonds_);
+    caneta_scan_filter_init(&scan_filter_, &bonds_, false);
+    caneta_reconnect_init(&reconnect_, nullptr);
 }
 
 CanetaBluetooth::~CanetaBluetooth() {
     end();
-    if (instance_ == this) {
-        instance_ = nullptr;
-    }
 }
 
 bool CanetaBluetooth::begin(const char* device_name) {
@@ -43,22 +76,52 @@ bool CanetaBluetooth::begin(const char* device_name) {
     strncpy(device_name_, device_name, sizeof(device_name_) - 1);
     device_name_[sizeof(device_name_) - 1] = '\0';
 
+    // Every link is routed through the registry
+    if (!register_links()) {
+        Serial.println("Too many BLE hosts for the link registry");
+        return false;
+    }
+
+    // Decoding and output happen here, off the BLE stack's task
+    if (report_task_ == nullptr &&
+        xTaskCreatePinnedToCore(report_task, "caneta-reports", REPORT_TASK_STACK, this, REPORT_TASK_PRIORITY,
+                                &report_task_, REPORT_TASK_CORE) != pdPASS) {
+        report_task_ = nullptr;
+        unregister_links();
+        Serial.println("Failed to start the report task");
+        return false;
+    }
+
     // Initialize BLE
     BLEDevice::init(device_name);
 
-    // Create BLE client
-    client_ = BLEDevice::createClient();
-    client_->setClientCallbacks(this);
+    // One BLE client per keyboard slot, each registering its own GATT
+    // interface, with its link for callbacks
+    for (Link& link : links_) {
+        link.client = BLEDevice::createClient();
+        link.client->setClientCallbacks(&link);
+    }
+
+    // Notifications and CCCD writes are handled by handle, without the
+    // characteristic objects discovery would create
+    BLEDevice::setCustomGattcHandler(gattc_event_handler);
+    BLEDevice::setCustomGapHandler(gap_event_handler);
 
     // Create BLE scanner
     scan_ = BLEDevice::getScan();
-    scan_->setAdvertisedDeviceCallbacks(this);
+    // One callback per advertiser per scan, as far as the controller's own
+    // duplicate filter reaches; caneta_scan_filter_check catches the rest
+    scan_->setAdvertisedDeviceCallbacks(this, false);
     scan_->setActiveScan(true);
     scan_->setInterval(100);
     scan_->setWindow(99);
 
+    load_bonds();
+    caneta_reconnect_lost(&reconnect_);
+
     initialized_ = true;
-    Serial.println("BLE HID Host initialized successfully");
+    Serial.printf("BLE HID Host initialized successfully, %u bonded keyboards, %u slots\n",
+                  static_cast<unsigned>(bonds_.count), static_cast<unsigned>(CANETA_BLE_MAX_KEYBOARDS));
     return true;
 }
 
@@ -68,36 +131,31 @@ void CanetaBluetooth::end() {
     }
 
     stopScan();
+    unregister_links();
 
-    if (connected_ && client_) {
-        client_->disconnect();
-    }
-
-    if (client_) {
-        delete client_;
-        client_ = nullptr;
+    for (Link& link : links_) {
+        if (link.client) {
+            if (link.client->isConnected()) {
+                link.client->disconnect();
+            }
+            delete link.client;
+            link.client = nullptr;
+        }
+        link.ready = false;
+        link.streaming = false;
+        set_name(link, "");
     }
 
     BLEDevice::deinit(false);
 
     initialized_ = false;
-    connected_ = false;
     scanning_ = false;
-    hid_service_ = nullptr;
-    hid_report_char_ = nullptr;
-
-    memset(connected_device_name_, 0, sizeof(connected_device_name_));
-    memset(&kbd_state, 0, sizeof(kbd_state));
 
     Serial.println("BLE HID Host deinitialized");
 }
 
-void CanetaBluetooth::setKeyEventCallback(KeyEventCallback callback) {
-    key_event_callback_ = callback;
-}
-
-void CanetaBluetooth::setEscapeSequenceCallback(EscapeSequenceCallback callback) {
-    escape_sequence_callback_ = callback;
+void CanetaBluetooth::setOutputCallback(OutputCallback callback) {
+    output_callback_ = callback;
 }
 
 void CanetaBluetooth::setConnectionCallback(ConnectionCallback callback) {
@@ -110,10 +168,16 @@ bool CanetaBluetooth::startScan(uint32_t duration_seconds) {
     }
 
     Serial.printf("Scanning for BLE HID keyboards for %d seconds...\n", duration_seconds);
-    Serial.println("Put your keyboard in pairing mode.");
 
+    // Runs in the background and stops by itself; update() stops it sooner
+    // when a keyboard turns up
+    caneta_scan_filter_reset(&scan_filter_);
+    candidate_ready_ = false;
+    if (!scan_->start(duration_seconds, nullptr, false)) {
+        return false;
+    }
     scanning_ = true;
-    scan_->start(duration_seconds, false);
+    scan_end_ms_ = millis() + duration_seconds * 1000;
     return true;
 }
 
@@ -125,190 +189,669 @@ void CanetaBluetooth::stopScan() {
     }
 }
 
-void CanetaBluetooth::update() {
-    // BLE handles most updates automatically through callbacks
-    // This method can be used for periodic maintenance if needed
+void CanetaBluetooth::setBondedOnly(bool bonded_only) {
+    // The BLE task may be checking an advertisement against the filter
+    // right now; onResult picks this up with the next one
+    bonded_only_ = bonded_only;
 }
 
-// BLE Client Callbacks
-void CanetaBluetooth::onConnect(BLEClient* client) {
-    Serial.println("BLE Client connected");
-    connected_ = true;
+void CanetaBluetooth::forgetBonds() {
+    // The bond cache and every cached layout. The scan filter reads the
+    // bond cache, so no scan may be running.
+    stopScan();
+    Preferences prefs;
+    if (prefs.begin(BONDS_NAMESPACE, false)) {
+        prefs.clear();
+        prefs.end();
+    }
+    caneta_bonds_init(&bonds_);
+}
 
-    // Get HID service
-    hid_service_ = client->getService(HID_SERVICE_UUID);
-    if (hid_service_ == nullptr) {
-        Serial.println("Failed to find HID service");
-        client->disconnect();
+void CanetaBluetooth::setLinkProfile(caneta_link_profile_t profile) {
+    link_profile_ = profile;
+    caneta_link_params_t params;
+    if (caneta_link_params_for(profile, &params)) {
+        for (Link& link : links_) {
+            if (link.ready) {
+                request_params(link, params);
+            }
+        }
+    }
+}
+
+bool CanetaBluetooth::requestConnectionParams(size_t keyboard, const caneta_link_params_t& params) {
+    return keyboard < CANETA_BLE_MAX_KEYBOARDS && links_[keyboard].ready && request_params(links_[keyboard], params);
+}
+
+bool CanetaBluetooth::request_params(Link& link, const caneta_link_params_t& params) {
+    if (!link.client || !link.client->isConnected() || !caneta_link_params_valid(&params)) {
+        return false;
+    }
+
+    esp_ble_conn_update_params_t update;
+    memcpy(update.bda, link.peer.addr, CANETA_BLE_ADDR_LEN);
+    update.min_int = params.min_interval;
+    update.max_int = params.max_interval;
+    update.latency = params.latency;
+    update.timeout = params.timeout;
+    return esp_ble_gap_update_conn_params(&update) == ESP_OK;
+}
+
+caneta_jitter_t CanetaBluetooth::getReportJitter(size_t keyboard) const {
+    if (keyboard >= CANETA_BLE_MAX_KEYBOARDS) {
+        caneta_jitter_t none;
+        caneta_jitter_init(&none, 0);
+        return none;
+    }
+    return links_[keyboard].published_jitter.read();
+}
+
+String CanetaBluetooth::getConnectedDeviceName(size_t keyboard) const {
+    if (keyboard >= CANETA_BLE_MAX_KEYBOARDS) {
+        return String();
+    }
+    return String(links_[keyboard].published_name.read().text);
+}
+
+void CanetaBluetooth::set_name(Link& link, const char* name) {
+    Link::Name published = {};
+    strncpy(published.text, name, sizeof(published.text) - 1);
+    memcpy(link.name, published.text, sizeof(link.name));
+    link.published_name.publish(published);
+}
+
+void CanetaBluetooth::reset_jitter(Link& link, uint32_t interval_us) {
+    caneta_jitter_init(&link.jitter, interval_us);
+    link.published_jitter.publish(link.jitter);
+}
+
+void CanetaBluetooth::record_jitter(Link& link, uint32_t now_us) {
+    caneta_jitter_record(&link.jitter, now_us);
+    link.published_jitter.publish(link.jitter);
+}
+
+size_t CanetaBluetooth::keyboardCount() const {
+    size_t count = 0;
+    for (const Link& link : links_) {
+        if (link.ready) {
+            count++;
+        }
+    }
+    return count;
+}
+
+CanetaBluetooth::Link* CanetaBluetooth::free_link() {
+    for (Link& link : links_) {
+        if (!link.ready && link.client && !link.client->isConnected()) {
+            return &link;
+        }
+    }
+    return nullptr;
+}
+
+CanetaBluetooth::Link* CanetaBluetooth::find_link(const uint8_t* addr) {
+    for (Link& link : links_) {
+        if ((link.ready || (link.client && link.client->isConnected())) &&
+            memcmp(link.peer.addr, addr, CANETA_BLE_ADDR_LEN) == 0) {
+            return &link;
+        }
+    }
+    return nullptr;
+}
+
+void CanetaBluetooth::update() {
+    if (!initialized_) {
         return;
     }
 
-    // Get HID report characteristic
-    hid_report_char_ = hid_service_->getCharacteristic(HID_REPORT_CHAR_UUID);
-    if (hid_report_char_ == nullptr) {
-        Serial.println("Failed to find HID report characteristic");
-        client->disconnect();
+    for (Link& link : links_) {
+        // The cached handles were refused: rediscover on the next connection
+        if (link.stale.exchange(false)) {
+            Serial.println("Cached GATT layout is stale, rediscovering");
+            forget_layout(link.peer);
+            if (link.client->isConnected()) {
+                link.client->disconnect();
+            }
+        }
+
+        // A keyboard that dropped its link is usually advertising again
+        // within a few hundred milliseconds, so the plan starts over with
+        // the bonded keyboards
+        if (link.lost.exchange(false)) {
+            Serial.printf("%s disconnected\n", link.name);
+            caneta_reconnect_lost(&reconnect_);
+            if (connection_callback_) {
+                connection_callback_(false, link.name);
+            }
+            set_name(link, "");
+        }
+
+        uint32_t interval = link.interval;
+        if (interval != link.logged_interval) {
+            link.logged_interval = interval;
+            if (interval != 0) {
+                Serial.printf("%s: connection interval %lu.%02lu ms, slave latency %lu\n", link.name,
+                              static_cast<unsigned long>(interval * 125 / 100),
+                              static_cast<unsigned long>(interval * 125 % 100),
+                              static_cast<unsigned long>(link.latency.load()));
+            }
+        }
+    }
+
+    uint32_t dropped = reports_.dropped();
+    if (dropped != dropped_) {
+        Serial.printf("Report queue full: %lu reports dropped\n", static_cast<unsigned long>(dropped - dropped_));
+        dropped_ = dropped;
+    }
+
+    // The background scan stops by itself when its time is up
+    if (scanning_ && (int32_t)(millis() - scan_end_ms_) >= 0) {
+        scanning_ = false;
+    }
+
+    // Nothing to do while every slot has a keyboard
+    Link* link = free_link();
+    if (link == nullptr) {
         return;
     }
 
-    // Register for notifications
-    if (hid_report_char_->canNotify()) {
-        hid_report_char_->registerForNotify(hid_report_callback);
-        Serial.println("Registered for HID notifications");
+    // The scan found a keyboard. onResult leaves the candidate alone while
+    // the flag is set, so it is copied out and the scan stopped before the
+    // flag is cleared; clearing it first would let a new advertisement
+    // rewrite the address and name halfway through.
+    bool found = false;
+    caneta_peer_t peer;
+    char name[sizeof(candidate_name_)];
+    if (candidate_ready_) {
+        peer = candidate_;
+        memcpy(name, candidate_name_, sizeof(name));
+        found = find_link(peer.addr) == nullptr;
+        if (found) {
+            stopScan();
+        }
+        candidate_ready_ = false;
     }
 
-    if (connection_callback_) {
-        connection_callback_(true, connected_device_name_);
+    // ...and it isn't connected already
+    if (found) {
+        set_name(*link, name);
+        if (connect_to_peer(*link, peer, CANETA_RECONNECT_DEFAULT_DIRECT_MS)) {
+            Serial.printf("Successfully connected to: %s\n", link->name);
+            return;
+        }
+        Serial.println("Failed to connect to keyboard");
+        // The plan carries on as if the scan had ended
+    } else if (scanning_) {
+        return;
+    }
+
+    // Bonded keyboards that are connected already are skipped
+    caneta_reconnect_action_t action;
+    int skipped = 0;
+    do {
+        if (!caneta_reconnect_next(&reconnect_, &bonds_, millis(), &action)) {
+            return;
+        }
+    } while (action.op == CANETA_RECONNECT_CONNECT && find_link(action.peer.addr) && ++skipped <= CANETA_BONDS_MAX);
+
+    switch (action.op) {
+        case CANETA_RECONNECT_WAIT:
+            break;
+        case CANETA_RECONNECT_CONNECT: {
+            if (find_link(action.peer.addr)) {
+                break;
+            }
+            esp_bd_addr_t native;
+            memcpy(native, action.peer.addr, CANETA_BLE_ADDR_LEN);
+            set_name(*link, BLEAddress(native).toString().c_str());
+            connect_to_peer(*link, action.peer, action.timeout_ms);
+            break;
+        }
+        case CANETA_RECONNECT_SCAN:
+            startScan((action.timeout_ms + 999) / 1000);
+            break;
     }
 }
 
-void CanetaBluetooth::onDisconnect(BLEClient* client) {
-    Serial.println("BLE Client disconnected");
+// Key of a keyboard's cached layout: "g" and the address in hex, within
+// NVS's 15-character limit
+static void layout_key(const caneta_peer_t& peer, char key[14]) {
+    key[0] = 'g';
+    for (int i = 0; i < CANETA_BLE_ADDR_LEN; i++) {
+        snprintf(key + 1 + 2 * i, 3, "%02x", peer.addr[i]);
+    }
+}
 
-    if (connection_callback_) {
-        connection_callback_(false, connected_device_name_);
+bool CanetaBluetooth::load_layout(Link& link) {
+    char key[14];
+    layout_key(link.peer, key);
+    static uint8_t blob[CANETA_GATT_BLOB_MAX];  // Only update() loads layouts
+    size_t len = 0;
+    Preferences prefs;
+    if (prefs.begin(BONDS_NAMESPACE, true)) {
+        size_t stored = prefs.getBytesLength(key);
+        if (stored > 0 && stored <= sizeof(blob)) {
+            len = prefs.getBytes(key, blob, sizeof(blob));
+        }
+        prefs.end();
     }
+    return len > 0 && caneta_gatt_layout_load(&link.layout, blob, len);
+}
 
-    connected_ = false;
-    hid_service_ = nullptr;
-    hid_report_char_ = nullptr;
-    memset(connected_device_name_, 0, sizeof(connected_device_name_));
-    memset(&kbd_state, 0, sizeof(kbd_state));
+void CanetaBluetooth::save_layout(const Link& link) {
+    char key[14];
+    layout_key(link.peer, key);
+    static uint8_t blob[CANETA_GATT_BLOB_MAX];
+    size_t len = caneta_gatt_layout_save(&link.layout, blob, sizeof(blob));
+    Preferences prefs;
+    if (len > 0 && prefs.begin(BONDS_NAMESPACE, false)) {
+        prefs.putBytes(key, blob, len);
+        prefs.end();
+    }
+}
 
-    // Restart scanning after disconnect
-    if (initialized_) {
-        delay(1000); // Brief delay before restarting scan
-        startScan(30);
+void CanetaBluetooth::forget_layout(const caneta_peer_t& peer) {
+    char key[14];
+    layout_key(peer, key);
+    Preferences prefs;
+    if (prefs.begin(BONDS_NAMESPACE, false)) {
+        prefs.remove(key);
+        prefs.end();
     }
 }
 
-// BLE Scan Callbacks
-void CanetaBluetooth::onResult(BLEAdvertisedDevice advertisedDevice) {
-    Serial.printf("Found device: %s\n", advertisedDevice.toString().c_str());
+void CanetaBluetooth::load_bonds() {
+    uint8_t blob[CANETA_BONDS_BLOB_SIZE];
+    size_t len = 0;
+    Preferences prefs;
+    if (prefs.begin(BONDS_NAMESPACE, true)) {
+        len = prefs.getBytes(BONDS_KEY, blob, sizeof(blob));
+        prefs.end();
+    }
+    caneta_bonds_load(&bonds_, blob, len);
+}
 
-    // Check if device advertises HID service
-    if (advertisedDevice.haveServiceUUID() &&
-        advertisedDevice.isAdvertisingService(BLEUUID(HID_SERVICE_UUID))) {
+void CanetaBluetooth::save_bonds() {
+    uint8_t blob[CANETA_BONDS_BLOB_SIZE];
+    size_t len = caneta_bonds_save(&bonds_, blob, sizeof(blob));
+    Preferences prefs;
+    if (prefs.begin(BONDS_NAMESPACE, false)) {
+        prefs.putBytes(BONDS_KEY, blob, len);
+        prefs.end();
+    }
+}
 
-        Serial.println("Found HID keyboard! Attempting connection...");
+// BLE Client Callbacks, one link each
+void CanetaBluetooth::Link::onConnect(BLEClient* client) {
+    // Runs on the BLE task, so nothing is logged here: connect_to_peer logs
+    // and sets the keyboard up once the connection is open
+    (void)client;
+}
 
-        // Stop scanning
-        scan_->stop();
-        scanning_ = false;
+void CanetaBluetooth::Link::onDisconnect(BLEClient* client) {
+    // Runs on the BLE task
+    (void)client;
+    // A link that never became a working keyboard was a failed attempt,
+    // which the reconnect plan has already accounted for
+    bool was_ready = ready.exchange(false);
+    streaming = false;
+    interval = 0;
+
+    // Release every key the keyboard held, in order behind its last reports
+    if (mounted) {
+        mounted = false;
+        owner->reports_.postReset(index);
+        xTaskNotifyGive(owner->report_task_);
+    }
+
+    // update() announces it and reconnects
+    if (was_ready) {
+        lost = true;
+    }
+}
+
+bool CanetaBluetooth::register_links() {
+    size_t free_entries = 0;
+    for (Link* entry : registry_) {
+        if (entry == nullptr) {
+            free_entries++;
+        }
+    }
+    if (free_entries < CANETA_BLE_MAX_KEYBOARDS) {
+        return false;
+    }
 
-        // Store device name
-        String name = advertisedDevice.getName();
-        if (name.length() == 0) {
-            name = "Unknown Keyboard";
+    size_t next = 0;
+    for (Link*& entry : registry_) {
+        if (entry == nullptr && next < CANETA_BLE_MAX_KEYBOARDS) {
+            entry = &links_[next++];
         }
-        strncpy(connected_device_name_, name.c_str(), sizeof(connected_device_name_) - 1);
-        connected_device_name_[sizeof(connected_device_name_) - 1] = '\0';
-
-        // Connect to the keyboard
-        if (connect_to_keyboard(advertisedDevice)) {
-            Serial.printf("Successfully connected to: %s\n", connected_device_name_);
-        } else {
-            Serial.println("Failed to connect to keyboard");
-            // Restart scanning
-            startScan(30);
+    }
+    return true;
+}
+
+void CanetaBluetooth::unregister_links() {
+    for (Link*& entry : registry_) {
+        if (entry && entry->owner == this) {
+            entry = nullptr;
         }
     }
 }
 
-bool CanetaBluetooth::connect_to_keyboard(BLEAdvertisedDevice device) {
-    if (!client_ || !initialized_) {
+CanetaBluetooth::Link* CanetaBluetooth::link_for_interface(esp_gatt_if_t gattc_if) {
+    for (Link* link : registry_) {
+        if (link && link->client && link->client->getGattcIf() == gattc_if) {
+            return link;
+        }
+    }
+    return nullptr;
+}
+
+CanetaBluetooth::Link* CanetaBluetooth::link_for_address(const uint8_t* addr) {
+    for (Link* link : registry_) {
+        if (link && link->client && link->client->isConnected() &&
+            memcmp(link->peer.addr, addr, CANETA_BLE_ADDR_LEN) == 0) {
+            return link;
+        }
+    }
+    return nullptr;
+}
+
+// BLE Scan Callbacks
+void CanetaBluetooth::onResult(BLEAdvertisedDevice advertisedDevice) {
+    // Runs for every advertisement heard, on the BLE task: nothing here may
+    // block or log
+    if (candidate_ready_) {
+        return;
+    }
+
+    BLEAddress address = advertisedDevice.getAddress();
+    bool has_hid = advertisedDevice.haveServiceUUID() &&
+                   advertisedDevice.isAdvertisingService(BLEUUID(HID_SERVICE_UUID));
+    scan_filter_.bonded_only = bonded_only_;
+    if (caneta_scan_filter_check(&scan_filter_, *address.getNative(), has_hid) != CANETA_SCAN_CONNECT) {
+        return;
+    }
+
+    memcpy(candidate_.addr, *address.getNative(), CANETA_BLE_ADDR_LEN);
+    candidate_.addr_type = static_cast<uint8_t>(advertisedDevice.getAddressType());
+
+    String name = advertisedDevice.getName();
+    if (name.length() == 0) {
+        name = "Unknown Keyboard";
+    }
+    strncpy(candidate_name_, name.c_str(), sizeof(candidate_name_) - 1);
+    candidate_name_[sizeof(candidate_name_) - 1] = '\0';
+
+    // update() stops the scan and connects
+    candidate_ready_ = true;
+}
+
+bool CanetaBluetooth::connect_to_peer(Link& link, const caneta_peer_t& peer, uint32_t timeout_ms) {
+    if (!link.client || !initialized_) {
         return false;
     }
 
+    link.peer = peer;
+    esp_bd_addr_t native;
+    memcpy(native, peer.addr, CANETA_BLE_ADDR_LEN);
+    BLEAddress address(native);
+    esp_ble_addr_type_t type = static_cast<esp_ble_addr_type_t>(peer.addr_type);
+
     try {
-        // Connect to the device
-        if (client_->connect(&device)) {
-            Serial.println("BLE connection established");
-            return true;
-        } else {
+#if ESP_ARDUINO_VERSION_MAJOR >= 3
+        bool ok = link.client->connect(address, type, timeout_ms);
+#else
+        // No per-call timeout before core 3; the stack's own applies
+        (void)timeout_ms;
+        bool ok = link.client->connect(address, type);
+#endif
+        if (!ok) {
             Serial.println("BLE connection failed");
             return false;
         }
+        Serial.println("BLE connection established");
     } catch (std::exception& e) {
         Serial.printf("Exception during connection: %s\n", e.what());
         return false;
     }
+
+    if (!start_keyboard(link)) {
+        link.streaming = false;
+        link.client->disconnect();
+        return false;
+    }
+    return true;
 }
 
-// Static callback for HID reports
-void CanetaBluetooth::hid_report_callback(BLERemoteCharacteristic* characteristic,
-                                         uint8_t* data, size_t length, bool isNotify) {
-    if (instance_) {
-        instance_->process_keyboard_report(data, length);
+bool CanetaBluetooth::start_keyboard(Link& link) {
+    // A bonded keyboard's layout comes from flash, so a reconnect goes
+    // straight to subscribing; anything else is discovered
+    bool cached = load_layout(link);
+    bool cacheable = false;
+    if (cached) {
+        Serial.printf("Cached GATT layout: %u input reports\n", link.layout.count);
+    } else if (!discover_layout(link, &cacheable)) {
+        return false;
+    }
+
+    // The BLE task queues the report map ahead of the first report
+    link.streaming = true;
+    if (!subscribe_reports(link)) {
+        Serial.println("Failed to subscribe to HID reports");
+        if (cached) {
+            forget_layout(link.peer);
+        }
+        return false;
+    }
+
+    // A working keyboard: first in line for direct reconnects. The least
+    // recent keyboard's layout goes when it drops out of the cache.
+    if (bonds_.count == CANETA_BONDS_MAX && !caneta_bonds_find(&bonds_, link.peer.addr)) {
+        forget_layout(bonds_.peers[CANETA_BONDS_MAX - 1]);
+    }
+    if (caneta_bonds_touch(&bonds_, &link.peer)) {
+        save_bonds();
+    }
+    if (cacheable) {
+        save_layout(link);
+    }
+
+    // The plan keeps looking for more keyboards until every slot is taken
+    link.ready = true;
+    if (free_link() == nullptr) {
+        caneta_reconnect_connected(&reconnect_);
+    }
+    if (connection_callback_) {
+        connection_callback_(true, link.name);
     }
+
+    // Keystroke latency is set by the connection interval the keyboard
+    // offered; ask for the profile's
+    caneta_link_params_t params;
+    if (caneta_link_params_for(link_profile_, &params) && !request_params(link, params)) {
+        Serial.println("Connection parameter request failed");
+    }
+    return true;
 }
 
-void CanetaBluetooth::process_keyboard_report(const uint8_t* report, size_t len) {
-    if (len < 8) return; // Standard keyboard report is 8 bytes
+bool CanetaBluetooth::discover_layout(Link& link, bool* cacheable) {
+    caneta_gatt_layout_init(&link.layout);
+    *cacheable = true;
 
-    // Byte 0: Modifier keys
-    uint8_t modifiers = report[0];
-    bool shift = (modifiers & 0x22) != 0;  // Left or right shift
-    bool ctrl = (modifiers & 0x11) != 0;   // Left or right ctrl
-    bool alt = (modifiers & 0x44) != 0;    // Left or right alt
+    BLERemoteService* service = link.client->getService(HID_SERVICE_UUID);
+    if (service == nullptr) {
+        Serial.println("Failed to find HID service");
+        return false;
+    }
 
-    kbd_state.shift_pressed = shift;
-    kbd_state.ctrl_pressed = ctrl;
-    kbd_state.alt_pressed = alt;
+    // The report map is the keyboard's HID report descriptor (at most 512
+    // bytes). Without one, reports are decoded as boot keyboard reports.
+    size_t desc_len = 0;
+    BLERemoteCharacteristic* report_map = service->getCharacteristic(HID_REPORT_MAP_UUID);
+    if (report_map && report_map->canRead()) {
+        auto desc = report_map->readValue();
+        desc_len = desc.length();
+        *cacheable = caneta_gatt_layout_set_map(&link.layout, reinterpret_cast<const uint8_t*>(desc.c_str()),
+                                                desc_len);
+    }
 
-    // Bytes 2-7: Up to 6 pressed keys
-    for (int i = 2; i < 8 && i < len; i++) {
-        uint8_t keycode = report[i];
-        if (keycode == 0) continue; // No key
+    // Every Input Report characteristic. They share one UUID, so only the
+    // by-handle map holds them all; getCharacteristics() fills it.
+    service->getCharacteristics();
+    for (auto& entry : *service->getCharacteristicsByHandle()) {
+        BLERemoteCharacteristic* characteristic = entry.second;
+        if (!characteristic->getUUID().equals(BLEUUID(HID_REPORT_CHAR_UUID)) || !characteristic->canNotify()) {
+            continue;
+        }
 
-        // Check if this is a new key press
-        bool was_pressed = false;
-        for (int j = 0; j < 6; j++) {
-            if (kbd_state.last_keys[j] == keycode) {
-                was_pressed = true;
-                break;
+        // Report Reference: report ID, report type. Output and feature
+        // reports share the UUID.
+        uint8_t report_id = 0;
+        BLERemoteDescriptor* reference = characteristic->getDescriptor(BLEUUID(HID_REPORT_REF_UUID));
+        if (reference) {
+            auto value = reference->readValue();
+            if (value.length() >= 2) {
+                if (static_cast<uint8_t>(value[1]) != REPORT_TYPE_INPUT) {
+                    continue;
+                }
+                report_id = static_cast<uint8_t>(value[0]);
             }
         }
 
-        if (!was_pressed) {
-            // New key press - process it
-            process_keycode(keycode, shift, ctrl, alt);
+        BLERemoteDescriptor* cccd = characteristic->getDescriptor(BLEUUID(CCCD_UUID));
+        if (cccd == nullptr) {
+            continue;
+        }
+        if (!caneta_gatt_layout_add(&link.layout, characteristic->getHandle(), cccd->getHandle(), report_id)) {
+            // More reports than the table holds: route these, but don't
+            // cache a partial layout
+            *cacheable = false;
+            break;
         }
     }
 
-    // Save current keys for next comparison
-    memset(kbd_state.last_keys, 0, 6);
-    for (int i = 2; i < 8 && i < len; i++) {
-        if (report[i] != 0) {
-            kbd_state.last_keys[i-2] = report[i];
-        }
+    if (link.layout.count == 0) {
+        Serial.println("Failed to find HID input reports");
+        return false;
     }
+
+    Serial.printf("Report map: %u bytes, %u input reports\n", static_cast<unsigned>(desc_len), link.layout.count);
+    return true;
 }
 
-void CanetaBluetooth::process_keycode(uint8_t keycode, bool shift, bool ctrl, bool alt) {
-    // Handle special keys first using caneta library
-    const char* special_seq = process_special_keys(keycode);
-    if (strlen(special_seq) > 0) {
-        if (escape_sequence_callback_) {
-            escape_sequence_callback_(special_seq);
+bool CanetaBluetooth::subscribe_reports(Link& link) {
+    esp_gatt_if_t gattc_if = link.client->getGattcIf();
+    uint16_t conn_id = link.client->getConnId();
+    esp_bd_addr_t bda;
+    memcpy(bda, link.peer.addr, CANETA_BLE_ADDR_LEN);
+
+    // Notifications on; a refused write means the cached handles are stale
+    uint8_t notify_on[2] = {0x01, 0x00};
+    for (uint8_t i = 0; i < link.layout.count; i++) {
+        const caneta_gatt_report_t* report = &link.layout.reports[i];
+        if (esp_ble_gattc_register_for_notify(gattc_if, bda, report->value_handle) != ESP_OK ||
+            esp_ble_gattc_write_char_descr(gattc_if, conn_id, report->cccd_handle, sizeof(notify_on), notify_on,
+                                           ESP_GATT_WRITE_TYPE_RSP, ESP_GATT_AUTH_REQ_NONE) != ESP_OK) {
+            return false;
         }
+    }
+    return true;
+}
+
+// Every GATT client event, on the BLE task
+void CanetaBluetooth::gattc_event_handler(esp_gattc_cb_event_t event, esp_gatt_if_t gattc_if,
+                                          esp_ble_gattc_cb_param_t* param) {
+    Link* link = link_for_interface(gattc_if);
+    if (link == nullptr) {
         return;
     }
 
-    // Handle regular keys using caneta library
-    char ascii_char = hid_to_ascii(keycode, shift);
+    switch (event) {
+        case ESP_GATTC_CONNECT_EVT: {
+            // Every client hears of every connection; this one is the link's
+            // own if it is to the address the link is connecting to
+            if (memcmp(param->connect.remote_bda, link->peer.addr, CANETA_BLE_ADDR_LEN) != 0) {
+                break;
+            }
 
-    if (ascii_char != 0) {
-        // Handle Ctrl combinations
-        if (ctrl && ascii_char >= 'a' && ascii_char <= 'z') {
-            ascii_char = ascii_char - 'a' + 1; // Ctrl+A = 0x01, etc.
-        } else if (ctrl && ascii_char >= 'A' && ascii_char <= 'Z') {
-            ascii_char = ascii_char - 'A' + 1;
+            // The keyboard's own parameters, until an update replaces them
+            uint32_t interval = 0;
+#if ESP_IDF_VERSION >= ESP_IDF_VERSION_VAL(5, 0, 0)
+            interval = param->connect.conn_params.interval;
+            link->latency = param->connect.conn_params.latency;
+#endif
+            link->interval = interval;
+            reset_jitter(*link, interval * CANETA_LINK_INTERVAL_US);
+            break;
         }
+        case ESP_GATTC_NOTIFY_EVT:
+            if (param->notify.conn_id == link->client->getConnId()) {
+                link->owner->process_keyboard_report(*link, param->notify.handle, param->notify.value,
+                                                     param->notify.value_len);
+            }
+            break;
+        case ESP_GATTC_WRITE_DESCR_EVT:
+            if (param->write.status != ESP_GATT_OK) {
+                link->stale = true;
+            }
+            break;
+        default:
+            break;
+    }
+}
 
-        // Send via callback
-        if (key_event_callback_) {
-            key_event_callback_(ascii_char);
-        }
+void CanetaBluetooth::process_keyboard_report(Link& link, uint16_t handle, const uint8_t* report, size_t len) {
+    if (!link.streaming) {
+        return;
+    }
+
+    // Notifications carry no report ID byte; each input report
+    // characteristic's comes from its Report Reference. The decoder keeps
+    // each report ID's keys apart, so one characteristic's notification
+    // never releases keys another is holding.
+    const caneta_gatt_report_t* route = caneta_gatt_layout_route(&link.layout, handle);
+    if (route == nullptr) {
+        return;
     }
-}
\ No newline at end of file
+
+    CANETA_REPORT_HOOK(report, len);
+    record_jitter(link, static_cast<uint32_t>(esp_timer_get_time()));
+
+    // Only copies here: the report task decodes. Every keyboard's reports
+    // share the one queue in arrival order, which is the order their output
+    // is merged in. A full queue drops the report (update() logs it) rather
+    // than stall the BLE stack.
+    if (!link.mounted) {
+        link.mounted = true;
+        reports_.postMount(link.index, link.layout.map_len ? link.layout.map : nullptr, link.layout.map_len);
+    }
+    reports_.postReport(link.index, route->report_id, report, len);
+    xTaskNotifyGive(report_task_);
+}
+
+// GAP events, on the BLE task (scan results arrive through BLEScan)
+void CanetaBluetooth::gap_event_handler(esp_gap_ble_cb_event_t event, esp_ble_gap_cb_param_t* param) {
+    if (event != ESP_GAP_BLE_UPDATE_CONN_PARAMS_EVT || param->update_conn_params.status != ESP_BT_STATUS_SUCCESS) {
+        return;
+    }
+    Link* link = link_for_address(param->update_conn_params.bda);
+    if (link == nullptr) {
+        return;
+    }
+
+    // Measure arrivals against the interval now in effect
+    link->latency = param->update_conn_params.latency;
+    link->interval = param->update_conn_params.conn_int;
+    reset_jitter(*link, param->update_conn_params.conn_int * CANETA_LINK_INTERVAL_US);
+}
+
+void CanetaBluetooth::report_task(void* arg) {
+    CanetaBluetooth* self = static_cast<CanetaBluetooth*>(arg);
+    for (;;) {
+        // Every report queued since the last wakeup, from every keyboard,
+        // and one write for all of their output
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+        self->reports_.drain();
+    }
+}
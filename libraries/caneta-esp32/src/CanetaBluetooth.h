@@ -6,8 +6,15 @@
 #define CANETABLUETOOTH_H
 
 #include <caneta.h>
+#include <caneta.hpp>
+#include <caneta_gatt.h>
+#include <caneta_link.h>
+#include <caneta_reconnect.h>
+#include <atomic>
 #include <cstdint>
 #include <functional>
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
 #include "BLEDevice.h"
 #include "BLEClient.h"
 #include "BLEScan.h"
@@ -20,80 +27,234 @@
 #define HID_REPORT_CHAR_UUID    "2A4D"
 #define HID_REPORT_MAP_UUID     "2A4B"
 #define HID_INFO_UUID           "2A4A"
+#define HID_REPORT_REF_UUID     "2908"
 
-class CanetaBluetooth : public BLEClientCallbacks, public BLEAdvertisedDeviceCallbacks {
+// Keyboards (or barcode scanners) connected at once, each with its own
+// BLEClient and decoder. Bluedroid's controller allows 3 links by default.
+#ifndef CANETA_BLE_MAX_KEYBOARDS
+#define CANETA_BLE_MAX_KEYBOARDS 3
+#endif
+
+// Links the GATT client event handler can route to, across every
+// CanetaBluetooth instance
+#define CANETA_BLE_REGISTRY_SIZE 8
+
+class CanetaBluetooth : public BLEAdvertisedDeviceCallbacks {
 public:
     // Callback function types
-    using KeyEventCallback = std::function<void(char ascii_char)>;
-    using EscapeSequenceCallback = std::function<void(const char* sequence)>;
+    // Receives terminal output (characters and escape sequences) for every
+    // report queued since the last call in one call, on the report task. The
+    // keyboards' output is merged in the order their reports arrived.
+    using OutputCallback = std::function<void(const uint8_t* data, size_t len)>;
     using ConnectionCallback = std::function<void(bool connected, const char* device_name)>;
 
     CanetaBluetooth();
     ~CanetaBluetooth();
 
-    // Initialize BLE and start scanning
+    // Initialize BLE and load the bonded keyboards. update() then reconnects
+    // to them, or scans for a new keyboard.
     bool begin(const char* device_name = "ESP32S3-KB-Host");
 
     // Stop BLE and cleanup
     void end();
 
-    // Set callbacks for key events
-    void setKeyEventCallback(KeyEventCallback callback);
-    void setEscapeSequenceCallback(EscapeSequenceCallback callback);
+    // Set callbacks for terminal output and connection changes
+    void setOutputCallback(OutputCallback callback);
     void setConnectionCallback(ConnectionCallback callback);
 
-    // Start/stop scanning for keyboards
+    // Start/stop scanning for keyboards. The scan runs in the background and
+    // connects to the first keyboard the scan filter accepts.
     bool startScan(uint32_t duration_seconds = 10);
     void stopScan();
 
-    // Process updates (call in loop)
+    // Accept only bonded keyboards while scanning (default: any HID device)
+    void setBondedOnly(bool bonded_only);
+
+    // Forget every bonded keyboard, in memory and in flash
+    void forgetBonds();
+
+    // Connection parameters to request once a keyboard is connected
+    // (default: CANETA_LINK_TYPING). Applies to the connected keyboards at
+    // once, except CANETA_LINK_KEYBOARD, which takes effect from the next
+    // connection.
+    void setLinkProfile(caneta_link_profile_t profile);
+
+    // Ask one connected keyboard for specific parameters. Returns false if
+    // they are out of range or that keyboard is not connected. The keyboard
+    // may refuse; getReportJitter() shows what is in effect.
+    bool requestConnectionParams(size_t keyboard, const caneta_link_params_t& params);
+
+    // Arrival times of a keyboard's reports, against the connection interval
+    // in use (caneta_jitter_in_effect, caneta_jitter_estimate_us). The BLE
+    // task records them and publishes a consistent copy after each report;
+    // an unknown keyboard reads as no reports at all.
+    caneta_jitter_t getReportJitter(size_t keyboard = 0) const;
+
+    // While a keyboard slot is free: each bonded keyboard not yet connected
+    // directly, most recent first, then a scan. Call in loop; connection
+    // attempts block for up to a second.
     void update();
 
-    // Get current connection status
-    bool isConnected() const { return connected_; }
-    const char* getConnectedDeviceName() const { return device_name_; }
+    // Connection status. Keyboards are numbered by slot, 0 to
+    // CANETA_BLE_MAX_KEYBOARDS - 1; a slot keeps its number while connected.
+    // Any other number is never connected and has no name.
+    bool isConnected() const { return keyboardCount() > 0; }
+    bool isConnected(size_t keyboard) const { return keyboard < CANETA_BLE_MAX_KEYBOARDS && links_[keyboard].ready; }
+    size_t keyboardCount() const;
+
+    // A copy, since update() renames a slot as it reconnects
+    String getConnectedDeviceName(size_t keyboard = 0) const;
 
-    // Get current keyboard state
-    const kbd_state_t& getKeyboardState() const { return kbd_state; }
+    // Get a keyboard's state (modifiers and up to six held keys), as of the
+    // report task's last drain. A consistent copy from any task or core, but
+    // not from a task above the report task's priority on its core. Any
+    // other keyboard number reads as all zeroes.
+    kbd_state_t getKeyboardState(size_t keyboard = 0) const { return reports_.state(keyboard); }
 
     // BLE Callbacks
-    void onConnect(BLEClient* client) override;
-    void onDisconnect(BLEClient* client) override;
     void onResult(BLEAdvertisedDevice advertisedDevice) override;
 
 private:
-    // Static callback for HID reports
-    static void hid_report_callback(BLERemoteCharacteristic* characteristic,
-                                   uint8_t* data, size_t length, bool isNotify);
+    // One keyboard connection: its own BLE client, GATT layout and report
+    // timing. The client's callbacks arrive here, so each is already routed.
+    struct Link : public BLEClientCallbacks {
+        CanetaBluetooth* owner = nullptr;
+        uint8_t index = 0;                 // Slot, and the report queue's keyboard number
+        BLEClient* client = nullptr;
+        caneta_peer_t peer = {};           // Set by update() before connecting
+
+        // update() owns name and publishes it for getConnectedDeviceName
+        char name[64] = {};
+        struct Name {
+            char text[64];
+        };
+        caneta::Snapshot<Name> published_name;
+        std::atomic<bool> ready{false};    // Subscribed and announced
+        bool mounted = false;              // BLE task: report map queued for this link
+        std::atomic<bool> streaming{false};  // layout is complete; notifications may be queued
+        std::atomic<bool> lost{false};     // A ready keyboard disconnected
+        std::atomic<bool> stale{false};    // A CCCD write was refused
+
+        // Input report routing: value handle to report ID. Written by
+        // update() only while streaming is false.
+        caneta_gatt_layout_t layout;
+
+        // The BLE task owns jitter and publishes it, and the interval the
+        // controller reports; update() logs interval changes
+        caneta_jitter_t jitter;
+        caneta::Snapshot<caneta_jitter_t> published_jitter;
+        std::atomic<uint32_t> interval{0};  // 1.25 ms units; 0 if not known
+        std::atomic<uint32_t> latency{0};
+        uint32_t logged_interval = 0;
+
+        void onConnect(BLEClient* client) override;
+        void onDisconnect(BLEClient* client) override;
+    };
+
+    // update(): rename a link, or clear its name, and publish it
+    static void set_name(Link& link, const char* name);
+
+    // BLE task: start a link's jitter over, or record a report, and publish it
+    static void reset_jitter(Link& link, uint32_t interval_us);
+    static void record_jitter(Link& link, uint32_t now_us);
+
+    // Static handler for GATT client events: connections, report
+    // notifications and CCCD write results, routed to their link through
+    // the registry by GATT interface
+    static void gattc_event_handler(esp_gattc_cb_event_t event, esp_gatt_if_t gattc_if,
+                                    esp_ble_gattc_cb_param_t* param);
 
-    // Process HID keyboard report
-    void process_keyboard_report(const uint8_t* report, size_t len);
+    // Static handler for GAP events: connection parameter updates, routed to
+    // their link by address
+    static void gap_event_handler(esp_gap_ble_cb_event_t event, esp_ble_gap_cb_param_t* param);
 
-    // Process individual keycode
-    void process_keycode(uint8_t keycode, bool shift, bool ctrl, bool alt);
+    // The IDF's GATT client and GAP callbacks carry no context, only the
+    // interface each BLEClient registered, so links are listed here while
+    // their host is running
+    static Link* registry_[CANETA_BLE_REGISTRY_SIZE];
+    static Link* link_for_interface(esp_gatt_if_t gattc_if);
+    static Link* link_for_address(const uint8_t* addr);
+    bool register_links();
+    void unregister_links();
 
-    // Connect to a discovered keyboard
-    bool connect_to_keyboard(BLEAdvertisedDevice device);
+    // Queue a notification from one of a keyboard's input reports for the
+    // report task. Runs on the BLE task.
+    void process_keyboard_report(Link& link, uint16_t handle, const uint8_t* report, size_t len);
+
+    // The report task: decodes queued reports and delivers their output
+    static void report_task(void* arg);
+
+    // A slot with no keyboard and no connection attempt, or nullptr
+    Link* free_link();
+
+    // The link connected, or connecting, to this address, or nullptr
+    Link* find_link(const uint8_t* addr);
+
+    // Connect to a keyboard by address, bonded or found by a scan, and start it
+    bool connect_to_peer(Link& link, const caneta_peer_t& peer, uint32_t timeout_ms);
+
+    // After connecting: load or discover the keyboard's GATT layout and
+    // subscribe to every input report
+    bool start_keyboard(Link& link);
+
+    // Find the report map and every input report characteristic. *cacheable
+    // is false if the layout didn't fit caneta_gatt_layout_t.
+    bool discover_layout(Link& link, bool* cacheable);
+
+    // Enable notifications on every input report in the link's layout
+    bool subscribe_reports(Link& link);
+
+    bool request_params(Link& link, const caneta_link_params_t& params);
+
+    // Decoder sink: hands each batch of output to the output callback
+    struct OutputSink {
+        CanetaBluetooth* owner;
+        void write(const uint8_t* data, size_t len) {
+            if (owner->output_callback_) {
+                owner->output_callback_(data, len);
+            }
+        }
+    };
+
+    // The bond cache and each bonded keyboard's GATT layout live in NVS
+    void load_bonds();
+    void save_bonds();
+    bool load_layout(Link& link);
+    void save_layout(const Link& link);
+    void forget_layout(const caneta_peer_t& peer);
 
     // Member variables
-    BLEClient* client_;
     BLEScan* scan_;
-    BLERemoteService* hid_service_;
-    BLERemoteCharacteristic* hid_report_char_;
 
     bool initialized_;
-    bool connected_;
     bool scanning_;
+    uint32_t scan_end_ms_;                // When the background scan stops by itself
     char device_name_[64];
-    char connected_device_name_[64];
+
+    Link links_[CANETA_BLE_MAX_KEYBOARDS];
+
+    // Raw reports on their way from the BLE task, the only producer, to the
+    // report task, which owns each keyboard's decoder and state
+    caneta::ReportQueue<OutputSink, CANETA_BLE_MAX_KEYBOARDS> reports_;
+    TaskHandle_t report_task_;
+    uint32_t dropped_;                    // Queue drops already logged
+
+    caneta_link_profile_t link_profile_;
+
+    // Reconnection. The BLE callbacks only set flags; update() acts on them.
+    // onResult owns scan_filter_ while a scan runs and takes bonded_only_
+    // from setBondedOnly each time it checks an advertisement.
+    caneta_bonds_t bonds_;
+    caneta_scan_filter_t scan_filter_;
+    std::atomic<bool> bonded_only_;
+    caneta_reconnect_t reconnect_;
+    caneta_peer_t candidate_;             // Accepted by the scan filter
+    char candidate_name_[64];
+    std::atomic<bool> candidate_ready_;
 
     // Callbacks
-    KeyEventCallback key_event_callback_;
-    EscapeSequenceCallback escape_sequence_callback_;
+    OutputCallback output_callback_;
     ConnectionCallback connection_callback_;
-
-    // Static instance for callback routing
-    static CanetaBluetooth* instance_;
 };
 
 #endif //CANETABLUETOOTH_H
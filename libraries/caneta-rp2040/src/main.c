@@ -5,6 +5,10 @@
 #include "pico/stdlib.h"
 #include "hardware/uart.h"
 #include "hardware/gpio.h"
+#include "hardware/sync.h"
+#include "hardware/dma.h"
+#include "hardware/irq.h"
+#include "pico/multicore.h"
 
 // PIO-USB includes
 #include "pio_usb.h"
@@ -12,6 +16,10 @@
 #include "class/hid/hid_host.h"
 
 #include <caneta.h>
+#include <caneta_hid.h>
+#include <caneta_host.h>
+#include <caneta_tx.h>
+#include <caneta_batch.h>
 
 // Manual function declarations for HID functions
 extern bool tuh_hid_receive_report(uint8_t dev_addr, uint8_t instance);
@@ -24,99 +32,236 @@ extern bool tuh_hid_set_protocol(uint8_t dev_addr, uint8_t instance, uint8_t pro
 // USB pins
 #define USB_HOST_DP_PIN 4   // GPIO4 for D+
 
+// Terminal output goes to the UART, or with CANETA_USB_CDC to a CDC-ACM
+// serial port on the native USB port
+#ifndef CANETA_USB_CDC
+#define CANETA_USB_CDC 0
+#endif
+
+// Called with every raw HID report before it is decoded. Host simulation
+// builds define this to record captures; on hardware it compiles away.
+#ifndef CANETA_REPORT_HOOK
+#define CANETA_REPORT_HOOK(dev_addr, instance, report, len) ((void)0)
+#endif
+
+// Everything sent to the terminal is queued in a transmit ring and drained
+// in the background, so no caller waits on the wire (about 87 us a byte on
+// the UART at 115200 baud). Writers on both cores are serialized by a
+// hardware spin lock.
+static caneta_tx_t terminal_tx;
+static spin_lock_t* terminal_lock;
+
+#if CANETA_USB_CDC
+// Core 0 drains the ring into the CDC device (TinyUSB runs there), batching
+// it into full bulk packets with a short flush timeout
+static caneta_batch_t cdc_batch;
+
+// New output wakes core 0 to batch it
+static void terminal_kick(void)
+{
+    __sev();
+}
+
+// Core 0: hand the CDC device whatever the batcher says is ready and fits in
+// its TX FIFO. Output is discarded while no terminal has the port open.
+// Returns false if nothing is waiting, or only overdue bytes the full FIFO
+// holds back (the USB interrupt that drains it ends the sleep); otherwise
+// *deadline_us is when a short packet is due.
+static bool cdc_task(uint32_t now_us, uint32_t* deadline_us)
+{
+    size_t queued = caneta_tx_queued(&terminal_tx);
+    if (queued == 0) return false;
+
+    size_t send = queued;
+    if (tud_cdc_connected()) {
+        send = caneta_batch_ready_within(&cdc_batch, queued, tud_cdc_write_available(), now_us);
+    } else {
+        caneta_batch_ready(&cdc_batch, 0, now_us);
+    }
+
+    if (send > 0) {
+        while (send > 0) {
+            const uint8_t* data;
+            size_t len = caneta_tx_peek(&terminal_tx, &data);
+            if (len > send) len = send;
+            if (tud_cdc_connected()) tud_cdc_write(data, len);
+            caneta_tx_consume(&terminal_tx, len);
+            send -= len;
+        }
+        if (tud_cdc_connected()) tud_cdc_write_flush();
+
+        // Room for core 1's output
+        __sev();
+    }
+    if (!caneta_batch_next_deadline(&cdc_batch, deadline_us)) return false;
+    return (int32_t)(*deadline_us - now_us) > 0;
+}
+#else
+// The UART is fed by DMA straight from the ring; the DMA interrupt shares
+// terminal_lock with the writers
+static int uart_tx_dma;
+static size_t uart_tx_sending;  // Bytes in the running DMA transfer, 0 when idle
+
+// Start the next transfer if the DMA is idle. Call with terminal_lock held.
+static void terminal_kick(void)
+{
+    if (uart_tx_sending) return;
+
+    const uint8_t* data;
+    size_t len = caneta_tx_peek(&terminal_tx, &data);
+    if (len == 0) return;
+    uart_tx_sending = len;
+    dma_channel_transfer_from_buffer_now(uart_tx_dma, data, len);
+}
+
+static void uart_tx_dma_irq(void)
+{
+    dma_channel_acknowledge_irq0(uart_tx_dma);
+
+    uint32_t save = spin_lock_blocking(terminal_lock);
+    caneta_tx_consume(&terminal_tx, uart_tx_sending);
+    uart_tx_sending = 0;
+    terminal_kick();
+    spin_unlock(terminal_lock, save);
+}
+#endif
+
+// Queue a whole sequence, or drop it (and count the drop) if the ring is full.
+// Never waits, so it is safe from USB callbacks.
+bool terminal_send(const uint8_t* data, size_t len)
+{
+    uint32_t save = spin_lock_blocking(terminal_lock);
+    bool queued = caneta_tx_write(&terminal_tx, data, len);
+    terminal_kick();
+    spin_unlock(terminal_lock, save);
+    return queued;
+}
+
+// Queue data, waiting for the drain to make room. Only for core 1, whose
+// output nothing else waits on.
+void terminal_send_waiting(const uint8_t* data, size_t len)
+{
+    while (len > 0) {
+        size_t part = len < CANETA_TX_SIZE ? len : CANETA_TX_SIZE;
+        uint32_t save = spin_lock_blocking(terminal_lock);
+        bool queued = caneta_tx_try_write(&terminal_tx, data, part);
+        terminal_kick();
+        spin_unlock(terminal_lock, save);
+
+        if (queued) {
+            data += part;
+            len -= part;
+        } else {
+            // The drain signals when it makes room
+            __wfe();
+        }
+    }
+}
+
 void debug_print(const char* format, ...)
 {
     char buffer[128];
     va_list args;
     va_start(args, format);
-    vsnprintf(buffer, sizeof(buffer), format, args);
+    int len = vsnprintf(buffer, sizeof(buffer), format, args);
     va_end(args);
-    uart_puts(UART_ID, buffer);
+    if (len < 0) return;
+    if ((size_t)len >= sizeof(buffer)) len = sizeof(buffer) - 1;
+    terminal_send((const uint8_t*)buffer, (size_t)len);
 }
 
-void uart_setup()
+void terminal_setup()
 {
+    caneta_tx_init(&terminal_tx);
+    terminal_lock = spin_lock_instance(spin_lock_claim_unused(true));
+
+#if CANETA_USB_CDC
+    caneta_batch_init(&cdc_batch, NULL);
+    tud_init(BOARD_TUD_RHPORT);
+#else
     uart_init(UART_ID, 115200);
     gpio_set_function(UART_TX_PIN, GPIO_FUNC_UART);
     uart_set_hw_flow(UART_ID, false, false);
     uart_set_format(UART_ID, 8, 1, UART_PARITY_NONE);
-    uart_set_fifo_enabled(UART_ID, false);
+    uart_set_fifo_enabled(UART_ID, true);
+
+    // Bytes from the ring to the data register, paced by the UART's TX DREQ
+    uart_tx_dma = dma_claim_unused_channel(true);
+    dma_channel_config config = dma_channel_get_default_config(uart_tx_dma);
+    channel_config_set_transfer_data_size(&config, DMA_SIZE_8);
+    channel_config_set_read_increment(&config, true);
+    channel_config_set_write_increment(&config, false);
+    channel_config_set_dreq(&config, uart_get_dreq(UART_ID, true));
+    dma_channel_configure(uart_tx_dma, &config, &uart_get_hw(UART_ID)->dr, NULL, 0, false);
+    dma_channel_set_irq0_enabled(uart_tx_dma, true);
+#endif
 }
 
-void send_to_terminal(const char* str)
+// Take the UART transmit interrupt on the calling core (core 1, which does
+// the output). Completions before this stay pending and are handled once
+// enabled.
+void terminal_irq_setup()
 {
-    uart_puts(UART_ID, str);
+#if !CANETA_USB_CDC
+    irq_set_exclusive_handler(DMA_IRQ_0, uart_tx_dma_irq);
+    irq_set_enabled(DMA_IRQ_0, true);
+#endif
 }
 
-void send_vt100_escape(const char* sequence)
+// Core 0 runs the USB host and only copies raw reports into the ring; core 1
+// owns a decoder and repeat engine per HID interface and does all translation
+// and UART output, so a slow escape sequence never delays the next USB poll.
+// Device addresses start at 1; hubs take addresses of their own.
+#define MAX_DEV_ADDR (CFG_TUH_DEVICE_MAX + CFG_TUH_HUB)
+_Static_assert(MAX_DEV_ADDR <= CANETA_HOST_MAX_DEVICES && CFG_TUH_HID <= CANETA_HOST_MAX_INTERFACES,
+               "caneta_host_t must cover every HID interface");
+
+static caneta_ring_t report_ring;
+static caneta_host_t host;
+
+// Terminal output sink: each report's output is queued in one write. Output
+// is never dropped; core 1 waits for room instead, and the report ring absorbs
+// the backlog.
+static void terminal_sink_write(void* ctx, const uint8_t* data, size_t len)
 {
-    uart_putc_raw(UART_ID, '\x1B');  // ESC
-    uart_puts(UART_ID, sequence);
+    (void)ctx;
+    terminal_send_waiting(data, len);
 }
 
-void process_hid_report(uint8_t const* report, uint16_t len)
-{
-    if (len < 8) return;  // Standard keyboard report is 8 bytes
+static const caneta_sink_t terminal_sink = { terminal_sink_write, NULL };
 
-    // Byte 0: Modifier keys
-    uint8_t modifiers = report[0];
-    bool shift = (modifiers & 0x22) != 0;  // Left or right shift
-    bool ctrl = (modifiers & 0x11) != 0;   // Left or right ctrl
-    bool alt = (modifiers & 0x44) != 0;    // Left or right alt
-
-    kbd_state.shift_pressed = shift;
-    kbd_state.ctrl_pressed = ctrl;
-    kbd_state.alt_pressed = alt;
-
-    // Byte 1: Reserved (always 0)
-    // Bytes 2-7: Up to 6 pressed keys
+// Core 1: decode queued reports and send repeats, sleeping in between. Core 0
+// signals an event after every push, which ends the sleep early.
+void core1_main(void)
+{
+    uint32_t overflows = 0;
+    uint32_t oversize = 0;
+    uint32_t tx_dropped = 0;
 
-    // Check for newly pressed keys
-    for (int i = 2; i < 8; i++) {
-        uint8_t keycode = report[i];
-        if (keycode == 0) continue;  // No key
+    terminal_irq_setup();
 
-        // Check if this is a new key press (not in last report)
-        bool was_pressed = false;
-        for (int j = 0; j < 6; j++) {
-            if (kbd_state.last_keys[j] == keycode) {
-                was_pressed = true;
-                break;
-            }
+    while(1)
+    {
+        uint32_t now_ms = to_ms_since_boot(get_absolute_time());
+        caneta_host_drain(&host, &report_ring, now_ms, &terminal_sink);
+
+        if (caneta_ring_overflows(&report_ring) != overflows || caneta_ring_oversize(&report_ring) != oversize) {
+            overflows = caneta_ring_overflows(&report_ring);
+            oversize = caneta_ring_oversize(&report_ring);
+            debug_print("report ring dropped %lu full, %lu oversize\r\n",
+                        (unsigned long)overflows, (unsigned long)oversize);
         }
-
-        if (!was_pressed) {
-            // New key press - process it
-
-            // Handle special keys first
-            const char* special_seq = process_special_keys(keycode);
-            if (*special_seq) {  // If not empty string
-                send_vt100_escape(special_seq);
-                continue;
-            }
-
-            // Handle regular keys using caneta function
-            char ascii_char = hid_to_ascii(keycode, shift);
-
-            if (ascii_char != 0) {
-                // Handle Ctrl combinations
-                if (ctrl && ascii_char >= 'a' && ascii_char <= 'z') {
-                    ascii_char = ascii_char - 'a' + 1;  // Ctrl+A = 0x01, etc.
-                } else if (ctrl && ascii_char >= 'A' && ascii_char <= 'Z') {
-                    ascii_char = ascii_char - 'A' + 1;
-                }
-
-                // Send the character
-                uart_putc_raw(UART_ID, ascii_char);
-            }
+        if (caneta_tx_dropped(&terminal_tx) != tx_dropped) {
+            tx_dropped = caneta_tx_dropped(&terminal_tx);
+            debug_print("terminal dropped %lu debug messages\r\n", (unsigned long)tx_dropped);
         }
-    }
 
-    // Save current keys for next comparison
-    memset(kbd_state.last_keys, 0, 6);
-    for (int i = 2; i < 8; i++) {
-        if (report[i] != 0) {
-            kbd_state.last_keys[i-2] = report[i];
+        uint32_t deadline_ms;
+        if (caneta_host_run_repeats(&host, now_ms, &terminal_sink, &deadline_ms)) {
+            int32_t wait_ms = (int32_t)(deadline_ms - now_ms);
+            if (wait_ms > 0) best_effort_wfe_or_timeout(make_timeout_time_ms(wait_ms));
+        } else {
+            __wfe();
         }
     }
 }
@@ -124,7 +269,7 @@ void process_hid_report(uint8_t const* report, uint16_t len)
 // USB callbacks
 void tuh_mount_cb(uint8_t dev_addr)
 {
-    uart_putc_raw(UART_ID, 'M');
+    terminal_send((const uint8_t*)"M", 1);
     debug_print("tuh_mount_cb %d\r\n", dev_addr);
 
     // Silent connection
@@ -134,22 +279,28 @@ void tuh_mount_cb(uint8_t dev_addr)
 void tuh_umount_cb(uint8_t dev_addr)
 {
     // Reset keyboard state on disconnect
-    memset(&kbd_state, 0, sizeof(kbd_state));
-    (void)dev_addr;
+    caneta_host_post_unmount(&report_ring, dev_addr);
+    __sev();
 }
 
 void tuh_hid_mount_cb(uint8_t dev_addr, uint8_t instance, uint8_t const* desc_report, uint16_t desc_len)
 {
-    // Set boot protocol and request reports
-    tuh_hid_set_protocol(dev_addr, instance, 0);  // Boot protocol
+    // Keyboards whose reports don't fit the boot layout (NKRO bitmaps,
+    // report IDs) stay in report protocol; everything else is switched to
+    // boot protocol. Core 1 compiles its own decoder from the descriptor; if
+    // the descriptor can't be queued it keeps a boot decoder.
+    caneta_hid_plan_t plan;
+    bool report_mode = caneta_hid_compile(desc_report, desc_len, &plan) && !caneta_hid_plan_is_boot(&plan);
+    if (!caneta_host_post_mount(&report_ring, dev_addr, instance, desc_report, desc_len)) report_mode = false;
+    __sev();
+
+    tuh_hid_set_protocol(dev_addr, instance, report_mode ? HID_PROTOCOL_REPORT : HID_PROTOCOL_BOOT);
     tuh_hid_receive_report(dev_addr, instance);
 
-    (void)desc_report;
-    (void)desc_len;
-
     uint8_t const itf_protocol = tuh_hid_interface_protocol(dev_addr, instance);
-    uart_putc_raw(UART_ID, 'H');
-    debug_print("HID mounted - dev:%d, instance:%d, protocol:%d\r\n", dev_addr, instance, itf_protocol);
+    terminal_send((const uint8_t*)"H", 1);
+    debug_print("HID mounted - dev:%d, instance:%d, protocol:%d, %s\r\n", dev_addr, instance, itf_protocol,
+                report_mode ? "report" : "boot");
 }
 
 void tuh_hid_umount_cb(uint8_t dev_addr, uint8_t instance) {
@@ -160,18 +311,20 @@ void tuh_hid_umount_cb(uint8_t dev_addr, uint8_t instance) {
 
 void tuh_hid_report_received_cb(uint8_t dev_addr, uint8_t instance, uint8_t const* report, uint16_t len)
 {
-    // Process the HID report and translate to VT100
-    process_hid_report(report, len);
+    CANETA_REPORT_HOOK(dev_addr, instance, report, len);
+
+    // Hand the report to core 1 for translation to VT100. If core 1 has
+    // fallen that far behind, the report is dropped and counted.
+    caneta_host_post_report(&report_ring, dev_addr, instance, report, len);
+    __sev();
 
     // Request next report
     tuh_hid_receive_report(dev_addr, instance);
-
-    (void)dev_addr;
 }
 
 int main()
 {
-    uart_setup();
+    terminal_setup();
     sleep_ms(100);
 
     // Configure PIO-USB
@@ -182,10 +335,28 @@ int main()
     tuh_configure(1, TUH_CFGID_RPI_PIO_USB_CONFIGURATION, &pio_cfg);
     tuh_init(1);
 
+    caneta_ring_init(&report_ring);
+    caneta_host_init(&host, NULL);
+    multicore_launch_core1(core1_main);
+
     while(1)
     {
         tuh_task();
-        sleep_us(100);
+
+#if CANETA_USB_CDC
+        // Sleep until a short packet is due at the latest
+        tud_task();
+        uint32_t now_us = time_us_32();
+        uint32_t deadline_us;
+        if (cdc_task(now_us, &deadline_us)) {
+            int32_t wait_us = (int32_t)(deadline_us - now_us);
+            if (wait_us > 0) best_effort_wfe_or_timeout(make_timeout_time_us(wait_us));
+            continue;
+        }
+#endif
+
+        // USB interrupts and new output end the sleep
+        __wfe();
     }
 
     return 0;
@@ -28,10 +28,32 @@
 //--------------------------------------------------------------------
 // DEVICE CONFIGURATION
 //--------------------------------------------------------------------
+
+// Terminal output over a CDC-ACM device on the native USB port
+#ifndef CANETA_USB_CDC
+#define CANETA_USB_CDC        0
+#endif
+
 #ifndef CFG_TUD_ENABLED
-#define CFG_TUD_ENABLED       0
+#define CFG_TUD_ENABLED       CANETA_USB_CDC
 #endif
 
+#ifndef CFG_TUD_ENDPOINT0_SIZE
+#define CFG_TUD_ENDPOINT0_SIZE 64
+#endif
+
+#define CFG_TUD_CDC             CANETA_USB_CDC
+#define CFG_TUD_MSC             0
+#define CFG_TUD_HID             0
+#define CFG_TUD_MIDI            0
+#define CFG_TUD_VENDOR          0
+
+// Full-speed bulk packets; the TX FIFO holds several so a paste burst
+// keeps every frame busy
+#define CFG_TUD_CDC_EP_BUFSIZE  64
+#define CFG_TUD_CDC_RX_BUFSIZE  64
+#define CFG_TUD_CDC_TX_BUFSIZE  1024
+
 //--------------------------------------------------------------------
 // HOST CONFIGURATION
 //--------------------------------------------------------------------
@@ -5,12 +5,11 @@
 
 namespace caneta
 {
-    // USB HID Usage Tables - Keyboard/Keypad Page (0x07)
-    // These match the standard USB HID keycodes used by your RP2040 code
-
-    SDLToHID::SDLToHID() : keyCount(0) {
+    SDLToHID::SDLToHID()
+        : captureWriter(nullptr), reportMode(BOOT_REPORTS), nkroReportId(1), nkroUsages(NKRO_USAGES_MAX),
+          modifiers(0), keyCount(0) {
         memset(currentReport, 0, sizeof(currentReport));
-        memset(pressedKeys, 0, sizeof(pressedKeys));
+        memset(keyBits, 0, sizeof(keyBits));
     }
 
     SDLToHID::~SDLToHID() {
@@ -20,86 +19,188 @@ namespace caneta
         reportCallback = callback;
     }
 
-    void SDLToHID::processEvent(const SDL_Event& event) {
-        switch (event.type) {
-            case SDL_KEYDOWN:
-                if (!event.key.repeat) {  // Ignore key repeat events
-                    handleKeyDown(event.key);
-                }
-                break;
-            case SDL_KEYUP:
-                handleKeyUp(event.key);
-                break;
-        }
+    void SDLToHID::setCaptureWriter(caneta_capture_writer_t* writer) {
+        captureWriter = writer;
     }
 
-    void SDLToHID::handleKeyDown(const SDL_KeyboardEvent& key) {
-        uint8_t hidCode = sdlToHIDKeycode(key.keysym.sym);
+    void SDLToHID::setReportMode(ReportMode mode) {
+        reportMode = mode;
+    }
 
-        if (hidCode != 0) {
-            addKey(hidCode);
-            updateReport();
-            sendReport();
+    void SDLToHID::setNkroFormat(uint8_t reportId, uint16_t keyUsages) {
+        if (keyUsages > NKRO_USAGES_MAX) {
+            keyUsages = NKRO_USAGES_MAX;
+        }
+        nkroReportId = reportId;
+        nkroUsages = static_cast<uint8_t>((keyUsages + 7) & ~7u);
+    }
+
+    size_t SDLToHID::reportSize() const {
+        if (reportMode == BOOT_REPORTS) {
+            return CANETA_REPORT_SIZE;
         }
+        return (nkroReportId ? 2u : 1u) + nkroUsages / 8u;
     }
 
-    void SDLToHID::handleKeyUp(const SDL_KeyboardEvent& key) {
-        uint8_t hidCode = sdlToHIDKeycode(key.keysym.sym);
+    size_t SDLToHID::nkroDescriptor(uint8_t* out) const {
+        size_t n = 0;
+        const uint8_t head[] = {
+            0x05, 0x01,        // Usage Page (Generic Desktop)
+            0x09, 0x06,        // Usage (Keyboard)
+            0xA1, 0x01,        // Collection (Application)
+        };
+        memcpy(out + n, head, sizeof(head));
+        n += sizeof(head);
+        if (nkroReportId) {
+            out[n++] = 0x85;   //   Report ID
+            out[n++] = nkroReportId;
+        }
+        const uint8_t modifierBits[] = {
+            0x05, 0x07,        //   Usage Page (Keyboard)
+            0x19, 0xE0,        //   Usage Minimum (Left Control)
+            0x29, 0xE7,        //   Usage Maximum (Right GUI)
+            0x15, 0x00,        //   Logical Minimum (0)
+            0x25, 0x01,        //   Logical Maximum (1)
+            0x75, 0x01,        //   Report Size (1)
+            0x95, 0x08,        //   Report Count (8)
+            0x81, 0x02,        //   Input (Data, Variable, Absolute): modifiers
+        };
+        memcpy(out + n, modifierBits, sizeof(modifierBits));
+        n += sizeof(modifierBits);
+        if (nkroUsages) {
+            const uint8_t keyBitmap[] = {
+                0x19, 0x00,                                   //   Usage Minimum (0)
+                0x29, static_cast<uint8_t>(nkroUsages - 1),   //   Usage Maximum
+                0x95, nkroUsages,                             //   Report Count
+                0x81, 0x02,                                   //   Input (Data, Variable, Absolute): key bitmap
+            };
+            memcpy(out + n, keyBitmap, sizeof(keyBitmap));
+            n += sizeof(keyBitmap);
+        }
+        out[n++] = 0xC0;       // End Collection
+        return n;
+    }
 
-        if (hidCode != 0) {
-            removeKey(hidCode);
+    void SDLToHID::processEvent(const SDL_Event& event) {
+        if (applyEvent(event)) {
             updateReport();
             sendReport();
         }
     }
 
-    void SDLToHID::addKey(uint8_t hidCode) {
-        // Check if key is already pressed
-        for (int i = 0; i < keyCount; i++) {
-            if (pressedKeys[i] == hidCode) {
-                return;  // Already pressed
+    size_t SDLToHID::translateEvents(const SDL_Event* events, size_t count, uint8_t* reports) {
+        size_t size = reportSize();
+        size_t report_count = 0;
+        for (size_t i = 0; i < count; i++) {
+            if (applyEvent(events[i])) {
+                updateReport();
+                recordReport();
+                memcpy(reports + report_count * size, currentReport, size);
+                report_count++;
             }
         }
-
-        // Add key if there's room
-        if (keyCount < 6) {
-            pressedKeys[keyCount++] = hidCode;
-        }
+        return report_count;
     }
 
-    void SDLToHID::removeKey(uint8_t hidCode) {
-        // Find and remove the key
-        for (int i = 0; i < keyCount; i++) {
-            if (pressedKeys[i] == hidCode) {
-                // Shift remaining keys
-                for (int j = i; j < keyCount - 1; j++) {
-                    pressedKeys[j] = pressedKeys[j + 1];
+    bool SDLToHID::applyEvent(const SDL_Event& event) {
+        bool down;
+        switch (event.type) {
+            case SDL_KEYDOWN:
+                if (event.key.repeat) {  // Reports only carry held keys; caneta_repeat does the repeating
+                    return false;
                 }
-                keyCount--;
-                pressedKeys[keyCount] = 0;
+                down = true;
                 break;
+            case SDL_KEYUP:
+                down = false;
+                break;
+            default:
+                return false;
+        }
+
+        uint8_t hidCode = sdlScancodeToHID(event.key.keysym.scancode);
+        if (hidCode == 0) {
+            return false;
+        }
+
+        // Modifier keys (0xE0-0xE7) are bits of byte 0, not keys
+        if (hidCode >= 0xE0) {
+            uint8_t bit = static_cast<uint8_t>(1u << (hidCode - 0xE0));
+            modifiers = down ? static_cast<uint8_t>(modifiers | bit) : static_cast<uint8_t>(modifiers & ~bit);
+            return true;
+        }
+
+        uint8_t& bits = keyBits[hidCode / 8];
+        uint8_t bit = static_cast<uint8_t>(1u << (hidCode % 8));
+        if (((bits & bit) != 0) == down) {
+            return false;  // Already down, or a release of a key we never saw pressed
+        }
+        bits ^= bit;
+        keyCount = down ? keyCount + 1 : keyCount - 1;
+        return true;
+    }
+
+    static inline unsigned lowestBit(unsigned mask) {
+#if defined(__GNUC__)
+        return static_cast<unsigned>(__builtin_ctz(mask));
+#else
+        unsigned bit = 0;
+        while (!(mask & 1u)) { mask >>= 1; bit++; }
+        return bit;
+#endif
+    }
+
+    void SDLToHID::buildBootReport(uint8_t* report) const {
+        memset(report, 0, CANETA_REPORT_SIZE);
+        report[0] = modifiers;
+
+        // Too many keys for six slots: every slot says so, and the host keeps
+        // the keys it last saw
+        if (keyCount > 6) {
+            memset(report + 2, CANETA_USAGE_ERROR_ROLLOVER, 6);
+            return;
+        }
+
+        int slot = 2;
+        for (unsigned i = 0; slot < 2 + keyCount; i++) {
+            for (unsigned held = keyBits[i]; held; held &= held - 1) {
+                report[slot++] = static_cast<uint8_t>(i * 8 + lowestBit(held));
             }
         }
     }
 
     void SDLToHID::updateReport() {
-        // Clear the report
-        memset(currentReport, 0, sizeof(currentReport));
-
-        // Byte 0: Modifiers
-        currentReport[0] = getHIDModifiers(SDL_GetModState());
+        if (reportMode == BOOT_REPORTS) {
+            buildBootReport(currentReport);
+            return;
+        }
 
-        // Byte 1: Reserved (always 0)
+        uint8_t* report = currentReport;
+        if (nkroReportId) {
+            *report++ = nkroReportId;
+        }
+        report[0] = modifiers;
+        memcpy(report + 1, keyBits, nkroUsages / 8);
+    }
 
-        // Bytes 2-7: Up to 6 pressed keys
-        for (int i = 0; i < keyCount && i < 6; i++) {
-            currentReport[i + 2] = pressedKeys[i];
+    void SDLToHID::recordReport() {
+        if (!captureWriter) {
+            return;
+        }
+        if (reportMode == BOOT_REPORTS) {
+            caneta_capture_write(captureWriter, caneta_capture_now_us(), 0, currentReport, CANETA_REPORT_SIZE);
+        } else {
+            uint8_t boot[CANETA_REPORT_SIZE];
+            buildBootReport(boot);
+            caneta_capture_write(captureWriter, caneta_capture_now_us(), 0, boot, sizeof(boot));
         }
     }
 
     void SDLToHID::sendReport() {
+        recordReport();
+
         if (reportCallback) {
-            reportCallback(currentReport, 8);
+            reportCallback(currentReport, static_cast<uint16_t>(reportSize()));
         }
     }
 
@@ -118,110 +219,45 @@ namespace caneta
         return hidMod;
     }
 
-    uint8_t SDLToHID::sdlToHIDKeycode(SDL_Keycode sdlKey) {
-        // USB HID Keyboard Usage Table conversions
-        // Based on USB HID Usage Tables v1.12, Section 10 (Keyboard/Keypad)
-
-        // Letters A-Z (HID: 0x04-0x1D)
-        if (sdlKey >= SDLK_a && sdlKey <= SDLK_z) {
-            return 0x04 + (sdlKey - SDLK_a);
-        }
-
-        // Numbers 1-9 (HID: 0x1E-0x26)
-        if (sdlKey >= SDLK_1 && sdlKey <= SDLK_9) {
-            return 0x1E + (sdlKey - SDLK_1);
-        }
-
-        // Special number keys
-        if (sdlKey == SDLK_0) return 0x27;  // 0
-
-        // Common keys
-        switch (sdlKey)
-        {
-            case SDLK_RETURN:     return 0x28;  // Enter
-            case SDLK_ESCAPE:     return 0x29;  // Escape
-            case SDLK_BACKSPACE:  return 0x2A;  // Backspace
-            case SDLK_TAB:        return 0x2B;  // Tab
-            case SDLK_SPACE:      return 0x2C;  // Space
-            case SDLK_MINUS:      return 0x2D;  // - _
-            case SDLK_EQUALS:     return 0x2E;  // = +
-            case SDLK_LEFTBRACKET: return 0x2F; // [ {
-            case SDLK_RIGHTBRACKET: return 0x30; // ] }
-            case SDLK_BACKSLASH:  return 0x31;  // \ |
-            case SDLK_SEMICOLON:  return 0x33;  // ; :
-            case SDLK_QUOTE:      return 0x34;  // ' "
-            case SDLK_BACKQUOTE:  return 0x35;  // ` ~
-            case SDLK_COMMA:      return 0x36;  // , <
-            case SDLK_PERIOD:     return 0x37;  // . >
-            case SDLK_SLASH:      return 0x38;  // / ?
-            case SDLK_CAPSLOCK:   return 0x39;  // Caps Lock
-
-                // Function keys F1-F12 (HID: 0x3A-0x45)
-            case SDLK_F1:  return 0x3A;
-            case SDLK_F2:  return 0x3B;
-            case SDLK_F3:  return 0x3C;
-            case SDLK_F4:  return 0x3D;
-            case SDLK_F5:  return 0x3E;
-            case SDLK_F6:  return 0x3F;
-            case SDLK_F7:  return 0x40;
-            case SDLK_F8:  return 0x41;
-            case SDLK_F9:  return 0x42;
-            case SDLK_F10: return 0x43;
-            case SDLK_F11: return 0x44;
-            case SDLK_F12: return 0x45;
-
-                // Control keys
-            case SDLK_PRINTSCREEN: return 0x46;  // Print Screen
-            case SDLK_SCROLLLOCK:  return 0x47;  // Scroll Lock
-            case SDLK_PAUSE:       return 0x48;  // Pause
-            case SDLK_INSERT:      return 0x49;  // Insert
-            case SDLK_HOME:        return 0x4A;  // Home
-            case SDLK_PAGEUP:      return 0x4B;  // Page Up
-            case SDLK_DELETE:      return 0x4C;  // Delete
-            case SDLK_END:         return 0x4D;  // End
-            case SDLK_PAGEDOWN:    return 0x4E;  // Page Down
-
-                // Arrow keys
-            case SDLK_RIGHT:       return 0x4F;  // Right Arrow
-            case SDLK_LEFT:        return 0x50;  // Left Arrow
-            case SDLK_DOWN:        return 0x51;  // Down Arrow
-            case SDLK_UP:          return 0x52;  // Up Arrow
-
-                // Keypad keys (when Num Lock is active)
-            case SDLK_KP_DIVIDE:   return 0x54;  // Keypad /
-            case SDLK_KP_MULTIPLY: return 0x55;  // Keypad *
-            case SDLK_KP_MINUS:    return 0x56;  // Keypad -
-            case SDLK_KP_PLUS:     return 0x57;  // Keypad +
-            case SDLK_KP_ENTER:    return 0x58;  // Keypad Enter
-            case SDLK_KP_1:        return 0x59;  // Keypad 1
-            case SDLK_KP_2:        return 0x5A;  // Keypad 2
-            case SDLK_KP_3:        return 0x5B;  // Keypad 3
-            case SDLK_KP_4:        return 0x5C;  // Keypad 4
-            case SDLK_KP_5:        return 0x5D;  // Keypad 5
-            case SDLK_KP_6:        return 0x5E;  // Keypad 6
-            case SDLK_KP_7:        return 0x5F;  // Keypad 7
-            case SDLK_KP_8:        return 0x60;  // Keypad 8
-            case SDLK_KP_9:        return 0x61;  // Keypad 9
-            case SDLK_KP_0:        return 0x62;  // Keypad 0
-            case SDLK_KP_PERIOD:   return 0x63;  // Keypad .
-
-                // Additional keys
-            case SDLK_APPLICATION: return 0x65;  // Application (Menu) key
-            case SDLK_NUMLOCKCLEAR: return 0x53; // Num Lock
-
-                // Modifier keys (these are handled separately in modifiers byte)
-                // But some apps might want to track them as regular keys too
-            case SDLK_LCTRL:       return 0xE0;  // Left Control
-            case SDLK_LSHIFT:      return 0xE1;  // Left Shift
-            case SDLK_LALT:        return 0xE2;  // Left Alt
-            case SDLK_LGUI:        return 0xE3;  // Left GUI (Command)
-            case SDLK_RCTRL:       return 0xE4;  // Right Control
-            case SDLK_RSHIFT:      return 0xE5;  // Right Shift
-            case SDLK_RALT:        return 0xE6;  // Right Alt
-            case SDLK_RGUI:        return 0xE7;  // Right GUI (Command)
+    // SDL scancode -> HID usage. SDL numbers its scancodes by the key's usage on
+    // the Keyboard/Keypad page, so every scancode SDL defines up to Right GUI is
+    // its own usage and the usages SDL leaves out (0x82-0x84, 0xA5-0xAF,
+    // 0xDE-0xDF) stay 0. From 0x101 on SDL's scancodes are its own media and
+    // application keys, which are Consumer page usages a boot report cannot
+    // carry; all but Mode stay 0.
+    static constexpr uint8_t kScancodeToHID[SDL_NUM_SCANCODES] = {
+        0x00, 0x00, 0x00, 0x00, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F,
+        0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1A, 0x1B, 0x1C, 0x1D, 0x1E, 0x1F,
+        0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x2A, 0x2B, 0x2C, 0x2D, 0x2E, 0x2F,
+        0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x3A, 0x3B, 0x3C, 0x3D, 0x3E, 0x3F,
+        0x40, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46, 0x47, 0x48, 0x49, 0x4A, 0x4B, 0x4C, 0x4D, 0x4E, 0x4F,
+        0x50, 0x51, 0x52, 0x53, 0x54, 0x55, 0x56, 0x57, 0x58, 0x59, 0x5A, 0x5B, 0x5C, 0x5D, 0x5E, 0x5F,
+        0x60, 0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6A, 0x6B, 0x6C, 0x6D, 0x6E, 0x6F,
+        0x70, 0x71, 0x72, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7A, 0x7B, 0x7C, 0x7D, 0x7E, 0x7F,
+        0x80, 0x81, 0x00, 0x00, 0x00, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8A, 0x8B, 0x8C, 0x8D, 0x8E, 0x8F,
+        0x90, 0x91, 0x92, 0x93, 0x94, 0x95, 0x96, 0x97, 0x98, 0x99, 0x9A, 0x9B, 0x9C, 0x9D, 0x9E, 0x9F,
+        0xA0, 0xA1, 0xA2, 0xA3, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0xB0, 0xB1, 0xB2, 0xB3, 0xB4, 0xB5, 0xB6, 0xB7, 0xB8, 0xB9, 0xBA, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF,
+        0xC0, 0xC1, 0xC2, 0xC3, 0xC4, 0xC5, 0xC6, 0xC7, 0xC8, 0xC9, 0xCA, 0xCB, 0xCC, 0xCD, 0xCE, 0xCF,
+        0xD0, 0xD1, 0xD2, 0xD3, 0xD4, 0xD5, 0xD6, 0xD7, 0xD8, 0xD9, 0xDA, 0xDB, 0xDC, 0xDD, 0x00, 0x00,
+        0xE0, 0xE1, 0xE2, 0xE3, 0xE4, 0xE5, 0xE6, 0xE7,  // Left Control .. Right GUI
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0xE6,  // SDL_SCANCODE_MODE (AltGr on X11) as Right Alt
+    };
+
+    static_assert(kScancodeToHID[SDL_SCANCODE_A] == 0x04, "scancodes are HID usages");
+    static_assert(kScancodeToHID[SDL_SCANCODE_EXSEL] == 0xA4, "scancodes are HID usages");
+    static_assert(kScancodeToHID[SDL_SCANCODE_KP_HEXADECIMAL] == 0xDD, "scancodes are HID usages");
+    static_assert(kScancodeToHID[SDL_SCANCODE_RGUI] == 0xE7, "scancodes are HID usages");
+    static_assert(kScancodeToHID[SDL_SCANCODE_MODE] == 0xE6, "Mode is Right Alt");
+
+    uint8_t SDLToHID::sdlScancodeToHID(SDL_Scancode scancode) {
+        unsigned index = static_cast<unsigned>(scancode);
+        return index < SDL_NUM_SCANCODES ? kScancodeToHID[index] : 0;
+    }
 
-            default:
-                return 0;  // Unknown key
-        }
+    uint8_t SDLToHID::sdlToHIDKeycode(SDL_Keycode sdlKey) {
+        return sdlScancodeToHID(SDL_GetScancodeFromKey(sdlKey));
     }
 }
\ No newline at end of file
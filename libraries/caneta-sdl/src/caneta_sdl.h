@@ -13,6 +13,7 @@
 extern "C" {
 #endif
 #include <caneta.h>
+#include <caneta_capture.h>
 #ifdef __cplusplus
 }
 #endif
@@ -21,7 +22,7 @@ namespace caneta {
 
   class SDLToHID {
     public:
-      // Callback type - mimics the HID report format
+      // Callback type - mimics the HID report format. Boot reports:
       // report[0] = modifiers, report[2-7] = up to 6 pressed keys
       using HIDReportCallback = std::function<void(const uint8_t* report, uint16_t len)>;
 
@@ -31,10 +32,106 @@ namespace caneta {
       // Set the callback for HID reports
       void setReportCallback(HIDReportCallback callback);
 
+      // Record every report sent to a capture file (nullptr to stop). Capture
+      // files hold boot reports, so NKRO reports are recorded as the boot
+      // report for the same keys. The writer is not owned and must outlive
+      // recording.
+      void setCaptureWriter(caneta_capture_writer_t* writer);
+
+      // Report formats
+      enum ReportMode {
+        BOOT_REPORTS,  // 8-byte boot reports; more than six keys is ErrorRollOver
+        NKRO_REPORTS   // Modifier byte and a bit per key usage (setNkroFormat)
+      };
+
+      // Longest report: report ID, modifiers and a bit for every usage below
+      // the modifiers
+      enum { NKRO_USAGES_MAX = 0xE0, REPORT_MAX = 2 + NKRO_USAGES_MAX / 8 };
+
+      // Longest descriptor nkroDescriptor writes
+      enum { NKRO_DESCRIPTOR_MAX = 40 };
+
+      // Switch report format. Held keys carry over; the next report is in the
+      // new format.
+      void setReportMode(ReportMode mode);
+      ReportMode getReportMode() const { return reportMode; }
+
+      // NKRO report layout: a report ID byte unless reportId is 0, the modifier
+      // byte, then bit u % 8 of byte u / 8 for each usage u below keyUsages
+      // (rounded up to a multiple of 8, at most NKRO_USAGES_MAX). Keys at or
+      // past keyUsages are not reported. The default is report ID 1 and every
+      // usage below the modifiers.
+      void setNkroFormat(uint8_t reportId, uint16_t keyUsages);
+
+      // Bytes per report in the current mode
+      size_t reportSize() const;
+
+      // The report descriptor of the NKRO format, for caneta_hid_decoder_init
+      // or a USB device's configuration. out must hold NKRO_DESCRIPTOR_MAX
+      // bytes. Returns the descriptor's length.
+      size_t nkroDescriptor(uint8_t* out) const;
+
       // Process SDL keyboard events
       void processEvent(const SDL_Event& event);
 
-      // Convert SDL keycode to USB HID keycode
+      // Events drainEvents takes from SDL's queue at a time
+      enum { EVENT_BATCH = 64 };
+
+      // Apply count events, writing the report each key change produces into
+      // reports (room for count reports of reportSize() bytes). Returns
+      // the number of reports written. Non-key events and key repeats produce
+      // none. Reports are recorded by the capture writer but do not reach the
+      // report callback.
+      size_t translateEvents(const SDL_Event* events, size_t count, uint8_t* reports);
+
+      // Apply count events and hand their reports to sink, EVENT_BATCH events
+      // at a time, each batch's reports in one contiguous write. Sink is any
+      // copyable type with a member
+      //
+      //     void write(const uint8_t* reports, size_t len);
+      //
+      // as for caneta::Stream, so the write can be inlined.
+      template <typename Sink>
+      void processEvents(const SDL_Event* events, size_t count, Sink sink) {
+        uint8_t reports[EVENT_BATCH * REPORT_MAX];
+        while (count > 0) {
+          size_t n = count < size_t(EVENT_BATCH) ? count : size_t(EVENT_BATCH);
+          size_t report_count = translateEvents(events, n, reports);
+          if (report_count > 0) {
+            sink.write(reports, report_count * reportSize());
+          }
+          events += n;
+          count -= n;
+        }
+      }
+
+      // Take every queued key event off SDL's queue and hand the reports to
+      // sink as processEvents does. Other events stay queued for
+      // SDL_PollEvent; the queue is only as fresh as the last SDL_PumpEvents.
+      // Returns the number of events taken.
+      template <typename Sink>
+      size_t drainEvents(Sink sink) {
+        SDL_Event events[EVENT_BATCH];
+        uint8_t reports[EVENT_BATCH * REPORT_MAX];
+        size_t taken = 0;
+        int n;
+        while ((n = SDL_PeepEvents(events, EVENT_BATCH, SDL_GETEVENT, SDL_KEYDOWN, SDL_KEYUP)) > 0) {
+          size_t report_count = translateEvents(events, static_cast<size_t>(n), reports);
+          if (report_count > 0) {
+            sink.write(reports, report_count * reportSize());
+          }
+          taken += static_cast<size_t>(n);
+        }
+        return taken;
+      }
+
+      // Convert an SDL scancode to its USB HID usage (0 for keys a boot
+      // report cannot carry). Scancodes name physical keys, so the report is
+      // the same whatever layout the host has; this is what key events use.
+      static uint8_t sdlScancodeToHID(SDL_Scancode scancode);
+
+      // Convert an SDL keycode to the usage of the key that types it in the
+      // host's current layout
       static uint8_t sdlToHIDKeycode(SDL_Keycode sdlKey);
 
       // Get current modifier state as HID modifier byte
@@ -42,20 +139,32 @@ namespace caneta {
 
     private:
       HIDReportCallback reportCallback;
-      uint8_t currentReport[8];  // Standard HID keyboard report
-
-      void handleKeyDown(const SDL_KeyboardEvent& key);
-      void handleKeyUp(const SDL_KeyboardEvent& key);
+      caneta_capture_writer_t* captureWriter;
+      uint8_t currentReport[REPORT_MAX];  // Report in the current mode
+      ReportMode reportMode;
+      uint8_t nkroReportId;
+      uint8_t nkroUsages;
+
+      // Apply one event to the tracked keys; true if the report changed
+      bool applyEvent(const SDL_Event& event);
       void sendReport();
       void updateReport();
 
-      // Track pressed keys (up to 6 simultaneously)
-      uint8_t pressedKeys[6];
+      // Write the report to the capture writer, if any, as a boot report
+      void recordReport();
+
+      // Modifier byte of the report, kept from the modifier keys' own events
+      // rather than asking SDL for its global state on every key
+      uint8_t modifiers;
+
+      // Pressed keys: bit u % 8 of byte u / 8 for usage u, the layout of an
+      // NKRO report, so a press or release is one bit and NKRO reports are a
+      // copy. keyCount counts the bits set.
+      uint8_t keyBits[32];
       uint8_t keyCount;
 
-      // Add/remove key from pressed keys array
-      void addKey(uint8_t hidCode);
-      void removeKey(uint8_t hidCode);
+      // Boot report for the pressed keys
+      void buildBootReport(uint8_t* report) const;
   };
 
 } // namespace caneta